@@ -0,0 +1,480 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file adc_trace.c
+ *
+ * @brief This module records the ADC input stream of a control ISR and
+ * replays it through the unmodified control state machine.
+ *
+ * Recording runs continuously over two alternating blocks. At the start of
+ * each block, the control state is copied to the snapshot of the block. When
+ * the trigger (fault) occurs, the trace is frozen and the replay window
+ * starts at the older block, so that at least ADC_TRACE_LENGTH/2 samples
+ * before the fault are available. Replay restores the snapshot of the window
+ * start, overwrites the inputs with the recorded samples and compares the
+ * output signature of each sample with the recorded one.
+ *
+ * Component: DIAGNOSTICS
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <string.h>
+
+#include "adc_trace.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS/MACROS ">
+
+#define ADC_TRACE_BLOCK_LENGTH      (ADC_TRACE_LENGTH >> 1)
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+static void ADCTraceCommand(ADC_TRACE_T *);
+static void ADCTraceFreeze(ADC_TRACE_T *, uint16_t);
+static void ADCTraceSnapshotSave(ADC_TRACE_T *, uint8_t *);
+static void ADCTraceSnapshotRestore(ADC_TRACE_T *, const uint8_t *);
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="INTERFACE FUNCTIONS ">
+
+/**
+ * <B> Function: ADCTraceInit(ADC_TRACE_T *, void *, uint16_t)  </B>
+ * @brief Function to initialize the trace.
+ * @param Pointer to the trace.
+ * @param Pointer to the control state restored at the start of replay.
+ * @param Size of the control state in bytes.
+ * @return None.
+ * @example
+ * <code>
+ * ADCTraceInit(&mc1Trace, &mc1, sizeof(mc1));
+ * </code>
+ */
+void ADCTraceInit(ADC_TRACE_T *pTrace, void *pState, uint16_t stateSize)
+{
+    pTrace->pState[0] = (uint8_t *)pState;
+    pTrace->regionSize[0] = stateSize;
+    pTrace->regions = 1;
+    pTrace->stateSize = stateSize;
+    pTrace->channels = 0;
+    pTrace->command = ADC_TRACE_CMD_NONE;
+    pTrace->wrapped = 0;
+    pTrace->index = 0;
+    pTrace->start = 0;
+    pTrace->length = 0;
+    pTrace->replayCount = 0;
+    pTrace->mismatchCount = 0;
+    pTrace->firstMismatch = 0;
+    pTrace->faultIndex = ADC_TRACE_NO_FAULT;
+    
+    if (stateSize > ADC_TRACE_SNAPSHOT_SIZE)
+    {
+        pTrace->state = ADC_TRACE_ERROR;
+    }
+    else
+    {
+        pTrace->state = ADC_TRACE_IDLE;
+    }
+}
+
+/**
+ * <B> Function: ADCTraceStateAdd(ADC_TRACE_T *, void *, uint16_t)  </B>
+ * @brief Function to add a control state region placed apart from the state
+ *        given to ADCTraceInit (e.g. ISR state of a motor). Regions
+ *        share the snapshot, trace is in error when they exceed its size.
+ * @param Pointer to the trace.
+ * @param Pointer to the control state region.
+ * @param Size of the region in bytes.
+ * @return None.
+ * @example
+ * <code>
+ * ADCTraceStateAdd(&mc1Trace, &mc1Isr, sizeof(mc1Isr));
+ * </code>
+ */
+void ADCTraceStateAdd(ADC_TRACE_T *pTrace, void *pState, uint16_t stateSize)
+{
+    if ((pTrace->regions >= ADC_TRACE_STATE_REGIONS) ||
+        ((pTrace->stateSize + stateSize) > ADC_TRACE_SNAPSHOT_SIZE))
+    {
+        pTrace->state = ADC_TRACE_ERROR;
+        return;
+    }
+    pTrace->pState[pTrace->regions] = (uint8_t *)pState;
+    pTrace->regionSize[pTrace->regions] = stateSize;
+    pTrace->regions++;
+    pTrace->stateSize += stateSize;
+}
+
+/**
+ * <B> Function: ADCTraceChannelAdd(ADC_TRACE_T *, int16_t *)  </B>
+ * @brief Function to add an input channel to the trace. Channels are the
+ *        raw ADC values and the commands written outside the control ISR.
+ * @param Pointer to the trace.
+ * @param Pointer to the input.
+ * @return None.
+ * @example
+ * <code>
+ * ADCTraceChannelAdd(&mc1Trace, &mc1Isr.motorInputs.measureCurrent.Ia);
+ * </code>
+ */
+void ADCTraceChannelAdd(ADC_TRACE_T *pTrace, int16_t *pInput)
+{
+    if (pTrace->channels < ADC_TRACE_CHANNELS)
+    {
+        pTrace->pChannel[pTrace->channels] = pInput;
+        pTrace->channels++;
+    }
+}
+
+/**
+ * <B> Function: ADCTraceInputs(ADC_TRACE_T *)  </B>
+ * @brief Function records the inputs of the sample. During replay, the
+ *        control state is restored at the first sample and the inputs are
+ *        overwritten with the recorded samples.
+ * @param Pointer to the trace.
+ * @return Trace state ADC_TRACE_STATE_T.
+ * @example
+ * <code>
+ * traceState = ADCTraceInputs(&mc1Trace);
+ * </code>
+ */
+uint16_t ADCTraceInputs(ADC_TRACE_T *pTrace)
+{
+    uint16_t i, index;
+    
+    ADCTraceCommand(pTrace);
+    
+    if (pTrace->state == ADC_TRACE_RECORD)
+    {
+        index = pTrace->index;
+        if ((index & (ADC_TRACE_BLOCK_LENGTH - 1)) == 0)
+        {
+            ADCTraceSnapshotSave(pTrace,
+                            pTrace->snapshot[index / ADC_TRACE_BLOCK_LENGTH]);
+        }
+        for (i = 0; i < pTrace->channels; i++)
+        {
+            pTrace->sample[index][i] = *pTrace->pChannel[i];
+        }
+    }
+    else if (pTrace->state == ADC_TRACE_REPLAY)
+    {
+        index = (pTrace->start + pTrace->replayCount) & (ADC_TRACE_LENGTH - 1);
+        if (pTrace->replayCount == 0)
+        {
+            ADCTraceSnapshotRestore(pTrace,
+                pTrace->snapshot[pTrace->start / ADC_TRACE_BLOCK_LENGTH]);
+        }
+        for (i = 0; i < pTrace->channels; i++)
+        {
+            *pTrace->pChannel[i] = pTrace->sample[index][i];
+        }
+    }
+    return pTrace->state;
+}
+
+/**
+ * <B> Function: ADCTraceOutputs(ADC_TRACE_T *, uint16_t, uint16_t)  </B>
+ * @brief Function records the output signature of the sample and freezes
+ *        the trace on trigger. During replay, the signature is compared with
+ *        the recorded one.
+ * @param Pointer to the trace.
+ * @param Output signature of the sample.
+ * @param Trigger (fault) indication, freezes the recording when non zero.
+ * @return None.
+ * @example
+ * <code>
+ * ADCTraceOutputs(&mc1Trace, signature, (mc1.appState == MCAPP_FAULT));
+ * </code>
+ */
+void ADCTraceOutputs(ADC_TRACE_T *pTrace, uint16_t signature, uint16_t trigger)
+{
+    uint16_t index;
+    
+    if (pTrace->state == ADC_TRACE_RECORD)
+    {
+        pTrace->signature[pTrace->index] = signature;
+        pTrace->index++;
+        if (pTrace->index >= ADC_TRACE_LENGTH)
+        {
+            pTrace->index = 0;
+            pTrace->wrapped = 1;
+        }
+        if (trigger)
+        {
+            ADCTraceFreeze(pTrace, 1);
+        }
+    }
+    else if (pTrace->state == ADC_TRACE_REPLAY)
+    {
+        index = (pTrace->start + pTrace->replayCount) & (ADC_TRACE_LENGTH - 1);
+        if (pTrace->signature[index] != signature)
+        {
+            if (pTrace->mismatchCount == 0)
+            {
+                pTrace->firstMismatch = pTrace->replayCount;
+            }
+            pTrace->mismatchCount++;
+        }
+        pTrace->replayCount++;
+        if (pTrace->replayCount >= pTrace->length)
+        {
+            pTrace->state = ADC_TRACE_DONE;
+        }
+    }
+}
+
+/**
+ * <B> Function: ADCTraceStreamLength(const ADC_TRACE_T *)  </B>
+ * @brief Function returns the number of words of the trace stream, see 
+ *        adc_trace.h. The stream is valid when the trace is frozen or the
+ *        replay is done.
+ * @param Pointer to the trace.
+ * @return Number of words.
+ * @example
+ * <code>
+ * words = ADCTraceStreamLength(&mc1Trace);
+ * </code>
+ */
+uint16_t ADCTraceStreamLength(const ADC_TRACE_T *pTrace)
+{
+    return ADC_TRACE_STREAM_HEADER + pTrace->regions + 
+            ((pTrace->stateSize + 1) >> 1) + 
+            pTrace->length * (pTrace->channels + 1);
+}
+
+/**
+ * <B> Function: ADCTraceStreamWord(const ADC_TRACE_T *, uint16_t)  </B>
+ * @brief Function returns a word of the trace stream, see adc_trace.h.
+ *        Words are read out one by one (X2CScope, debugger or a serial 
+ *        port) from the main loop.
+ * @param Pointer to the trace.
+ * @param Position of the word in the stream.
+ * @return Word, 0 beyond the end of the stream.
+ * @example
+ * <code>
+ * word = ADCTraceStreamWord(&mc1Trace, position);
+ * </code>
+ */
+uint16_t ADCTraceStreamWord(const ADC_TRACE_T *pTrace, uint16_t position)
+{
+    const uint16_t snapshotWords = (pTrace->stateSize + 1) >> 1;
+    const uint8_t *pSnapshot;
+    uint16_t sample, channel, index;
+    
+    if (position < ADC_TRACE_STREAM_HEADER)
+    {
+        const uint16_t header[ADC_TRACE_STREAM_HEADER] =
+        {
+            ADC_TRACE_STREAM_MAGIC, ADC_TRACE_STREAM_VERSION, 
+            pTrace->channels, pTrace->length, pTrace->faultIndex, 
+            pTrace->stateSize, pTrace->regions
+        };
+        return header[position];
+    }
+    position -= ADC_TRACE_STREAM_HEADER;
+    if (position < pTrace->regions)
+    {
+        return pTrace->regionSize[position];
+    }
+    position -= pTrace->regions;
+    if (position < snapshotWords)
+    {
+        pSnapshot = &pTrace->snapshot[pTrace->start / ADC_TRACE_BLOCK_LENGTH]
+                                                            [position << 1];
+        return (uint16_t)pSnapshot[0] | ((uint16_t)pSnapshot[1] << 8);
+    }
+    position -= snapshotWords;
+    sample = position / (pTrace->channels + 1);
+    channel = position - sample * (pTrace->channels + 1);
+    if (sample >= pTrace->length)
+    {
+        return 0;
+    }
+    index = (pTrace->start + sample) & (ADC_TRACE_LENGTH - 1);
+    if (channel < pTrace->channels)
+    {
+        return (uint16_t)pTrace->sample[index][channel];
+    }
+    return pTrace->signature[index];
+}
+
+// </editor-fold>
+
+/**
+ * <B> Function: ADCTraceCommand(ADC_TRACE_T *)  </B>
+ * @brief Function executes the trace command.
+ * @param Pointer to the trace.
+ * @return None.
+ * @example
+ * <code>
+ * ADCTraceCommand(&mc1Trace);
+ * </code>
+ */
+static void ADCTraceCommand(ADC_TRACE_T *pTrace)
+{
+    uint16_t command = pTrace->command;
+    
+    if ((command == ADC_TRACE_CMD_NONE) || (pTrace->state == ADC_TRACE_ERROR))
+    {
+        return;
+    }
+    pTrace->command = ADC_TRACE_CMD_NONE;
+    
+    switch (command)
+    {
+        case ADC_TRACE_CMD_RECORD:
+            if (pTrace->state != ADC_TRACE_REPLAY)
+            {
+                pTrace->index = 0;
+                pTrace->wrapped = 0;
+                pTrace->state = ADC_TRACE_RECORD;
+            }
+        break;
+        case ADC_TRACE_CMD_STOP:
+            if (pTrace->state == ADC_TRACE_RECORD)
+            {
+                ADCTraceFreeze(pTrace, 0);
+            }
+        break;
+        case ADC_TRACE_CMD_REPLAY:
+            if (((pTrace->state == ADC_TRACE_FROZEN) || 
+                    (pTrace->state == ADC_TRACE_DONE)) && (pTrace->length > 0))
+            {
+                pTrace->replayCount = 0;
+                pTrace->mismatchCount = 0;
+                pTrace->firstMismatch = 0;
+                pTrace->state = ADC_TRACE_REPLAY;
+            }
+        break;
+        default:
+        break;
+    }
+}
+
+/**
+ * <B> Function: ADCTraceFreeze(ADC_TRACE_T *, uint16_t)  </B>
+ * @brief Function stops the recording and sets the replay window : from the
+ *        start of the older block up to the last recorded sample.
+ * @param Pointer to the trace.
+ * @param Trigger indication : the last recorded sample is the fault index.
+ * @return None.
+ * @example
+ * <code>
+ * ADCTraceFreeze(&mc1Trace, 1);
+ * </code>
+ */
+static void ADCTraceFreeze(ADC_TRACE_T *pTrace, uint16_t trigger)
+{
+    uint16_t blockStart, blockSamples;
+    
+    /* Block of the next sample; a full block ending at the last recorded 
+       sample is replayed completely */
+    blockSamples = pTrace->index & (ADC_TRACE_BLOCK_LENGTH - 1);
+    blockStart = pTrace->index - blockSamples;
+    if (blockSamples == 0)
+    {
+        blockSamples = ADC_TRACE_BLOCK_LENGTH;
+        blockStart = (pTrace->index - ADC_TRACE_BLOCK_LENGTH) & 
+                                                (ADC_TRACE_LENGTH - 1);
+    }
+    
+    if ((pTrace->wrapped == 0) && (blockStart == 0))
+    {
+        pTrace->start = 0;
+        pTrace->length = blockSamples;
+    }
+    else
+    {
+        pTrace->start = (blockStart - ADC_TRACE_BLOCK_LENGTH) & 
+                                                (ADC_TRACE_LENGTH - 1);
+        pTrace->length = ADC_TRACE_BLOCK_LENGTH + blockSamples;
+    }
+    pTrace->faultIndex = trigger ? (pTrace->length - 1) : ADC_TRACE_NO_FAULT;
+    pTrace->state = ADC_TRACE_FROZEN;
+}
+
+/**
+ * <B> Function: ADCTraceSnapshotSave(ADC_TRACE_T *, uint8_t *)  </B>
+ * @brief Function copies the control state regions to a snapshot.
+ * @param Pointer to the trace.
+ * @param Pointer to the snapshot.
+ * @return None.
+ * @example
+ * <code>
+ * ADCTraceSnapshotSave(&mc1Trace, mc1Trace.snapshot[0]);
+ * </code>
+ */
+static void ADCTraceSnapshotSave(ADC_TRACE_T *pTrace, uint8_t *pSnapshot)
+{
+    uint16_t i;
+    
+    for (i = 0; i < pTrace->regions; i++)
+    {
+        memcpy(pSnapshot, pTrace->pState[i], pTrace->regionSize[i]);
+        pSnapshot += pTrace->regionSize[i];
+    }
+}
+
+/**
+ * <B> Function: ADCTraceSnapshotRestore(ADC_TRACE_T *, const uint8_t *)  </B>
+ * @brief Function copies a snapshot back to the control state regions.
+ * @param Pointer to the trace.
+ * @param Pointer to the snapshot.
+ * @return None.
+ * @example
+ * <code>
+ * ADCTraceSnapshotRestore(&mc1Trace, mc1Trace.snapshot[0]);
+ * </code>
+ */
+static void ADCTraceSnapshotRestore(ADC_TRACE_T *pTrace, const uint8_t *pSnapshot)
+{
+    uint16_t i;
+    
+    for (i = 0; i < pTrace->regions; i++)
+    {
+        memcpy(pTrace->pState[i], pSnapshot, pTrace->regionSize[i]);
+        pSnapshot += pTrace->regionSize[i];
+    }
+}
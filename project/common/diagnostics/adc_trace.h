@@ -0,0 +1,214 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file adc_trace.h
+ *
+ * @brief This module records the ADC input stream of a control ISR and
+ * replays it through the unmodified control state machine. Shared by the
+ * PFC (main core) and motor control (secondary core) projects.
+ *
+ * Component: DIAGNOSTICS
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+#ifndef __ADC_TRACE_H
+#define __ADC_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS/MACROS ">
+
+/* Define ENABLE_ADC_TRACE to record and replay the ADC inputs of the control
+ * ISR. Trace is controlled and read out through X2CScope or the debugger */
+#undef ENABLE_ADC_TRACE
+
+/* Trace length in ISR samples (power of 2), recorded as two alternating
+ * blocks of ADC_TRACE_LENGTH/2 samples each */
+#define ADC_TRACE_LENGTH            128
+/* Maximum number of input channels per sample */
+#define ADC_TRACE_CHANNELS          8
+/* Size in bytes of the control state snapshot taken at the start of a block */
+#define ADC_TRACE_SNAPSHOT_SIZE     1280
+/* Maximum number of separately placed control state regions */
+#define ADC_TRACE_STATE_REGIONS     3
+/* Fault index of a trace frozen by command */
+#define ADC_TRACE_NO_FAULT          0xFFFF
+
+/* Compile time check that the control state regions of a trace fit the 
+ * snapshot : ADC_TRACE_SNAPSHOT_CHECK(mc1, sizeof(mc1) + sizeof(mc1Isr)) 
+ * fails to compile (negative array size) if they do not */
+#define ADC_TRACE_SNAPSHOT_CHECK(name, size) \
+    typedef char name##TraceSnapshotCheck[((size) <= ADC_TRACE_SNAPSHOT_SIZE) ? 1 : -1]
+
+/* Trace stream : a frozen trace is read out as a sequence of 16 bit words 
+ * (ADCTraceStreamWord), stored little endian in a trace file.
+ *  word 0      ADC_TRACE_STREAM_MAGIC
+ *  word 1      ADC_TRACE_STREAM_VERSION
+ *  word 2      Number of channels C
+ *  word 3      Number of samples N of the replay window
+ *  word 4      Fault index : sample of the window that froze the trace
+ *              (fault trigger), ADC_TRACE_NO_FAULT if frozen by command
+ *  word 5      Snapshot size S in bytes
+ *  word 6      Number of control state regions R
+ *  R words     Size of each region in bytes, in ADCTraceStateAdd order
+ *  (S+1)/2     Snapshot of the window start, two bytes per word (first byte
+ *              in the low byte)
+ *  N*(C+1)     Per sample : C channel values in ADCTraceChannelAdd order, 
+ *              then the output signature
+ * The snapshot is the raw memory of the control state (including pointers)
+ * : a trace replays in the build that recorded it, region sizes identify 
+ * the layout. */
+#define ADC_TRACE_STREAM_MAGIC      0x5441
+#define ADC_TRACE_STREAM_VERSION    1
+#define ADC_TRACE_STREAM_HEADER     7
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="ENUMERATED CONSTANTS ">
+
+typedef enum
+{
+    ADC_TRACE_IDLE = 0,         /* No recording or replay */
+    ADC_TRACE_RECORD = 1,       /* Recording inputs and output signatures */
+    ADC_TRACE_FROZEN = 2,       /* Recording stopped by trigger or command */
+    ADC_TRACE_REPLAY = 3,       /* Replaying the recorded inputs */
+    ADC_TRACE_DONE = 4,         /* Replay complete, check mismatchCount */
+    ADC_TRACE_ERROR = 5,        /* Control state exceeds snapshot size */
+
+}ADC_TRACE_STATE_T;
+
+typedef enum
+{
+    ADC_TRACE_CMD_NONE = 0,     /* No command */
+    ADC_TRACE_CMD_RECORD = 1,   /* Start recording */
+    ADC_TRACE_CMD_STOP = 2,     /* Stop recording, trace is frozen */
+    ADC_TRACE_CMD_REPLAY = 3,   /* Replay the frozen trace */
+
+}ADC_TRACE_COMMAND_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
+
+typedef struct
+{
+    int16_t sample[ADC_TRACE_LENGTH][ADC_TRACE_CHANNELS];
+    uint16_t signature[ADC_TRACE_LENGTH];
+    uint8_t snapshot[2][ADC_TRACE_SNAPSHOT_SIZE];
+    
+    int16_t *pChannel[ADC_TRACE_CHANNELS];
+    uint8_t *pState[ADC_TRACE_STATE_REGIONS];
+    uint16_t regionSize[ADC_TRACE_STATE_REGIONS];
+    uint16_t regions;
+    uint16_t stateSize;
+    uint16_t channels;
+    
+    volatile uint16_t command;
+    uint16_t state;
+    uint16_t wrapped;
+    uint16_t index;
+    uint16_t start;
+    uint16_t length;
+    uint16_t replayCount;
+    uint16_t mismatchCount;
+    uint16_t firstMismatch;
+    uint16_t faultIndex;
+}ADC_TRACE_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="INTERFACE FUNCTIONS ">
+
+/**
+ * Initializes the trace with the control state restored on replay
+ */
+void ADCTraceInit(ADC_TRACE_T *, void *, uint16_t);
+
+/**
+ * Adds a control state region, restored on replay with the initial state
+ */
+void ADCTraceStateAdd(ADC_TRACE_T *, void *, uint16_t);
+
+/**
+ * Adds an input channel, recorded and overwritten on replay
+ */
+void ADCTraceChannelAdd(ADC_TRACE_T *, int16_t *);
+
+/**
+ * Records or replays the inputs, called after reading the ADC buffers
+ */
+uint16_t ADCTraceInputs(ADC_TRACE_T *);
+
+/**
+ * Records or compares the output signature, called after the state machine
+ */
+void ADCTraceOutputs(ADC_TRACE_T *, uint16_t, uint16_t);
+
+/**
+ * Returns the number of words of the stream of a frozen trace
+ */
+uint16_t ADCTraceStreamLength(const ADC_TRACE_T *);
+
+/**
+ * Returns a word of the stream of a frozen trace
+ */
+uint16_t ADCTraceStreamWord(const ADC_TRACE_T *, uint16_t);
+
+/**
+ * Accumulates a word into the output signature of the sample
+ */
+inline static uint16_t ADCTraceSignatureAdd(uint16_t signature, uint16_t word)
+{
+    return (uint16_t)((signature << 1) | (signature >> 15)) ^ word;
+}
+
+// </editor-fold>
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ADC_TRACE_H */
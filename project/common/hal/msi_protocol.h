@@ -0,0 +1,144 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file msi_protocol.h
+ *
+ * @brief This header file lists the data types and definitions of the data 
+ * exchange between the Main and Secondary cores through the MSI mailboxes. 
+ * It is shared by the Main and Secondary core projects.
+ * 
+ * Component: MSI
+ * 
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+#ifndef __MSI_PROTOCOL_H
+#define __MSI_PROTOCOL_H
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+// </editor-fold> 
+
+#ifdef __cplusplus  // Provide C++ Compatability
+    extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS or MACROS ">
+
+/* Definition to run the outer motor control loops on the Main core : speed 
+   potentiometer filtering, target velocity generation and run permission,
+   velocity reference ramps, speed controllers and flux weakening 
+   controllers. Secondary core runs the current loops and estimators, sends
+   the feedback and applies the current references of the Main core 
+   through the MSI mailboxes */
+#undef ENABLE_CROSS_CORE_SUPERVISOR
+
+/* Mailbox map :
+   - Protocol block A (Main to Secondary) : MBX0 - MBX6, MBX6 written last
+   - Protocol block B (Secondary to Main) : MBX7 - MBX15, MBX15 written last
+   Writing the last register of a block sets its data ready flag, reading it
+   clears the flag. A block is written only after the previous one is read */
+
+/* Flags of both motors in one word : MC1 in the low byte, MC2 in the high
+   byte (shifted by MSI_FLAGS_SHIFT_MC2) */
+#define MSI_FLAGS_SHIFT_MC2     8
+#define MSI_FLAGS_MASK          0x00FF
+/* Command flags of a motor */
+#define MSI_RUN_PERMIT          0x0001  /* Motor is permitted to run */
+#define MSI_SPEED_LOOP          0x0002  /* Velocity and q axis current 
+                                           references of the speed loop of 
+                                           the epoch are valid */
+#define MSI_FLUX_WEAKENING      0x0004  /* d axis current reference of the
+                                           flux weakening control is valid */
+/* Status flags of a motor */
+#define MSI_RUN_CMD             0x0001  /* Run command (button) */
+#define MSI_SPEED_LOOP_ACTIVE   0x0002  /* Speed loop of the epoch runs on 
+                                           the Main core */
+#define MSI_CLOSE_LOOP          0x0004  /* Sensorless closed loop */
+#define MSI_IDLE                0x0008  /* Idle, waiting for a run command */
+/* Speed loop epoch, in the status and command flags of a motor : the
+   Secondary core increments it when the speed loop (re)starts, the Main core
+   restarts its speed loop from the fed back references and returns the 
+   epoch with its references */
+#define MSI_EPOCH_SHIFT         4
+#define MSI_EPOCH_MASK          0x00F0
+
+// </editor-fold>    
+        
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">  
+
+/* Main to Secondary core data */
+typedef struct
+{
+    int16_t
+        velocityRefMC1,         /* MC1 velocity reference */
+        iqRefMC1,               /* MC1 q axis current reference (speed loop) */
+        idRefMC1,               /* MC1 d axis current reference (flux 
+                                   weakening, added to the MTPA reference) */
+        velocityRefMC2,         /* MC2 velocity reference */
+        iqRefMC2,               /* MC2 q axis current reference */
+        idRefMC2;               /* MC2 d axis current reference */
+    uint16_t
+        flags;                  /* Command flags and epochs of both motors */
+}MSI_COMMAND_T;
+
+/* Secondary to Main core data */
+typedef struct
+{
+    int16_t
+        potentiometer,          /* Raw speed potentiometer input */
+        velocityMC1,            /* MC1 estimated velocity */
+        velocityMC2,            /* MC2 estimated velocity */
+        iqRefMC1,               /* MC1 q axis current reference less the 
+                                   load torque feedforward */
+        iqRefMC2,               /* MC2 q axis current reference less the 
+                                   load torque feedforward */
+        voltageErrorMC1,        /* MC1 flux weakening voltage error */
+        voltageErrorMC2,        /* MC2 flux weakening voltage error */
+        voltageDemand;          /* DC link voltage required by the motors */
+    uint16_t
+        status;                 /* Status flags and epochs of both motors */
+}MSI_FEEDBACK_T;
+
+// </editor-fold> 
+
+#ifdef __cplusplus  // Provide C++ Compatibility
+    }
+#endif
+#endif      // end of __MSI_PROTOCOL_H
@@ -0,0 +1,204 @@
+/**
+ * @file motor_control_host.c
+ *
+ * @brief Motor Control library functions used by the firmware, for the host
+ *        build (libmotor_control_dspic-elf.a is dsPIC object code).
+ *
+ * Functions follow the inline C versions of motor_control_inline_dspic.h,
+ * with the DSP builtins of the host emulation (host_dsp.c), so results
+ * match the library to the rounding of the last bit. Space vector
+ * modulation takes the non swapped phase voltages : sector times are the
+ * line to line differences (scaled by 1/sqrt(3)), as in the library.
+ */
+#include <stdint.h>
+
+#include <xc.h>
+
+#include "motor_control.h"
+
+#define MC_CORECONTROL  0x00E2  /* SATA, SATB, SATDW, biased rounding */
+#define MC_ONEBYSQ3     18919   /* 1/sqrt(3) in Q15 */
+#define MC_SQ3OV2       28378   /* sqrt(3)/2 in Q15 */
+#define MC_NEGPOINT5    (-16384)
+
+/* sin(2*pi*k/128) in Q15 */
+uint16_t MC_SineTableInRam[128] =
+{
+         0,   1608,   3212,   4808,   6393,   7962,   9512,  11039,
+     12540,  14010,  15447,  16846,  18205,  19520,  20788,  22006,
+     23170,  24279,  25330,  26320,  27246,  28106,  28899,  29622,
+     30274,  30853,  31357,  31786,  32138,  32413,  32610,  32729,
+     32767,  32729,  32610,  32413,  32138,  31786,  31357,  30853,
+     30274,  29622,  28899,  28106,  27246,  26320,  25330,  24279,
+     23170,  22006,  20788,  19520,  18205,  16846,  15447,  14010,
+     12540,  11039,   9512,   7962,   6393,   4808,   3212,   1608,
+         0,  -1608,  -3212,  -4808,  -6393,  -7962,  -9512, -11039,
+    -12540, -14010, -15447, -16846, -18205, -19520, -20788, -22006,
+    -23170, -24279, -25330, -26320, -27246, -28106, -28899, -29622,
+    -30274, -30853, -31357, -31786, -32138, -32413, -32610, -32729,
+    -32767, -32729, -32610, -32413, -32138, -31786, -31357, -30853,
+    -30274, -29622, -28899, -28106, -27246, -26320, -25330, -24279,
+    -23170, -22006, -20788, -19520, -18205, -16846, -15447, -14010,
+    -12540, -11039,  -9512,  -7962,  -6393,  -4808,  -3212,  -1608
+};
+
+static int16_t Interpolate(uint16_t index, uint16_t remainder)
+{
+    const uint16_t y0 = MC_SineTableInRam[index & 127];
+    const uint16_t y1 = MC_SineTableInRam[(index + 1) & 127];
+    const uint16_t delta = y1 - y0;
+
+    return (int16_t)(y0 + (uint16_t)(__builtin_mulus(remainder,
+                                                (int16_t)delta) >> 16));
+}
+
+uint16_t MC_CalculateSineCosine_Assembly_Ram(int16_t angle,
+                                             MC_SINCOS_T *pSinCos)
+{
+    const uint32_t result = __builtin_muluu(128, (uint16_t)angle);
+    const uint16_t index = (uint16_t)(result >> 16);
+    const uint16_t remainder = (uint16_t)result;
+
+    if (remainder == 0)
+    {
+        pSinCos->sin = (int16_t)MC_SineTableInRam[index];
+        pSinCos->cos = (int16_t)MC_SineTableInRam[(index + 32) & 127];
+        return 1;
+    }
+    pSinCos->sin = Interpolate(index, remainder);
+    pSinCos->cos = Interpolate(index + 32, remainder);
+    return 2;
+}
+
+uint16_t MC_TransformPark_Assembly(const MC_ALPHABETA_T *pAlphaBeta,
+                                   const MC_SINCOS_T *pSinCos, MC_DQ_T *pDQ)
+{
+    const uint16_t corconSave = CORCON;
+    int32_t acc;
+
+    CORCON = MC_CORECONTROL;
+    acc = __builtin_mpy(pAlphaBeta->alpha, pSinCos->cos, 0, 0, 0, 0, 0, 0);
+    acc = __builtin_mac(acc, pAlphaBeta->beta, pSinCos->sin,
+                                                0, 0, 0, 0, 0, 0, 0, 0);
+    pDQ->d = __builtin_sacr(acc, 0);
+
+    acc = __builtin_mpy(pAlphaBeta->beta, pSinCos->cos, 0, 0, 0, 0, 0, 0);
+    acc = __builtin_msc(acc, pAlphaBeta->alpha, pSinCos->sin,
+                                                0, 0, 0, 0, 0, 0, 0, 0);
+    pDQ->q = __builtin_sacr(acc, 0);
+    CORCON = corconSave;
+    return 1;
+}
+
+uint16_t MC_TransformParkInverse_Assembly(const MC_DQ_T *pDQ,
+                    const MC_SINCOS_T *pSinCos, MC_ALPHABETA_T *pAlphaBeta)
+{
+    const uint16_t corconSave = CORCON;
+    int32_t acc;
+
+    CORCON = MC_CORECONTROL;
+    acc = __builtin_mpy(pDQ->d, pSinCos->cos, 0, 0, 0, 0, 0, 0);
+    acc = __builtin_msc(acc, pDQ->q, pSinCos->sin, 0, 0, 0, 0, 0, 0, 0, 0);
+    pAlphaBeta->alpha = __builtin_sacr(acc, 0);
+
+    acc = __builtin_mpy(pDQ->d, pSinCos->sin, 0, 0, 0, 0, 0, 0);
+    acc = __builtin_mac(acc, pDQ->q, pSinCos->cos, 0, 0, 0, 0, 0, 0, 0, 0);
+    pAlphaBeta->beta = __builtin_sacr(acc, 0);
+    CORCON = corconSave;
+    return 1;
+}
+
+uint16_t MC_TransformClarke_Assembly(const MC_ABC_T *pABC,
+                                     MC_ALPHABETA_T *pAlphaBeta)
+{
+    const uint16_t corconSave = CORCON;
+    int32_t acc;
+
+    CORCON = MC_CORECONTROL;
+    pAlphaBeta->alpha = pABC->a;
+    acc = __builtin_mpy(pABC->a, MC_ONEBYSQ3, 0, 0, 0, 0, 0, 0);
+    acc = __builtin_mac(acc, MC_ONEBYSQ3, pABC->b, 0, 0, 0, 0, 0, 0, 0, 0);
+    acc = __builtin_mac(acc, MC_ONEBYSQ3, pABC->b, 0, 0, 0, 0, 0, 0, 0, 0);
+    pAlphaBeta->beta = __builtin_sacr(acc, 0);
+    CORCON = corconSave;
+    return 1;
+}
+
+uint16_t MC_TransformClarkeInverse_Assembly(const MC_ALPHABETA_T *pAlphaBeta,
+                                            MC_ABC_T *pABC)
+{
+    const uint16_t corconSave = CORCON;
+    int32_t acc;
+
+    CORCON = MC_CORECONTROL;
+    pABC->a = pAlphaBeta->alpha;
+    acc = __builtin_mpy(pAlphaBeta->alpha, MC_NEGPOINT5, 0, 0, 0, 0, 0, 0);
+    acc = __builtin_mac(acc, pAlphaBeta->beta, MC_SQ3OV2,
+                                                0, 0, 0, 0, 0, 0, 0, 0);
+    pABC->b = __builtin_sacr(acc, 0);
+
+    acc = __builtin_mpy(pAlphaBeta->alpha, MC_NEGPOINT5, 0, 0, 0, 0, 0, 0);
+    acc = __builtin_msc(acc, pAlphaBeta->beta, MC_SQ3OV2,
+                                                0, 0, 0, 0, 0, 0, 0, 0);
+    pABC->c = __builtin_sacr(acc, 0);
+    CORCON = corconSave;
+    return 1;
+}
+
+/* Line to line modulation index : (x - y)/sqrt(3) */
+static int16_t LineToLine(int16_t x, int16_t y)
+{
+    int32_t acc;
+
+    acc = __builtin_mpy(x, MC_ONEBYSQ3, 0, 0, 0, 0, 0, 0);
+    acc = __builtin_msc(acc, y, MC_ONEBYSQ3, 0, 0, 0, 0, 0, 0, 0, 0);
+    return __builtin_sacr(acc, 0);
+}
+
+/* Sector time : period * T (Q15) */
+static int16_t SectorTime(uint16_t period, int16_t time)
+{
+    return __builtin_sacr(HostAccSat((int64_t)__builtin_mulus(period, time)
+                                                                * 2), 0);
+}
+
+uint16_t MC_CalculateSpaceVector_Assembly(const MC_ABC_T *pABC,
+                        uint16_t iPwmPeriod, MC_DUTYCYCLEOUT_T *pDutyCycleOut)
+{
+    const uint16_t corconSave = CORCON;
+    const int16_t v[3] = {pABC->a, pABC->b, pABC->c};
+    uint16_t duty[3];
+    int16_t max = 0, min = 0, mid, t1, t2, tc, i;
+
+    CORCON = MC_CORECONTROL;
+    for (i = 1; i < 3; i++)
+    {
+        if (v[i] > v[max])
+        {
+            max = i;
+        }
+        if (v[i] < v[min])
+        {
+            min = i;
+        }
+    }
+    if (max == min)
+    {
+        min = (max + 1) % 3;
+    }
+    mid = 3 - max - min;
+
+    /* Active vector times of the sector and zero vector time, centred */
+    t1 = SectorTime(iPwmPeriod, LineToLine(v[mid], v[min]));
+    t2 = SectorTime(iPwmPeriod, LineToLine(v[max], v[mid]));
+    tc = (int16_t)(iPwmPeriod - t1 - t2) >> 1;
+    duty[min] = tc;
+    duty[mid] = tc + t1;
+    duty[max] = tc + t1 + t2;
+
+    pDutyCycleOut->dutycycle1 = duty[0];
+    pDutyCycleOut->dutycycle2 = duty[1];
+    pDutyCycleOut->dutycycle3 = duty[2];
+    CORCON = corconSave;
+    return 1;
+}
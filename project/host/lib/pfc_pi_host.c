@@ -0,0 +1,47 @@
+/**
+ * @file pfc_pi_host.c
+ *
+ * @brief PFC PI controller (main/pfc/pfc_pi.s) for the host build : the
+ *        assembly routine, instruction by instruction, with the DSP builtins
+ *        of the host emulation (CORCON = 0x00E0, convergent rounding).
+ */
+#include <stdint.h>
+
+#include <xc.h>
+
+#include "pfc_pi.h"
+
+void PFC_PIController(PFC_PI_T *pPI, int16_t error)
+{
+    const uint16_t corconSave = CORCON;
+    int32_t accA, accB;
+    int16_t output;
+
+    CORCON = 0x00E0;
+    pPI->error = error;
+
+    /* A = integralOut + (ki * error) << kiScale */
+    accB = __builtin_lac(pPI->integralOut, 0);
+    accA = __builtin_mpy(pPI->ki, error, 0, 0, 0, 0, 0, 0);
+    accA = __builtin_sftac(accA, -pPI->kiScale);
+    accA = __builtin_addab(accA, accB);
+    pPI->integralOut = __builtin_sacr(accA, 0);
+
+    /* B = (kp * error) << kpScale */
+    accB = __builtin_mpy(pPI->kp, error, 0, 0, 0, 0, 0, 0);
+    accB = __builtin_sftac(accB, -pPI->kpScale);
+    pPI->propOut = __builtin_sacr(accB, 0);
+
+    accB = __builtin_addab(accB, accA);
+    output = __builtin_sacr(accB, 0);
+    if (output <= pPI->minOutput)
+    {
+        output = pPI->minOutput;
+    }
+    if (output >= pPI->maxOutput)
+    {
+        output = pPI->maxOutput;
+    }
+    pPI->output = output;
+    CORCON = corconSave;
+}
@@ -0,0 +1,40 @@
+/**
+ * @file x2cscope_host.c
+ *
+ * @brief X2CScope library functions for the host build (libx2cscope is
+ *        dsPIC object code). There is no scope connection on the host :
+ *        initialisation and sampling do nothing. X2CScope_Communicate() is
+ *        called from the main loop of the firmware only, it returns to the
+ *        host port, which runs the interrupts (see host_port.h).
+ */
+#include <stdint.h>
+#include <stddef.h>
+
+#include "X2CScope.h"
+#include "host_port.h"
+
+void X2CScope_Initialise(uint8_t *buffer, size_t buffer_size)
+{
+    (void)buffer;
+    (void)buffer_size;
+}
+
+void X2CScope_HookUARTFunctions(void (*sendSerialFcnPntr)(uint8_t),
+        uint8_t (*receiveSerialFcnPntr)(),
+        uint8_t (*isReceiveDataAvailableFcnPntr)(),
+        uint8_t (*isSendReadyFcnPntr)())
+{
+    (void)sendSerialFcnPntr;
+    (void)receiveSerialFcnPntr;
+    (void)isReceiveDataAvailableFcnPntr;
+    (void)isSendReadyFcnPntr;
+}
+
+void X2CScope_Update(void)
+{
+}
+
+void X2CScope_Communicate(void)
+{
+    HostPortMainLoop();
+}
@@ -0,0 +1,208 @@
+/**
+ * @file host_adc.c
+ *
+ * @brief ADC of a core on the host, see host_adc.h.
+ */
+#include <stdint.h>
+#include <stddef.h>
+
+#include "host_adc.h"
+
+#define HOST_ADC_FILTER_AVERAGE 3   /* ADFLxCON.MODE averaging */
+
+void HostAdcInit(HOST_ADC_T *pAdc, HOST_ANALOG_T analog, void *context)
+{
+    int i;
+
+    pAdc->analog = analog;
+    pAdc->context = context;
+    for (i = 0; i < pAdc->channels; i++)
+    {
+        HOST_ADC_CHANNEL_T *pChannel = &pAdc->channel[i];
+
+        pChannel->sample = HOST_NEVER;
+        pChannel->done = HOST_NEVER;
+        pChannel->request = HOST_NEVER;
+    }
+}
+
+void HostAdcTrigger(HOST_ADC_T *pAdc, uint16_t source, double t)
+{
+    int i;
+
+    if (source == 0)
+    {
+        return;
+    }
+    /* Channels are in order of channel number : lowest converts first */
+    for (i = 0; i < pAdc->channels; i++)
+    {
+        HOST_ADC_CHANNEL_T *pChannel = &pAdc->channel[i];
+        double start;
+
+        if ((*pChannel->trgsrc != source) || (pChannel->done != HOST_NEVER))
+        {
+            /* A trigger during the conversion of the channel is lost */
+            continue;
+        }
+        pChannel->input = pChannel->channel;
+        if ((pChannel->alternate != NULL) && (*pChannel->alternate == 1))
+        {
+            pChannel->input = HOST_ANA(pChannel->channel);
+        }
+        start = t;
+        if (start < pAdc->coreBusy[pChannel->core])
+        {
+            start = pAdc->coreBusy[pChannel->core];
+        }
+        pChannel->sample = start;
+        if (pChannel->core == HOST_ADC_CORE_SHARED)
+        {
+            pChannel->sample += (*pAdc->shrsamc + 2) * pAdc->tad;
+        }
+        pChannel->done = pChannel->sample +
+                                    HOST_ADC_CONVERSION_TAD * pAdc->tad;
+        pAdc->coreBusy[pChannel->core] = pChannel->done;
+
+        pChannel->request = HOST_NEVER;
+        if ((pChannel->vector != NULL) && (pChannel->ie != NULL) &&
+            (*pChannel->ie != 0))
+        {
+            pChannel->request = pChannel->done;
+            if ((pAdc->eien != NULL) && (*pAdc->eien != 0) &&
+                (pChannel->eien != NULL) && (*pChannel->eien != 0))
+            {
+                pChannel->request -= (*pAdc->shreisel + 1) * pAdc->tad;
+            }
+        }
+        if (pChannel->ready != NULL)
+        {
+            *pChannel->ready = 0;
+        }
+    }
+}
+
+double HostAdcNext(const HOST_ADC_T *pAdc)
+{
+    double next = HOST_NEVER;
+    int i;
+
+    for (i = 0; i < pAdc->channels; i++)
+    {
+        const HOST_ADC_CHANNEL_T *pChannel = &pAdc->channel[i];
+
+        if (pChannel->sample < next)
+        {
+            next = pChannel->sample;
+        }
+        if (pChannel->done < next)
+        {
+            next = pChannel->done;
+        }
+        if (pChannel->request < next)
+        {
+            next = pChannel->request;
+        }
+    }
+    return next;
+}
+
+/* Result in the format of the result buffers */
+static uint16_t Format(const HOST_ADC_T *pAdc,
+                                    const HOST_ADC_CHANNEL_T *pChannel)
+{
+    uint16_t code = pChannel->code & 0x0FFF;
+
+    if (*pChannel->sign)
+    {
+        code ^= 0x0800;
+        if (*pAdc->form == 0)
+        {
+            /* Sign extended integer */
+            return (code & 0x0800) ? (code | 0xF000) : code;
+        }
+    }
+    return (*pAdc->form) ? (uint16_t)(code << 4) : code;
+}
+
+static void FilterUpdate(HOST_ADC_T *pAdc, const HOST_ADC_CHANNEL_T *pChannel)
+{
+    int i;
+
+    for (i = 0; i < pAdc->filters; i++)
+    {
+        HOST_ADC_FILTER_T *pFilter = &pAdc->filter[i];
+        uint16_t length;
+
+        if ((*pFilter->flen == 0) || (*pFilter->flchsel != pChannel->channel)
+            || (*pFilter->mode != HOST_ADC_FILTER_AVERAGE))
+        {
+            continue;
+        }
+        length = 2 << *pFilter->ovrsam;
+        pFilter->sum += *pChannel->sign ? (int16_t)*pChannel->result :
+                                          (int32_t)*pChannel->result;
+        pFilter->count++;
+        if (pFilter->count >= length)
+        {
+            *pFilter->data = (uint16_t)(pFilter->sum / length);
+            *pFilter->rdy = 1;
+            pFilter->sum = 0;
+            pFilter->count = 0;
+        }
+    }
+}
+
+void HostAdcFilterUpdate(HOST_ADC_T *pAdc)
+{
+    int i;
+
+    for (i = 0; i < pAdc->filters; i++)
+    {
+        HOST_ADC_FILTER_T *pFilter = &pAdc->filter[i];
+
+        if (*pFilter->flen == 0)
+        {
+            pFilter->sum = 0;
+            pFilter->count = 0;
+            *pFilter->rdy = 0;
+        }
+    }
+}
+
+void HostAdcRun(HOST_ADC_T *pAdc, double t)
+{
+    double next;
+
+    while ((next = HostAdcNext(pAdc)) <= t)
+    {
+        int i;
+
+        for (i = 0; i < pAdc->channels; i++)
+        {
+            HOST_ADC_CHANNEL_T *pChannel = &pAdc->channel[i];
+
+            if (pChannel->sample == next)
+            {
+                pChannel->code = pAdc->analog(pAdc->context, pChannel->input,
+                                              pChannel->sample);
+                pChannel->sample = HOST_NEVER;
+            }
+            if (pChannel->request == next)
+            {
+                HostPortRequest(pChannel->vector, pChannel->request);
+                pChannel->request = HOST_NEVER;
+            }
+            if (pChannel->done == next)
+            {
+                *pChannel->result = Format(pAdc, pChannel);
+                if (pChannel->ready != NULL)
+                {
+                    *pChannel->ready = 1;
+                }
+                FilterUpdate(pAdc, pChannel);
+                pChannel->done = HOST_NEVER;
+            }
+        }
+    }
+}
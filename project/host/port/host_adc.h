@@ -0,0 +1,104 @@
+/**
+ * @file host_adc.h
+ *
+ * @brief ADC of a core on the host : conversions of the channels used by the
+ *        firmware, as configured by the ADC registers the port passes in.
+ *
+ * A trigger source starts the conversion of every channel whose TRGSRC
+ * selects it, unless the channel is still converting. Dedicated cores
+ * sample continuously (SAMCxEN = 0) : the trigger is the sampling instant.
+ * The shared core converts the triggered channels in order of channel
+ * number, each after a sampling time of SHRSAMC + 2 TAD. A conversion
+ * takes HOST_ADC_CONVERSION_TAD; its ready bit is cleared by the trigger
+ * and set with the result. The individual interrupt of a channel (_IEn)
+ * requests its vector at the end of the conversion, or (SHREISEL + 1) TAD
+ * earlier with the early interrupt (ADCON2L.EIEN and EIENn).
+ * Digital filters in averaging mode accumulate 2 << OVRSAM results of their
+ * channel, a filter restarts while FLEN is clear.
+ *
+ * Results are formatted as the hardware does (FORM, SIGNn) from the 12 bit
+ * code returned by the analog input of the simulation.
+ */
+#ifndef HOST_ADC_H
+#define HOST_ADC_H
+
+#include <stdint.h>
+
+#include "host_periph.h"
+#include "host_port.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HOST_ADC_CONVERSION_TAD     14      /* 12 bit conversion */
+#define HOST_ADC_CORE_SHARED        2       /* Cores 0, 1 are dedicated */
+
+typedef struct
+{
+    /* Configuration */
+    int channel;                    /* Result buffer ADCBUFn, input ANn */
+    int core;                       /* 0, 1 or HOST_ADC_CORE_SHARED */
+    volatile uint16_t *trgsrc;      /* TRGSRCn */
+    volatile uint16_t *alternate;   /* CxCHS of a dedicated core (1 : ANAn
+                                       input), NULL */
+    volatile uint16_t *sign;        /* SIGNn */
+    volatile uint16_t *result;      /* ADCBUFn */
+    volatile uint16_t *ready;       /* ANnRDY, NULL */
+    volatile uint16_t *ie;          /* _IEn, NULL */
+    volatile uint16_t *eien;        /* EIENn, NULL */
+    HOST_VECTOR_T *vector;          /* ADCANn interrupt, NULL */
+
+    /* Conversion in progress */
+    int input;                      /* Analog input sampled */
+    double sample;                  /* Sampling instant, HOST_NEVER once
+                                       sampled */
+    double done;                    /* End of conversion, HOST_NEVER */
+    double request;                 /* Interrupt request, HOST_NEVER */
+    uint16_t code;
+} HOST_ADC_CHANNEL_T;
+
+typedef struct
+{
+    volatile uint16_t *flen;        /* ADFLxCON bits */
+    volatile uint16_t *mode;
+    volatile uint16_t *ovrsam;
+    volatile uint16_t *flchsel;
+    volatile uint16_t *rdy;
+    volatile uint16_t *data;        /* ADFLxDAT */
+    int32_t sum;
+    uint16_t count;
+} HOST_ADC_FILTER_T;
+
+typedef struct
+{
+    HOST_ADC_CHANNEL_T *channel;
+    int channels;
+    HOST_ADC_FILTER_T *filter;
+    int filters;
+    double tad;                     /* ADC core clock period */
+    volatile uint16_t *form;        /* ADCON1H.FORM */
+    volatile uint16_t *shrsamc;     /* ADCON2H.SHRSAMC */
+    volatile uint16_t *eien;        /* ADCON2L.EIEN, NULL */
+    volatile uint16_t *shreisel;    /* ADCON2H.SHREISEL, NULL */
+    HOST_ANALOG_T analog;
+    void *context;
+    double coreBusy[HOST_ADC_CORE_SHARED + 1];
+} HOST_ADC_T;
+
+/* No conversion in progress, analog inputs are read with analog */
+void HostAdcInit(HOST_ADC_T *pAdc, HOST_ANALOG_T analog, void *context);
+/* Starts the conversions of trigger source at time t */
+void HostAdcTrigger(HOST_ADC_T *pAdc, uint16_t source, double t);
+/* Time of the next sampling, conversion end or interrupt request */
+double HostAdcNext(const HOST_ADC_T *pAdc);
+/* Processes the events up to time t */
+void HostAdcRun(HOST_ADC_T *pAdc, double t);
+/* Restarts the filters whose FLEN is clear, see HostSfrAccess() */
+void HostAdcFilterUpdate(HOST_ADC_T *pAdc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_ADC_H */
@@ -0,0 +1,59 @@
+/**
+ * @file host_image.h
+ *
+ * @brief Interface of a firmware image (the firmware of a core with its
+ *        host port) to the simulation.
+ *
+ * An image exports only its HOST_IMAGE_T (hostImage, renamed to
+ * hostImage_<image name> by CMakeLists.txt), all other symbols are local,
+ * so that a simulation links both cores and several variants of a core.
+ * Firmware globals are initialised once : an image is started once per
+ * process.
+ *
+ * Simulated time is in seconds from the start of the PWM time bases of the
+ * core, which start when main() reaches its main loop.
+ */
+#ifndef HOST_IMAGE_H
+#define HOST_IMAGE_H
+
+#include <stdint.h>
+
+#include "host_periph.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    const char *core;               /* "secondary" or "main" */
+    double fcy;                     /* Instruction cycle frequency */
+    double pwmClock;                /* PWM clock frequency */
+    int pwmGenerators;              /* PWM generators 1 to pwmGenerators */
+
+    /* Runs main() to the main loop. Analog inputs are read with analog. */
+    void (*start)(HOST_ANALOG_T analog, void *context);
+    /* Time of the next event of the image (ADC sample or conversion end,
+       timer or interrupt entry), HOST_NEVER if none */
+    double (*next)(void);
+    /* Processes the events of the image up to time t : interrupt service
+       routines run to completion at their entry time */
+    void (*run)(double t);
+    /* ADC trigger 1 or 2 of a PWM generator at time t */
+    void (*adcTrigger)(int generator, int trigger, double t);
+    /* Register state of a PWM generator, 0 if the generator is off */
+    int (*pwm)(int generator, HOST_PWM_T *pPwm);
+    /* Statistics of interrupt vector n, 0 if there is no vector n */
+    int (*isrStats)(int vector, HOST_ISR_STATS_T *pStats);
+    /* Firmware variable by name (see the port), NULL if unknown */
+    const HOST_PROBE_T *(*probe)(const char *name);
+    /* Address of a firmware object or function by name (see the port),
+       NULL if unknown */
+    void *(*symbol)(const char *name);
+} HOST_IMAGE_T;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_IMAGE_H */
@@ -0,0 +1,8 @@
+/**
+ * @file host_msi.c
+ *
+ * @brief MSI mailboxes shared by the core images, see host_msi.h.
+ */
+#include "host_msi.h"
+
+HOST_MSI_T hostMsi;
@@ -0,0 +1,46 @@
+/**
+ * @file host_msi.h
+ *
+ * @brief Mailboxes of the Main Secondary Interface (MSI) between the core
+ *        images on the host. Protocol block A (MBX0-6, Main to Secondary) 
+ *        and block B (MBX7-15, Secondary to Main) are copied between the 
+ *        mailbox registers of the cores as the hardware does : writing the
+ *        last register of a block sets its data ready flag, reading the 
+ *        last register clears it. Flags are accessed with release/acquire
+ *        ordering, so the cores may run in different threads.
+ */
+#ifndef HOST_MSI_H
+#define HOST_MSI_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HOST_MSI_MAILBOXES  16
+
+typedef struct
+{
+    uint16_t data[HOST_MSI_MAILBOXES];  /* MBX0D to MBX15D */
+    int readyA;                         /* DTRDYA : MBX0-6 written by Main */
+    int readyB;                         /* DTRDYB : MBX7-15 written by Secondary*/
+} HOST_MSI_T;
+
+extern HOST_MSI_T hostMsi;
+
+static inline int HostMsiReady(const int *pReady)
+{
+    return __atomic_load_n(pReady, __ATOMIC_ACQUIRE);
+}
+
+static inline void HostMsiReadySet(int *pReady, int value)
+{
+    __atomic_store_n(pReady, value, __ATOMIC_RELEASE);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_MSI_H */
@@ -0,0 +1,98 @@
+/**
+ * @file host_periph.h
+ *
+ * @brief Peripheral interface between the firmware images (host ports) and
+ *        the simulation : PWM generator state, ADC triggers and analog
+ *        inputs. Free of firmware types, so that the simulation links both
+ *        cores.
+ */
+#ifndef HOST_PERIPH_H
+#define HOST_PERIPH_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Time of events that do not occur */
+#define HOST_NEVER          1.0e30
+
+/* State of a PWM generator as configured by its registers. The time base
+   of a center aligned generator counts 2 * period clocks per cycle and the
+   high side is active for 2 * duty clocks centred in the cycle; an edge
+   aligned generator is active for duty clocks from the start of the cycle.
+   Rising edges of the complementary outputs are delayed by the dead time. */
+typedef struct
+{
+    uint16_t
+        on,                 /* Generator enabled */
+        centered,           /* Center aligned mode */
+        complementary,      /* Complementary output mode */
+        period,             /* Time base period : PER + 1 */
+        cycle,              /* Clocks from start to start of cycle : 2 * period
+                               (center aligned), period (edge aligned) or
+                               the period of the synchronisation source */
+        offset,             /* Start of the first cycle from the PWM start */
+        duty,               /* Duty cycle */
+        deadTimeH,          /* Dead time before the high side turns on */
+        deadTimeL,          /* Dead time before the low side turns on */
+        overrideH,          /* 1 - PWMxH is overridden */
+        overrideL,          /* 1 - PWMxL is overridden */
+        overrideDataH,      /* Override state of PWMxH */
+        overrideDataL,      /* Override state of PWMxL */
+        trig[3],            /* TRIGA, TRIGB, TRIGC compare values (center
+                               aligned : bit 15 selects the second half) */
+        adTrig1,            /* Bit n set : TRIGA + n is ADC trigger 1 source */
+        adTrig2,            /* Bit n set : TRIGA + n is ADC trigger 2 source */
+        adTrig1Postscale,   /* Trigger events per ADC trigger 1 */
+        syncOut,            /* ADC trigger 1 is output to the other core
+                               (PWMEVTy.EVTySEL = ADC Trigger 1) */
+        syncIn;             /* Cycle restarted by the event output of the
+                               other core (PCI sync from a Master PWM Event),
+                               directly or through the synchronisation
+                               source */
+} HOST_PWM_T;
+
+/* Analog input channels (AN<n> and the alternate inputs ANA<n> of the
+   dedicated ADC cores) */
+#define HOST_AN(n)          (n)
+#define HOST_ANA(n)         (32 + (n))
+
+/* Analog input of a channel at the sampling time t, as the code of a 12 bit
+   unipolar conversion (0 to 4095, 2048 is zero of a bipolar input) */
+typedef uint16_t (*HOST_ANALOG_T)(void *context, int channel, double t);
+
+/* Execution statistics of an interrupt vector */
+typedef struct
+{
+    const char *name;       /* Vector name, e.g. "_ADCAN15Interrupt" */
+    uint32_t count;         /* Executions */
+    uint32_t overrun;       /* Requests lost while still pending */
+    uint32_t cycles;        /* Estimated cycles of the last execution */
+    uint32_t cyclesMax;     /* Longest execution */
+    double cyclesMean;      /* Mean execution */
+    double delayMax;        /* Longest request to entry time */
+} HOST_ISR_STATS_T;
+
+/* Probe of a firmware variable : size in bytes (1, 2 or 4), or-ed with
+   HOST_PROBE_SIGNED for signed types */
+#define HOST_PROBE_SIGNED   0x100
+#define HOST_PROBE_TYPE(x)  (sizeof(x) | \
+                ((__typeof__(x))-1 < 0 ? HOST_PROBE_SIGNED : 0))
+
+typedef struct
+{
+    const char *name;       /* C expression, e.g. "mc1.appState" */
+    volatile void *address;
+    int type;
+} HOST_PROBE_T;
+
+double HostProbeRead(const HOST_PROBE_T *pProbe);
+void HostProbeWrite(const HOST_PROBE_T *pProbe, double value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_PERIPH_H */
@@ -0,0 +1,179 @@
+/**
+ * @file host_port.c
+ *
+ * @brief Execution of the firmware of a core on the host, see host_port.h.
+ */
+#include <stdint.h>
+#include <stddef.h>
+#include <setjmp.h>
+
+#include "host_dsp.h"
+#include "host_port.h"
+
+HOST_CORE_T hostCore = {.running = -1};
+
+static jmp_buf mainLoop;
+static int inMain;
+
+/* Called by every basic block of the firmware (-fsanitize-coverage) */
+void __sanitizer_cov_trace_pc(void)
+{
+    hostCore.blocks++;
+}
+
+HOST_VECTOR_T *HostPortVectorAdd(const char *name, void (*handler)(void),
+                volatile uint16_t *enable, volatile uint16_t *priority)
+{
+    HOST_VECTOR_T *pVector = &hostCore.vector[hostCore.vectorCount++];
+
+    pVector->name = name;
+    pVector->handler = handler;
+    pVector->enable = enable;
+    pVector->priority = priority;
+    pVector->request = HOST_NEVER;
+    return pVector;
+}
+
+void HostPortStart(int (*entry)(void))
+{
+    inMain = 1;
+    if (setjmp(mainLoop) == 0)
+    {
+        entry();
+    }
+    inMain = 0;
+    hostCore.started = 1;
+}
+
+void HostPortMainLoop(void)
+{
+    if (inMain)
+    {
+        longjmp(mainLoop, 1);
+    }
+}
+
+void HostPortRequest(HOST_VECTOR_T *pVector, double t)
+{
+    if (pVector->request != HOST_NEVER)
+    {
+        /* Interrupt flag is still set : requests merge */
+        pVector->overrun++;
+        return;
+    }
+    pVector->request = t;
+}
+
+/* Vector to execute next and its entry time */
+static HOST_VECTOR_T *Next(double *pEntry)
+{
+    HOST_VECTOR_T *pNext = NULL;
+    double start = HOST_NEVER;
+    int i;
+
+    for (i = 0; i < hostCore.vectorCount; i++)
+    {
+        HOST_VECTOR_T *pVector = &hostCore.vector[i];
+        double t = pVector->request;
+
+        if ((t == HOST_NEVER) || (*pVector->enable == 0))
+        {
+            continue;
+        }
+        if (t < hostCore.busyUntil)
+        {
+            t = hostCore.busyUntil;
+        }
+        if ((t < start) || ((t == start) &&
+                            (*pVector->priority > *pNext->priority)))
+        {
+            start = t;
+            pNext = pVector;
+        }
+    }
+    *pEntry = start + HOST_INTERRUPT_LATENCY * hostCore.tcy;
+    return pNext;
+}
+
+double HostPortNext(void)
+{
+    double entry;
+
+    Next(&entry);
+    return entry;
+}
+
+void HostPortRun(double t)
+{
+    HOST_VECTOR_T *pVector;
+    double entry;
+
+    while (((pVector = Next(&entry)) != NULL) && (entry <= t))
+    {
+        uint32_t cycles;
+
+        if (entry - pVector->request > pVector->delayMax)
+        {
+            pVector->delayMax = entry - pVector->request;
+        }
+        pVector->request = HOST_NEVER;
+        hostCore.running = (int)(pVector - hostCore.vector);
+        hostCore.entry = entry;
+        hostCore.blocks = 0;
+        hostCore.dspCycles = hostDspCount.cycles;
+        if (hostCore.isrStart != NULL)
+        {
+            hostCore.isrStart();
+        }
+        pVector->handler();
+        cycles = HostPortCycles();
+        hostCore.running = -1;
+        hostCore.busyUntil = entry + cycles * hostCore.tcy;
+        if (hostCore.isrEnd != NULL)
+        {
+            hostCore.isrEnd();
+        }
+        pVector->count++;
+        pVector->cycles = cycles;
+        pVector->cyclesSum += cycles;
+        if (cycles > pVector->cyclesMax)
+        {
+            pVector->cyclesMax = cycles;
+        }
+    }
+}
+
+uint32_t HostPortCycles(void)
+{
+    return HOST_BLOCK_CYCLES * hostCore.blocks +
+                                (hostDspCount.cycles - hostCore.dspCycles);
+}
+
+double HostPortNow(void)
+{
+    if (hostCore.running < 0)
+    {
+        return hostCore.busyUntil;
+    }
+    return hostCore.entry + HostPortCycles() * hostCore.tcy;
+}
+
+int HostPortIsrStats(int vector, HOST_ISR_STATS_T *pStats)
+{
+    const HOST_VECTOR_T *pVector;
+
+    if ((vector < 0) || (vector >= hostCore.vectorCount))
+    {
+        return 0;
+    }
+    pVector = &hostCore.vector[vector];
+    pStats->name = pVector->name;
+    pStats->count = pVector->count;
+    pStats->overrun = pVector->overrun;
+    pStats->cycles = pVector->cycles;
+    pStats->cyclesMax = pVector->cyclesMax;
+    pStats->cyclesMean = pVector->count ?
+                            pVector->cyclesSum / pVector->count : 0;
+    pStats->delayMax = pVector->delayMax;
+    return 1;
+}
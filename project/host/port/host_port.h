@@ -0,0 +1,90 @@
+/**
+ * @file host_port.h
+ *
+ * @brief Execution of the firmware of a core on the host : interrupt
+ *        requests, CPU time and the main loop of the core.
+ *
+ * The firmware image of a core runs main() up to its main loop, where
+ * X2CScope_Communicate() returns to the port (HostPortMainLoop()). The
+ * simulation then requests interrupts and the port executes their service
+ * routines : each ISR runs to completion at its entry time (request time,
+ * or return of the previous ISR, plus HOST_INTERRUPT_LATENCY). Requests
+ * are served in order of time and then priority; nesting is not modelled,
+ * a higher priority request waits for the running ISR to return.
+ *
+ * CPU time of the firmware is estimated from the basic blocks it executes
+ * (-fsanitize-coverage=trace-pc, HOST_BLOCK_CYCLES each) and the cycles of
+ * the emulated DSP builtins (host_dsp.h). It is a relative measure used to
+ * compare variants and to resolve the busy waits of the firmware (ADC
+ * ready, PWM half cycle, timer) against the simulated time, not a cycle
+ * count of the dsPIC.
+ *
+ * Each firmware image is linked with its own copy of the port (the
+ * symbols of an image are local to it, see CMakeLists.txt).
+ */
+#ifndef HOST_PORT_H
+#define HOST_PORT_H
+
+#include <stdint.h>
+
+#include "host_periph.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HOST_BLOCK_CYCLES           3
+#define HOST_INTERRUPT_LATENCY      10      /* Cycles to the first ISR block */
+#define HOST_VECTORS_MAX            4
+
+typedef struct
+{
+    const char *name;
+    void (*handler)(void);
+    volatile uint16_t *enable;      /* Interrupt enable (_xxIE) */
+    volatile uint16_t *priority;    /* Interrupt priority (_xxIP) */
+    double request;                 /* Pending request time, HOST_NEVER */
+    uint32_t
+        count,                      /* Executions */
+        overrun,                    /* Requests while still pending */
+        cycles,                     /* Cycles of the last execution */
+        cyclesMax;                  /* Longest execution */
+    double
+        cyclesSum,                  /* Sum of cycles of all executions */
+        delayMax;                   /* Longest request to entry time */
+} HOST_VECTOR_T;
+
+typedef struct
+{
+    double tcy;                     /* Instruction cycle time */
+    double entry;                   /* Entry time of the running ISR */
+    double busyUntil;               /* Return time of the last ISR */
+    int running;                    /* Running vector, -1 - none */
+    int started;                    /* main() reached the main loop */
+    uint32_t blocks;                /* Basic blocks since ISR entry */
+    uint32_t dspCycles;             /* DSP cycles at ISR entry */
+    HOST_VECTOR_T vector[HOST_VECTORS_MAX];
+    int vectorCount;
+    void (*isrStart)(void);         /* Called before each ISR, at entry */
+    void (*isrEnd)(void);           /* Called after each ISR */
+} HOST_CORE_T;
+
+extern HOST_CORE_T hostCore;
+
+HOST_VECTOR_T *HostPortVectorAdd(const char *name, void (*handler)(void),
+                volatile uint16_t *enable, volatile uint16_t *priority);
+void HostPortStart(int (*entry)(void));
+void HostPortMainLoop(void);
+void HostPortRequest(HOST_VECTOR_T *pVector, double t);
+double HostPortNext(void);
+void HostPortRun(double t);
+double HostPortNow(void);
+uint32_t HostPortCycles(void);
+/* Statistics of vector n, see HOST_IMAGE_T */
+int HostPortIsrStats(int vector, HOST_ISR_STATS_T *pStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_PORT_H */
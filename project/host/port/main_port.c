@@ -0,0 +1,375 @@
+/**
+ * @file main_port.c
+ *
+ * @brief Host port of the Main core firmware (PFC) : register hooks, ADC,
+ *        Timer1 and PWM register state of the core, see host_image.h.
+ *
+ * PWM : PG4 (boost switch) is center aligned and free running. Its ADC
+ * trigger 1 (PG4TRIGC, postscaled 1:4) is Master PWM Event C, the sync of
+ * the motor PWM of the Secondary core.
+ * ADC : Vac (AN0), iL (AN11) and Vdc (AN12) are converted by the shared core
+ * on PWM4 trigger 2, the AN12 interrupt runs the PFC (PFC_ADCInterrupt).
+ * ADC trigger sources (TRGSRC) are those documented in hal/adc.c.
+ * MSI : the Main core writes block A (MBX0-6) and reads block B (MBX7-15).
+ */
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <xc.h>
+
+#include "clock.h"
+#include "adc_trace.h"
+#include "pfc.h"
+#include "msi.h"
+#include "supervisor.h"
+
+#include "host_adc.h"
+#include "host_image.h"
+#include "host_msi.h"
+#include "host_port.h"
+
+#define PORT_GENERATORS         4
+#define PORT_PFC_GENERATOR      4
+#define PORT_CENTER_ALIGNED     4       /* PGxCONL.MODSEL */
+#define PORT_IOCONL_OVRDAT      10      /* Bit positions in PGxIOCONL */
+#define PORT_IOCONL_OVRENL      12
+#define PORT_IOCONL_OVRENH      13
+#define PORT_EVT_ADC_TRIGGER1   0b1000  /* PWMEVTy.EVTySEL */
+
+int HostFirmwareMain(void);
+void _ADCAN12Interrupt(void);
+void _T1Interrupt(void);
+
+extern PFC_T pfcParam;
+#ifdef ENABLE_ADC_TRACE
+extern ADC_TRACE_T pfcTrace;
+#endif
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+extern SUPERVISOR_T supervisor;
+#endif
+
+/* ADC trigger sources (TRGSRC) of the PWM4 triggers 1 and 2 */
+static const uint16_t pwmTriggerSource[2] = {0b01010, 0b01011};
+
+static HOST_ADC_CHANNEL_T adcChannel[] =
+{
+    {.channel = 0, .core = HOST_ADC_CORE_SHARED,
+     .trgsrc = &ADTRIG0Lbits.TRGSRC0, .sign = &ADMOD0Lbits.SIGN0,
+     .result = &ADCBUF0},
+    {.channel = 11, .core = HOST_ADC_CORE_SHARED,
+     .trgsrc = &ADTRIG2Hbits.TRGSRC11, .sign = &ADMOD0Hbits.SIGN11,
+     .result = &ADCBUF11},
+    {.channel = 12, .core = HOST_ADC_CORE_SHARED,
+     .trgsrc = &ADTRIG3Lbits.TRGSRC12, .sign = &ADMOD0Hbits.SIGN12,
+     .result = &ADCBUF12, .ie = &_IE12},
+};
+
+static HOST_ADC_T adc =
+{
+    .channel = adcChannel,
+    .channels = sizeof(adcChannel) / sizeof(adcChannel[0]),
+    .form = &ADCON1Hbits.FORM,
+    .shrsamc = &ADCON2Hbits.SHRSAMC,
+};
+
+static HOST_VECTOR_T *pTimer1Vector;
+static double timer1Next = HOST_NEVER;
+static double timer1Tick;               /* TMR1 count period */
+static int msiCommandPending;
+
+static void MsiCommit(void);
+
+#define PORT_PROBE(x)   {#x, &(x), HOST_PROBE_TYPE(x)}
+/* Outer loops of a motor, scaling checked by test/msistress.c */
+#define PORT_SUPERVISOR_PROBES(mc) \
+    PORT_PROBE(mc.qTargetVelocity), \
+    PORT_PROBE(mc.qVelRef), \
+    PORT_PROBE(mc.qIqRef), \
+    PORT_PROBE(mc.qIdRef), \
+    PORT_PROBE(mc.qMinSpeed), \
+    PORT_PROBE(mc.qMaxSpeed), \
+    PORT_PROBE(mc.qNominalSpeed), \
+    PORT_PROBE(mc.piSpeed.outMax), \
+    PORT_PROBE(mc.piFluxWeakening.outMin)
+
+static const HOST_PROBE_T probe[] =
+{
+    PORT_PROBE(pfcParam.state),
+    PORT_PROBE(pfcParam.faultStatus),
+    PORT_PROBE(pfcParam.duty),
+    PORT_PROBE(pfcParam.iL),
+    PORT_PROBE(pfcParam.rectifiedVac),
+    PORT_PROBE(pfcParam.outputVdc),
+    PORT_PROBE(pfcParam.vdcReference),
+    PORT_PROBE(pfcParam.currentReference),
+    PORT_PROBE(pfcParam.pfcVoltage.vdc),
+    PORT_PROBE(pfcParam.pfcVoltage.vac),
+    PORT_PROBE(pfcParam.pfcCurrent.iL),
+    PORT_PROBE(pfcParam.vacRMS.sqrOutput),
+    PORT_PROBE(pfcParam.vdcAVG.output),
+    PORT_PROBE(pfcParam.piVoltage.reference),
+    PORT_PROBE(pfcParam.piVoltage.output),
+    PORT_PROBE(pfcParam.piVoltage.integralOut),
+    PORT_PROBE(pfcParam.piCurrent.output),
+    PORT_PROBE(pfcParam.lightLoad.state),
+    PORT_PROBE(pfcParam.lightLoad.standbyRequest),
+    PORT_PROBE(pfcParam.lightLoad.standbyCount),
+    PORT_PROBE(pfcParam.lightLoad.burstCount),
+    PORT_PROBE(pfcParam.kpi.softStartTime),
+    PORT_PROBE(pfcParam.kpi.vdcRipple),
+    PORT_PROBE(pfcParam.kpi.vdcRippleMax),
+    PORT_PROBE(pfcParam.kpi.powerFactor),
+    PORT_PROBE(pfcParam.kpi.isrCycles),
+    PORT_PROBE(pfcParam.kpi.isrCyclesMax),
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+    PORT_SUPERVISOR_PROBES(supervisor.mc1),
+    PORT_SUPERVISOR_PROBES(supervisor.mc2),
+    PORT_PROBE(supervisor.command.flags),
+    PORT_PROBE(supervisor.feedback.status),
+    PORT_PROBE(supervisor.feedback.voltageDemand),
+    PORT_PROBE(supervisor.commandMissed),
+    PORT_PROBE(supervisor.feedbackAge),
+#endif
+};
+
+static const struct
+{
+    const char *name;
+    void *address;
+} symbol[] =
+{
+    {"pfcParam", &pfcParam}, {"hostDspCount", &hostDspCount},
+    /* MSI protocol across threads (test/msistress.c) */
+    {"HAL_MSICommandWrite", (void *)HAL_MSICommandWrite},
+    {"HAL_MSIFeedbackRead", (void *)HAL_MSIFeedbackRead},
+    {"MsiCommit", (void *)MsiCommit},
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+    {"supervisor", &supervisor},
+#endif
+#ifdef ENABLE_ADC_TRACE
+    {"pfcTrace", &pfcTrace},
+    {"ADCTraceStreamLength", (void *)ADCTraceStreamLength},
+    {"ADCTraceStreamWord", (void *)ADCTraceStreamWord},
+#endif
+};
+
+/* MSI mailbox block A written by the firmware is committed after the write
+   of MSI1MBX6D completes */
+static void MsiCommit(void)
+{
+    if (msiCommandPending)
+    {
+        hostMsi.data[0] = MSI1MBX0D;
+        hostMsi.data[1] = MSI1MBX1D;
+        hostMsi.data[2] = MSI1MBX2D;
+        hostMsi.data[3] = MSI1MBX3D;
+        hostMsi.data[4] = MSI1MBX4D;
+        hostMsi.data[5] = MSI1MBX5D;
+        hostMsi.data[6] = host_MSI1MBX6D;
+        msiCommandPending = 0;
+        HostMsiReadySet(&hostMsi.readyA, 1);
+    }
+}
+
+void HostSfrAccess(HOST_SFR_ID_T id, volatile void *storage)
+{
+    (void)storage;
+    switch (id)
+    {
+        case HOST_SFR_ID_MSI1MBXS:
+            MsiCommit();
+            if (HostMsiReady(&hostMsi.readyB))
+            {
+                MSI1MBX7D = hostMsi.data[7];
+                MSI1MBX8D = hostMsi.data[8];
+                MSI1MBX9D = hostMsi.data[9];
+                MSI1MBX10D = hostMsi.data[10];
+                MSI1MBX11D = hostMsi.data[11];
+                MSI1MBX12D = hostMsi.data[12];
+                MSI1MBX13D = hostMsi.data[13];
+                MSI1MBX14D = hostMsi.data[14];
+                host_MSI1MBX15D = hostMsi.data[15];
+            }
+            host_MSI1MBXSbits.DTRDYA = HostMsiReady(&hostMsi.readyA);
+            host_MSI1MBXSbits.DTRDYB = HostMsiReady(&hostMsi.readyB);
+        break;
+        case HOST_SFR_ID_MSI1MBX6D:
+            msiCommandPending = 1;
+        break;
+        case HOST_SFR_ID_MSI1MBX15D:
+            /* Read of the last register of block B */
+            HostMsiReadySet(&hostMsi.readyB, 0);
+        break;
+        case HOST_SFR_ID_TMR1:
+            host_TMR1 = (uint16_t)((uint64_t)(HostPortNow() / timer1Tick) %
+                                                        (PR1 + 1));
+        break;
+        default:
+        break;
+    }
+}
+
+static void IsrStart(void)
+{
+    HostAdcRun(&adc, hostCore.entry);
+}
+
+static int PWM(int generator, HOST_PWM_T *pPwm)
+{
+    uint16_t iocon;
+
+    memset(pPwm, 0, sizeof(*pPwm));
+    if ((generator != PORT_PFC_GENERATOR) || (PG4CONLbits.ON == 0))
+    {
+        return 0;
+    }
+    pPwm->on = 1;
+    pPwm->centered = (PG4CONLbits.MODSEL == PORT_CENTER_ALIGNED);
+    pPwm->complementary = (PG4IOCONHbits.PMOD == 0);
+    pPwm->period = (PG4CONHbits.MPERSEL ? MPER : PG4PER) + 1;
+    pPwm->duty = PG4CONHbits.MDCSEL ? MDC : PG4DC;
+    pPwm->deadTimeH = PG4DTH;
+    pPwm->deadTimeL = PG4DTL;
+    iocon = PG4IOCONL;
+    pPwm->overrideH = (iocon >> PORT_IOCONL_OVRENH) & 1;
+    pPwm->overrideL = (iocon >> PORT_IOCONL_OVRENL) & 1;
+    pPwm->overrideDataH = (iocon >> (PORT_IOCONL_OVRDAT + 1)) & 1;
+    pPwm->overrideDataL = (iocon >> PORT_IOCONL_OVRDAT) & 1;
+    pPwm->trig[0] = PG4TRIGA;
+    pPwm->trig[1] = PG4TRIGB;
+    pPwm->trig[2] = PG4TRIGC;
+    pPwm->adTrig1 = (PG4EVTLbits.ADTR1EN1 != 0) |
+                    ((PG4EVTLbits.ADTR1EN2 != 0) << 1) |
+                    ((PG4EVTLbits.ADTR1EN3 != 0) << 2);
+    pPwm->adTrig2 = (PG4EVTHbits.ADTR2EN1 != 0) |
+                    ((PG4EVTHbits.ADTR2EN2 != 0) << 1) |
+                    ((PG4EVTHbits.ADTR2EN3 != 0) << 2);
+    pPwm->adTrig1Postscale = PG4EVTLbits.ADTR1PS + 1;
+    /* Master PWM Event C : PCI sync of the motor PWM of the Secondary core */
+    pPwm->syncOut = (PWMEVTCbits.EVTCSEL == PORT_EVT_ADC_TRIGGER1) &&
+                    (PWMEVTCbits.EVTCPGS == PORT_PFC_GENERATOR - 1);
+    pPwm->cycle = pPwm->centered ? 2 * pPwm->period : pPwm->period;
+    return 1;
+}
+
+static void Start(HOST_ANALOG_T analog, void *context)
+{
+    static const double timer1Prescaler[] = {1, 8, 64, 256};
+
+    /* Status of registers without a model */
+    ADCON5Lbits.SHRRDY = 1;
+    OSCCONbits.LOCK = 1;
+
+    hostCore.tcy = 1.0 / FCY;
+    hostCore.isrStart = IsrStart;
+    hostCore.isrEnd = MsiCommit;
+    adcChannel[2].vector = HostPortVectorAdd("_ADCAN12Interrupt",
+                            _ADCAN12Interrupt, &_ADCAN12IE, &_ADCAN12IP);
+    pTimer1Vector = HostPortVectorAdd("_T1Interrupt", _T1Interrupt,
+                                      &_T1IE, &_T1IP);
+    HostAdcInit(&adc, analog, context);
+
+    HostPortStart(HostFirmwareMain);
+
+    /* TAD = 2 * SHRADCS (at least 2) source clocks of FP / (CLKDIV + 1) */
+    adc.tad = (ADCON3Hbits.CLKDIV + 1) * 2.0 *
+                    (ADCON2Lbits.SHRADCS ? ADCON2Lbits.SHRADCS : 1) / FCY;
+    timer1Tick = timer1Prescaler[T1CONbits.TCKPS & 3] / FCY;
+    if (T1CONbits.TON)
+    {
+        timer1Next = (PR1 + 1) * timer1Tick;
+    }
+}
+
+static double Next(void)
+{
+    double next = HostAdcNext(&adc);
+    double entry = HostPortNext();
+
+    if (entry < next)
+    {
+        next = entry;
+    }
+    if (timer1Next < next)
+    {
+        next = timer1Next;
+    }
+    return next;
+}
+
+static void Run(double t)
+{
+    double next;
+
+    while ((next = Next()) <= t)
+    {
+        if (HostAdcNext(&adc) == next)
+        {
+            HostAdcRun(&adc, next);
+        }
+        else if (timer1Next == next)
+        {
+            HostPortRequest(pTimer1Vector, next);
+            timer1Next += (PR1 + 1) * timer1Tick;
+        }
+        else
+        {
+            HostPortRun(next);
+        }
+    }
+}
+
+static void AdcTrigger(int generator, int trigger, double t)
+{
+    if ((generator != PORT_PFC_GENERATOR) || (trigger < 1) || (trigger > 2))
+    {
+        return;
+    }
+    Run(t);
+    HostAdcTrigger(&adc, pwmTriggerSource[trigger - 1], t);
+}
+
+static const HOST_PROBE_T *Probe(const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(probe) / sizeof(probe[0]); i++)
+    {
+        if (strcmp(probe[i].name, name) == 0)
+        {
+            return &probe[i];
+        }
+    }
+    return NULL;
+}
+
+static void *Symbol(const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(symbol) / sizeof(symbol[0]); i++)
+    {
+        if (strcmp(symbol[i].name, name) == 0)
+        {
+            return symbol[i].address;
+        }
+    }
+    return NULL;
+}
+
+const HOST_IMAGE_T hostImage =
+{
+    .core = "main",
+    .fcy = FCY,
+    .pwmClock = FOSC,
+    .pwmGenerators = PORT_GENERATORS,
+    .start = Start,
+    .next = Next,
+    .run = Run,
+    .adcTrigger = AdcTrigger,
+    .pwm = PWM,
+    .isrStats = HostPortIsrStats,
+    .probe = Probe,
+    .symbol = Symbol,
+};
@@ -0,0 +1,549 @@
+/**
+ * @file secondary_port.c
+ *
+ * @brief Host port of the Secondary core firmware (dual motor control) :
+ *        register hooks, ADC, Timer1 and PWM register state of the core, see
+ *        host_image.h.
+ *
+ * PWM : PG1-PG3 (MC1) and PG6-PG8 (MC2) are center aligned and restarted by
+ * PG5 (PCI sync, SOCS = 0xF), PG1-PG3 on its rising edge, PG6-PG8 on its
+ * falling edge (PGxSPCIL.PPS) : the cycle of a motor generator is the PG5
+ * period, its offset the PG5 duty when PPS is set. PG5 is restarted by
+ * Master PWM Event C (PG5SPCIL.PSS) of the Main core, which outputs ADC
+ * trigger 1 of the PFC generator (PG4TRIGC, every 4th PFC cycle); without a
+ * Main image it runs at its own period.
+ * ADC trigger sources (TRGSRC) are those documented in hal/adc.c.
+ * Timer1 runs from the start of the PWM; before that (bootstrap charging in
+ * main()) PGxSTAT.CAHALF toggles on each read.
+ */
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <xc.h>
+
+#include "adc_trace.h"
+#include "clock.h"
+#include "mc1_init.h"
+#include "mc2_init.h"
+#include "mc1_service.h"
+#include "mc2_service.h"
+#include "msi.h"
+
+#include "host_adc.h"
+#include "host_image.h"
+#include "host_msi.h"
+#include "host_port.h"
+
+#define PORT_GENERATORS         8
+#define PORT_SYNC_GENERATOR     5       /* PCI sync source of PG1-3, PG6-8 */
+#define PORT_SYNC_SOCS          0xF     /* Start of cycle : PCI sync */
+#define PORT_SYNC_PSS           0b10111 /* PCI source : Master PWM Event C */
+#define PORT_CENTER_ALIGNED     4       /* PGxCONL.MODSEL */
+#define PORT_IOCONL_OVRDAT      10      /* Bit positions in PGxIOCONL */
+#define PORT_IOCONL_OVRENL      12
+#define PORT_IOCONL_OVRENH      13
+
+int HostFirmwareMain(void);
+void _ADCAN15Interrupt(void);
+void _ADCAN18Interrupt(void);
+void _T1Interrupt(void);
+
+extern MC1APP_DATA_T mc1;
+extern MC1APP_ISR_DATA_T mc1Isr;
+extern MC2APP_DATA_T mc2;
+extern MC2APP_ISR_DATA_T mc2Isr;
+extern MCAPP_MOTOR_T mc1Motor, mc2Motor;
+extern int16_t runCmdMC1, qTargetVelocityMC1;
+extern int16_t runCmdMC2, qTargetVelocityMC2;
+#ifdef ENABLE_ADC_TRACE
+extern ADC_TRACE_T mc1Trace;
+#endif
+
+/* Registers of a PWM generator */
+typedef struct
+{
+    volatile uint16_t *on, *modsel, *mpersel, *mdcsel, *socs, *pmod, *pps,
+        *per, *dc, *dth, *dtl, *iocon, *trig[3], *tr1en[3], *tr2en[3], *tr1ps;
+} PORT_PWM_T;
+
+#define PORT_PWM(n) \
+    { \
+        &PG##n##CONLbits.ON, &PG##n##CONLbits.MODSEL, \
+        &PG##n##CONHbits.MPERSEL, &PG##n##CONHbits.MDCSEL, \
+        &PG##n##CONHbits.SOCS, &PG##n##IOCONHbits.PMOD, \
+        &PG##n##SPCILbits.PPS, &PG##n##PER, &PG##n##DC, &PG##n##DTH, \
+        &PG##n##DTL, &PG##n##IOCONL, \
+        {&PG##n##TRIGA, &PG##n##TRIGB, &PG##n##TRIGC}, \
+        {&PG##n##EVTLbits.ADTR1EN1, &PG##n##EVTLbits.ADTR1EN2, \
+         &PG##n##EVTLbits.ADTR1EN3}, \
+        {&PG##n##EVTHbits.ADTR2EN1, &PG##n##EVTHbits.ADTR2EN2, \
+         &PG##n##EVTHbits.ADTR2EN3}, \
+        &PG##n##EVTLbits.ADTR1PS \
+    }
+
+static const PORT_PWM_T pwmGenerator[PORT_GENERATORS] =
+{
+    PORT_PWM(1), PORT_PWM(2), PORT_PWM(3), {NULL}, PORT_PWM(5),
+    PORT_PWM(6), PORT_PWM(7), PORT_PWM(8)
+};
+
+/* ADC trigger sources (TRGSRC) of the PWM generator triggers 1 and 2 */
+static const uint16_t pwmTriggerSource[PORT_GENERATORS][2] =
+{
+    {0b00100, 0b00101}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0b01101, 0},
+    {0, 0}, {0, 0}
+};
+
+static HOST_ADC_CHANNEL_T adcChannel[] =
+{
+    {.channel = 0, .core = 0, .trgsrc = &ADTRIG0Lbits.TRGSRC0,
+     .alternate = &ADCON4Hbits.C0CHS, .sign = &ADMOD0Lbits.SIGN0,
+     .result = &ADCBUF0},
+    {.channel = 1, .core = 1, .trgsrc = &ADTRIG0Lbits.TRGSRC1,
+     .alternate = &ADCON4Hbits.C1CHS, .sign = &ADMOD0Lbits.SIGN1,
+     .result = &ADCBUF1},
+    {.channel = 10, .core = HOST_ADC_CORE_SHARED,
+     .trgsrc = &ADTRIG2Hbits.TRGSRC10, .sign = &ADMOD0Hbits.SIGN10,
+     .result = &ADCBUF10},
+    {.channel = 13, .core = HOST_ADC_CORE_SHARED,
+     .trgsrc = &ADTRIG3Lbits.TRGSRC13, .sign = &ADMOD0Hbits.SIGN13,
+     .result = &ADCBUF13},
+    {.channel = 15, .core = HOST_ADC_CORE_SHARED,
+     .trgsrc = &ADTRIG3Hbits.TRGSRC15, .sign = &ADMOD0Hbits.SIGN15,
+     .result = &ADCBUF15, .ready = &host_ADSTATLbits.AN15RDY,
+     .ie = &_IE15, .eien = &ADEIELbits.EIEN15},
+    {.channel = 18, .core = HOST_ADC_CORE_SHARED,
+     .trgsrc = &ADTRIG4Hbits.TRGSRC18, .sign = &ADMOD1Lbits.SIGN18,
+     .result = &ADCBUF18, .ready = &host_ADSTATHbits.AN18RDY,
+     .ie = &_IE18, .eien = &ADEIEHbits.EIEN18},
+};
+
+static HOST_ADC_FILTER_T adcFilter[] =
+{
+    {&host_ADFL0CONbits.FLEN, &host_ADFL0CONbits.MODE,
+     &host_ADFL0CONbits.OVRSAM, &host_ADFL0CONbits.FLCHSEL,
+     &host_ADFL0CONbits.RDY, &ADFL0DAT},
+    {&host_ADFL1CONbits.FLEN, &host_ADFL1CONbits.MODE,
+     &host_ADFL1CONbits.OVRSAM, &host_ADFL1CONbits.FLCHSEL,
+     &host_ADFL1CONbits.RDY, &ADFL1DAT},
+};
+
+static HOST_ADC_T adc =
+{
+    .channel = adcChannel,
+    .channels = sizeof(adcChannel) / sizeof(adcChannel[0]),
+    .filter = adcFilter,
+    .filters = sizeof(adcFilter) / sizeof(adcFilter[0]),
+    .form = &ADCON1Hbits.FORM,
+    .shrsamc = &ADCON2Hbits.SHRSAMC,
+    .eien = &ADCON2Lbits.EIEN,
+    .shreisel = &ADCON2Hbits.SHREISEL,
+};
+
+static int PWM(int generator, HOST_PWM_T *pPwm);
+
+static HOST_VECTOR_T *pTimer1Vector;
+static double timer1Next = HOST_NEVER;
+static double timer1Tick;               /* TMR1 count period */
+static int msiFeedbackPending;
+
+static void MsiCommit(void);
+
+#define PORT_PROBE(x)   {#x, &(x), HOST_PROBE_TYPE(x)}
+#define PORT_MC_PROBES(mc, isr) \
+    PORT_PROBE(mc.appState), \
+    PORT_PROBE(mc.runCmd), \
+    PORT_PROBE(mc.qTargetVelocity), \
+    PORT_PROBE(mc.command.sequence), \
+    PORT_PROBE(mc.command.adopted), \
+    PORT_PROBE(mc.fault.faultState), \
+    PORT_PROBE(isr.motorInputs.measureCurrent.Ia), \
+    PORT_PROBE(isr.motorInputs.measureCurrent.Ib), \
+    PORT_PROBE(isr.motorInputs.measureCurrent.Ibus), \
+    PORT_PROBE(isr.motorInputs.measureVdc.value), \
+    PORT_PROBE(isr.motorInputs.measurePot), \
+    PORT_PROBE(isr.controlScheme.focState), \
+    PORT_PROBE(isr.controlScheme.faultStatus), \
+    PORT_PROBE(isr.controlScheme.idq.d), \
+    PORT_PROBE(isr.controlScheme.idq.q), \
+    PORT_PROBE(isr.controlScheme.vdq.d), \
+    PORT_PROBE(isr.controlScheme.vdq.q), \
+    PORT_PROBE(isr.controlScheme.ctrlParam.qVelRef), \
+    PORT_PROBE(isr.controlScheme.ctrlParam.qIdRef), \
+    PORT_PROBE(isr.controlScheme.ctrlParam.qIqRef), \
+    PORT_PROBE(isr.controlScheme.ctrlParam.qTargetVelocity), \
+    PORT_PROBE(isr.controlScheme.ctrlParam.openLoop), \
+    PORT_PROBE(isr.controlScheme.estimInterface.qVelEstim), \
+    PORT_PROBE(isr.controlScheme.estimInterface.qTheta), \
+    PORT_PROBE(isr.controlScheme.estimPLL.qTheta), \
+    PORT_PROBE(mc.kpi.closeLoopTime), \
+    PORT_PROBE(mc.kpi.overshoot), \
+    PORT_PROBE(mc.kpi.settleTime), \
+    PORT_PROBE(mc.kpi.isrCycles), \
+    PORT_PROBE(mc.kpi.isrCyclesMax), \
+    PORT_PROBE(mc.kpi.isrJitter), \
+    PORT_PROBE(isr.PWMDuty.dutycycle1), \
+    PORT_PROBE(isr.PWMDuty.dutycycle2), \
+    PORT_PROBE(isr.PWMDuty.dutycycle3)
+
+static const HOST_PROBE_T probe[] =
+{
+    PORT_PROBE(runCmdMC1),
+    PORT_PROBE(runCmdMC2),
+    PORT_PROBE(qTargetVelocityMC1),
+    PORT_PROBE(qTargetVelocityMC2),
+    PORT_PROBE(PORTEbits.RE4),
+    PORT_PROBE(PORTEbits.RE5),
+    PORT_MC_PROBES(mc1, mc1Isr),
+    PORT_MC_PROBES(mc2, mc2Isr),
+};
+
+static const struct
+{
+    const char *name;
+    void *address;
+} symbol[] =
+{
+    {"mc1", &mc1}, {"mc1Isr", &mc1Isr}, {"mc2", &mc2}, {"mc2Isr", &mc2Isr},
+    {"mc1Motor", &mc1Motor}, {"mc2Motor", &mc2Motor},
+    {"hostDspCount", &hostDspCount},
+    /* Command buffer stress test (test/cmdstress.c) */
+    {"MCAPP_MC1InputBufferSet", (void *)MCAPP_MC1InputBufferSet},
+    {"MCAPP_MC2InputBufferSet", (void *)MCAPP_MC2InputBufferSet},
+    {"_ADCAN15Interrupt", (void *)_ADCAN15Interrupt},
+    {"_ADCAN18Interrupt", (void *)_ADCAN18Interrupt},
+    /* MSI protocol across threads (test/msistress.c) */
+    {"HAL_MSICommandRead", (void *)HAL_MSICommandRead},
+    {"HAL_MSIFeedbackWrite", (void *)HAL_MSIFeedbackWrite},
+    {"MsiCommit", (void *)MsiCommit},
+#ifdef ENABLE_ADC_TRACE
+    {"mc1Trace", &mc1Trace},
+    {"ADCTraceStreamLength", (void *)ADCTraceStreamLength},
+    {"ADCTraceStreamWord", (void *)ADCTraceStreamWord},
+#endif
+};
+
+/* Time base position of a generator in PWM clocks from the start of its
+   cycle, -1 if off */
+static int32_t Position(int generator, double t)
+{
+    HOST_PWM_T pwm;
+    double clocks;
+    int32_t position;
+
+    if ((PWM(generator, &pwm) == 0) || (t < 0))
+    {
+        return -1;
+    }
+    clocks = t * FOSC - pwm.offset;
+    if (clocks < 0)
+    {
+        return -1;
+    }
+    position = (int32_t)(clocks - (double)pwm.cycle *
+                                    (int32_t)(clocks / pwm.cycle));
+    if (pwm.centered && (position >= 2 * pwm.period))
+    {
+        /* Waits for the next sync in the last state */
+        position = 2 * pwm.period - 1;
+    }
+    return position;
+}
+
+static void PWMStatus(int generator, volatile uint16_t *pCahalf,
+                                    volatile uint16_t *pCapture)
+{
+    HOST_PWM_T pwm;
+    int32_t position;
+
+    if (!hostCore.started)
+    {
+        /* Bootstrap charging counts half cycles before the simulation */
+        if (pCahalf != NULL)
+        {
+            *pCahalf = !*pCahalf;
+        }
+        return;
+    }
+    position = Position(generator, HostPortNow());
+    PWM(generator, &pwm);
+    if (position < 0)
+    {
+        position = 0;
+    }
+    if (pCahalf != NULL)
+    {
+        *pCahalf = (position >= pwm.period);
+    }
+    if (pCapture != NULL)
+    {
+        *pCapture = (uint16_t)(position % pwm.period);
+    }
+}
+
+/* MSI mailbox block B written by the firmware is committed after the write
+   of SI1MBX15D completes */
+static void MsiCommit(void)
+{
+    if (msiFeedbackPending)
+    {
+        hostMsi.data[7] = SI1MBX7D;
+        hostMsi.data[8] = SI1MBX8D;
+        hostMsi.data[9] = SI1MBX9D;
+        hostMsi.data[10] = SI1MBX10D;
+        hostMsi.data[11] = SI1MBX11D;
+        hostMsi.data[12] = SI1MBX12D;
+        hostMsi.data[13] = SI1MBX13D;
+        hostMsi.data[14] = SI1MBX14D;
+        hostMsi.data[15] = host_SI1MBX15D;
+        msiFeedbackPending = 0;
+        HostMsiReadySet(&hostMsi.readyB, 1);
+    }
+}
+
+void HostSfrAccess(HOST_SFR_ID_T id, volatile void *storage)
+{
+    (void)storage;
+    switch (id)
+    {
+        case HOST_SFR_ID_ADFL0CON:
+        case HOST_SFR_ID_ADFL1CON:
+            HostAdcFilterUpdate(&adc);
+            /* fall through */
+        case HOST_SFR_ID_ADSTATH:
+        case HOST_SFR_ID_ADSTATL:
+            if (hostCore.started)
+            {
+                HostAdcRun(&adc, HostPortNow());
+            }
+        break;
+        case HOST_SFR_ID_PG1CAP:
+            PWMStatus(1, NULL, &host_PG1CAP);
+        break;
+        case HOST_SFR_ID_PG1STAT:
+            PWMStatus(1, &host_PG1STATbits.CAHALF, NULL);
+        break;
+        case HOST_SFR_ID_PG6CAP:
+            PWMStatus(6, NULL, &host_PG6CAP);
+        break;
+        case HOST_SFR_ID_PG6STAT:
+            PWMStatus(6, &host_PG6STATbits.CAHALF, NULL);
+        break;
+        case HOST_SFR_ID_SI1MBXS:
+            MsiCommit();
+            if (HostMsiReady(&hostMsi.readyA))
+            {
+                SI1MBX0D = hostMsi.data[0];
+                SI1MBX1D = hostMsi.data[1];
+                SI1MBX2D = hostMsi.data[2];
+                SI1MBX3D = hostMsi.data[3];
+                SI1MBX4D = hostMsi.data[4];
+                SI1MBX5D = hostMsi.data[5];
+                host_SI1MBX6D = hostMsi.data[6];
+            }
+            host_SI1MBXSbits.DTRDYA = HostMsiReady(&hostMsi.readyA);
+            host_SI1MBXSbits.DTRDYB = HostMsiReady(&hostMsi.readyB);
+        break;
+        case HOST_SFR_ID_SI1MBX6D:
+            /* Read of the last register of block A */
+            HostMsiReadySet(&hostMsi.readyA, 0);
+        break;
+        case HOST_SFR_ID_SI1MBX15D:
+            msiFeedbackPending = 1;
+        break;
+        case HOST_SFR_ID_TMR1:
+            host_TMR1 = (uint16_t)((uint64_t)(HostPortNow() / timer1Tick) %
+                                                        (PR1 + 1));
+        break;
+        default:
+        break;
+    }
+}
+
+static void IsrStart(void)
+{
+    HostAdcRun(&adc, hostCore.entry);
+}
+
+static int PWM(int generator, HOST_PWM_T *pPwm)
+{
+    const PORT_PWM_T *pGen;
+    uint16_t iocon;
+    int i;
+
+    memset(pPwm, 0, sizeof(*pPwm));
+    if ((generator < 1) || (generator > PORT_GENERATORS) ||
+        (pwmGenerator[generator - 1].on == NULL))
+    {
+        return 0;
+    }
+    pGen = &pwmGenerator[generator - 1];
+    if (*pGen->on == 0)
+    {
+        return 0;
+    }
+    pPwm->on = 1;
+    pPwm->centered = (*pGen->modsel == PORT_CENTER_ALIGNED);
+    pPwm->complementary = (*pGen->pmod == 0);
+    pPwm->period = (*pGen->mpersel ? MPER : *pGen->per) + 1;
+    pPwm->duty = *pGen->mdcsel ? MDC : *pGen->dc;
+    pPwm->deadTimeH = *pGen->dth;
+    pPwm->deadTimeL = *pGen->dtl;
+    iocon = *pGen->iocon;
+    pPwm->overrideH = (iocon >> PORT_IOCONL_OVRENH) & 1;
+    pPwm->overrideL = (iocon >> PORT_IOCONL_OVRENL) & 1;
+    pPwm->overrideDataH = (iocon >> (PORT_IOCONL_OVRDAT + 1)) & 1;
+    pPwm->overrideDataL = (iocon >> PORT_IOCONL_OVRDAT) & 1;
+    for (i = 0; i < 3; i++)
+    {
+        pPwm->trig[i] = *pGen->trig[i];
+        pPwm->adTrig1 |= (*pGen->tr1en[i] != 0) << i;
+        pPwm->adTrig2 |= (*pGen->tr2en[i] != 0) << i;
+    }
+    pPwm->adTrig1Postscale = *pGen->tr1ps + 1;
+    pPwm->cycle = pPwm->centered ? 2 * pPwm->period : pPwm->period;
+    if ((*pGen->socs == PORT_SYNC_SOCS) && (generator == PORT_SYNC_GENERATOR))
+    {
+        pPwm->syncIn = (PG5SPCILbits.PSS == PORT_SYNC_PSS);
+    }
+    else if (*pGen->socs == PORT_SYNC_SOCS)
+    {
+        HOST_PWM_T sync;
+
+        if (PWM(PORT_SYNC_GENERATOR, &sync) == 0)
+        {
+            return 0;
+        }
+        pPwm->cycle = sync.cycle;
+        pPwm->offset = *pGen->pps ? sync.duty : 0;
+        pPwm->syncIn = sync.syncIn;
+    }
+    return 1;
+}
+
+static void Start(HOST_ANALOG_T analog, void *context)
+{
+    static const double timer1Prescaler[] = {1, 8, 64, 256};
+
+    /* Status of registers without a model */
+    ADCON5Lbits.C0RDY = 1;
+    ADCON5Lbits.C1RDY = 1;
+    ADCON5Lbits.SHRRDY = 1;
+    OSCCONbits.LOCK = 1;
+
+    hostCore.tcy = 1.0 / FCY;
+    hostCore.isrStart = IsrStart;
+    hostCore.isrEnd = MsiCommit;
+    adcChannel[4].vector = HostPortVectorAdd("_ADCAN15Interrupt",
+                            _ADCAN15Interrupt, &_ADCAN15IE, &_ADCAN15IP);
+    adcChannel[5].vector = HostPortVectorAdd("_ADCAN18Interrupt",
+                            _ADCAN18Interrupt, &_ADCAN18IE, &_ADCAN18IP);
+    pTimer1Vector = HostPortVectorAdd("_T1Interrupt", _T1Interrupt,
+                                      &_T1IE, &_T1IP);
+    HostAdcInit(&adc, analog, context);
+
+    HostPortStart(HostFirmwareMain);
+
+    /* TAD = 2 * SHRADCS (at least 2) source clocks of FP / (CLKDIV + 1) */
+    adc.tad = (ADCON3Hbits.CLKDIV + 1) * 2.0 *
+                    (ADCON2Lbits.SHRADCS ? ADCON2Lbits.SHRADCS : 1) / FCY;
+    timer1Tick = timer1Prescaler[T1CONbits.TCKPS & 3] / FCY;
+    if (T1CONbits.TON)
+    {
+        timer1Next = (PR1 + 1) * timer1Tick;
+    }
+}
+
+static double Next(void)
+{
+    double next = HostAdcNext(&adc);
+    double entry = HostPortNext();
+
+    if (entry < next)
+    {
+        next = entry;
+    }
+    if (timer1Next < next)
+    {
+        next = timer1Next;
+    }
+    return next;
+}
+
+static void Run(double t)
+{
+    double next;
+
+    while ((next = Next()) <= t)
+    {
+        if (HostAdcNext(&adc) == next)
+        {
+            HostAdcRun(&adc, next);
+        }
+        else if (timer1Next == next)
+        {
+            HostPortRequest(pTimer1Vector, next);
+            timer1Next += (PR1 + 1) * timer1Tick;
+        }
+        else
+        {
+            HostPortRun(next);
+        }
+    }
+}
+
+static void AdcTrigger(int generator, int trigger, double t)
+{
+    if ((generator < 1) || (generator > PORT_GENERATORS) ||
+        (trigger < 1) || (trigger > 2))
+    {
+        return;
+    }
+    Run(t);
+    HostAdcTrigger(&adc, pwmTriggerSource[generator - 1][trigger - 1], t);
+}
+
+static const HOST_PROBE_T *Probe(const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(probe) / sizeof(probe[0]); i++)
+    {
+        if (strcmp(probe[i].name, name) == 0)
+        {
+            return &probe[i];
+        }
+    }
+    return NULL;
+}
+
+static void *Symbol(const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(symbol) / sizeof(symbol[0]); i++)
+    {
+        if (strcmp(symbol[i].name, name) == 0)
+        {
+            return symbol[i].address;
+        }
+    }
+    return NULL;
+}
+
+const HOST_IMAGE_T hostImage =
+{
+    .core = "secondary",
+    .fcy = FCY,
+    .pwmClock = FOSC,
+    .pwmGenerators = PORT_GENERATORS,
+    .start = Start,
+    .next = Next,
+    .run = Run,
+    .adcTrigger = AdcTrigger,
+    .pwm = PWM,
+    .isrStats = HostPortIsrStats,
+    .probe = Probe,
+    .symbol = Symbol,
+};
@@ -0,0 +1,103 @@
+/**
+ * @file afe.c
+ *
+ * @brief Analog front end of the board, see afe.h.
+ */
+#include <math.h>
+#include <stdint.h>
+
+#include "afe.h"
+#include "host_periph.h"
+#include "sim.h"
+
+#define AFE_CODE_MAX    4095
+#define AFE_CODE_ZERO   2048
+
+/* Gaussian noise (LSB) of the ADC, xorshift32 and Box-Muller */
+static double Noise(SIM_T *pSim)
+{
+    double u1, u2;
+
+    if (pSim->noise <= 0)
+    {
+        return 0;
+    }
+    pSim->random ^= pSim->random << 13;
+    pSim->random ^= pSim->random >> 17;
+    pSim->random ^= pSim->random << 5;
+    u1 = (pSim->random + 1.0) / 4294967297.0;
+    pSim->random ^= pSim->random << 13;
+    pSim->random ^= pSim->random >> 17;
+    pSim->random ^= pSim->random << 5;
+    u2 = pSim->random / 4294967296.0;
+    return pSim->noise * sqrt(-2 * log(u1)) * cos(2 * M_PI * u2);
+}
+
+static uint16_t Code(SIM_T *pSim, double code)
+{
+    code = floor(code + Noise(pSim) + 0.5);
+    if (code < 0)
+    {
+        return 0;
+    }
+    if (code > AFE_CODE_MAX)
+    {
+        return AFE_CODE_MAX;
+    }
+    return (uint16_t)code;
+}
+
+uint16_t AfeSecondary(void *context, int channel, double t)
+{
+    SIM_T *pSim = context;
+    const PLANT_T *pPlant = &pSim->plant;
+    const double currentGain = AFE_CODE_ZERO / AFE_PEAK_CURRENT;
+
+    (void)t;
+    switch (channel)
+    {
+        case HOST_AN(0):
+        case HOST_AN(1):
+            return Code(pSim, AFE_CODE_ZERO -
+                        pPlant->motor[0].iShunt[channel] * currentGain);
+        case HOST_ANA(0):
+        case HOST_ANA(1):
+            return Code(pSim, AFE_CODE_ZERO -
+                pPlant->motor[1].iShunt[channel - HOST_ANA(0)] * currentGain);
+        case HOST_AN(10):
+            return Code(pSim, pPlant->vdc / AFE_PEAK_VOLTAGE_MC *
+                                                    (AFE_CODE_MAX + 1));
+        case HOST_AN(13):
+            return Code(pSim, AFE_CODE_ZERO +
+                                    pPlant->motor[0].iDc * currentGain);
+        case HOST_AN(18):
+            return Code(pSim, AFE_CODE_ZERO +
+                                    pPlant->motor[1].iDc * currentGain);
+        case HOST_AN(15):
+            return Code(pSim, pSim->pot * AFE_CODE_MAX);
+        default:
+            return 0;
+    }
+}
+
+uint16_t AfeMain(void *context, int channel, double t)
+{
+    SIM_T *pSim = context;
+    const PLANT_T *pPlant = &pSim->plant;
+
+    (void)t;
+    switch (channel)
+    {
+        case HOST_AN(0):
+            return Code(pSim, AFE_CODE_ZERO +
+                        pPlant->vac / AFE_PEAK_VOLTAGE_PFC * AFE_CODE_ZERO);
+        case HOST_AN(11):
+            return Code(pSim, AFE_CODE_ZERO +
+                        pPlant->iL / AFE_PFC_PEAK_CURRENT * AFE_CODE_ZERO);
+        case HOST_AN(12):
+            return Code(pSim, pPlant->vdc / AFE_PEAK_VOLTAGE_PFC *
+                                                    (AFE_CODE_MAX + 1));
+        default:
+            return 0;
+    }
+}
@@ -0,0 +1,36 @@
+/**
+ * @file afe.h
+ *
+ * @brief Analog front end of the board : 12 bit ADC codes of the plant
+ *        signals at the analog inputs of each core.
+ *
+ * Secondary core : phase currents of the low side shunts (AN0, AN1 motor 1,
+ * ANA0, ANA1 motor 2, inverting amplifier), DC link current (AN13, AN18),
+ * DC link voltage (AN10) and the potentiometer (AN15).
+ * Main core : line voltage (AN0), inductor current (AN11) and DC link
+ * voltage (AN12).
+ * Gains are the board peak values of the firmware (MCx_PEAK_CURRENT,
+ * MCx_PEAK_VOLTAGE, PFC_INPUT_MAX_CURRENT, PFC_VOLTAGE_BASE).
+ */
+#ifndef AFE_H
+#define AFE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AFE_PEAK_CURRENT        22.0    /* A at full scale (bipolar) */
+#define AFE_PEAK_VOLTAGE_MC     453.3   /* V at full scale, Secondary */
+#define AFE_PEAK_VOLTAGE_PFC    453.0   /* V at full scale, Main */
+#define AFE_PFC_PEAK_CURRENT    22.0
+
+uint16_t AfeSecondary(void *context, int channel, double t);
+uint16_t AfeMain(void *context, int channel, double t);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AFE_H */
@@ -0,0 +1,761 @@
+/**
+ * @file hostsim.c
+ *
+ * @brief Scenario runner : runs one scenario of the board on the firmware
+ *        images and writes its measurements as JSON (json.h) to stdout.
+ *
+ * Usage : hostsim <scenario> [image ...]
+ *         hostsim --list
+ *
+ * An image replaces the default image of its core in the scenario, or adds
+ * its core to the simulation.
+ *
+ * The simulation is deterministic (fixed noise seed) : the output of two
+ * builds, or of two variants of an image, compares with diff. Exit status
+ * 1 if the scenario fails its criteria (fault, no closed loop, no
+ * settling, power factor), 2 on a usage error. Images are started once per
+ * process : a scenario runs in its own process.
+ *
+ * Speeds are mechanical rpm of motor 1, times in seconds from the start of
+ * the PWM. Measurements are taken on the plant (metrics.h), the firmware
+ * is only read for its state and for the estimated angle.
+ */
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_msi.h"
+#include "json.h"
+#include "metrics.h"
+#include "sim.h"
+
+#define HOSTSIM_SAMPLE_TIME     50.0e-6 /* Scenario sample, line analysis */
+#define HOSTSIM_MC1_VECTOR      "_ADCAN15Interrupt"
+#define HOSTSIM_FOC_CLOSE_LOOP  3       /* FOC_CLOSE_LOOP, foc_types.h */
+#define HOSTSIM_PFC_CTRL_RUN    3       /* PFC_CTRL_RUN, pfc.h */
+#define HOSTSIM_PFC_FAULT       4
+#define HOSTSIM_SPEED_BAND      0.02    /* Settled : +/-2 % of the target */
+#define HOSTSIM_VDC_BAND        0.02
+#define HOSTSIM_VDC_NOMINAL     380.0   /* PFC_OUPUT_VOLTAGE_NOMINAL */
+#define HOSTSIM_PF_MIN          0.9
+#define HOSTSIM_LINE_CYCLES     10
+#define HOSTSIM_BASE_LOAD       0.05    /* Nm, see MotorStart() */
+#define HOSTSIM_LOAD_STEP       0.2     /* Nm */
+#define HOSTSIM_FW_LOAD         0.3     /* Nm, see FWSweep() */
+#define HOSTSIM_FW_SPEED_RPM    2000.0
+#define HOSTSIM_RIPPLE_LOAD     0.3     /* Nm, see DcLinkRipple() */
+#define HOSTSIM_RIPPLE_RPM      1500.0
+#define HOSTSIM_RIPPLE_TIME     0.5
+#define HOSTSIM_MC1_PWM         0       /* Generators : PG1, PG6, PG4 */
+#define HOSTSIM_MC2_PWM         5
+#define HOSTSIM_PFC_PWM         3
+
+/* Speed scaling of MC1 (mc1_user_params.h) : Q15 of MC1_PEAK_SPEED_RPM,
+   potentiometer to target between MINIMUM_SPEED_RPM and MAXIMUM_SPEED_RPM
+   with the gain POT_NOM_FACTOR / 2^14 (saturates at 0.686) */
+#define HOSTSIM_PEAK_SPEED_RPM  7500.0
+#define HOSTSIM_MIN_SPEED_RPM   500.0
+#define HOSTSIM_MAX_SPEED_RPM   5000.0
+#define HOSTSIM_POT_GAIN        (23900.0 / 16384.0)
+#define HOSTSIM_PEAK_CURRENT    22.0    /* MC1_PEAK_CURRENT */
+
+typedef struct
+{
+    SIM_T sim;
+    JSON_T json;
+    int failures;
+
+    /* Probes read at each sample */
+    const HOST_PROBE_T *pFocState, *pMcFault, *pFocFault, *pTheta;
+    const HOST_PROBE_T *pPfcState;
+    int mc1Vector;                  /* -1 until found */
+
+    /* Time to closed loop from tRun */
+    double tRun;
+    double tClosedLoop;
+
+    int faultMC1;
+    int faultPFC;
+
+    /* Outer loops of the motors on the Main core : target velocity of the
+       supervisor (ENABLE_CROSS_CORE_SUPERVISOR) */
+    int outerLoopsMain;
+
+    /* MSI blocks : time from the commit of a block (data ready set) to its
+       read (cleared), at the end of the ISRs of the cores */
+    int msiReady[2];
+    double msiCommit[2];
+    long msiBlocks[2];
+    double msiDelaySum[2], msiDelayMax[2];
+
+    /* Active measurements */
+    METRICS_ANGLE_T angle;
+    int stepActive;
+    int stepVdc;                    /* Variable of the step : Vdc, speed */
+    METRICS_STEP_T step;
+    int lineActive;
+    METRICS_LINE_T line;
+    double vdcMin;
+} RUN_T;
+
+typedef struct
+{
+    const char *name;
+    const char *description;
+    const char *secondary;          /* Default images, NULL - core not */
+    const char *main;               /* simulated */
+    void (*run)(RUN_T *pRun);
+} SCENARIO_T;
+
+static double Rpm(const PLANT_T *pPlant)
+{
+    return pPlant->motor[0].speed * 60.0 / (2 * M_PI);
+}
+
+static double PotForSpeed(double rpm)
+{
+    return (rpm - HOSTSIM_MIN_SPEED_RPM) /
+            (HOSTSIM_MAX_SPEED_RPM - HOSTSIM_MIN_SPEED_RPM) / HOSTSIM_POT_GAIN;
+}
+
+static double TargetRpm(const RUN_T *pRun)
+{
+    if (pRun->outerLoopsMain)
+    {
+        return SimRead(&pRun->sim, SIM_MAIN, "supervisor.mc1.qTargetVelocity") *
+                                        HOSTSIM_PEAK_SPEED_RPM / 32768.0;
+    }
+    return SimRead(&pRun->sim, SIM_SECONDARY,
+                   "mc1Isr.controlScheme.ctrlParam.qTargetVelocity") *
+                                        HOSTSIM_PEAK_SPEED_RPM / 32768.0;
+}
+
+static void Fail(RUN_T *pRun, const char *criterion)
+{
+    fprintf(stderr, "hostsim: %s\n", criterion);
+    pRun->failures++;
+}
+
+static void Sample(SIM_T *pSim, void *context)
+{
+    RUN_T *pRun = context;
+    const PLANT_T *pPlant = &pSim->plant;
+
+    if (pRun->pFocState != NULL)
+    {
+        if ((pRun->tClosedLoop < 0) && (pRun->tRun >= 0) &&
+            (HostProbeRead(pRun->pFocState) == HOSTSIM_FOC_CLOSE_LOOP))
+        {
+            pRun->tClosedLoop = pSim->t - pRun->tRun;
+        }
+        if ((HostProbeRead(pRun->pMcFault) != 0) ||
+            (HostProbeRead(pRun->pFocFault) != 0))
+        {
+            pRun->faultMC1 = 1;
+        }
+    }
+    if ((pRun->pPfcState != NULL) &&
+        (HostProbeRead(pRun->pPfcState) == HOSTSIM_PFC_FAULT))
+    {
+        pRun->faultPFC = 1;
+    }
+    if (pRun->stepActive)
+    {
+        MetricsStepSample(&pRun->step, pSim->t,
+                          pRun->stepVdc ? pPlant->vdc : Rpm(pPlant));
+    }
+    if (pRun->lineActive && MetricsLineSample(&pRun->line, pPlant))
+    {
+        pRun->lineActive = 0;
+    }
+    if (pPlant->vdc < pRun->vdcMin)
+    {
+        pRun->vdcMin = pPlant->vdc;
+    }
+}
+
+/* Data ready flags of MSI blocks A (command) and B (feedback) */
+static void MsiSample(RUN_T *pRun, double t)
+{
+    const int ready[2] = {HostMsiReady(&hostMsi.readyA),
+                          HostMsiReady(&hostMsi.readyB)};
+    int k;
+
+    for (k = 0; k < 2; k++)
+    {
+        if (ready[k] && !pRun->msiReady[k])
+        {
+            pRun->msiCommit[k] = t;
+        }
+        else if (!ready[k] && pRun->msiReady[k])
+        {
+            const double delay = t - pRun->msiCommit[k];
+
+            pRun->msiBlocks[k]++;
+            pRun->msiDelaySum[k] += delay;
+            if (delay > pRun->msiDelayMax[k])
+            {
+                pRun->msiDelayMax[k] = delay;
+            }
+        }
+        pRun->msiReady[k] = ready[k];
+    }
+}
+
+/* Estimated angle of MC1 at the end of its control ISR, in closed loop */
+static void Isr(SIM_T *pSim, int core, int vector, void *context)
+{
+    RUN_T *pRun = context;
+
+    MsiSample(pRun, pSim->t);
+    if ((core != SIM_SECONDARY) || (pRun->pTheta == NULL))
+    {
+        return;
+    }
+    if (pRun->mc1Vector < 0)
+    {
+        HOST_ISR_STATS_T stats;
+
+        pSim->core[core].pImage->isrStats(vector, &stats);
+        if (strcmp(stats.name, HOSTSIM_MC1_VECTOR) != 0)
+        {
+            return;
+        }
+        pRun->mc1Vector = vector;
+    }
+    if ((vector == pRun->mc1Vector) &&
+        (HostProbeRead(pRun->pFocState) == HOSTSIM_FOC_CLOSE_LOOP))
+    {
+        MetricsAngleSample(&pRun->angle,
+                    HostProbeRead(pRun->pTheta) * M_PI / 32768.0,
+                    pSim->plant.motor[0].theta);
+    }
+}
+
+static void StepBegin(RUN_T *pRun, int vdc, double initial, double target,
+                      double band)
+{
+    MetricsStepBegin(&pRun->step, pRun->sim.t, initial, target, band);
+    pRun->stepVdc = vdc;
+    pRun->stepActive = 1;
+}
+
+/* Writes the step response as member key and checks that it settled */
+static void StepReport(RUN_T *pRun, const char *key, const char *unit)
+{
+    METRICS_STEP_RESULT_T result;
+    char name[32];
+
+    pRun->stepActive = 0;
+    MetricsStepResult(&pRun->step, &result);
+    JsonObjectBegin(&pRun->json, key);
+    snprintf(name, sizeof(name), "initial_%s", unit);
+    JsonNumber(&pRun->json, name, pRun->step.initial);
+    snprintf(name, sizeof(name), "target_%s", unit);
+    JsonNumber(&pRun->json, name, pRun->step.target);
+    JsonNumber(&pRun->json, "overshoot_pct", result.overshoot);
+    JsonNumber(&pRun->json, "settling_s", result.settlingTime);
+    snprintf(name, sizeof(name), "deviation_max_%s", unit);
+    JsonNumber(&pRun->json, name, result.deviationMax);
+    JsonObjectEnd(&pRun->json);
+    if (isnan(result.settlingTime))
+    {
+        Fail(pRun, "not settled");
+    }
+}
+
+static void LineRun(RUN_T *pRun)
+{
+    MetricsLineBegin(&pRun->line, &pRun->sim.plant, HOSTSIM_LINE_CYCLES);
+    pRun->lineActive = 1;
+    SimRun(&pRun->sim, pRun->line.tEnd + HOSTSIM_SAMPLE_TIME);
+    pRun->lineActive = 0;
+}
+
+static void LineReport(RUN_T *pRun, const char *key)
+{
+    METRICS_LINE_RESULT_T result;
+
+    MetricsLineResult(&pRun->line, &result);
+    JsonObjectBegin(&pRun->json, key);
+    JsonNumber(&pRun->json, "t_s", pRun->line.tStart);
+    JsonNumber(&pRun->json, "power_w", result.power);
+    JsonNumber(&pRun->json, "voltage_rms_v", result.voltageRms);
+    JsonNumber(&pRun->json, "current_rms_a", result.currentRms);
+    JsonNumber(&pRun->json, "power_factor", result.powerFactor);
+    JsonNumber(&pRun->json, "thd_pct", result.thd);
+    JsonNumber(&pRun->json, "vdc_mean_v", result.vdcMean);
+    JsonNumber(&pRun->json, "vdc_ripple_v", result.vdcRipple);
+    JsonNumber(&pRun->json, "cap_current_rms_a", result.capCurrentRms);
+    JsonObjectEnd(&pRun->json);
+    if (!(result.powerFactor >= HOSTSIM_PF_MIN))
+    {
+        Fail(pRun, "power factor");
+    }
+}
+
+/* Runs MC1 from standstill to closed loop at rpm, settled at tSettled.
+   The motor drives HOSTSIM_BASE_LOAD (friction of the driven machine) : at
+   no load the phase currents stay within the dead time distortion of the
+   inverter, and the estimator loses the angle from about 1500 rpm. */
+static void MotorStart(RUN_T *pRun, double rpm, double tSettled)
+{
+    pRun->sim.plant.motor[0].loadTorque = HOSTSIM_BASE_LOAD;
+    JsonNumber(&pRun->json, "base_load_nm", HOSTSIM_BASE_LOAD);
+    pRun->sim.pot = PotForSpeed(rpm);
+    SimRun(&pRun->sim, 0.2);
+    pRun->tRun = pRun->sim.t;
+    SimButton(&pRun->sim, 1, 0.1);
+    while ((pRun->tClosedLoop < 0) && (pRun->sim.t < pRun->tRun + 5.0) &&
+           !pRun->faultMC1)
+    {
+        SimRun(&pRun->sim, pRun->sim.t + 0.01);
+    }
+    JsonNumber(&pRun->json, "time_to_closed_loop_s",
+               (pRun->tClosedLoop < 0) ? NAN : pRun->tClosedLoop);
+    if (pRun->tClosedLoop < 0)
+    {
+        Fail(pRun, "no closed loop");
+        return;
+    }
+    StepBegin(pRun, 0, Rpm(&pRun->sim.plant), TargetRpm(pRun),
+              HOSTSIM_SPEED_BAND * TargetRpm(pRun));
+    SimRun(&pRun->sim, tSettled);
+    StepReport(pRun, "start", "rpm");
+}
+
+/* Speed step of the potentiometer, speed settled at tSettled */
+static void SpeedStep(RUN_T *pRun, const char *key, double rpm,
+                      double tSettled)
+{
+    const double initial = Rpm(&pRun->sim.plant);
+    const double t = pRun->sim.t;
+
+    pRun->sim.pot = PotForSpeed(rpm);
+    /* Potentiometer filter and command to the ISR */
+    SimRun(&pRun->sim, t + 0.05);
+    StepBegin(pRun, 0, initial, TargetRpm(pRun),
+              HOSTSIM_SPEED_BAND * TargetRpm(pRun));
+    pRun->step.tStart = t;
+    SimRun(&pRun->sim, tSettled);
+    StepReport(pRun, key, "rpm");
+}
+
+static void ColdStart(RUN_T *pRun)
+{
+    MotorStart(pRun, 1000.0, 7.0);
+}
+
+static void SpeedStepScenario(RUN_T *pRun)
+{
+    MotorStart(pRun, 1000.0, 7.0);
+    SpeedStep(pRun, "speed_step", 1500.0, 11.5);
+}
+
+/* Speed step with the outer loops (ramp, speed and flux weakening 
+   controllers) of the motors on the Main core, every 1 ms : compares with
+   speed_step run with the main image. Reported : commands the Secondary
+   core had not read when the next one was due (missed), time from the
+   commit of a command to its read by the Secondary core and age of the
+   feedback when the Main core reads it; the delay of the outer loops is
+   the sum. */
+static void XcoreSpeedStep(RUN_T *pRun)
+{
+    static const char *const key[2][2] =
+    {
+        {"command_delay_mean_us", "command_delay_max_us"},
+        {"feedback_age_mean_us", "feedback_age_max_us"},
+    };
+    int k;
+
+    pRun->outerLoopsMain = 1;
+    SpeedStepScenario(pRun);
+    JsonObjectBegin(&pRun->json, "msi");
+    JsonInteger(&pRun->json, "commands_missed", (int64_t)SimRead(&pRun->sim,
+                                    SIM_MAIN, "supervisor.commandMissed"));
+    for (k = 0; k < 2; k++)
+    {
+        JsonNumber(&pRun->json, key[k][0],
+                   pRun->msiDelaySum[k] / pRun->msiBlocks[k] * 1.0e6);
+        JsonNumber(&pRun->json, key[k][1], pRun->msiDelayMax[k] * 1.0e6);
+    }
+    JsonObjectEnd(&pRun->json);
+}
+
+static void LoadStep(RUN_T *pRun)
+{
+    double target;
+
+    MotorStart(pRun, 1000.0, 7.0);
+    target = TargetRpm(pRun);
+    StepBegin(pRun, 0, target, target, HOSTSIM_SPEED_BAND * target);
+    JsonNumber(&pRun->json, "load_step_nm", HOSTSIM_LOAD_STEP);
+    pRun->sim.plant.motor[0].loadTorque += HOSTSIM_LOAD_STEP;
+    SimRun(&pRun->sim, 9.0);
+    StepReport(pRun, "load_step", "rpm");
+}
+
+/* Speed ramp into field weakening. The back EMF of the motor at 5000 rpm is
+   half the field weakening voltage reference of the firmware, the default
+   image never weakens the field : the fw image (CMakeLists.txt) lowers the
+   reference (FW_VOLTAGE_REF_FACTOR) so that field weakening starts at about
+   1500 rpm. The ramp runs at HOSTSIM_FW_LOAD : at the base load the phase
+   currents are within the dead time distortion and the estimator loses the
+   angle under field weakening (see MotorStart()). */
+static void FWSweep(RUN_T *pRun)
+{
+    SIM_T *pSim = &pRun->sim;
+    const double peak = HOSTSIM_PEAK_CURRENT / 32768.0;
+    double idRefMin = 0, rpmFW = NAN, rpmMax = 0;
+
+    MotorStart(pRun, 1000.0, 7.0);
+    JsonNumber(&pRun->json, "load_nm", HOSTSIM_FW_LOAD);
+    pSim->plant.motor[0].loadTorque = HOSTSIM_FW_LOAD;
+    pSim->pot = PotForSpeed(HOSTSIM_FW_SPEED_RPM);
+    while ((pSim->t < 13.0) && !pRun->faultMC1)
+    {
+        const double idRef = SimRead(pSim, SIM_SECONDARY,
+                        "mc1Isr.controlScheme.ctrlParam.qIdRef") * peak;
+
+        SimRun(pSim, pSim->t + 0.01);
+        if (idRef < idRefMin)
+        {
+            idRefMin = idRef;
+        }
+        if (isnan(rpmFW) && (idRef < -0.1))
+        {
+            rpmFW = Rpm(&pSim->plant);
+        }
+        if (Rpm(&pSim->plant) > rpmMax)
+        {
+            rpmMax = Rpm(&pSim->plant);
+        }
+    }
+    JsonObjectBegin(&pRun->json, "fw_sweep");
+    JsonNumber(&pRun->json, "target_rpm", TargetRpm(pRun));
+    JsonNumber(&pRun->json, "speed_max_rpm", rpmMax);
+    JsonNumber(&pRun->json, "speed_fw_start_rpm", rpmFW);
+    JsonNumber(&pRun->json, "id_ref_min_a", idRefMin);
+    JsonNumber(&pRun->json, "speed_error_rpm",
+               Rpm(&pSim->plant) - TargetRpm(pRun));
+    JsonObjectEnd(&pRun->json);
+    if (isnan(rpmFW))
+    {
+        Fail(pRun, "no field weakening");
+    }
+}
+
+/* Waits for the PFC control to start, then measures the DC link voltage
+   step to its reference and the line quality at the load of the plant */
+static void PfcStart(RUN_T *pRun, double tSettled)
+{
+    SIM_T *pSim = &pRun->sim;
+
+    while ((HostProbeRead(pRun->pPfcState) != HOSTSIM_PFC_CTRL_RUN) &&
+           (pSim->t < 1.0) && !pRun->faultPFC)
+    {
+        SimRun(pSim, pSim->t + 0.001);
+    }
+    JsonNumber(&pRun->json, "time_to_control_s", pSim->t);
+    StepBegin(pRun, 1, pSim->plant.vdc, HOSTSIM_VDC_NOMINAL,
+              HOSTSIM_VDC_BAND * HOSTSIM_VDC_NOMINAL);
+    SimRun(pSim, tSettled);
+    StepReport(pRun, "soft_start", "v");
+}
+
+static void PfcSoftStart(RUN_T *pRun)
+{
+    pRun->sim.plant.auxPower = 300.0;
+    JsonNumber(&pRun->json, "load_w", pRun->sim.plant.auxPower);
+    PfcStart(pRun, 2.5);
+    LineRun(pRun);
+    LineReport(pRun, "line");
+}
+
+/* 230 V line sagging to 70 % (161 V, above the input undervoltage limit)
+   for 0.5 s at 500 W */
+static void LineSag(RUN_T *pRun)
+{
+    SIM_T *pSim = &pRun->sim;
+
+    pSim->plant.auxPower = 500.0;
+    JsonNumber(&pRun->json, "load_w", pSim->plant.auxPower);
+    JsonNumber(&pRun->json, "sag_scale", 0.7);
+    PfcStart(pRun, 2.5);
+    LineRun(pRun);
+    LineReport(pRun, "line_nominal");
+    StepBegin(pRun, 1, HOSTSIM_VDC_NOMINAL, HOSTSIM_VDC_NOMINAL,
+              HOSTSIM_VDC_BAND * HOSTSIM_VDC_NOMINAL);
+    pRun->vdcMin = pSim->plant.vdc;
+    pSim->plant.lineScale = 0.7;
+    SimRun(pSim, pRun->step.tStart + 0.5 - HOSTSIM_LINE_CYCLES /
+                                        pSim->plant.lineFrequency);
+    LineRun(pRun);
+    LineReport(pRun, "line_sag");
+    pSim->plant.lineScale = 1.0;
+    SimRun(pSim, pSim->t + 1.0);
+    JsonNumber(&pRun->json, "vdc_min_v", pRun->vdcMin);
+    StepReport(pRun, "vdc", "v");
+}
+
+/* Carrier phase of generator n of a core from generator PG1 of the
+   Secondary core, 0 to 1 of the period of generator n */
+static double CarrierPhase(const SIM_T *pSim, int core, int n)
+{
+    const PWM_GENERATOR_T *pRef =
+                    &pSim->core[SIM_SECONDARY].pwm.generator[HOSTSIM_MC1_PWM];
+    const PWM_GENERATOR_T *pGen = &pSim->core[core].pwm.generator[n];
+    const double period = pGen->end - pGen->start;
+    double phase = fmod(pGen->start - pRef->start, period) / period;
+
+    return (phase < 0) ? phase + 1.0 : phase;
+}
+
+/* Ripple current of the DC link capacitor with both motors loaded and the
+   PFC in control : compare the carrier phase of MC2 (MC2_PWM_PHASE_DEG,
+   pwm.h of the Secondary core) and of the PFC (PFC_MC_SYNC_PHASE_DEG, pwm.h
+   of the Main core) of the images. The capacitor carries the inverter
+   current less the boost diode current : their covariance is the part of
+   the inverter current the PFC supplies directly. */
+static void DcLinkRipple(RUN_T *pRun)
+{
+    SIM_T *pSim = &pRun->sim;
+    const HOST_PROBE_T *pState2;
+    METRICS_DCLINK_T dcLink;
+    METRICS_DCLINK_RESULT_T result;
+    double tRun2;
+    int n;
+
+    PfcStart(pRun, 2.5);
+    MotorStart(pRun, HOSTSIM_RIPPLE_RPM, 10.0);
+    pState2 = SimProbe(pSim, SIM_SECONDARY, "mc2Isr.controlScheme.focState");
+    tRun2 = pSim->t;
+    pSim->plant.motor[1].loadTorque = HOSTSIM_BASE_LOAD;
+    SimButton(pSim, 2, 0.1);
+    while ((HostProbeRead(pState2) != HOSTSIM_FOC_CLOSE_LOOP) &&
+           (pSim->t < tRun2 + 5.0) && !pRun->faultMC1)
+    {
+        SimRun(pSim, pSim->t + 0.01);
+        fprintf(stderr, "DBGS t %.2f st %g rpm %g id %g iq %g ol %g\n", pSim->t, HostProbeRead(pState2), pSim->plant.motor[1].speed*60/2/M_PI, SimRead(pSim, SIM_SECONDARY, "mc2Isr.controlScheme.idq.d"), SimRead(pSim, SIM_SECONDARY, "mc2Isr.controlScheme.idq.q"), SimRead(pSim, SIM_SECONDARY, "mc2Isr.controlScheme.ctrlParam.openLoop"));
+    }
+    if (HostProbeRead(pState2) != HOSTSIM_FOC_CLOSE_LOOP)
+    {
+        Fail(pRun, "no closed loop of MC2");
+        return;
+    }
+    /* MC2 accelerates to its target, then the load of both motors ramps up
+       in 1 s */
+    while ((fabs(pSim->plant.motor[1].speed * 60.0 / (2 * M_PI) -
+                 HOSTSIM_RIPPLE_RPM) > HOSTSIM_SPEED_BAND * HOSTSIM_RIPPLE_RPM) &&
+           (pSim->t < tRun2 + 10.0)) { SimRun(pSim, pSim->t + 0.1); fprintf(stderr, "DBG0 t %.2f st %g rpm %g\n", pSim->t, HostProbeRead(pState2), pSim->plant.motor[1].speed*60/2/M_PI); }
+    SimRun(pSim, pSim->t + 0.5);
+    JsonNumber(&pRun->json, "load_nm", HOSTSIM_RIPPLE_LOAD);
+    for (n = 1; n <= 100; n++)
+    {
+        pSim->plant.motor[0].loadTorque = HOSTSIM_BASE_LOAD +
+                        (HOSTSIM_RIPPLE_LOAD - HOSTSIM_BASE_LOAD) * n / 100;
+        pSim->plant.motor[1].loadTorque = pSim->plant.motor[0].loadTorque;
+        SimRun(pSim, pSim->t + 0.01);
+        if (n % 10 == 0) fprintf(stderr, "DBG1 t %.2f st %g iq %g rpm %g\n", pSim->t, HostProbeRead(pState2), SimRead(pSim, SIM_SECONDARY, "mc2Isr.controlScheme.idq.q"), pSim->plant.motor[1].speed*60/2/M_PI);
+    }
+    SimRun(pSim, pSim->t + 1.0);
+
+    MetricsDcLinkBegin(&dcLink, &pSim->plant);
+    while (pSim->t < dcLink.tStart + HOSTSIM_RIPPLE_TIME) { SimRun(pSim, pSim->t + 0.05); fprintf(stderr, "DBG t %.2f st %g app %g flt %g iq %g iqref %g rpm %g\n", pSim->t, HostProbeRead(pState2), SimRead(pSim, SIM_SECONDARY, "mc2.appState"), SimRead(pSim, SIM_SECONDARY, "mc2.fault.faultState"), SimRead(pSim, SIM_SECONDARY, "mc2Isr.controlScheme.idq.q"), SimRead(pSim, SIM_SECONDARY, "mc2Isr.controlScheme.ctrlParam.qIqRef"), pSim->plant.motor[1].speed*60/2/M_PI); }
+    MetricsDcLinkResult(&dcLink, &pSim->plant, &result);
+    if ((HostProbeRead(pState2) != HOSTSIM_FOC_CLOSE_LOOP) ||
+        (pSim->plant.motor[1].speed <= 0))
+    {
+        Fail(pRun, "MC2 lost the angle");
+    }
+
+    JsonObjectBegin(&pRun->json, "dc_link");
+    JsonNumber(&pRun->json, "mc2_phase_deg", 360.0 *
+                CarrierPhase(pSim, SIM_SECONDARY, HOSTSIM_MC2_PWM));
+    JsonNumber(&pRun->json, "pfc_sync_phase_deg", 360.0 *
+                fmod(1.0 - CarrierPhase(pSim, SIM_MAIN, HOSTSIM_PFC_PWM), 1.0));
+    JsonNumber(&pRun->json, "mc1_rpm", Rpm(&pSim->plant));
+    JsonNumber(&pRun->json, "mc2_rpm",
+               pSim->plant.motor[1].speed * 60.0 / (2 * M_PI));
+    JsonNumber(&pRun->json, "vdc_v", pSim->plant.vdc);
+    JsonNumber(&pRun->json, "inverter_ripple_rms_a",
+               result.inverterRippleRms);
+    JsonNumber(&pRun->json, "boost_inverter_covariance_a2",
+               result.covariance);
+    JsonNumber(&pRun->json, "cap_current_rms_a", result.capCurrentRms);
+    JsonObjectEnd(&pRun->json);
+}
+
+static const SCENARIO_T scenario[] =
+{
+    {"cold_start", "MC1 start to 1000 rpm", "secondary", NULL, ColdStart},
+    {"speed_step", "MC1 1000 to 1500 rpm", "secondary", NULL,
+     SpeedStepScenario},
+    {"xcore_speed_step", "MC1 1000 to 1500 rpm, outer loops on the Main core",
+     "xcore", "xcore_main", XcoreSpeedStep},
+    {"load_step", "MC1 0.2 Nm load step at 1000 rpm", "secondary", NULL,
+     LoadStep},
+    {"fw_sweep", "MC1 ramp to 2000 rpm, field weakening", "fw", NULL,
+     FWSweep},
+    {"pfc_soft_start", "PFC soft start into 300 W", NULL, "main",
+     PfcSoftStart},
+    {"line_sag", "PFC at 500 W, line sag to 70 % for 0.5 s", NULL, "main",
+     LineSag},
+    {"dclink_ripple", "MC1 and MC2 at 1500 rpm and 0.3 Nm with the PFC, DC "
+     "link ripple", "dual", "main", DcLinkRipple},
+};
+
+#define HOSTSIM_SCENARIOS   (sizeof(scenario) / sizeof(scenario[0]))
+
+static void IsrReport(RUN_T *pRun)
+{
+    static const char *const coreName[SIM_CORES] = {"secondary", "main"};
+    int core, n;
+
+    JsonArrayBegin(&pRun->json, "isr");
+    for (core = 0; core < SIM_CORES; core++)
+    {
+        const HOST_IMAGE_T *pImage = pRun->sim.core[core].pImage;
+        HOST_ISR_STATS_T stats;
+
+        for (n = 0; (pImage != NULL) && pImage->isrStats(n, &stats); n++)
+        {
+            JsonObjectBegin(&pRun->json, NULL);
+            JsonString(&pRun->json, "core", coreName[core]);
+            JsonString(&pRun->json, "vector", stats.name);
+            JsonInteger(&pRun->json, "count", stats.count);
+            JsonInteger(&pRun->json, "overrun", stats.overrun);
+            JsonNumber(&pRun->json, "cycles_mean", stats.cyclesMean);
+            JsonInteger(&pRun->json, "cycles_max", stats.cyclesMax);
+            JsonObjectEnd(&pRun->json);
+        }
+    }
+    JsonArrayEnd(&pRun->json);
+}
+
+static const HOST_IMAGE_T *Image(const char *name)
+{
+    const HOST_IMAGE_T *pImage = SimImage(name);
+
+    if (pImage == NULL)
+    {
+        fprintf(stderr, "hostsim: no image %s\n", name);
+        exit(2);
+    }
+    return pImage;
+}
+
+static void Usage(void)
+{
+    size_t i;
+
+    fprintf(stderr, "usage: hostsim <scenario> [image ...]\n"
+                    "       hostsim --list\nscenarios :\n");
+    for (i = 0; i < HOSTSIM_SCENARIOS; i++)
+    {
+        fprintf(stderr, "  %-16s %s\n", scenario[i].name,
+                scenario[i].description);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    static RUN_T run;
+    const SCENARIO_T *pScenario = NULL;
+    const char *secondary, *main;
+    double mean, rms, max;
+    size_t i;
+    int k;
+
+    if ((argc > 1) && (strcmp(argv[1], "--list") == 0))
+    {
+        for (i = 0; i < HOSTSIM_SCENARIOS; i++)
+        {
+            printf("%s\n", scenario[i].name);
+        }
+        return EXIT_SUCCESS;
+    }
+    for (i = 0; (argc > 1) && (i < HOSTSIM_SCENARIOS); i++)
+    {
+        if (strcmp(argv[1], scenario[i].name) == 0)
+        {
+            pScenario = &scenario[i];
+        }
+    }
+    if (pScenario == NULL)
+    {
+        Usage();
+        return 2;
+    }
+    secondary = pScenario->secondary;
+    main = pScenario->main;
+    for (k = 2; k < argc; k++)
+    {
+        if (strcmp(Image(argv[k])->core, "main") == 0)
+        {
+            main = argv[k];
+        }
+        else
+        {
+            secondary = argv[k];
+        }
+    }
+
+    SimInit(&run.sim, HOSTSIM_SAMPLE_TIME, Sample, Isr, &run);
+    run.tRun = -1;
+    run.tClosedLoop = -1;
+    run.mc1Vector = -1;
+    run.vdcMin = run.sim.plant.vdc;
+    JsonInit(&run.json, stdout);
+    JsonObjectBegin(&run.json, NULL);
+    JsonString(&run.json, "scenario", pScenario->name);
+    JsonObjectBegin(&run.json, "images");
+    if (main != NULL)
+    {
+        SimStart(&run.sim, Image(main));
+        JsonString(&run.json, "main", main);
+        run.pPfcState = SimProbe(&run.sim, SIM_MAIN, "pfcParam.state");
+    }
+    if (secondary != NULL)
+    {
+        SimStart(&run.sim, Image(secondary));
+        JsonString(&run.json, "secondary", secondary);
+        run.pFocState = SimProbe(&run.sim, SIM_SECONDARY,
+                                 "mc1Isr.controlScheme.focState");
+        run.pFocFault = SimProbe(&run.sim, SIM_SECONDARY,
+                                 "mc1Isr.controlScheme.faultStatus");
+        run.pMcFault = SimProbe(&run.sim, SIM_SECONDARY,
+                                "mc1.fault.faultState");
+        run.pTheta = SimProbe(&run.sim, SIM_SECONDARY,
+                              "mc1Isr.controlScheme.estimInterface.qTheta");
+    }
+    JsonObjectEnd(&run.json);
+
+    pScenario->run(&run);
+
+    JsonNumber(&run.json, "t_end_s", run.sim.t);
+    if (secondary != NULL)
+    {
+        MetricsAngleResult(&run.angle, &mean, &rms, &max);
+        JsonObjectBegin(&run.json, "angle_error_deg");
+        JsonNumber(&run.json, "mean", mean);
+        JsonNumber(&run.json, "rms", rms);
+        JsonNumber(&run.json, "max", max);
+        JsonObjectEnd(&run.json);
+        JsonBool(&run.json, "fault_mc1", run.faultMC1);
+    }
+    if (main != NULL)
+    {
+        JsonBool(&run.json, "fault_pfc", run.faultPFC);
+    }
+    IsrReport(&run);
+    if (run.faultMC1 || run.faultPFC)
+    {
+        Fail(&run, "fault");
+    }
+    JsonBool(&run.json, "pass", run.failures == 0);
+    JsonObjectEnd(&run.json);
+    return (run.failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
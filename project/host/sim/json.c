@@ -0,0 +1,125 @@
+/**
+ * @file json.c
+ *
+ * @brief JSON output of the scenario runner, see json.h.
+ */
+#include <inttypes.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "json.h"
+
+void JsonInit(JSON_T *pJson, FILE *pFile)
+{
+    pJson->pFile = pFile;
+    pJson->depth = 0;
+    pJson->members[0] = 0;
+}
+
+/* Separator, indentation and key of a member */
+static void Member(JSON_T *pJson, const char *key)
+{
+    if (pJson->members[pJson->depth]++ > 0)
+    {
+        fputc(',', pJson->pFile);
+    }
+    if (pJson->depth > 0)
+    {
+        fprintf(pJson->pFile, "\n%*s", 2 * pJson->depth, "");
+    }
+    if (key != NULL)
+    {
+        fprintf(pJson->pFile, "\"%s\": ", key);
+    }
+}
+
+static void Begin(JSON_T *pJson, const char *key, char open)
+{
+    Member(pJson, key);
+    fputc(open, pJson->pFile);
+    if (pJson->depth < JSON_DEPTH_MAX - 1)
+    {
+        pJson->depth++;
+    }
+    pJson->members[pJson->depth] = 0;
+}
+
+static void End(JSON_T *pJson, char close)
+{
+    const int empty = (pJson->members[pJson->depth] == 0);
+
+    if (pJson->depth > 0)
+    {
+        pJson->depth--;
+    }
+    if (!empty)
+    {
+        fprintf(pJson->pFile, "\n%*s", 2 * pJson->depth, "");
+    }
+    fputc(close, pJson->pFile);
+    if (pJson->depth == 0)
+    {
+        fputc('\n', pJson->pFile);
+    }
+}
+
+void JsonObjectBegin(JSON_T *pJson, const char *key)
+{
+    Begin(pJson, key, '{');
+}
+
+void JsonObjectEnd(JSON_T *pJson)
+{
+    End(pJson, '}');
+}
+
+void JsonArrayBegin(JSON_T *pJson, const char *key)
+{
+    Begin(pJson, key, '[');
+}
+
+void JsonArrayEnd(JSON_T *pJson)
+{
+    End(pJson, ']');
+}
+
+void JsonNumber(JSON_T *pJson, const char *key, double value)
+{
+    Member(pJson, key);
+    if (isfinite(value))
+    {
+        fprintf(pJson->pFile, "%.6g", value);
+    }
+    else
+    {
+        fputs("null", pJson->pFile);
+    }
+}
+
+void JsonInteger(JSON_T *pJson, const char *key, int64_t value)
+{
+    Member(pJson, key);
+    fprintf(pJson->pFile, "%" PRId64, value);
+}
+
+void JsonBool(JSON_T *pJson, const char *key, int value)
+{
+    Member(pJson, key);
+    fputs(value ? "true" : "false", pJson->pFile);
+}
+
+void JsonString(JSON_T *pJson, const char *key, const char *value)
+{
+    Member(pJson, key);
+    fputc('"', pJson->pFile);
+    for (; *value != '\0'; value++)
+    {
+        if ((*value == '"') || (*value == '\\'))
+        {
+            fputc('\\', pJson->pFile);
+        }
+        fputc(*value, pJson->pFile);
+    }
+    fputc('"', pJson->pFile);
+}
@@ -0,0 +1,43 @@
+/**
+ * @file json.h
+ *
+ * @brief JSON output of the scenario runner : one member per line, keys in
+ *        the order written and numbers with a fixed precision, so that the
+ *        results of two runs compare with diff.
+ */
+#ifndef JSON_H
+#define JSON_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define JSON_DEPTH_MAX      8
+
+typedef struct
+{
+    FILE *pFile;
+    int depth;
+    int members[JSON_DEPTH_MAX];     /* Members written at each depth */
+} JSON_T;
+
+/* key is NULL for an element of an array and for the top level value */
+void JsonInit(JSON_T *pJson, FILE *pFile);
+void JsonObjectBegin(JSON_T *pJson, const char *key);
+void JsonObjectEnd(JSON_T *pJson);
+void JsonArrayBegin(JSON_T *pJson, const char *key);
+void JsonArrayEnd(JSON_T *pJson);
+/* 6 significant digits, null if not finite */
+void JsonNumber(JSON_T *pJson, const char *key, double value);
+void JsonInteger(JSON_T *pJson, const char *key, int64_t value);
+void JsonBool(JSON_T *pJson, const char *key, int value);
+void JsonString(JSON_T *pJson, const char *key, const char *value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JSON_H */
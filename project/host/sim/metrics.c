@@ -0,0 +1,215 @@
+/**
+ * @file metrics.c
+ *
+ * @brief Measurements of the scenario runner, see metrics.h.
+ */
+#define _GNU_SOURCE     /* sincos */
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "metrics.h"
+
+void MetricsStepBegin(METRICS_STEP_T *pStep, double t, double initial,
+                      double target, double band)
+{
+    memset(pStep, 0, sizeof(*pStep));
+    pStep->tStart = t;
+    pStep->initial = initial;
+    pStep->target = target;
+    pStep->band = band;
+    pStep->peak = initial;
+    pStep->tOutside = t;
+    pStep->tLast = t;
+}
+
+void MetricsStepSample(METRICS_STEP_T *pStep, double t, double value)
+{
+    const double error = value - pStep->target;
+
+    if ((pStep->target >= pStep->initial) ? (value > pStep->peak) :
+                                            (value < pStep->peak))
+    {
+        pStep->peak = value;
+    }
+    pStep->inside = (fabs(error) <= pStep->band);
+    if (pStep->inside)
+    {
+        pStep->entered = 1;
+    }
+    else
+    {
+        pStep->tOutside = t;
+    }
+    if (pStep->entered && (fabs(error) > pStep->deviationMax))
+    {
+        pStep->deviationMax = fabs(error);
+    }
+    pStep->tLast = t;
+}
+
+void MetricsStepResult(const METRICS_STEP_T *pStep,
+                       METRICS_STEP_RESULT_T *pResult)
+{
+    const double step = pStep->target - pStep->initial;
+
+    pResult->overshoot = NAN;
+    if (step != 0)
+    {
+        pResult->overshoot = (pStep->peak - pStep->target) / step * 100.0;
+        if (pResult->overshoot < 0)
+        {
+            pResult->overshoot = 0;
+        }
+    }
+    pResult->settlingTime = pStep->inside ?
+                                pStep->tOutside - pStep->tStart : NAN;
+    pResult->deviationMax = pStep->deviationMax;
+}
+
+void MetricsAngleSample(METRICS_ANGLE_T *pAngle, double estimated,
+                        double actual)
+{
+    const double error = remainder(estimated - actual, 2 * M_PI);
+
+    pAngle->sum += error;
+    pAngle->squares += error * error;
+    if (fabs(error) > pAngle->max)
+    {
+        pAngle->max = fabs(error);
+    }
+    pAngle->samples++;
+}
+
+void MetricsAngleResult(const METRICS_ANGLE_T *pAngle, double *pMean,
+                        double *pRms, double *pMax)
+{
+    const double degrees = 180.0 / M_PI;
+
+    if (pAngle->samples == 0)
+    {
+        *pMean = *pRms = *pMax = NAN;
+        return;
+    }
+    *pMean = pAngle->sum / pAngle->samples * degrees;
+    *pRms = sqrt(pAngle->squares / pAngle->samples) * degrees;
+    *pMax = pAngle->max * degrees;
+}
+
+void MetricsLineBegin(METRICS_LINE_T *pLine, const PLANT_T *pPlant,
+                      int cycles)
+{
+    memset(pLine, 0, sizeof(*pLine));
+    pLine->tStart = pPlant->t;
+    pLine->tEnd = pPlant->t + cycles / pPlant->lineFrequency;
+    pLine->t = pPlant->t;
+    pLine->charge = pPlant->lineCharge;
+    pLine->energy = pLine->energyStart = pPlant->lineEnergy;
+    pLine->capSquare = pLine->capSquareStart = pPlant->capCurrentSquare;
+    pLine->vdcMin = pLine->vdcMax = pPlant->vdc;
+}
+
+int MetricsLineSample(METRICS_LINE_T *pLine, const PLANT_T *pPlant)
+{
+    const double dt = pPlant->t - pLine->t;
+    const double omega = 2 * M_PI * pPlant->lineFrequency;
+    /* Mean current of the interval, at its middle */
+    const double phase = omega * (pPlant->t - 0.5 * dt - pLine->tStart);
+    double current;
+    int h;
+
+    if ((pLine->t >= pLine->tEnd) || (dt <= 0))
+    {
+        return (pLine->t >= pLine->tEnd);
+    }
+    current = (pPlant->lineCharge - pLine->charge) / dt;
+    pLine->voltageSquares += pPlant->vac * pPlant->vac * dt;
+    pLine->currentSquares += current * current * dt;
+    for (h = 1; h <= METRICS_HARMONICS; h++)
+    {
+        double s, c;
+
+        sincos(h * phase, &s, &c);
+        pLine->re[h] += current * c * dt;
+        pLine->im[h] += current * s * dt;
+    }
+    if (pPlant->vdc < pLine->vdcMin)
+    {
+        pLine->vdcMin = pPlant->vdc;
+    }
+    if (pPlant->vdc > pLine->vdcMax)
+    {
+        pLine->vdcMax = pPlant->vdc;
+    }
+    pLine->vdcSum += pPlant->vdc * dt;
+    pLine->t = pPlant->t;
+    pLine->charge = pPlant->lineCharge;
+    pLine->energy = pPlant->lineEnergy;
+    pLine->capSquare = pPlant->capCurrentSquare;
+    pLine->samples++;
+    return (pLine->t >= pLine->tEnd);
+}
+
+void MetricsLineResult(const METRICS_LINE_T *pLine,
+                       METRICS_LINE_RESULT_T *pResult)
+{
+    const double period = pLine->t - pLine->tStart;
+    double fundamental, harmonics = 0;
+    int h;
+
+    if ((pLine->samples == 0) || (period <= 0))
+    {
+        pResult->power = pResult->voltageRms = pResult->currentRms = NAN;
+        pResult->powerFactor = pResult->thd = pResult->vdcMean = NAN;
+        pResult->vdcRipple = pResult->capCurrentRms = NAN;
+        return;
+    }
+    pResult->power = (pLine->energy - pLine->energyStart) / period;
+    pResult->voltageRms = sqrt(pLine->voltageSquares / period);
+    pResult->currentRms = sqrt(pLine->currentSquares / period);
+    pResult->powerFactor = pResult->power /
+                            (pResult->voltageRms * pResult->currentRms);
+    fundamental = hypot(pLine->re[1], pLine->im[1]);
+    for (h = 2; h <= METRICS_HARMONICS; h++)
+    {
+        harmonics += pLine->re[h] * pLine->re[h] + pLine->im[h] * pLine->im[h];
+    }
+    pResult->thd = sqrt(harmonics) / fundamental * 100.0;
+    pResult->vdcMean = pLine->vdcSum / period;
+    pResult->vdcRipple = pLine->vdcMax - pLine->vdcMin;
+    pResult->capCurrentRms = sqrt((pLine->capSquare -
+                                            pLine->capSquareStart) / period);
+}
+
+void MetricsDcLinkBegin(METRICS_DCLINK_T *pDcLink, const PLANT_T *pPlant)
+{
+    pDcLink->tStart = pPlant->t;
+    pDcLink->capSquare = pPlant->capCurrentSquare;
+    pDcLink->inverterCharge = pPlant->inverterCharge;
+    pDcLink->inverterSquare = pPlant->inverterSquare;
+    pDcLink->boostCharge = pPlant->boostCharge;
+    pDcLink->boostInverter = pPlant->boostInverter;
+}
+
+void MetricsDcLinkResult(const METRICS_DCLINK_T *pDcLink,
+                         const PLANT_T *pPlant,
+                         METRICS_DCLINK_RESULT_T *pResult)
+{
+    const double period = pPlant->t - pDcLink->tStart;
+    double mean, square, boost;
+
+    if (period <= 0)
+    {
+        pResult->capCurrentRms = pResult->inverterRippleRms = NAN;
+        pResult->covariance = NAN;
+        return;
+    }
+    pResult->capCurrentRms = sqrt((pPlant->capCurrentSquare -
+                                            pDcLink->capSquare) / period);
+    mean = (pPlant->inverterCharge - pDcLink->inverterCharge) / period;
+    square = (pPlant->inverterSquare - pDcLink->inverterSquare) / period;
+    pResult->inverterRippleRms = sqrt(fmax(square - mean * mean, 0));
+    boost = (pPlant->boostCharge - pDcLink->boostCharge) / period;
+    pResult->covariance = (pPlant->boostInverter - pDcLink->boostInverter) /
+                                                    period - boost * mean;
+}
@@ -0,0 +1,132 @@
+/**
+ * @file metrics.h
+ *
+ * @brief Measurements of the scenario runner on the signals of the plant :
+ *        step response of a controlled variable, estimator angle error and
+ *        line side quality of the PFC (power factor, current THD, DC link
+ *        ripple) and ripple current of the DC link capacitor.
+ */
+#ifndef METRICS_H
+#define METRICS_H
+
+#include "plant.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define METRICS_HARMONICS   40      /* Current THD : harmonics 2 to 40 */
+
+/* Step of a controlled variable from initial to target at tStart. The
+   variable has settled from the last sample outside target +/- band. */
+typedef struct
+{
+    double tStart;
+    double initial;
+    double target;
+    double band;
+    double peak;                /* Furthest value in the direction of the step */
+    double deviationMax;        /* Largest |value - target| after the first
+                                   entry in the band */
+    double tOutside;            /* Last sample outside the band */
+    double tLast;
+    int entered;                /* Has been in the band */
+    int inside;                 /* Last sample in the band */
+} METRICS_STEP_T;
+
+typedef struct
+{
+    double overshoot;           /* % of the step, NAN for a zero step */
+    double settlingTime;        /* s from tStart, NAN if not settled */
+    double deviationMax;
+} METRICS_STEP_RESULT_T;
+
+void MetricsStepBegin(METRICS_STEP_T *pStep, double t, double initial,
+                      double target, double band);
+void MetricsStepSample(METRICS_STEP_T *pStep, double t, double value);
+void MetricsStepResult(const METRICS_STEP_T *pStep,
+                       METRICS_STEP_RESULT_T *pResult);
+
+/* Error of an estimated electrical angle against the plant */
+typedef struct
+{
+    double sum;
+    double squares;
+    double max;
+    uint32_t samples;
+} METRICS_ANGLE_T;
+
+/* Angles in radians, error wrapped to +/- pi */
+void MetricsAngleSample(METRICS_ANGLE_T *pAngle, double estimated,
+                        double actual);
+/* Mean, rms and largest absolute error in electrical degrees */
+void MetricsAngleResult(const METRICS_ANGLE_T *pAngle, double *pMean,
+                        double *pRms, double *pMax);
+
+/* Line side quality over whole line cycles. The line current of a sample
+   is the mean over the sample interval (from PLANT_T.lineCharge), which
+   filters the switching ripple before the harmonic analysis. */
+typedef struct
+{
+    double tStart;
+    double tEnd;
+    double t;                   /* Last sample */
+    double charge, energy, capSquare;   /* Plant integrals at the last sample */
+    double energyStart, capSquareStart;
+    double voltageSquares, currentSquares;
+    double re[METRICS_HARMONICS + 1], im[METRICS_HARMONICS + 1];
+    double vdcMin, vdcMax, vdcSum;
+    uint32_t samples;
+} METRICS_LINE_T;
+
+typedef struct
+{
+    double power;               /* W, line side */
+    double voltageRms, currentRms;
+    double powerFactor;
+    double thd;                 /* % of the fundamental current */
+    double vdcMean;
+    double vdcRipple;           /* Peak to peak */
+    double capCurrentRms;       /* DC link capacitor current */
+} METRICS_LINE_RESULT_T;
+
+/* Analysis over cycles line cycles from the present state of the plant */
+void MetricsLineBegin(METRICS_LINE_T *pLine, const PLANT_T *pPlant,
+                      int cycles);
+/* Returns 1 when the analysis interval is complete */
+int MetricsLineSample(METRICS_LINE_T *pLine, const PLANT_T *pPlant);
+void MetricsLineResult(const METRICS_LINE_T *pLine,
+                       METRICS_LINE_RESULT_T *pResult);
+
+/* Ripple current of the DC link over an interval, from the integrals of
+   the plant : rms of the capacitor current, rms about their mean of the
+   currents of both inverters (the part of the capacitor current the
+   carrier phase between the inverters changes) and covariance of the boost
+   diode and inverter currents (the part the carrier phase of the PFC
+   changes : the capacitor current squared is less twice the covariance) */
+typedef struct
+{
+    double tStart;
+    double capSquare;
+    double inverterCharge, inverterSquare;
+    double boostCharge, boostInverter;
+} METRICS_DCLINK_T;
+
+typedef struct
+{
+    double capCurrentRms;
+    double inverterRippleRms;
+    double covariance;          /* A^2 */
+} METRICS_DCLINK_RESULT_T;
+
+void MetricsDcLinkBegin(METRICS_DCLINK_T *pDcLink, const PLANT_T *pPlant);
+/* Result from the start to the present state of the plant */
+void MetricsDcLinkResult(const METRICS_DCLINK_T *pDcLink,
+                         const PLANT_T *pPlant,
+                         METRICS_DCLINK_RESULT_T *pResult);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* METRICS_H */
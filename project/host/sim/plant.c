@@ -0,0 +1,366 @@
+/**
+ * @file plant.c
+ *
+ * @brief Power stage and machines driven by the firmware images, see
+ *        plant.h.
+ */
+#define _GNU_SOURCE     /* sincos */
+#include <math.h>
+#include <string.h>
+
+#include "plant.h"
+
+#define PLANT_STATES        (PLANT_MOTORS * 4 + 9)
+#define PLANT_LINE_CHARGE   (PLANT_MOTORS * 4 + 2)  /* Integrals of outputs */
+#define PLANT_LINE_ENERGY   (PLANT_MOTORS * 4 + 3)
+#define PLANT_CAP_SQUARE    (PLANT_MOTORS * 4 + 4)
+#define PLANT_INV_CHARGE    (PLANT_MOTORS * 4 + 5)
+#define PLANT_INV_SQUARE    (PLANT_MOTORS * 4 + 6)
+#define PLANT_BOOST_CHARGE  (PLANT_MOTORS * 4 + 7)
+#define PLANT_BOOST_INV     (PLANT_MOTORS * 4 + 8)
+#define PLANT_TWO_PI        (2.0 * M_PI)
+#define PLANT_SQRT3         1.7320508075688772
+#define PLANT_FLOAT_CURRENT 1.0e-3  /* Current of a leg left floating (A) */
+#define PLANT_FLOAT_DECAY   2.0e-6  /* Current decay of a floating machine (s) */
+
+typedef struct
+{
+    double x[PLANT_STATES];
+} PLANT_STATE_T;
+
+void PlantInit(PLANT_T *pPlant)
+{
+    int m;
+
+    memset(pPlant, 0, sizeof(*pPlant));
+    for (m = 0; m < PLANT_MOTORS; m++)
+    {
+        PLANT_MOTOR_T *pMotor = &pPlant->motor[m];
+
+        /* Leadshine EL5-M0400 as seen by the firmware (mc1_user_params.h :
+           NORM_RS, NORM_LSDT, NORM_INVKFI_CONST) */
+        pMotor->rs = 0.78;
+        pMotor->ld = 1.73e-3;
+        pMotor->lq = 1.73e-3;
+        pMotor->psi = 0.028;
+        pMotor->polePairs = 5;
+        pMotor->inertia = 2.0e-4;
+        pMotor->friction = 1.0e-4;
+    }
+    pPlant->ron = 0.15;
+    pPlant->vf = 0.9;
+
+    pPlant->lineVoltage = 230.0;
+    pPlant->lineFrequency = 50.0;
+    pPlant->lineScale = 1.0;
+    pPlant->boostL = 0.7e-3;
+    pPlant->boostR = 0.1;
+
+    pPlant->capacitance = 1000.0e-6;
+    pPlant->auxPower = 3.0;
+    /* Precharged through the inrush limiter */
+    pPlant->vdc = pPlant->lineVoltage * M_SQRT2 - 2 * pPlant->vf;
+}
+
+static void Load(PLANT_T *pPlant, const PLANT_STATE_T *pState)
+{
+    int m;
+
+    for (m = 0; m < PLANT_MOTORS; m++)
+    {
+        PLANT_MOTOR_T *pMotor = &pPlant->motor[m];
+
+        pMotor->id = pState->x[4 * m];
+        pMotor->iq = pState->x[4 * m + 1];
+        pMotor->speed = pState->x[4 * m + 2];
+        pMotor->angle = pState->x[4 * m + 3];
+        pMotor->theta = fmod(pMotor->angle * pMotor->polePairs, PLANT_TWO_PI);
+    }
+    pPlant->iL = pState->x[4 * PLANT_MOTORS];
+    pPlant->vdc = pState->x[4 * PLANT_MOTORS + 1];
+    pPlant->lineCharge = pState->x[PLANT_LINE_CHARGE];
+    pPlant->lineEnergy = pState->x[PLANT_LINE_ENERGY];
+    pPlant->capCurrentSquare = pState->x[PLANT_CAP_SQUARE];
+    pPlant->inverterCharge = pState->x[PLANT_INV_CHARGE];
+    pPlant->inverterSquare = pState->x[PLANT_INV_SQUARE];
+    pPlant->boostCharge = pState->x[PLANT_BOOST_CHARGE];
+    pPlant->boostInverter = pState->x[PLANT_BOOST_INV];
+}
+
+static void Store(const PLANT_T *pPlant, PLANT_STATE_T *pState)
+{
+    int m;
+
+    for (m = 0; m < PLANT_MOTORS; m++)
+    {
+        const PLANT_MOTOR_T *pMotor = &pPlant->motor[m];
+
+        pState->x[4 * m] = pMotor->id;
+        pState->x[4 * m + 1] = pMotor->iq;
+        pState->x[4 * m + 2] = pMotor->speed;
+        pState->x[4 * m + 3] = pMotor->angle;
+    }
+    pState->x[4 * PLANT_MOTORS] = pPlant->iL;
+    pState->x[4 * PLANT_MOTORS + 1] = pPlant->vdc;
+    pState->x[PLANT_LINE_CHARGE] = pPlant->lineCharge;
+    pState->x[PLANT_LINE_ENERGY] = pPlant->lineEnergy;
+    pState->x[PLANT_CAP_SQUARE] = pPlant->capCurrentSquare;
+    pState->x[PLANT_INV_CHARGE] = pPlant->inverterCharge;
+    pState->x[PLANT_INV_SQUARE] = pPlant->inverterSquare;
+    pState->x[PLANT_BOOST_CHARGE] = pPlant->boostCharge;
+    pState->x[PLANT_BOOST_INV] = pPlant->boostInverter;
+}
+
+/* Leg voltages, DC link and shunt currents of an inverter */
+static void Inverter(const PLANT_T *pPlant, PLANT_MOTOR_T *pMotor)
+{
+    int k;
+
+    pMotor->iDc = 0;
+    for (k = 0; k < PLANT_PHASES; k++)
+    {
+        const double i = pMotor->i[k];
+        int lowSide;
+
+        if (pMotor->gateH[k])
+        {
+            pMotor->v[k] = pPlant->vdc - pPlant->ron * i;
+            lowSide = 0;
+        }
+        else if (pMotor->gateL[k])
+        {
+            pMotor->v[k] = -pPlant->ron * i;
+            lowSide = 1;
+        }
+        else if (i < 0)
+        {
+            /* Upper diode returns the current to the DC link */
+            pMotor->v[k] = pPlant->vdc + pPlant->vf;
+            lowSide = 0;
+        }
+        else
+        {
+            pMotor->v[k] = -pPlant->vf;
+            lowSide = 1;
+        }
+        pMotor->iShunt[k] = lowSide ? i : 0;
+        if (!lowSide)
+        {
+            pMotor->iDc += i;
+        }
+    }
+}
+
+/* Phase currents of the dq currents at the electrical angle */
+static void PhaseCurrents(PLANT_MOTOR_T *pMotor)
+{
+    int k;
+
+    for (k = 0; k < PLANT_PHASES; k++)
+    {
+        const double angle = pMotor->theta - k * PLANT_TWO_PI / 3;
+
+        pMotor->i[k] = pMotor->id * cos(angle) - pMotor->iq * sin(angle);
+    }
+}
+
+static int Floating(const PLANT_T *pPlant, const PLANT_MOTOR_T *pMotor)
+{
+    const double emf = pMotor->psi * pMotor->polePairs * fabs(pMotor->speed);
+    int k;
+
+    for (k = 0; k < PLANT_PHASES; k++)
+    {
+        if (pMotor->gateH[k] || pMotor->gateL[k] ||
+            (fabs(pMotor->i[k]) > PLANT_FLOAT_CURRENT))
+        {
+            return 0;
+        }
+    }
+    /* No diode conducts below the DC link voltage */
+    return (sqrt(3.0) * emf < pPlant->vdc + 2 * pPlant->vf);
+}
+
+static double Line(const PLANT_T *pPlant, double t)
+{
+    return pPlant->lineScale * pPlant->lineVoltage * M_SQRT2 *
+                        sin(PLANT_TWO_PI * pPlant->lineFrequency * t);
+}
+
+static void Derivative(PLANT_T *pPlant, const PLANT_STATE_T *pState, double t,
+                       PLANT_STATE_T *pDerivative)
+{
+    double iInverter = 0;
+    double vRectified, vL;
+    int m;
+
+    Load(pPlant, pState);
+    for (m = 0; m < PLANT_MOTORS; m++)
+    {
+        PLANT_MOTOR_T *pMotor = &pPlant->motor[m];
+        double *pDx = &pDerivative->x[4 * m];
+        const double omega = pMotor->speed * pMotor->polePairs;
+        double valpha, vbeta, vd, vq, load;
+
+        PhaseCurrents(pMotor);
+        Inverter(pPlant, pMotor);
+        pMotor->torque = 1.5 * pMotor->polePairs * (pMotor->psi * pMotor->iq +
+                            (pMotor->ld - pMotor->lq) * pMotor->id * pMotor->iq);
+        if (Floating(pPlant, pMotor))
+        {
+            pMotor->iDc = 0;
+            pDx[0] = -pMotor->id / PLANT_FLOAT_DECAY;
+            pDx[1] = -pMotor->iq / PLANT_FLOAT_DECAY;
+            pMotor->torque = 0;
+        }
+        else
+        {
+            /* Star point floats : Clarke transform of the leg voltages */
+            double sine, cosine;
+
+            sincos(pMotor->theta, &sine, &cosine);
+            valpha = (2 * pMotor->v[0] - pMotor->v[1] - pMotor->v[2]) / 3;
+            vbeta = (pMotor->v[1] - pMotor->v[2]) * (1.0 / PLANT_SQRT3);
+            vd = valpha * cosine + vbeta * sine;
+            vq = -valpha * sine + vbeta * cosine;
+            pDx[0] = (vd - pMotor->rs * pMotor->id +
+                            omega * pMotor->lq * pMotor->iq) / pMotor->ld;
+            pDx[1] = (vq - pMotor->rs * pMotor->iq -
+                    omega * (pMotor->ld * pMotor->id + pMotor->psi)) /
+                                                                pMotor->lq;
+        }
+        load = pMotor->loadTorque +
+            pMotor->loadFan * pMotor->speed * fabs(pMotor->speed) / 1.0e6;
+        if (pMotor->loadRipple != 0)
+        {
+            load += pMotor->loadRipple *
+                                sin(pMotor->loadHarmonic * pMotor->angle);
+        }
+        if ((pMotor->speed == 0) && (fabs(pMotor->torque) <= fabs(load)))
+        {
+            /* Static friction : the load holds a rotor at standstill */
+            pDx[2] = 0;
+        }
+        else
+        {
+            pDx[2] = (pMotor->torque - load - pMotor->friction * pMotor->speed)
+                                                        / pMotor->inertia;
+        }
+        pDx[3] = pMotor->speed;
+        iInverter += pMotor->iDc;
+    }
+
+    /* Boost : bridge, inductor, switch and diode */
+    pPlant->vac = Line(pPlant, t);
+    vRectified = fabs(pPlant->vac) - 2 * pPlant->vf;
+    vL = vRectified - pPlant->boostR * pPlant->iL;
+    if (pPlant->boostGate)
+    {
+        vL -= pPlant->ron * pPlant->iL;
+        pPlant->iBoost = 0;
+    }
+    else
+    {
+        vL -= pPlant->vdc + pPlant->vf;
+        pPlant->iBoost = pPlant->iL;
+    }
+    if ((pPlant->iL <= 0) && (vL < 0))
+    {
+        vL = 0;
+    }
+    pDerivative->x[4 * PLANT_MOTORS] = vL / pPlant->boostL;
+    pPlant->iac = (pPlant->vac >= 0) ? pPlant->iL : -pPlant->iL;
+
+    pPlant->iCap = pPlant->iBoost - iInverter;
+    if (pPlant->vdc > 1.0)
+    {
+        pPlant->iCap -= pPlant->auxPower / pPlant->vdc;
+    }
+    pDerivative->x[4 * PLANT_MOTORS + 1] = pPlant->iCap / pPlant->capacitance;
+    pDerivative->x[PLANT_LINE_CHARGE] = pPlant->iac;
+    pDerivative->x[PLANT_LINE_ENERGY] = pPlant->vac * pPlant->iac;
+    pDerivative->x[PLANT_CAP_SQUARE] = pPlant->iCap * pPlant->iCap;
+    pDerivative->x[PLANT_INV_CHARGE] = iInverter;
+    pDerivative->x[PLANT_INV_SQUARE] = iInverter * iInverter;
+    pDerivative->x[PLANT_BOOST_CHARGE] = pPlant->iBoost;
+    pDerivative->x[PLANT_BOOST_INV] = pPlant->iBoost * iInverter;
+}
+
+void PlantUpdate(PLANT_T *pPlant)
+{
+    PLANT_STATE_T state, derivative;
+
+    Store(pPlant, &state);
+    Derivative(pPlant, &state, pPlant->t, &derivative);
+}
+
+static void Step(PLANT_T *pPlant, double h)
+{
+    PLANT_STATE_T x, k1, k2, k3, k4, y;
+    const double t = pPlant->t;
+    int n;
+
+    Store(pPlant, &x);
+    Derivative(pPlant, &x, t, &k1);
+    for (n = 0; n < PLANT_STATES; n++)
+    {
+        y.x[n] = x.x[n] + 0.5 * h * k1.x[n];
+    }
+    Derivative(pPlant, &y, t + 0.5 * h, &k2);
+    for (n = 0; n < PLANT_STATES; n++)
+    {
+        y.x[n] = x.x[n] + 0.5 * h * k2.x[n];
+    }
+    Derivative(pPlant, &y, t + 0.5 * h, &k3);
+    for (n = 0; n < PLANT_STATES; n++)
+    {
+        y.x[n] = x.x[n] + h * k3.x[n];
+    }
+    Derivative(pPlant, &y, t + h, &k4);
+    for (n = 0; n < PLANT_STATES; n++)
+    {
+        y.x[n] = x.x[n] + h / 6 * (k1.x[n] + 2 * k2.x[n] + 2 * k3.x[n] +
+                                                                k4.x[n]);
+    }
+    /* Diode of the boost and standstill under load */
+    if (y.x[4 * PLANT_MOTORS] < 0)
+    {
+        y.x[4 * PLANT_MOTORS] = 0;
+    }
+    for (n = 0; n < PLANT_MOTORS; n++)
+    {
+        if ((x.x[4 * n + 2] != 0) &&
+            ((x.x[4 * n + 2] > 0) != (y.x[4 * n + 2] > 0)) &&
+            (fabs(pPlant->motor[n].torque) < fabs(pPlant->motor[n].loadTorque)))
+        {
+            y.x[4 * n + 2] = 0;
+        }
+        y.x[4 * n + 3] = fmod(y.x[4 * n + 3], PLANT_TWO_PI);
+        if (y.x[4 * n + 3] < 0)
+        {
+            y.x[4 * n + 3] += PLANT_TWO_PI;
+        }
+    }
+    Load(pPlant, &y);
+    pPlant->t = t + h;
+}
+
+void PlantRun(PLANT_T *pPlant, double t, double hMax)
+{
+    while (pPlant->t < t)
+    {
+        double h = t - pPlant->t;
+        int steps = (int)ceil(h / hMax - 1.0e-9);
+
+        if (steps > 1)
+        {
+            h /= steps;
+        }
+        Step(pPlant, h);
+        if (steps <= 1)
+        {
+            pPlant->t = t;
+        }
+    }
+    PlantUpdate(pPlant);
+}
@@ -0,0 +1,112 @@
+/**
+ * @file plant.h
+ *
+ * @brief Power stage and machines driven by the firmware images : two PMSM
+ *        on three phase inverters, the boost PFC from the AC line and the DC
+ *        link they share.
+ *
+ * Machines are modelled in the rotor (dq) frame, with a star point that
+ * floats : the phase voltages are the inverter leg voltages less their
+ * mean. Inverter legs conduct through the switch that is on, or during the
+ * dead time through the diode set by the sign of the phase current. The
+ * boost inductor current is clamped at zero (discontinuous conduction).
+ * The plant is integrated with the gate states constant between PWM edges.
+ */
+#ifndef PLANT_H
+#define PLANT_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PLANT_MOTORS        2
+#define PLANT_PHASES        3
+
+typedef struct
+{
+    /* Machine (per phase, amplitude invariant dq) */
+    double rs;                  /* Stator resistance (Ohm) */
+    double ld, lq;              /* d, q axis inductance (H) */
+    double psi;                 /* PM flux linkage (Vs, peak phase) */
+    double polePairs;
+    double inertia;             /* Rotor and load inertia (kg m^2) */
+    double friction;            /* Viscous friction (Nm s/rad) */
+
+    /* Load torque (Nm) : constant, proportional to speed squared (fan) and
+       cyclic with the mechanical angle (compressor) */
+    double loadTorque;
+    double loadFan;             /* Nm at 1000 rad/s mechanical */
+    double loadRipple;          /* Amplitude of the cyclic load */
+    int loadHarmonic;           /* Cycles per mechanical revolution */
+
+    /* State */
+    double id, iq;              /* Currents (A) */
+    double speed;               /* Mechanical speed (rad/s) */
+    double theta;               /* Electrical angle (rad, 0 to 2 pi) */
+    double angle;               /* Mechanical angle (rad, 0 to 2 pi) */
+
+    /* Gate drives : high and low side of each leg (1 - on) */
+    uint8_t gateH[PLANT_PHASES], gateL[PLANT_PHASES];
+
+    /* Outputs, updated by PlantUpdate() */
+    double i[PLANT_PHASES];     /* Phase currents, positive out of the leg */
+    double v[PLANT_PHASES];     /* Leg voltages to the DC link minus */
+    double torque;              /* Electromagnetic torque (Nm) */
+    double iDc;                 /* DC link current into the inverter */
+    double iShunt[PLANT_PHASES];/* Leg current through the low side shunt */
+} PLANT_MOTOR_T;
+
+typedef struct
+{
+    PLANT_MOTOR_T motor[PLANT_MOTORS];
+
+    /* Inverter devices */
+    double ron;                 /* Switch on resistance (Ohm) */
+    double vf;                  /* Diode forward drop (V) */
+
+    /* AC line and boost PFC */
+    double lineVoltage;         /* RMS voltage (V) */
+    double lineFrequency;       /* Hz */
+    double lineScale;           /* Sag / dropout : 1 - nominal, 0 - lost */
+    double boostL;              /* Boost inductance (H) */
+    double boostR;              /* Inductor and bridge resistance (Ohm) */
+    double iL;                  /* Inductor current (A) */
+    uint8_t boostGate;          /* Boost switch (1 - on) */
+
+    /* DC link */
+    double capacitance;         /* F */
+    double auxPower;            /* Auxiliary supplies (W) */
+    double vdc;                 /* V */
+
+    double t;                   /* Time of the state (s) */
+
+    /* Integrals from time 0, for averages over an interval */
+    double lineCharge;          /* Line current (As) */
+    double lineEnergy;          /* Line power (J) */
+    double capCurrentSquare;    /* DC link capacitor current squared (A^2 s) */
+    double inverterCharge;      /* Current of both inverters (As) */
+    double inverterSquare;      /* Current of both inverters squared (A^2 s) */
+    double boostCharge;         /* Boost diode current (As) */
+    double boostInverter;       /* Boost diode times inverter current (A^2 s) */
+
+    /* Outputs, updated by PlantUpdate() */
+    double vac;                 /* Line voltage (V) */
+    double iac;                 /* Line current (A) */
+    double iBoost;              /* Boost diode current into the DC link */
+    double iCap;                /* DC link capacitor current */
+} PLANT_T;
+
+/* Board and machine defaults (see README.md) */
+void PlantInit(PLANT_T *pPlant);
+/* Outputs of the state at pPlant->t */
+void PlantUpdate(PLANT_T *pPlant);
+/* Integrates the plant to time t with steps of at most hMax */
+void PlantRun(PLANT_T *pPlant, double t, double hMax);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLANT_H */
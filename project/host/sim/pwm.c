@@ -0,0 +1,240 @@
+/**
+ * @file pwm.c
+ *
+ * @brief PWM generators of a core image, see pwm.h.
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "pwm.h"
+
+#define PWM_SECOND_HALF     0x8000  /* PGxTRIGy of a center aligned cycle */
+
+static void EventAdd(PWM_GENERATOR_T *pGen, double position, double clock,
+                     PWM_EVENT_TYPE_T type)
+{
+    const double t = pGen->start + position * clock;
+    int i;
+
+    if ((position < 0) || (t >= pGen->end) ||
+        (pGen->events >= PWM_EVENTS_MAX))
+    {
+        return;
+    }
+    /* Events in order of time */
+    for (i = pGen->events; (i > 0) && (pGen->event[i - 1].t > t); i--)
+    {
+        pGen->event[i] = pGen->event[i - 1];
+    }
+    pGen->event[i].t = t;
+    pGen->event[i].type = type;
+    pGen->events++;
+}
+
+/* Position of a PGxTRIGy compare event in clocks from the start of cycle */
+static double TriggerPosition(const HOST_PWM_T *pReg, uint16_t trig)
+{
+    if (pReg->centered && (trig & PWM_SECOND_HALF))
+    {
+        return pReg->period + (trig & ~PWM_SECOND_HALF);
+    }
+    return trig;
+}
+
+static void CycleStart(PWM_T *pPwm, int n, double t)
+{
+    PWM_GENERATOR_T *pGen = &pPwm->generator[n];
+    const HOST_PWM_T *pReg = &pGen->reg;
+    const double clock = pPwm->clock;
+    double p, d;
+    int i;
+
+    pGen->on = pPwm->pImage->pwm(n + 1, &pGen->reg);
+    p = pReg->period;
+    d = pReg->duty;
+    pGen->events = 0;
+    pGen->nextEvent = 0;
+    if (!pGen->on)
+    {
+        pGen->start = t;
+        pGen->end = HOST_NEVER;
+        return;
+    }
+    pGen->start = t;
+    pGen->end = t + pReg->cycle * clock;
+
+    if (pReg->centered)
+    {
+        EventAdd(pGen, p - d, clock, PWM_EVENT_EDGE);
+        EventAdd(pGen, p - d + pReg->deadTimeH, clock, PWM_EVENT_EDGE);
+        EventAdd(pGen, p + d, clock, PWM_EVENT_EDGE);
+        EventAdd(pGen, p + d + pReg->deadTimeL, clock, PWM_EVENT_EDGE);
+        EventAdd(pGen, 2 * p, clock, PWM_EVENT_EDGE);
+    }
+    else
+    {
+        EventAdd(pGen, d, clock, PWM_EVENT_EDGE);
+        EventAdd(pGen, d + pReg->deadTimeL, clock, PWM_EVENT_EDGE);
+        EventAdd(pGen, pReg->deadTimeH, clock, PWM_EVENT_EDGE);
+    }
+    for (i = 0; i < 3; i++)
+    {
+        const double position = TriggerPosition(pReg, pReg->trig[i]);
+
+        if (pReg->adTrig1 & (1 << i))
+        {
+            EventAdd(pGen, position, clock, PWM_EVENT_ADC_TRIGGER1);
+        }
+        if (pReg->adTrig2 & (1 << i))
+        {
+            EventAdd(pGen, position, clock, PWM_EVENT_ADC_TRIGGER2);
+        }
+    }
+}
+
+void PWMInit(PWM_T *pPwm, const HOST_IMAGE_T *pImage)
+{
+    int n;
+
+    memset(pPwm, 0, sizeof(*pPwm));
+    pPwm->pImage = pImage;
+    pPwm->clock = 1.0 / pImage->pwmClock;
+    for (n = 0; n < pImage->pwmGenerators; n++)
+    {
+        PWM_GENERATOR_T *pGen = &pPwm->generator[n];
+
+        pGen->on = pImage->pwm(n + 1, &pGen->reg);
+        /* First cycle starts at the offset of the generator */
+        pGen->end = pGen->on ? pGen->reg.offset * pPwm->clock : HOST_NEVER;
+        pGen->start = pGen->end;
+    }
+}
+
+double PWMNext(const PWM_T *pPwm)
+{
+    double next = HOST_NEVER;
+    int n;
+
+    for (n = 0; n < pPwm->pImage->pwmGenerators; n++)
+    {
+        const PWM_GENERATOR_T *pGen = &pPwm->generator[n];
+
+        if (pGen->end < next)
+        {
+            next = pGen->end;
+        }
+        if ((pGen->nextEvent < pGen->events) &&
+            (pGen->event[pGen->nextEvent].t < next))
+        {
+            next = pGen->event[pGen->nextEvent].t;
+        }
+    }
+    return next;
+}
+
+int PWMRun(PWM_T *pPwm, double t)
+{
+    int n, syncOut = 0;
+
+    for (n = 0; n < pPwm->pImage->pwmGenerators; n++)
+    {
+        PWM_GENERATOR_T *pGen = &pPwm->generator[n];
+
+        if (pGen->end <= t)
+        {
+            CycleStart(pPwm, n, pGen->end);
+        }
+        while ((pGen->nextEvent < pGen->events) &&
+               (pGen->event[pGen->nextEvent].t <= t))
+        {
+            const PWM_EVENT_T *pEvent = &pGen->event[pGen->nextEvent++];
+
+            if (pEvent->type == PWM_EVENT_ADC_TRIGGER1)
+            {
+                if (++pGen->postscale >= pGen->reg.adTrig1Postscale)
+                {
+                    pGen->postscale = 0;
+                    pPwm->pImage->adcTrigger(n + 1, 1, pEvent->t);
+                    syncOut |= pGen->reg.syncOut;
+                }
+            }
+            else if (pEvent->type == PWM_EVENT_ADC_TRIGGER2)
+            {
+                pPwm->pImage->adcTrigger(n + 1, 2, pEvent->t);
+            }
+        }
+    }
+    return syncOut;
+}
+
+void PWMSync(PWM_T *pPwm, double t)
+{
+    int n;
+
+    for (n = 0; n < pPwm->pImage->pwmGenerators; n++)
+    {
+        PWM_GENERATOR_T *pGen = &pPwm->generator[n];
+
+        /* Retriggerable : the current cycle ends at the sync */
+        if (pGen->on && pGen->reg.syncIn)
+        {
+            pGen->end = t + pGen->reg.offset * pPwm->clock;
+        }
+    }
+}
+
+void PWMOutputs(const PWM_T *pPwm, int generator, double t,
+                uint8_t *pH, uint8_t *pL)
+{
+    const PWM_GENERATOR_T *pGen = &pPwm->generator[generator - 1];
+    const HOST_PWM_T *pReg = &pGen->reg;
+    double position, p, d;
+
+    *pH = 0;
+    *pL = 0;
+    if (!pGen->on || (t < pGen->start))
+    {
+        return;
+    }
+    /* Edges are events : a time on an edge has the state after it */
+    position = (t - pGen->start) / pPwm->clock + 1.0e-3;
+    p = pReg->period;
+    d = pReg->duty;
+    if (pReg->centered)
+    {
+        if (position >= 2 * p)
+        {
+            /* Waits for the next sync in the last state */
+            position = 2 * p - 0.5;
+        }
+        if (pReg->complementary)
+        {
+            *pH = (position >= p - d + pReg->deadTimeH) && (position < p + d);
+            *pL = (position < p - d) || (position >= p + d + pReg->deadTimeL);
+        }
+        else
+        {
+            *pH = (position >= p - d) && (position < p + d);
+        }
+    }
+    else
+    {
+        if (pReg->complementary)
+        {
+            *pH = (position >= pReg->deadTimeH) && (position < d);
+            *pL = (position >= d + pReg->deadTimeL);
+        }
+        else
+        {
+            *pH = (position < d);
+        }
+    }
+    if (pReg->overrideH)
+    {
+        *pH = pReg->overrideDataH;
+    }
+    if (pReg->overrideL)
+    {
+        *pL = pReg->overrideDataL;
+    }
+}
@@ -0,0 +1,74 @@
+/**
+ * @file pwm.h
+ *
+ * @brief PWM generators of a core image : output edges and ADC triggers of
+ *        the register state (HOST_PWM_T) of each generator.
+ *
+ * The register state is latched at the start of each PWM cycle, as the
+ * generators update duty cycle, triggers and overrides at the start of
+ * cycle (PGxCONH.UPDMOD = 0, PGxIOCONL.OSYNC = 0).
+ */
+#ifndef PWM_H
+#define PWM_H
+
+#include <stdint.h>
+
+#include "host_image.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PWM_GENERATORS_MAX  8
+#define PWM_EVENTS_MAX      16
+
+typedef enum
+{
+    PWM_EVENT_EDGE = 0,
+    PWM_EVENT_ADC_TRIGGER1 = 1,
+    PWM_EVENT_ADC_TRIGGER2 = 2,
+} PWM_EVENT_TYPE_T;
+
+typedef struct
+{
+    double t;
+    PWM_EVENT_TYPE_T type;
+} PWM_EVENT_T;
+
+typedef struct
+{
+    HOST_PWM_T reg;                 /* Latched at the start of the cycle */
+    int on;
+    double start;                   /* Start of the current cycle */
+    double end;                     /* Start of the next cycle */
+    uint16_t postscale;             /* ADC trigger 1 events counted */
+    PWM_EVENT_T event[PWM_EVENTS_MAX];
+    int events, nextEvent;
+} PWM_GENERATOR_T;
+
+typedef struct
+{
+    const HOST_IMAGE_T *pImage;
+    double clock;                   /* PWM clock period */
+    PWM_GENERATOR_T generator[PWM_GENERATORS_MAX];
+} PWM_T;
+
+void PWMInit(PWM_T *pPwm, const HOST_IMAGE_T *pImage);
+/* Time of the next event (cycle start, edge, ADC trigger) after time t */
+double PWMNext(const PWM_T *pPwm);
+/* Processes the events at time t : cycle starts latch the register state,
+   ADC triggers are passed to the image. Returns 1 if an ADC trigger 1 was
+   output to the other core (HOST_PWM_T.syncOut) */
+int PWMRun(PWM_T *pPwm, double t);
+/* Event output of the other core at time t : the generators restarted by it
+   (HOST_PWM_T.syncIn) start their next cycle at t plus their offset */
+void PWMSync(PWM_T *pPwm, double t);
+/* Output states of generator n (1 to 8) at time t */
+void PWMOutputs(const PWM_T *pPwm, int generator, double t,
+                uint8_t *pH, uint8_t *pL);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PWM_H */
@@ -0,0 +1,239 @@
+/**
+ * @file sim.c
+ *
+ * @brief Closed loop simulation of the board, see sim.h.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "afe.h"
+#include "host_msi.h"
+#include "sim.h"
+
+#define SIM_STEP_MAX        2.0e-6  /* Plant integration step (s) */
+#define SIM_MC1_GENERATOR   1       /* PG1-PG3 : motor 1, phases A to C */
+#define SIM_MC2_GENERATOR   6       /* PG6-PG8 : motor 2 */
+#define SIM_PFC_GENERATOR   4
+
+static void Gates(SIM_T *pSim);
+
+void SimInit(SIM_T *pSim, double sampleTime, SIM_SAMPLE_T sample,
+             SIM_ISR_T isr, void *context)
+{
+    memset(pSim, 0, sizeof(*pSim));
+    PlantInit(&pSim->plant);
+    pSim->hMax = SIM_STEP_MAX;
+    pSim->noise = 1.0;
+    pSim->random = 2463534242u;
+    pSim->sampleTime = sampleTime;
+    pSim->nextSample = sampleTime;
+    pSim->sample = sample;
+    pSim->isr = isr;
+    pSim->context = context;
+    /* Mailboxes are shared by all images of the process */
+    memset(&hostMsi, 0, sizeof(hostMsi));
+}
+
+void SimStart(SIM_T *pSim, const HOST_IMAGE_T *pImage)
+{
+    const int core = (strcmp(pImage->core, "main") == 0) ? SIM_MAIN :
+                                                           SIM_SECONDARY;
+    SIM_CORE_T *pCore = &pSim->core[core];
+
+    pCore->pImage = pImage;
+    pImage->start((core == SIM_MAIN) ? AfeMain : AfeSecondary, pSim);
+    PWMInit(&pCore->pwm, pImage);
+    Gates(pSim);
+    PlantUpdate(&pSim->plant);
+}
+
+static void Gates(SIM_T *pSim)
+{
+    const SIM_CORE_T *pSecondary = &pSim->core[SIM_SECONDARY];
+    const SIM_CORE_T *pMain = &pSim->core[SIM_MAIN];
+    uint8_t low;
+    int k;
+
+    if (pSecondary->pImage != NULL)
+    {
+        for (k = 0; k < PLANT_PHASES; k++)
+        {
+            PLANT_MOTOR_T *pMotor1 = &pSim->plant.motor[0];
+            PLANT_MOTOR_T *pMotor2 = &pSim->plant.motor[1];
+
+            PWMOutputs(&pSecondary->pwm, SIM_MC1_GENERATOR + k, pSim->t,
+                       &pMotor1->gateH[k], &pMotor1->gateL[k]);
+            PWMOutputs(&pSecondary->pwm, SIM_MC2_GENERATOR + k, pSim->t,
+                       &pMotor2->gateH[k], &pMotor2->gateL[k]);
+        }
+    }
+    if (pMain->pImage != NULL)
+    {
+        PWMOutputs(&pMain->pwm, SIM_PFC_GENERATOR, pSim->t,
+                   &pSim->plant.boostGate, &low);
+    }
+}
+
+static void Isr(SIM_T *pSim, int core)
+{
+    SIM_CORE_T *pCore = &pSim->core[core];
+    HOST_ISR_STATS_T stats;
+    int n;
+
+    for (n = 0; (n < SIM_VECTORS_MAX) &&
+                            pCore->pImage->isrStats(n, &stats); n++)
+    {
+        if (stats.count != pCore->isrCount[n])
+        {
+            pCore->isrCount[n] = stats.count;
+            if (pSim->isr != NULL)
+            {
+                pSim->isr(pSim, core, n, pSim->context);
+            }
+        }
+    }
+}
+
+void SimRun(SIM_T *pSim, double t)
+{
+    while (pSim->t < t)
+    {
+        double next = t;
+        int core;
+
+        if (pSim->nextSample < next)
+        {
+            next = pSim->nextSample;
+        }
+        for (core = 0; core < SIM_CORES; core++)
+        {
+            const SIM_CORE_T *pCore = &pSim->core[core];
+            double event;
+
+            if (pCore->pImage == NULL)
+            {
+                continue;
+            }
+            event = PWMNext(&pCore->pwm);
+            if (event < next)
+            {
+                next = event;
+            }
+            event = pCore->pImage->next();
+            if (event < next)
+            {
+                next = event;
+            }
+        }
+        if (next < pSim->t)
+        {
+            next = pSim->t;
+        }
+
+        PlantRun(&pSim->plant, next, pSim->hMax);
+        pSim->t = next;
+        for (core = 0; core < SIM_CORES; core++)
+        {
+            SIM_CORE_T *pCore = &pSim->core[core];
+
+            if (pCore->pImage == NULL)
+            {
+                continue;
+            }
+            pCore->pImage->run(next);
+            Isr(pSim, core);
+            if (PWMRun(&pCore->pwm, next) &&
+                (pSim->core[!core].pImage != NULL))
+            {
+                PWMSync(&pSim->core[!core].pwm, next);
+            }
+        }
+        Gates(pSim);
+        PlantUpdate(&pSim->plant);
+        if (pSim->nextSample <= next)
+        {
+            pSim->nextSample += pSim->sampleTime;
+            if (pSim->sample != NULL)
+            {
+                pSim->sample(pSim, pSim->context);
+            }
+        }
+    }
+}
+
+const HOST_PROBE_T *SimProbe(const SIM_T *pSim, int core, const char *name)
+{
+    const HOST_IMAGE_T *pImage = pSim->core[core].pImage;
+    const HOST_PROBE_T *pProbe = NULL;
+
+    if (pImage != NULL)
+    {
+        pProbe = pImage->probe(name);
+    }
+    if (pProbe == NULL)
+    {
+        fprintf(stderr, "hostsim: no probe %s in the %s image\n", name,
+                                (core == SIM_MAIN) ? "main" : "secondary");
+        exit(EXIT_FAILURE);
+    }
+    return pProbe;
+}
+
+double SimRead(const SIM_T *pSim, int core, const char *name)
+{
+    return HostProbeRead(SimProbe(pSim, core, name));
+}
+
+void SimWrite(SIM_T *pSim, int core, const char *name, double value)
+{
+    HostProbeWrite(SimProbe(pSim, core, name), value);
+}
+
+void SimButton(SIM_T *pSim, int button, double held)
+{
+    const char *name = (button == 1) ? "PORTEbits.RE4" : "PORTEbits.RE5";
+
+    SimWrite(pSim, SIM_SECONDARY, name, 1);
+    SimRun(pSim, pSim->t + held);
+    SimWrite(pSim, SIM_SECONDARY, name, 0);
+}
+
+double HostProbeRead(const HOST_PROBE_T *pProbe)
+{
+    const int sign = pProbe->type & HOST_PROBE_SIGNED;
+
+    switch (pProbe->type & ~HOST_PROBE_SIGNED)
+    {
+        case 1:
+            return sign ? *(volatile int8_t *)pProbe->address :
+                          *(volatile uint8_t *)pProbe->address;
+        case 2:
+            return sign ? *(volatile int16_t *)pProbe->address :
+                          *(volatile uint16_t *)pProbe->address;
+        case 4:
+            return sign ? *(volatile int32_t *)pProbe->address :
+                          *(volatile uint32_t *)pProbe->address;
+        default:
+            return 0;
+    }
+}
+
+void HostProbeWrite(const HOST_PROBE_T *pProbe, double value)
+{
+    switch (pProbe->type & ~HOST_PROBE_SIGNED)
+    {
+        case 1:
+            *(volatile uint8_t *)pProbe->address = (uint8_t)(int32_t)value;
+        break;
+        case 2:
+            *(volatile uint16_t *)pProbe->address = (uint16_t)(int32_t)value;
+        break;
+        case 4:
+            *(volatile uint32_t *)pProbe->address = (uint32_t)(int64_t)value;
+        break;
+        default:
+        break;
+    }
+}
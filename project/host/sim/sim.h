@@ -0,0 +1,95 @@
+/**
+ * @file sim.h
+ *
+ * @brief Closed loop simulation of the board : the firmware images of the
+ *        Secondary core (motors) and of the Main core (PFC) with the plant.
+ *
+ * Events (PWM edges and ADC triggers, ADC samples, interrupt entries and
+ * timer periods of the images, samples of the scenario) are processed in
+ * order of time; the plant is integrated between them with the gate
+ * states constant. At equal times the images run first, so that duty
+ * cycles written by an ISR take effect at a start of cycle at the same
+ * time, as on the device. The PWM event output of one core restarts the
+ * generators of the other core synchronised to it (PWMSync()) : the motor
+ * PWM follows the PFC PWM when both cores run.
+ *
+ * Analog inputs (afe.c) are read at the sampling time of the ADC model,
+ * except for conversions started while an ISR runs (ready polling), which
+ * read the plant at the entry time of the ISR.
+ */
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdint.h>
+
+#include "host_image.h"
+#include "plant.h"
+#include "pwm.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SIM_CORES           2
+#define SIM_SECONDARY       0
+#define SIM_MAIN            1
+#define SIM_VECTORS_MAX     4
+
+typedef struct SIM SIM_T;
+
+/* Called at each sample of the scenario and after each ISR */
+typedef void (*SIM_SAMPLE_T)(SIM_T *pSim, void *context);
+typedef void (*SIM_ISR_T)(SIM_T *pSim, int core, int vector, void *context);
+
+typedef struct
+{
+    const HOST_IMAGE_T *pImage;     /* NULL - core not simulated */
+    PWM_T pwm;
+    uint32_t isrCount[SIM_VECTORS_MAX];
+} SIM_CORE_T;
+
+struct SIM
+{
+    PLANT_T plant;
+    SIM_CORE_T core[SIM_CORES];
+    double t;
+    double hMax;                    /* Integration step of the plant */
+
+    /* Analog front end */
+    double pot;                     /* Potentiometer, 0 to 1 */
+    double noise;                   /* ADC noise (LSB rms) */
+    uint32_t random;                /* Noise generator state */
+
+    /* Scenario */
+    double sampleTime;
+    double nextSample;
+    SIM_SAMPLE_T sample;
+    SIM_ISR_T isr;
+    void *context;
+};
+
+/* Plant defaults, no image. sampleTime of the scenario callback. */
+void SimInit(SIM_T *pSim, double sampleTime, SIM_SAMPLE_T sample,
+             SIM_ISR_T isr, void *context);
+/* Starts an image (main() to its main loop) on its core */
+void SimStart(SIM_T *pSim, const HOST_IMAGE_T *pImage);
+/* Runs the simulation to time t */
+void SimRun(SIM_T *pSim, double t);
+
+/* Firmware variable of a core, exits if the image has no such probe */
+const HOST_PROBE_T *SimProbe(const SIM_T *pSim, int core, const char *name);
+double SimRead(const SIM_T *pSim, int core, const char *name);
+void SimWrite(SIM_T *pSim, int core, const char *name, double value);
+/* Presses button 1 or 2 of the Secondary core for time held */
+void SimButton(SIM_T *pSim, int button, double held);
+
+/* Image by name (images.c, generated by CMakeLists.txt), NULL if unknown */
+const HOST_IMAGE_T *SimImage(const char *name);
+/* Names of the images, NULL terminated */
+extern const char *const simImageNames[];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_H */
@@ -0,0 +1,307 @@
+/**
+ * @file tracereplay.c
+ *
+ * @brief Records the ADC trace (adc_trace.h) of a control ISR in the
+ *        simulation and replays a trace file through the unmodified state
+ *        machine of the firmware.
+ *
+ * Usage : tracereplay record <mc1|pfc> <file>
+ *         tracereplay replay <mc1|pfc> <file>
+ *
+ * record runs the trace image of the core (CMakeLists.txt) up to a fault
+ * of the state machine, which freezes the trace, and writes the trace
+ * stream read out by ADCTraceStreamWord() to the file.
+ * replay starts the trace image, loads the file into the trace as a frozen
+ * trace and replays it with ADC_TRACE_CMD_REPLAY, as the debugger does on
+ * the device. Results are written as JSON (json.h) to stdout.
+ *
+ * The snapshot of a trace holds pointers : a trace replays in the build
+ * that recorded it. This executable is linked at a fixed address (no PIE)
+ * so that a file recorded by one process replays in another; the region
+ * sizes of the stream header reject the files of other builds, including
+ * those of the device.
+ *
+ * Exit status 1 if recording does not freeze the trace or if the replayed
+ * signatures differ from the recorded ones, 2 on a usage or file error.
+ */
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adc_trace.h"
+
+#include "json.h"
+#include "sim.h"
+
+#define TRACE_RECORD_TIMEOUT    15.0    /* s of simulation to the fault */
+#define TRACE_REPLAY_TIMEOUT    1.0
+#define TRACE_STREAM_WORDS_MAX  (ADC_TRACE_STREAM_HEADER + \
+            ADC_TRACE_STATE_REGIONS + ADC_TRACE_SNAPSHOT_SIZE / 2 + \
+            ADC_TRACE_LENGTH * (ADC_TRACE_CHANNELS + 1))
+
+typedef struct
+{
+    const char *name;
+    const char *image;              /* Image with ENABLE_ADC_TRACE */
+    const char *symbol;             /* ADC_TRACE_T of the image */
+    int core;
+    /* Runs the simulation into a fault of the state machine */
+    void (*fault)(SIM_T *pSim, ADC_TRACE_T *pTrace);
+} TRACE_T;
+
+static void RunWhileRecording(SIM_T *pSim, const ADC_TRACE_T *pTrace,
+                              double t)
+{
+    while ((pSim->t < t) && ((pTrace->state == ADC_TRACE_RECORD) ||
+                             (pTrace->command == ADC_TRACE_CMD_RECORD)))
+    {
+        SimRun(pSim, pSim->t + 0.001);
+    }
+}
+
+/* MC1 started to closed loop at 1000 rpm, then run to the maximum speed
+   without load : the estimator loses the angle (see hostsim.c) and the
+   phase current exceeds the fault limit */
+static void MC1Fault(SIM_T *pSim, ADC_TRACE_T *pTrace)
+{
+    pSim->plant.motor[0].loadTorque = 0.05;
+    pSim->pot = 0.08;
+    SimRun(pSim, 0.2);
+    SimButton(pSim, 1, 0.1);
+    RunWhileRecording(pSim, pTrace, 4.0);
+    pSim->plant.motor[0].loadTorque = 0;
+    pSim->pot = 1.0;
+    RunWhileRecording(pSim, pTrace, TRACE_RECORD_TIMEOUT);
+}
+
+/* PFC soft start at 300 W, then a line dropout : input under voltage */
+static void PFCFault(SIM_T *pSim, ADC_TRACE_T *pTrace)
+{
+    pSim->plant.auxPower = 300.0;
+    RunWhileRecording(pSim, pTrace, 2.0);
+    pSim->plant.lineScale = 0;
+    RunWhileRecording(pSim, pTrace, TRACE_RECORD_TIMEOUT);
+}
+
+static const TRACE_T trace[] =
+{
+    {"mc1", "trace", "mc1Trace", SIM_SECONDARY, MC1Fault},
+    {"pfc", "trace_main", "pfcTrace", SIM_MAIN, PFCFault},
+};
+
+#define TRACES  (sizeof(trace) / sizeof(trace[0]))
+
+static void Error(const char *message, const char *argument)
+{
+    fprintf(stderr, "tracereplay: %s%s\n", message, argument);
+    exit(2);
+}
+
+static ADC_TRACE_T *Start(SIM_T *pSim, const TRACE_T *pTrace)
+{
+    const HOST_IMAGE_T *pImage = SimImage(pTrace->image);
+    ADC_TRACE_T *pADCTrace;
+
+    if (pImage == NULL)
+    {
+        Error("no image ", pTrace->image);
+    }
+    SimInit(pSim, 1.0e-3, NULL, NULL, NULL);
+    SimStart(pSim, pImage);
+    pADCTrace = pImage->symbol(pTrace->symbol);
+    if ((pADCTrace == NULL) || (pADCTrace->state == ADC_TRACE_ERROR))
+    {
+        Error("no trace in the image ", pTrace->image);
+    }
+    return pADCTrace;
+}
+
+static void Summary(JSON_T *pJson, const ADC_TRACE_T *pADCTrace)
+{
+    JsonInteger(pJson, "channels", pADCTrace->channels);
+    JsonInteger(pJson, "samples", pADCTrace->length);
+    JsonInteger(pJson, "snapshot_bytes", pADCTrace->stateSize);
+    if (pADCTrace->faultIndex == ADC_TRACE_NO_FAULT)
+    {
+        JsonNumber(pJson, "fault_index", NAN);
+    }
+    else
+    {
+        JsonInteger(pJson, "fault_index", pADCTrace->faultIndex);
+    }
+}
+
+static int Record(const TRACE_T *pTrace, const char *path, JSON_T *pJson)
+{
+    static SIM_T sim;
+    ADC_TRACE_T *pADCTrace = Start(&sim, pTrace);
+    const HOST_IMAGE_T *pImage = sim.core[pTrace->core].pImage;
+    uint16_t (*streamLength)(const ADC_TRACE_T *) =
+                            pImage->symbol("ADCTraceStreamLength");
+    uint16_t (*streamWord)(const ADC_TRACE_T *, uint16_t) =
+                            pImage->symbol("ADCTraceStreamWord");
+    uint16_t words, n;
+    FILE *pFile;
+
+    pADCTrace->command = ADC_TRACE_CMD_RECORD;
+    pTrace->fault(&sim, pADCTrace);
+    JsonNumber(pJson, "t_frozen_s", sim.t);
+    if (pADCTrace->state != ADC_TRACE_FROZEN)
+    {
+        fprintf(stderr, "tracereplay: trace not frozen\n");
+        return 0;
+    }
+    Summary(pJson, pADCTrace);
+
+    pFile = fopen(path, "wb");
+    if (pFile == NULL)
+    {
+        Error("cannot write ", path);
+    }
+    words = streamLength(pADCTrace);
+    for (n = 0; n < words; n++)
+    {
+        const uint16_t word = streamWord(pADCTrace, n);
+
+        fputc(word & 0xFF, pFile);
+        fputc(word >> 8, pFile);
+    }
+    fclose(pFile);
+    JsonInteger(pJson, "stream_words", words);
+    return 1;
+}
+
+/* Loads a stream into the trace as a frozen trace starting at sample 0 */
+static void Load(ADC_TRACE_T *pADCTrace, const uint16_t *pWord,
+                 size_t words, const char *path)
+{
+    const uint16_t channels = pWord[2], length = pWord[3];
+    const uint16_t stateSize = pWord[5], regions = pWord[6];
+    size_t position = ADC_TRACE_STREAM_HEADER;
+    uint16_t i, k;
+
+    if ((words < ADC_TRACE_STREAM_HEADER) ||
+        (pWord[0] != ADC_TRACE_STREAM_MAGIC) ||
+        (pWord[1] != ADC_TRACE_STREAM_VERSION))
+    {
+        Error("not a trace stream : ", path);
+    }
+    if ((channels != pADCTrace->channels) ||
+        (regions != pADCTrace->regions) ||
+        (stateSize != pADCTrace->stateSize) || (length == 0) ||
+        (length > ADC_TRACE_LENGTH) ||
+        (words != ADC_TRACE_STREAM_HEADER + regions + (stateSize + 1) / 2 +
+                                        (size_t)length * (channels + 1)))
+    {
+        Error("trace of another build : ", path);
+    }
+    for (i = 0; i < regions; i++)
+    {
+        if (pWord[position++] != pADCTrace->regionSize[i])
+        {
+            Error("trace of another build : ", path);
+        }
+    }
+    for (i = 0; i < stateSize; i += 2)
+    {
+        const uint16_t word = pWord[position++];
+
+        pADCTrace->snapshot[0][i] = word & 0xFF;
+        if (i + 1 < stateSize)
+        {
+            pADCTrace->snapshot[0][i + 1] = word >> 8;
+        }
+    }
+    for (k = 0; k < length; k++)
+    {
+        for (i = 0; i < channels; i++)
+        {
+            pADCTrace->sample[k][i] = (int16_t)pWord[position++];
+        }
+        pADCTrace->signature[k] = pWord[position++];
+    }
+    pADCTrace->start = 0;
+    pADCTrace->length = length;
+    pADCTrace->faultIndex = pWord[4];
+    pADCTrace->state = ADC_TRACE_FROZEN;
+}
+
+static int Replay(const TRACE_T *pTrace, const char *path, JSON_T *pJson)
+{
+    static SIM_T sim;
+    static uint16_t word[TRACE_STREAM_WORDS_MAX + 1];
+    ADC_TRACE_T *pADCTrace = Start(&sim, pTrace);
+    uint8_t bytes[2];
+    size_t words = 0;
+    FILE *pFile;
+
+    pFile = fopen(path, "rb");
+    if (pFile == NULL)
+    {
+        Error("cannot read ", path);
+    }
+    while ((words <= TRACE_STREAM_WORDS_MAX) &&
+           (fread(bytes, 1, 2, pFile) == 2))
+    {
+        word[words++] = bytes[0] | (bytes[1] << 8);
+    }
+    fclose(pFile);
+    Load(pADCTrace, word, words, path);
+    Summary(pJson, pADCTrace);
+
+    pADCTrace->command = ADC_TRACE_CMD_REPLAY;
+    while ((pADCTrace->state != ADC_TRACE_DONE) &&
+           (sim.t < TRACE_REPLAY_TIMEOUT))
+    {
+        SimRun(&sim, sim.t + 0.001);
+    }
+    JsonBool(pJson, "replayed", pADCTrace->state == ADC_TRACE_DONE);
+    JsonInteger(pJson, "mismatches", pADCTrace->mismatchCount);
+    if (pADCTrace->mismatchCount == 0)
+    {
+        JsonNumber(pJson, "first_mismatch", NAN);
+    }
+    else
+    {
+        JsonInteger(pJson, "first_mismatch", pADCTrace->firstMismatch);
+    }
+    return (pADCTrace->state == ADC_TRACE_DONE) &&
+           (pADCTrace->mismatchCount == 0);
+}
+
+int main(int argc, char **argv)
+{
+    const TRACE_T *pTrace = NULL;
+    JSON_T json;
+    size_t i;
+    int record, pass;
+
+    for (i = 0; (argc == 4) && (i < TRACES); i++)
+    {
+        if (strcmp(argv[2], trace[i].name) == 0)
+        {
+            pTrace = &trace[i];
+        }
+    }
+    record = (argc == 4) && (strcmp(argv[1], "record") == 0);
+    if ((pTrace == NULL) ||
+        (!record && (strcmp(argv[1], "replay") != 0)))
+    {
+        fprintf(stderr, "usage: tracereplay record <mc1|pfc> <file>\n"
+                        "       tracereplay replay <mc1|pfc> <file>\n");
+        return 2;
+    }
+
+    JsonInit(&json, stdout);
+    JsonObjectBegin(&json, NULL);
+    JsonString(&json, "trace", pTrace->name);
+    JsonString(&json, "image", pTrace->image);
+    JsonString(&json, record ? "record" : "replay", argv[3]);
+    pass = record ? Record(pTrace, argv[3], &json) :
+                    Replay(pTrace, argv[3], &json);
+    JsonBool(&json, "pass", pass);
+    JsonObjectEnd(&json);
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,303 @@
+/**
+ * @file host_dsp.c
+ *
+ * @brief XC16 DSP and arithmetic builtins emulated for the host build.
+ */
+#include <stdint.h>
+#include <stddef.h>
+
+#include "host_dsp.h"
+
+/* dsPIC33C cycles of the instruction sequence generated for a builtin */
+#define CYCLES_MUL      1
+#define CYCLES_MAC      1
+#define CYCLES_ACC      1
+#define CYCLES_DIV      19      /* REPEAT #17 + DIV.SD/DIV.UD/DIVF */
+
+volatile uint16_t CORCON = 0x0020;
+volatile uint16_t ACCAH, ACCAL, ACCBH, ACCBL;
+HOST_DSP_COUNT_T hostDspCount;
+
+int32_t HostAccSat(int64_t value)
+{
+    if (value > INT32_MAX)
+    {
+        hostDspCount.accSaturation++;
+        return INT32_MAX;
+    }
+    if (value < INT32_MIN)
+    {
+        hostDspCount.accSaturation++;
+        return INT32_MIN;
+    }
+    return (int32_t)value;
+}
+
+int16_t HostStoreSat(int64_t value)
+{
+    if (value > INT16_MAX)
+    {
+        hostDspCount.storeSaturation++;
+        return INT16_MAX;
+    }
+    if (value < INT16_MIN)
+    {
+        hostDspCount.storeSaturation++;
+        return INT16_MIN;
+    }
+    return (int16_t)value;
+}
+
+static int64_t Shift(int64_t value, int shift)
+{
+    /* Positive shift is right (arithmetic), negative shift is left */
+    if (shift >= 0)
+    {
+        return value >> shift;
+    }
+    return value * ((int64_t)1 << (-shift));
+}
+
+static int16_t Quotient(int64_t quotient)
+{
+    hostDspCount.div++;
+    hostDspCount.cycles += CYCLES_DIV;
+    if ((quotient > INT16_MAX) || (quotient < INT16_MIN))
+    {
+        /* Result register content is undefined on overflow */
+        hostDspCount.divOverflow++;
+    }
+    return (int16_t)quotient;
+}
+
+static void Multiply(void)
+{
+    hostDspCount.mul++;
+    hostDspCount.cycles += CYCLES_MUL;
+}
+
+static void Accumulate(void)
+{
+    hostDspCount.acc++;
+    hostDspCount.cycles += CYCLES_ACC;
+}
+
+static void Prefetch(void *pointer, void *value, int increment)
+{
+    int16_t **pp = (int16_t **)pointer;
+
+    if ((pp != NULL) && (value != NULL))
+    {
+        *(int16_t *)value = **pp;
+        *pp = (int16_t *)((char *)*pp + increment);
+    }
+}
+
+int32_t __builtin_mulss(int16_t a, int16_t b)
+{
+    Multiply();
+    return (int32_t)a * b;
+}
+
+int32_t __builtin_mulsu(int16_t a, uint16_t b)
+{
+    Multiply();
+    return (int32_t)a * b;
+}
+
+int32_t __builtin_mulus(uint16_t a, int16_t b)
+{
+    Multiply();
+    return (int32_t)a * b;
+}
+
+uint32_t __builtin_muluu(uint16_t a, uint16_t b)
+{
+    Multiply();
+    return (uint32_t)a * b;
+}
+
+int16_t __builtin_divsd(int32_t num, int16_t den)
+{
+    if (den == 0)
+    {
+        hostDspCount.divOverflow++;
+        return (int16_t)(num < 0 ? INT16_MIN : INT16_MAX);
+    }
+    return Quotient((int64_t)num / den);
+}
+
+uint16_t __builtin_divud(uint32_t num, uint16_t den)
+{
+    if (den == 0)
+    {
+        hostDspCount.divOverflow++;
+        return UINT16_MAX;
+    }
+    hostDspCount.div++;
+    hostDspCount.cycles += CYCLES_DIV;
+    if ((num / den) > UINT16_MAX)
+    {
+        hostDspCount.divOverflow++;
+    }
+    return (uint16_t)(num / den);
+}
+
+int16_t __builtin_divf(int16_t num, int16_t den)
+{
+    if (den == 0)
+    {
+        hostDspCount.divOverflow++;
+        return (int16_t)(num < 0 ? INT16_MIN : INT16_MAX);
+    }
+    return Quotient(((int64_t)num * 32768) / den);
+}
+
+int16_t __builtin_divmodsd(int32_t num, int16_t den, int16_t *remainder)
+{
+    if (den == 0)
+    {
+        hostDspCount.divOverflow++;
+        *remainder = 0;
+        return (int16_t)(num < 0 ? INT16_MIN : INT16_MAX);
+    }
+    *remainder = (int16_t)(num % den);
+    return Quotient((int64_t)num / den);
+}
+
+int32_t HostMpy(int16_t a, int16_t b, void *xp, void *xv, int xi,
+                void *yp, void *yv, int yi)
+{
+    hostDspCount.mac++;
+    hostDspCount.cycles += CYCLES_MAC;
+    Prefetch(xp, xv, xi);
+    Prefetch(yp, yv, yi);
+    /* Fractional multiply : 1.15 x 1.15 = 1.31, -1 x -1 saturates */
+    return HostAccSat((int64_t)a * b * 2);
+}
+
+int32_t HostMac(int32_t acc, int16_t a, int16_t b, void *xp, void *xv, int xi,
+                void *yp, void *yv, int yi, void *awb, int awbValue)
+{
+    (void)awb;
+    (void)awbValue;
+    hostDspCount.mac++;
+    hostDspCount.cycles += CYCLES_MAC;
+    Prefetch(xp, xv, xi);
+    Prefetch(yp, yv, yi);
+    return HostAccSat((int64_t)acc + (int64_t)a * b * 2);
+}
+
+int32_t HostMsc(int32_t acc, int16_t a, int16_t b, void *xp, void *xv, int xi,
+                void *yp, void *yv, int yi, void *awb, int awbValue)
+{
+    (void)awb;
+    (void)awbValue;
+    hostDspCount.mac++;
+    hostDspCount.cycles += CYCLES_MAC;
+    Prefetch(xp, xv, xi);
+    Prefetch(yp, yv, yi);
+    return HostAccSat((int64_t)acc - (int64_t)a * b * 2);
+}
+
+int32_t HostClrPrefetch(void *xp, void *xv, int xi, void *yp, void *yv,
+                        int yi, void *awb, int awbValue)
+{
+    (void)awb;
+    (void)awbValue;
+    Accumulate();
+    Prefetch(xp, xv, xi);
+    Prefetch(yp, yv, yi);
+    return 0;
+}
+
+int32_t __builtin_clr(void)
+{
+    Accumulate();
+    return 0;
+}
+
+int32_t __builtin_lac(int16_t value, int shift)
+{
+    Accumulate();
+    return HostAccSat(Shift((int64_t)value * 65536, shift));
+}
+
+int32_t __builtin_lacd(int32_t value, int shift)
+{
+    Accumulate();
+    return HostAccSat(Shift(value, shift));
+}
+
+int16_t __builtin_sac(int32_t acc, int shift)
+{
+    Accumulate();
+    return HostStoreSat(Shift(acc, shift) >> 16);
+}
+
+int16_t __builtin_sacr(int32_t acc, int shift)
+{
+    int64_t value = Shift(acc, shift);
+    int64_t upper = value >> 16;
+    uint16_t lower = (uint16_t)(value & 0xFFFF);
+
+    Accumulate();
+    if (CORCON & HOST_CORCON_RND)
+    {
+        /* Biased (conventional) rounding */
+        if (lower >= 0x8000)
+        {
+            upper++;
+        }
+    }
+    else
+    {
+        /* Convergent rounding : ties go to the even result */
+        if ((lower > 0x8000) || ((lower == 0x8000) && (upper & 1)))
+        {
+            upper++;
+        }
+    }
+    return HostStoreSat(upper);
+}
+
+int32_t __builtin_sacd(int32_t acc, int shift)
+{
+    Accumulate();
+    return HostAccSat(Shift(acc, shift));
+}
+
+int32_t __builtin_sftac(int32_t acc, int shift)
+{
+    Accumulate();
+    return HostAccSat(Shift(acc, shift));
+}
+
+int32_t __builtin_addab(int32_t a, int32_t b)
+{
+    Accumulate();
+    return HostAccSat((int64_t)a + b);
+}
+
+int32_t __builtin_subab(int32_t a, int32_t b)
+{
+    Accumulate();
+    return HostAccSat((int64_t)a - b);
+}
+
+void __builtin_write_OSCCONH(uint16_t value)
+{
+    (void)value;
+}
+
+void __builtin_write_OSCCONL(uint16_t value)
+{
+    (void)value;
+}
+
+void HostDspCountReset(void)
+{
+    HOST_DSP_COUNT_T zero = {0};
+
+    hostDspCount = zero;
+}
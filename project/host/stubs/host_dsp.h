@@ -0,0 +1,101 @@
+/**
+ * @file host_dsp.h
+ *
+ * @brief XC16 DSP and arithmetic builtins emulated for the host build.
+ *
+ * The dsPIC accumulators are 40 bit. Firmware runs them with normal (1.31)
+ * saturation enabled (CORCON SATA/SATB), so an accumulator value always fits
+ * in 32 bits : accumulators are emulated as saturated int32 values and the
+ * 'register int' accumulator variables of the firmware hold them unchanged.
+ * Rounding of sacr follows CORCON.RND (1 - biased, 0 - convergent).
+ *
+ * Every builtin call is counted (see HOST_DSP_COUNT_T) with the dsPIC33C
+ * cycle count of its instruction sequence, so that host runs report the
+ * DSP work of a function. Saturation of accumulators and stores and
+ * overflow of divisions are counted as well.
+ */
+#ifndef HOST_DSP_H
+#define HOST_DSP_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CORCON bits used by the emulation */
+#define HOST_CORCON_RND     0x0002
+
+typedef struct
+{
+    uint32_t
+        mul,            /* mulss, mulus, mulsu, muluu */
+        mac,            /* mpy, mac, msc */
+        acc,            /* lac, lacd, sac, sacr, sacd, sftac, addab, subab */
+        div,            /* divsd, divud, divf, divmodsd */
+        sqrt,           /* _Q15sqrt */
+        cycles,         /* Estimated dsPIC33C cycles of the calls above */
+        accSaturation,  /* Accumulator results clipped to 1.31 */
+        storeSaturation,/* sac/sacr/sacd results clipped to the word size */
+        divOverflow;    /* Quotients out of the 16 bit range */
+} HOST_DSP_COUNT_T;
+
+extern volatile uint16_t CORCON;
+extern volatile uint16_t ACCAH, ACCAL, ACCBH, ACCBL;
+extern HOST_DSP_COUNT_T hostDspCount;
+
+int32_t HostAccSat(int64_t value);
+int16_t HostStoreSat(int64_t value);
+
+int32_t __builtin_mulss(int16_t, int16_t);
+int32_t __builtin_mulsu(int16_t, uint16_t);
+int32_t __builtin_mulus(uint16_t, int16_t);
+uint32_t __builtin_muluu(uint16_t, uint16_t);
+
+int16_t __builtin_divsd(int32_t, int16_t);
+uint16_t __builtin_divud(uint32_t, uint16_t);
+int16_t __builtin_divf(int16_t, int16_t);
+int16_t __builtin_divmodsd(int32_t, int16_t, int16_t *);
+
+/* Prefetch arguments : X/Y pointer (int16_t **), prefetched value
+   (int16_t *) and pointer increment in bytes, NULL/0 when not used */
+int32_t HostMpy(int16_t, int16_t, void *, void *, int, void *, void *, int);
+int32_t HostMac(int32_t, int16_t, int16_t, void *, void *, int, void *, void *,
+                                                        int, void *, int);
+int32_t HostMsc(int32_t, int16_t, int16_t, void *, void *, int, void *, void *,
+                                                        int, void *, int);
+int32_t HostClrPrefetch(void *, void *, int, void *, void *, int, void *, int);
+
+#define __builtin_mpy(a, b, xp, xv, xi, yp, yv, yi) \
+    HostMpy((int16_t)(a), (int16_t)(b), (void *)(xp), (void *)(xv), (xi), \
+            (void *)(yp), (void *)(yv), (yi))
+#define __builtin_mac(acc, a, b, xp, xv, xi, yp, yv, yi, awb, awbv) \
+    HostMac((acc), (int16_t)(a), (int16_t)(b), (void *)(xp), (void *)(xv), \
+            (xi), (void *)(yp), (void *)(yv), (yi), (void *)(awb), (awbv))
+#define __builtin_msc(acc, a, b, xp, xv, xi, yp, yv, yi, awb, awbv) \
+    HostMsc((acc), (int16_t)(a), (int16_t)(b), (void *)(xp), (void *)(xv), \
+            (xi), (void *)(yp), (void *)(yv), (yi), (void *)(awb), (awbv))
+#define __builtin_clr_prefetch(xp, xv, xi, yp, yv, yi, awb, awbv) \
+    HostClrPrefetch((void *)(xp), (void *)(xv), (xi), (void *)(yp), \
+            (void *)(yv), (yi), (void *)(awb), (awbv))
+
+int32_t __builtin_clr(void);
+int32_t __builtin_lac(int16_t, int);
+int32_t __builtin_lacd(int32_t, int);
+int16_t __builtin_sac(int32_t, int);
+int16_t __builtin_sacr(int32_t, int);
+int32_t __builtin_sacd(int32_t, int);
+int32_t __builtin_sftac(int32_t, int);
+int32_t __builtin_addab(int32_t, int32_t);
+int32_t __builtin_subab(int32_t, int32_t);
+
+void __builtin_write_OSCCONH(uint16_t);
+void __builtin_write_OSCCONL(uint16_t);
+
+void HostDspCountReset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_DSP_H */
@@ -0,0 +1,28 @@
+/**
+ * @file host_prelude.h
+ *
+ * @brief Included ahead of every firmware translation unit of the host build
+ *        (-include). Maps XC16 keywords and attributes that have no host 
+ *        equivalent; unknown attributes (near, space, no_auto_psv) are 
+ *        ignored by the host compiler.
+ *        Host int is 32 bit : expressions that rely on 16 bit int promotion
+ *        on target may compute differently (see README.md).
+ */
+#ifndef HOST_PRELUDE_H
+#define HOST_PRELUDE_H
+
+#define __XC16_VERSION__    2000
+
+/* Accumulator variables (register int x asm("A")) become plain globals */
+#define register
+#define asm(x)
+
+/* interrupt is an x86 attribute with another signature */
+#define __interrupt__       __unused__
+#define __auto_psv__        __unused__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <xc.h>
+
+#endif /* HOST_PRELUDE_H */
@@ -0,0 +1,16 @@
+/**
+ * @file libpic30.h
+ *
+ * @brief Subset of the XC16 device support library for the host build :
+ *        delays return at once, the Secondary core is started by the host
+ *        harness and not by the Main core image.
+ */
+#ifndef HOST_LIBPIC30_H
+#define HOST_LIBPIC30_H
+
+#define __delay_ms(x)               ((void)0)
+#define __delay_us(x)               ((void)0)
+#define _program_secondary(a, b, c) ((void)0)
+#define _start_secondary()          ((void)0)
+
+#endif /* HOST_LIBPIC30_H */
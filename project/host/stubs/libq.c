@@ -0,0 +1,50 @@
+/**
+ * @file libq.c
+ *
+ * @brief Subset of the XC16 fixed point math library (libq) for the host
+ *        build.
+ */
+#include <stdint.h>
+
+#include "libq.h"
+#include "host_dsp.h"
+
+/* Approximate cycles of the libq square root */
+#define CYCLES_SQRT     130
+
+_Q15 _Q15abs(_Q15 x)
+{
+    if (x == INT16_MIN)
+    {
+        return INT16_MAX;
+    }
+    return (x < 0) ? (_Q15)-x : x;
+}
+
+_Q15 _Q15sqrt(_Q15 x)
+{
+    uint32_t square, root, bit;
+
+    hostDspCount.sqrt++;
+    hostDspCount.cycles += CYCLES_SQRT;
+    if (x <= 0)
+    {
+        return 0;
+    }
+    /* Integer square root of x * 2^15, truncated */
+    square = (uint32_t)x << 15;
+    root = 0;
+    for (bit = (uint32_t)1 << 30; bit != 0; bit >>= 2)
+    {
+        if (square >= root + bit)
+        {
+            square -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+    }
+    return (_Q15)((root > INT16_MAX) ? INT16_MAX : root);
+}
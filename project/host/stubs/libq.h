@@ -0,0 +1,27 @@
+/**
+ * @file libq.h
+ *
+ * @brief Subset of the XC16 fixed point math library (libq) for the host
+ *        build.
+ */
+#ifndef HOST_LIBQ_H
+#define HOST_LIBQ_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int16_t _Q15;
+
+/* Absolute value, -1.0 saturates to 0.99997 */
+_Q15 _Q15abs(_Q15);
+/* Square root of a positive Q15 value, 0 for negative input */
+_Q15 _Q15sqrt(_Q15);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_LIBQ_H */
@@ -0,0 +1,216 @@
+/* Generated by tools/gen_sfr.py, do not edit */
+#include "host_sfr.h"
+
+volatile uint16_t ADCBUF0;
+volatile uint16_t ADCBUF11;
+volatile uint16_t ADCBUF12;
+volatile uint16_t ADCON1H;
+volatile HOST_ADCON1HBITS_T ADCON1Hbits;
+volatile uint16_t ADCON1L;
+volatile HOST_ADCON1LBITS_T ADCON1Lbits;
+volatile uint16_t ADCON2H;
+volatile HOST_ADCON2HBITS_T ADCON2Hbits;
+volatile uint16_t ADCON2L;
+volatile HOST_ADCON2LBITS_T ADCON2Lbits;
+volatile uint16_t ADCON3H;
+volatile HOST_ADCON3HBITS_T ADCON3Hbits;
+volatile uint16_t ADCON3L;
+volatile HOST_ADCON3LBITS_T ADCON3Lbits;
+volatile uint16_t ADCON5H;
+volatile HOST_ADCON5HBITS_T ADCON5Hbits;
+volatile uint16_t ADCON5L;
+volatile HOST_ADCON5LBITS_T ADCON5Lbits;
+volatile uint16_t ADEIEH;
+volatile uint16_t ADEIEL;
+volatile uint16_t ADEISTATH;
+volatile uint16_t ADEISTATL;
+volatile uint16_t ADIEH;
+volatile uint16_t ADIEL;
+volatile uint16_t ADMOD0H;
+volatile HOST_ADMOD0HBITS_T ADMOD0Hbits;
+volatile uint16_t ADMOD0L;
+volatile HOST_ADMOD0LBITS_T ADMOD0Lbits;
+volatile uint16_t ADMOD1L;
+volatile uint16_t ADSTATH;
+volatile uint16_t ADSTATL;
+volatile uint16_t ADTRIG0L;
+volatile HOST_ADTRIG0LBITS_T ADTRIG0Lbits;
+volatile uint16_t ADTRIG2H;
+volatile HOST_ADTRIG2HBITS_T ADTRIG2Hbits;
+volatile uint16_t ADTRIG3L;
+volatile HOST_ADTRIG3LBITS_T ADTRIG3Lbits;
+volatile uint16_t ANSELA;
+volatile HOST_ANSELABITS_T ANSELAbits;
+volatile uint16_t ANSELB;
+volatile HOST_ANSELBBITS_T ANSELBbits;
+volatile uint16_t ANSELC;
+volatile HOST_ANSELCBITS_T ANSELCbits;
+volatile uint16_t CLKDIV;
+volatile HOST_CLKDIVBITS_T CLKDIVbits;
+volatile uint16_t CMBTRIGH;
+volatile uint16_t CMBTRIGL;
+volatile uint16_t FSCL;
+volatile uint16_t FSMINPER;
+volatile uint16_t IEC4;
+volatile HOST_IEC4BITS_T IEC4bits;
+volatile uint16_t IFS4;
+volatile HOST_IFS4BITS_T IFS4bits;
+volatile uint16_t IPC17;
+volatile HOST_IPC17BITS_T IPC17bits;
+volatile uint16_t LATE;
+volatile HOST_LATEBITS_T LATEbits;
+volatile uint16_t LFSR;
+volatile uint16_t LOGCONA;
+volatile uint16_t LOGCONB;
+volatile uint16_t LOGCONC;
+volatile uint16_t LOGCOND;
+volatile uint16_t LOGCONE;
+volatile uint16_t LOGCONF;
+volatile uint16_t MDC;
+volatile uint16_t MPER;
+volatile uint16_t MPHASE;
+volatile uint16_t MSI1CON;
+volatile HOST_MSI1CONBITS_T MSI1CONbits;
+volatile uint16_t MSI1MBX0D;
+volatile uint16_t MSI1MBX10D;
+volatile uint16_t MSI1MBX11D;
+volatile uint16_t MSI1MBX12D;
+volatile uint16_t MSI1MBX13D;
+volatile uint16_t MSI1MBX14D;
+volatile uint16_t host_MSI1MBX15D;
+volatile uint16_t *host_sfr_MSI1MBX15D(void)
+{
+    HostSfrAccess(HOST_SFR_ID_MSI1MBX15D, &host_MSI1MBX15D);
+    return &host_MSI1MBX15D;
+}
+volatile uint16_t MSI1MBX1D;
+volatile uint16_t MSI1MBX2D;
+volatile uint16_t MSI1MBX3D;
+volatile uint16_t MSI1MBX4D;
+volatile uint16_t MSI1MBX5D;
+volatile uint16_t host_MSI1MBX6D;
+volatile uint16_t *host_sfr_MSI1MBX6D(void)
+{
+    HostSfrAccess(HOST_SFR_ID_MSI1MBX6D, &host_MSI1MBX6D);
+    return &host_MSI1MBX6D;
+}
+volatile uint16_t MSI1MBX7D;
+volatile uint16_t MSI1MBX8D;
+volatile uint16_t MSI1MBX9D;
+volatile uint16_t MSI1MBXS;
+volatile HOST_MSI1MBXSBITS_T host_MSI1MBXSbits;
+volatile HOST_MSI1MBXSBITS_T *host_sfr_MSI1MBXSbits(void)
+{
+    HostSfrAccess(HOST_SFR_ID_MSI1MBXS, &host_MSI1MBXSbits);
+    return &host_MSI1MBXSbits;
+}
+volatile uint16_t OSCCON;
+volatile HOST_OSCCONBITS_T OSCCONbits;
+volatile uint16_t PCLKCON;
+volatile HOST_PCLKCONBITS_T PCLKCONbits;
+volatile uint16_t PG4CLPCIH;
+volatile uint16_t PG4CLPCIL;
+volatile uint16_t PG4CONH;
+volatile HOST_PG4CONHBITS_T PG4CONHbits;
+volatile uint16_t PG4CONL;
+volatile HOST_PG4CONLBITS_T PG4CONLbits;
+volatile uint16_t PG4DC;
+volatile uint16_t PG4DCA;
+volatile uint16_t PG4DTH;
+volatile uint16_t PG4DTL;
+volatile uint16_t PG4EVTH;
+volatile HOST_PG4EVTHBITS_T PG4EVTHbits;
+volatile uint16_t PG4EVTL;
+volatile HOST_PG4EVTLBITS_T PG4EVTLbits;
+volatile uint16_t PG4FFPCIH;
+volatile uint16_t PG4FFPCIL;
+volatile uint16_t PG4FPCIH;
+volatile HOST_PG4FPCIHBITS_T PG4FPCIHbits;
+volatile uint16_t PG4FPCIL;
+volatile HOST_PG4FPCILBITS_T PG4FPCILbits;
+volatile uint16_t PG4IOCONH;
+volatile HOST_PG4IOCONHBITS_T PG4IOCONHbits;
+volatile HOST_PG4IOCONL_T host_PG4IOCONL;
+volatile uint16_t PG4LEBH;
+volatile uint16_t PG4LEBL;
+volatile uint16_t PG4PER;
+volatile uint16_t PG4PHASE;
+volatile uint16_t PG4SPCIH;
+volatile uint16_t PG4SPCIL;
+volatile uint16_t PG4STAT;
+volatile uint16_t PG4TRIGA;
+volatile uint16_t PG4TRIGB;
+volatile uint16_t PG4TRIGC;
+volatile uint16_t PLLDIV;
+volatile HOST_PLLDIVBITS_T PLLDIVbits;
+volatile uint16_t PLLFBD;
+volatile HOST_PLLFBDBITS_T PLLFBDbits;
+volatile uint16_t PORTE;
+volatile HOST_PORTEBITS_T PORTEbits;
+volatile uint16_t PR1;
+volatile uint16_t PWMEVTA;
+volatile uint16_t PWMEVTB;
+volatile uint16_t PWMEVTC;
+volatile HOST_PWMEVTCBITS_T PWMEVTCbits;
+volatile uint16_t PWMEVTD;
+volatile uint16_t PWMEVTE;
+volatile uint16_t PWMEVTF;
+volatile uint16_t RCON;
+volatile HOST_RCONBITS_T RCONbits;
+volatile uint16_t REFOCONH;
+volatile HOST_REFOCONHBITS_T REFOCONHbits;
+volatile uint16_t REFOCONL;
+volatile HOST_REFOCONLBITS_T REFOCONLbits;
+volatile uint16_t T1CON;
+volatile HOST_T1CONBITS_T T1CONbits;
+volatile uint16_t host_TMR1;
+volatile uint16_t *host_sfr_TMR1(void)
+{
+    HostSfrAccess(HOST_SFR_ID_TMR1, &host_TMR1);
+    return &host_TMR1;
+}
+volatile uint16_t TRISA;
+volatile HOST_TRISABITS_T TRISAbits;
+volatile uint16_t TRISB;
+volatile HOST_TRISBBITS_T TRISBbits;
+volatile uint16_t TRISC;
+volatile HOST_TRISCBITS_T TRISCbits;
+volatile uint16_t TRISE;
+volatile HOST_TRISEBITS_T TRISEbits;
+volatile uint16_t U1BRG;
+volatile uint16_t U1BRGH;
+volatile uint16_t U1INT;
+volatile HOST_U1INTBITS_T U1INTbits;
+volatile uint16_t U1MODE;
+volatile HOST_U1MODEBITS_T U1MODEbits;
+volatile uint16_t U1MODEH;
+volatile HOST_U1MODEHBITS_T U1MODEHbits;
+volatile uint16_t U1P1;
+volatile uint16_t U1P2;
+volatile uint16_t U1P3;
+volatile uint16_t U1P3H;
+volatile uint16_t U1RXCHK;
+volatile uint16_t U1RXREG;
+volatile HOST_U1RXREGBITS_T U1RXREGbits;
+volatile uint16_t U1SCCON;
+volatile uint16_t U1SCINT;
+volatile uint16_t U1STA;
+volatile HOST_U1STABITS_T U1STAbits;
+volatile uint16_t U1STAH;
+volatile HOST_U1STAHBITS_T U1STAHbits;
+volatile uint16_t U1TXCHK;
+volatile uint16_t U1TXREG;
+volatile HOST_U1TXREGBITS_T U1TXREGbits;
+volatile uint16_t _ADCAN12IE;
+volatile uint16_t _ADCAN12IF;
+volatile uint16_t _ADCAN12IP;
+volatile uint16_t _IE12;
+volatile uint16_t _RP46R;
+volatile uint16_t _T1IE;
+volatile uint16_t _T1IF;
+volatile uint16_t _T1IP;
+volatile uint16_t _U1RXIE;
+volatile uint16_t _U1RXIF;
+volatile uint16_t _U1RXR;
+volatile uint16_t _U1TXIE;
+volatile uint16_t _U1TXIF;
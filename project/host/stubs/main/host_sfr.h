@@ -0,0 +1,581 @@
+/**
+ * @file host_sfr.h
+ *
+ * @brief Special function registers of the main core for the host build.
+ *        Generated by tools/gen_sfr.py from the firmware sources, do not
+ *        edit.
+ */
+#ifndef HOST_SFR_H
+#define HOST_SFR_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+    HOST_SFR_ID_MSI1MBX15D,
+    HOST_SFR_ID_MSI1MBX6D,
+    HOST_SFR_ID_MSI1MBXS,
+    HOST_SFR_ID_TMR1,
+    HOST_SFR_ID_COUNT
+} HOST_SFR_ID_T;
+
+/* Implemented by the host port, called before each access */
+void HostSfrAccess(HOST_SFR_ID_T id, volatile void *storage);
+
+extern volatile uint16_t ADCBUF0;
+extern volatile uint16_t ADCBUF11;
+extern volatile uint16_t ADCBUF12;
+extern volatile uint16_t ADCON1H;
+typedef struct
+{
+    uint16_t FORM;
+    uint16_t SHRRES;
+} HOST_ADCON1HBITS_T;
+extern volatile HOST_ADCON1HBITS_T ADCON1Hbits;
+extern volatile uint16_t ADCON1L;
+typedef struct
+{
+    uint16_t ADON;
+    uint16_t ADSIDL;
+} HOST_ADCON1LBITS_T;
+extern volatile HOST_ADCON1LBITS_T ADCON1Lbits;
+extern volatile uint16_t ADCON2H;
+typedef struct
+{
+    uint16_t SHRSAMC;
+} HOST_ADCON2HBITS_T;
+extern volatile HOST_ADCON2HBITS_T ADCON2Hbits;
+extern volatile uint16_t ADCON2L;
+typedef struct
+{
+    uint16_t EIEN;
+    uint16_t SHRADCS;
+} HOST_ADCON2LBITS_T;
+extern volatile HOST_ADCON2LBITS_T ADCON2Lbits;
+extern volatile uint16_t ADCON3H;
+typedef struct
+{
+    uint16_t CLKDIV;
+    uint16_t CLKSEL;
+    uint16_t SHREN;
+} HOST_ADCON3HBITS_T;
+extern volatile HOST_ADCON3HBITS_T ADCON3Hbits;
+extern volatile uint16_t ADCON3L;
+typedef struct
+{
+    uint16_t REFSEL;
+} HOST_ADCON3LBITS_T;
+extern volatile HOST_ADCON3LBITS_T ADCON3Lbits;
+extern volatile uint16_t ADCON5H;
+typedef struct
+{
+    uint16_t SHRCIE;
+    uint16_t WARMTIME;
+} HOST_ADCON5HBITS_T;
+extern volatile HOST_ADCON5HBITS_T ADCON5Hbits;
+extern volatile uint16_t ADCON5L;
+typedef struct
+{
+    uint16_t SHRPWR;
+    uint16_t SHRRDY;
+} HOST_ADCON5LBITS_T;
+extern volatile HOST_ADCON5LBITS_T ADCON5Lbits;
+extern volatile uint16_t ADEIEH;
+extern volatile uint16_t ADEIEL;
+extern volatile uint16_t ADEISTATH;
+extern volatile uint16_t ADEISTATL;
+extern volatile uint16_t ADIEH;
+extern volatile uint16_t ADIEL;
+extern volatile uint16_t ADMOD0H;
+typedef struct
+{
+    uint16_t SIGN11;
+    uint16_t SIGN12;
+} HOST_ADMOD0HBITS_T;
+extern volatile HOST_ADMOD0HBITS_T ADMOD0Hbits;
+extern volatile uint16_t ADMOD0L;
+typedef struct
+{
+    uint16_t SIGN0;
+} HOST_ADMOD0LBITS_T;
+extern volatile HOST_ADMOD0LBITS_T ADMOD0Lbits;
+extern volatile uint16_t ADMOD1L;
+extern volatile uint16_t ADSTATH;
+extern volatile uint16_t ADSTATL;
+extern volatile uint16_t ADTRIG0L;
+typedef struct
+{
+    uint16_t TRGSRC0;
+} HOST_ADTRIG0LBITS_T;
+extern volatile HOST_ADTRIG0LBITS_T ADTRIG0Lbits;
+extern volatile uint16_t ADTRIG2H;
+typedef struct
+{
+    uint16_t TRGSRC11;
+} HOST_ADTRIG2HBITS_T;
+extern volatile HOST_ADTRIG2HBITS_T ADTRIG2Hbits;
+extern volatile uint16_t ADTRIG3L;
+typedef struct
+{
+    uint16_t TRGSRC12;
+} HOST_ADTRIG3LBITS_T;
+extern volatile HOST_ADTRIG3LBITS_T ADTRIG3Lbits;
+extern volatile uint16_t ANSELA;
+typedef struct
+{
+    uint16_t ANSELA0;
+} HOST_ANSELABITS_T;
+extern volatile HOST_ANSELABITS_T ANSELAbits;
+extern volatile uint16_t ANSELB;
+typedef struct
+{
+    uint16_t ANSELB9;
+} HOST_ANSELBBITS_T;
+extern volatile HOST_ANSELBBITS_T ANSELBbits;
+extern volatile uint16_t ANSELC;
+typedef struct
+{
+    uint16_t ANSELC0;
+} HOST_ANSELCBITS_T;
+extern volatile HOST_ANSELCBITS_T ANSELCbits;
+extern volatile uint16_t CLKDIV;
+typedef struct
+{
+    uint16_t DOZEN;
+    uint16_t FRCDIV;
+    uint16_t PLLPRE;
+} HOST_CLKDIVBITS_T;
+extern volatile HOST_CLKDIVBITS_T CLKDIVbits;
+extern volatile uint16_t CMBTRIGH;
+extern volatile uint16_t CMBTRIGL;
+extern volatile uint16_t FSCL;
+extern volatile uint16_t FSMINPER;
+extern volatile uint16_t IEC4;
+typedef struct
+{
+    uint16_t PWM4IE;
+} HOST_IEC4BITS_T;
+extern volatile HOST_IEC4BITS_T IEC4bits;
+extern volatile uint16_t IFS4;
+typedef struct
+{
+    uint16_t PWM4IF;
+} HOST_IFS4BITS_T;
+extern volatile HOST_IFS4BITS_T IFS4bits;
+extern volatile uint16_t IPC17;
+typedef struct
+{
+    uint16_t PWM4IP;
+} HOST_IPC17BITS_T;
+extern volatile HOST_IPC17BITS_T IPC17bits;
+extern volatile uint16_t LATE;
+typedef struct
+{
+    uint16_t LATE1;
+    uint16_t LATE2;
+    uint16_t LATE3;
+} HOST_LATEBITS_T;
+extern volatile HOST_LATEBITS_T LATEbits;
+extern volatile uint16_t LFSR;
+extern volatile uint16_t LOGCONA;
+extern volatile uint16_t LOGCONB;
+extern volatile uint16_t LOGCONC;
+extern volatile uint16_t LOGCOND;
+extern volatile uint16_t LOGCONE;
+extern volatile uint16_t LOGCONF;
+extern volatile uint16_t MDC;
+extern volatile uint16_t MPER;
+extern volatile uint16_t MPHASE;
+extern volatile uint16_t MSI1CON;
+typedef struct
+{
+    uint16_t MTSIRQ;
+} HOST_MSI1CONBITS_T;
+extern volatile HOST_MSI1CONBITS_T MSI1CONbits;
+extern volatile uint16_t MSI1MBX0D;
+extern volatile uint16_t MSI1MBX10D;
+extern volatile uint16_t MSI1MBX11D;
+extern volatile uint16_t MSI1MBX12D;
+extern volatile uint16_t MSI1MBX13D;
+extern volatile uint16_t MSI1MBX14D;
+extern volatile uint16_t host_MSI1MBX15D;
+volatile uint16_t *host_sfr_MSI1MBX15D(void);
+#define MSI1MBX15D (*host_sfr_MSI1MBX15D())
+extern volatile uint16_t MSI1MBX1D;
+extern volatile uint16_t MSI1MBX2D;
+extern volatile uint16_t MSI1MBX3D;
+extern volatile uint16_t MSI1MBX4D;
+extern volatile uint16_t MSI1MBX5D;
+extern volatile uint16_t host_MSI1MBX6D;
+volatile uint16_t *host_sfr_MSI1MBX6D(void);
+#define MSI1MBX6D (*host_sfr_MSI1MBX6D())
+extern volatile uint16_t MSI1MBX7D;
+extern volatile uint16_t MSI1MBX8D;
+extern volatile uint16_t MSI1MBX9D;
+extern volatile uint16_t MSI1MBXS;
+typedef struct
+{
+    uint16_t DTRDYA;
+    uint16_t DTRDYB;
+} HOST_MSI1MBXSBITS_T;
+extern volatile HOST_MSI1MBXSBITS_T host_MSI1MBXSbits;
+volatile HOST_MSI1MBXSBITS_T *host_sfr_MSI1MBXSbits(void);
+#define MSI1MBXSbits (*host_sfr_MSI1MBXSbits())
+extern volatile uint16_t OSCCON;
+typedef struct
+{
+    uint16_t LOCK;
+    uint16_t OSWEN;
+} HOST_OSCCONBITS_T;
+extern volatile HOST_OSCCONBITS_T OSCCONbits;
+extern volatile uint16_t PCLKCON;
+typedef struct
+{
+    uint16_t DIVSEL;
+    uint16_t LOCK;
+    uint16_t MCLKSEL;
+} HOST_PCLKCONBITS_T;
+extern volatile HOST_PCLKCONBITS_T PCLKCONbits;
+extern volatile uint16_t PG4CLPCIH;
+extern volatile uint16_t PG4CLPCIL;
+extern volatile uint16_t PG4CONH;
+typedef struct
+{
+    uint16_t MDCSEL;
+    uint16_t MPERSEL;
+    uint16_t MPHSEL;
+    uint16_t MSTEN;
+    uint16_t SOCS;
+    uint16_t TRGMOD;
+    uint16_t UPDMOD;
+} HOST_PG4CONHBITS_T;
+extern volatile HOST_PG4CONHBITS_T PG4CONHbits;
+extern volatile uint16_t PG4CONL;
+typedef struct
+{
+    uint16_t CLKSEL;
+    uint16_t MODSEL;
+    uint16_t ON;
+    uint16_t TRGCNT;
+} HOST_PG4CONLBITS_T;
+extern volatile HOST_PG4CONLBITS_T PG4CONLbits;
+extern volatile uint16_t PG4DC;
+extern volatile uint16_t PG4DCA;
+extern volatile uint16_t PG4DTH;
+extern volatile uint16_t PG4DTL;
+extern volatile uint16_t PG4EVTH;
+typedef struct
+{
+    uint16_t ADTR1OFS;
+    uint16_t ADTR2EN1;
+    uint16_t ADTR2EN2;
+    uint16_t ADTR2EN3;
+    uint16_t CLIEN;
+    uint16_t FFIEN;
+    uint16_t FLTIEN;
+    uint16_t IEVTSEL;
+    uint16_t SIEN;
+} HOST_PG4EVTHBITS_T;
+extern volatile HOST_PG4EVTHBITS_T PG4EVTHbits;
+extern volatile uint16_t PG4EVTL;
+typedef struct
+{
+    uint16_t ADTR1EN1;
+    uint16_t ADTR1EN2;
+    uint16_t ADTR1EN3;
+    uint16_t ADTR1PS;
+    uint16_t PGTRGSEL;
+    uint16_t UPDTRG;
+} HOST_PG4EVTLBITS_T;
+extern volatile HOST_PG4EVTLBITS_T PG4EVTLbits;
+extern volatile uint16_t PG4FFPCIH;
+extern volatile uint16_t PG4FFPCIL;
+extern volatile uint16_t PG4FPCIH;
+typedef struct
+{
+    uint16_t ACP;
+    uint16_t BPEN;
+    uint16_t BPSEL;
+    uint16_t PCIGT;
+    uint16_t TQPS;
+    uint16_t TQSS;
+} HOST_PG4FPCIHBITS_T;
+extern volatile HOST_PG4FPCIHBITS_T PG4FPCIHbits;
+extern volatile uint16_t PG4FPCIL;
+typedef struct
+{
+    uint16_t AQPS;
+    uint16_t AQSS;
+    uint16_t PPS;
+    uint16_t PSS;
+    uint16_t PSYNC;
+    uint16_t TERM;
+    uint16_t TSYNCDIS;
+} HOST_PG4FPCILBITS_T;
+extern volatile HOST_PG4FPCILBITS_T PG4FPCILbits;
+extern volatile uint16_t PG4IOCONH;
+typedef struct
+{
+    uint16_t CAPSRC;
+    uint16_t DTCMPSEL;
+    uint16_t PENH;
+    uint16_t PENL;
+    uint16_t PMOD;
+    uint16_t POLH;
+    uint16_t POLL;
+} HOST_PG4IOCONHBITS_T;
+extern volatile HOST_PG4IOCONHBITS_T PG4IOCONHbits;
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        uint16_t DBDAT:2;
+        uint16_t FFDAT:2;
+        uint16_t CLDAT:2;
+        uint16_t FLTDAT:2;
+        uint16_t OSYNC:2;
+        uint16_t OVRDAT:2;
+        uint16_t OVRENL:1;
+        uint16_t OVRENH:1;
+        uint16_t SWAP:1;
+        uint16_t CLMOD:1;
+    } bits;
+} HOST_PG4IOCONL_T;
+extern volatile HOST_PG4IOCONL_T host_PG4IOCONL;
+#define PG4IOCONL host_PG4IOCONL.reg
+#define PG4IOCONLbits host_PG4IOCONL.bits
+extern volatile uint16_t PG4LEBH;
+extern volatile uint16_t PG4LEBL;
+extern volatile uint16_t PG4PER;
+extern volatile uint16_t PG4PHASE;
+extern volatile uint16_t PG4SPCIH;
+extern volatile uint16_t PG4SPCIL;
+extern volatile uint16_t PG4STAT;
+extern volatile uint16_t PG4TRIGA;
+extern volatile uint16_t PG4TRIGB;
+extern volatile uint16_t PG4TRIGC;
+extern volatile uint16_t PLLDIV;
+typedef struct
+{
+    uint16_t POST1DIV;
+    uint16_t POST2DIV;
+    uint16_t VCODIV;
+} HOST_PLLDIVBITS_T;
+extern volatile HOST_PLLDIVBITS_T PLLDIVbits;
+extern volatile uint16_t PLLFBD;
+typedef struct
+{
+    uint16_t PLLFBDIV;
+} HOST_PLLFBDBITS_T;
+extern volatile HOST_PLLFBDBITS_T PLLFBDbits;
+extern volatile uint16_t PORTE;
+typedef struct
+{
+    uint16_t RE4;
+} HOST_PORTEBITS_T;
+extern volatile HOST_PORTEBITS_T PORTEbits;
+extern volatile uint16_t PR1;
+extern volatile uint16_t PWMEVTA;
+extern volatile uint16_t PWMEVTB;
+extern volatile uint16_t PWMEVTC;
+typedef struct
+{
+    uint16_t EVTCOEN;
+    uint16_t EVTCPGS;
+    uint16_t EVTCPOL;
+    uint16_t EVTCSEL;
+    uint16_t EVTCSTRD;
+    uint16_t EVTCSYNC;
+} HOST_PWMEVTCBITS_T;
+extern volatile HOST_PWMEVTCBITS_T PWMEVTCbits;
+extern volatile uint16_t PWMEVTD;
+extern volatile uint16_t PWMEVTE;
+extern volatile uint16_t PWMEVTF;
+extern volatile uint16_t RCON;
+typedef struct
+{
+    uint16_t SWDTEN;
+} HOST_RCONBITS_T;
+extern volatile HOST_RCONBITS_T RCONbits;
+extern volatile uint16_t REFOCONH;
+typedef struct
+{
+    uint16_t RODIV;
+} HOST_REFOCONHBITS_T;
+extern volatile HOST_REFOCONHBITS_T REFOCONHbits;
+extern volatile uint16_t REFOCONL;
+typedef struct
+{
+    uint16_t ROACTIVE;
+    uint16_t ROEN;
+    uint16_t ROOUT;
+    uint16_t ROSEL;
+    uint16_t ROSIDL;
+    uint16_t ROSLP;
+} HOST_REFOCONLBITS_T;
+extern volatile HOST_REFOCONLBITS_T REFOCONLbits;
+extern volatile uint16_t T1CON;
+typedef struct
+{
+    uint16_t TCKPS;
+    uint16_t TCS;
+    uint16_t TGATE;
+    uint16_t TON;
+    uint16_t TSIDL;
+    uint16_t TSYNC;
+} HOST_T1CONBITS_T;
+extern volatile HOST_T1CONBITS_T T1CONbits;
+extern volatile uint16_t host_TMR1;
+volatile uint16_t *host_sfr_TMR1(void);
+#define TMR1 (*host_sfr_TMR1())
+extern volatile uint16_t TRISA;
+typedef struct
+{
+    uint16_t TRISA0;
+} HOST_TRISABITS_T;
+extern volatile HOST_TRISABITS_T TRISAbits;
+extern volatile uint16_t TRISB;
+typedef struct
+{
+    uint16_t TRISB9;
+} HOST_TRISBBITS_T;
+extern volatile HOST_TRISBBITS_T TRISBbits;
+extern volatile uint16_t TRISC;
+typedef struct
+{
+    uint16_t TRISC0;
+    uint16_t TRISC12;
+    uint16_t TRISC15;
+} HOST_TRISCBITS_T;
+extern volatile HOST_TRISCBITS_T TRISCbits;
+extern volatile uint16_t TRISE;
+typedef struct
+{
+    uint16_t TRISE1;
+    uint16_t TRISE2;
+    uint16_t TRISE3;
+    uint16_t TRISE4;
+} HOST_TRISEBITS_T;
+extern volatile HOST_TRISEBITS_T TRISEbits;
+extern volatile uint16_t U1BRG;
+extern volatile uint16_t U1BRGH;
+extern volatile uint16_t U1INT;
+typedef struct
+{
+    uint16_t ABDIE;
+    uint16_t ABDIF;
+    uint16_t WUIF;
+} HOST_U1INTBITS_T;
+extern volatile HOST_U1INTBITS_T U1INTbits;
+extern volatile uint16_t U1MODE;
+typedef struct
+{
+    uint16_t ABAUD;
+    uint16_t BRGH;
+    uint16_t BRKOVR;
+    uint16_t MOD;
+    uint16_t RXBIMD;
+    uint16_t UARTEN;
+    uint16_t URXEN;
+    uint16_t USIDL;
+    uint16_t UTXBRK;
+    uint16_t UTXEN;
+    uint16_t WAKE;
+} HOST_U1MODEBITS_T;
+extern volatile HOST_U1MODEBITS_T U1MODEbits;
+extern volatile uint16_t U1MODEH;
+typedef struct
+{
+    uint16_t ACTIVE;
+    uint16_t BCLKSEL;
+    uint16_t C0EN;
+    uint16_t FLO;
+    uint16_t HALFDPLX;
+    uint16_t RUNOVF;
+    uint16_t SLPEN;
+    uint16_t STSEL;
+    uint16_t URXINV;
+    uint16_t UTXINV;
+} HOST_U1MODEHBITS_T;
+extern volatile HOST_U1MODEHBITS_T U1MODEHbits;
+extern volatile uint16_t U1P1;
+extern volatile uint16_t U1P2;
+extern volatile uint16_t U1P3;
+extern volatile uint16_t U1P3H;
+extern volatile uint16_t U1RXCHK;
+extern volatile uint16_t U1RXREG;
+typedef struct
+{
+    uint16_t RXREG;
+} HOST_U1RXREGBITS_T;
+extern volatile HOST_U1RXREGBITS_T U1RXREGbits;
+extern volatile uint16_t U1SCCON;
+extern volatile uint16_t U1SCINT;
+extern volatile uint16_t U1STA;
+typedef struct
+{
+    uint16_t ABDOVE;
+    uint16_t ABDOVF;
+    uint16_t CERIE;
+    uint16_t CERIF;
+    uint16_t FERIE;
+    uint16_t FERR;
+    uint16_t OERIE;
+    uint16_t OERR;
+    uint16_t PERIE;
+    uint16_t PERR;
+    uint16_t RXBKIE;
+    uint16_t RXBKIF;
+    uint16_t TRMT;
+    uint16_t TXCIE;
+    uint16_t TXCIF;
+    uint16_t TXMTIE;
+} HOST_U1STABITS_T;
+extern volatile HOST_U1STABITS_T U1STAbits;
+extern volatile uint16_t U1STAH;
+typedef struct
+{
+    uint16_t RIDLE;
+    uint16_t STPMD;
+    uint16_t TXWRE;
+    uint16_t URXBE;
+    uint16_t URXBF;
+    uint16_t URXISEL;
+    uint16_t UTXBE;
+    uint16_t UTXBF;
+    uint16_t UTXISEL;
+    uint16_t XON;
+} HOST_U1STAHBITS_T;
+extern volatile HOST_U1STAHBITS_T U1STAHbits;
+extern volatile uint16_t U1TXCHK;
+extern volatile uint16_t U1TXREG;
+typedef struct
+{
+    uint16_t LAST;
+    uint16_t TXREG;
+} HOST_U1TXREGBITS_T;
+extern volatile HOST_U1TXREGBITS_T U1TXREGbits;
+extern volatile uint16_t _ADCAN12IE;
+extern volatile uint16_t _ADCAN12IF;
+extern volatile uint16_t _ADCAN12IP;
+extern volatile uint16_t _IE12;
+extern volatile uint16_t _RP46R;
+extern volatile uint16_t _T1IE;
+extern volatile uint16_t _T1IF;
+extern volatile uint16_t _T1IP;
+extern volatile uint16_t _U1RXIE;
+extern volatile uint16_t _U1RXIF;
+extern volatile uint16_t _U1RXR;
+extern volatile uint16_t _U1TXIE;
+extern volatile uint16_t _U1TXIF;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_SFR_H */
@@ -0,0 +1,13 @@
+/**
+ * @file mcapp_pmsm.h
+ *
+ * @brief Secondary core image, generated by MPLAB X for the Main core
+ *        project. In the host build both cores are linked into one
+ *        executable, the image is not used (see libpic30.h).
+ */
+#ifndef HOST_MCAPP_PMSM_H
+#define HOST_MCAPP_PMSM_H
+
+#define mcapp_pmsm  0
+
+#endif /* HOST_MCAPP_PMSM_H */
@@ -0,0 +1,526 @@
+/* Generated by tools/gen_sfr.py, do not edit */
+#include "host_sfr.h"
+
+volatile uint16_t ADCBUF0;
+volatile uint16_t ADCBUF1;
+volatile uint16_t ADCBUF10;
+volatile uint16_t ADCBUF13;
+volatile uint16_t ADCBUF15;
+volatile uint16_t ADCBUF18;
+volatile uint16_t ADCON1H;
+volatile HOST_ADCON1HBITS_T ADCON1Hbits;
+volatile uint16_t ADCON1L;
+volatile HOST_ADCON1LBITS_T ADCON1Lbits;
+volatile uint16_t ADCON2H;
+volatile HOST_ADCON2HBITS_T ADCON2Hbits;
+volatile uint16_t ADCON2L;
+volatile HOST_ADCON2LBITS_T ADCON2Lbits;
+volatile uint16_t ADCON3H;
+volatile HOST_ADCON3HBITS_T ADCON3Hbits;
+volatile uint16_t ADCON3L;
+volatile HOST_ADCON3LBITS_T ADCON3Lbits;
+volatile uint16_t ADCON4H;
+volatile HOST_ADCON4HBITS_T ADCON4Hbits;
+volatile uint16_t ADCON4L;
+volatile HOST_ADCON4LBITS_T ADCON4Lbits;
+volatile uint16_t ADCON5H;
+volatile HOST_ADCON5HBITS_T ADCON5Hbits;
+volatile uint16_t ADCON5L;
+volatile HOST_ADCON5LBITS_T ADCON5Lbits;
+volatile uint16_t ADCORE0H;
+volatile HOST_ADCORE0HBITS_T ADCORE0Hbits;
+volatile uint16_t ADCORE0L;
+volatile HOST_ADCORE0LBITS_T ADCORE0Lbits;
+volatile uint16_t ADCORE1H;
+volatile HOST_ADCORE1HBITS_T ADCORE1Hbits;
+volatile uint16_t ADCORE1L;
+volatile HOST_ADCORE1LBITS_T ADCORE1Lbits;
+volatile uint16_t ADEIEH;
+volatile HOST_ADEIEHBITS_T ADEIEHbits;
+volatile uint16_t ADEIEL;
+volatile HOST_ADEIELBITS_T ADEIELbits;
+volatile uint16_t ADEISTATH;
+volatile uint16_t ADEISTATL;
+volatile uint16_t ADFL0CON;
+volatile HOST_ADFL0CONBITS_T host_ADFL0CONbits;
+volatile HOST_ADFL0CONBITS_T *host_sfr_ADFL0CONbits(void)
+{
+    HostSfrAccess(HOST_SFR_ID_ADFL0CON, &host_ADFL0CONbits);
+    return &host_ADFL0CONbits;
+}
+volatile uint16_t ADFL0DAT;
+volatile uint16_t ADFL1CON;
+volatile HOST_ADFL1CONBITS_T host_ADFL1CONbits;
+volatile HOST_ADFL1CONBITS_T *host_sfr_ADFL1CONbits(void)
+{
+    HostSfrAccess(HOST_SFR_ID_ADFL1CON, &host_ADFL1CONbits);
+    return &host_ADFL1CONbits;
+}
+volatile uint16_t ADFL1DAT;
+volatile uint16_t ADIEH;
+volatile uint16_t ADIEL;
+volatile uint16_t ADMOD0H;
+volatile HOST_ADMOD0HBITS_T ADMOD0Hbits;
+volatile uint16_t ADMOD0L;
+volatile HOST_ADMOD0LBITS_T ADMOD0Lbits;
+volatile uint16_t ADMOD1L;
+volatile HOST_ADMOD1LBITS_T ADMOD1Lbits;
+volatile uint16_t ADSTATH;
+volatile HOST_ADSTATHBITS_T host_ADSTATHbits;
+volatile HOST_ADSTATHBITS_T *host_sfr_ADSTATHbits(void)
+{
+    HostSfrAccess(HOST_SFR_ID_ADSTATH, &host_ADSTATHbits);
+    return &host_ADSTATHbits;
+}
+volatile uint16_t ADSTATL;
+volatile HOST_ADSTATLBITS_T host_ADSTATLbits;
+volatile HOST_ADSTATLBITS_T *host_sfr_ADSTATLbits(void)
+{
+    HostSfrAccess(HOST_SFR_ID_ADSTATL, &host_ADSTATLbits);
+    return &host_ADSTATLbits;
+}
+volatile uint16_t ADTRIG0L;
+volatile HOST_ADTRIG0LBITS_T ADTRIG0Lbits;
+volatile uint16_t ADTRIG2H;
+volatile HOST_ADTRIG2HBITS_T ADTRIG2Hbits;
+volatile uint16_t ADTRIG3H;
+volatile HOST_ADTRIG3HBITS_T ADTRIG3Hbits;
+volatile uint16_t ADTRIG3L;
+volatile HOST_ADTRIG3LBITS_T ADTRIG3Lbits;
+volatile uint16_t ADTRIG4H;
+volatile HOST_ADTRIG4HBITS_T ADTRIG4Hbits;
+volatile uint16_t ANSELA;
+volatile HOST_ANSELABITS_T ANSELAbits;
+volatile uint16_t ANSELB;
+volatile HOST_ANSELBBITS_T ANSELBbits;
+volatile uint16_t ANSELC;
+volatile HOST_ANSELCBITS_T ANSELCbits;
+volatile uint16_t ANSELD;
+volatile HOST_ANSELDBITS_T ANSELDbits;
+volatile uint16_t CLKDIV;
+volatile HOST_CLKDIVBITS_T CLKDIVbits;
+volatile uint16_t CMBTRIGH;
+volatile uint16_t CMBTRIGL;
+volatile uint16_t FSCL;
+volatile uint16_t FSMINPER;
+volatile uint16_t IEC4;
+volatile HOST_IEC4BITS_T IEC4bits;
+volatile uint16_t IFS4;
+volatile HOST_IFS4BITS_T IFS4bits;
+volatile uint16_t IPC16;
+volatile HOST_IPC16BITS_T IPC16bits;
+volatile uint16_t LATE;
+volatile HOST_LATEBITS_T LATEbits;
+volatile uint16_t LFSR;
+volatile uint16_t LOGCONA;
+volatile uint16_t LOGCONB;
+volatile uint16_t LOGCONC;
+volatile uint16_t LOGCOND;
+volatile uint16_t LOGCONE;
+volatile uint16_t LOGCONF;
+volatile uint16_t MDC;
+volatile uint16_t MPER;
+volatile uint16_t MPHASE;
+volatile uint16_t OSCCON;
+volatile HOST_OSCCONBITS_T OSCCONbits;
+volatile uint16_t PCLKCON;
+volatile HOST_PCLKCONBITS_T PCLKCONbits;
+volatile uint16_t host_PG1CAP;
+volatile uint16_t *host_sfr_PG1CAP(void)
+{
+    HostSfrAccess(HOST_SFR_ID_PG1CAP, &host_PG1CAP);
+    return &host_PG1CAP;
+}
+volatile uint16_t PG1CLPCIH;
+volatile uint16_t PG1CLPCIL;
+volatile uint16_t PG1CONH;
+volatile HOST_PG1CONHBITS_T PG1CONHbits;
+volatile uint16_t PG1CONL;
+volatile HOST_PG1CONLBITS_T PG1CONLbits;
+volatile uint16_t PG1DC;
+volatile uint16_t PG1DCA;
+volatile uint16_t PG1DTH;
+volatile uint16_t PG1DTL;
+volatile uint16_t PG1EVTH;
+volatile HOST_PG1EVTHBITS_T PG1EVTHbits;
+volatile uint16_t PG1EVTL;
+volatile HOST_PG1EVTLBITS_T PG1EVTLbits;
+volatile uint16_t PG1FFPCIH;
+volatile uint16_t PG1FFPCIL;
+volatile uint16_t PG1FPCIH;
+volatile HOST_PG1FPCIHBITS_T PG1FPCIHbits;
+volatile uint16_t PG1FPCIL;
+volatile HOST_PG1FPCILBITS_T PG1FPCILbits;
+volatile uint16_t PG1IOCONH;
+volatile HOST_PG1IOCONHBITS_T PG1IOCONHbits;
+volatile HOST_PG1IOCONL_T host_PG1IOCONL;
+volatile uint16_t PG1LEBH;
+volatile HOST_PG1LEBHBITS_T PG1LEBHbits;
+volatile uint16_t PG1LEBL;
+volatile uint16_t PG1PER;
+volatile uint16_t PG1PHASE;
+volatile uint16_t PG1SPCIH;
+volatile HOST_PG1SPCIHBITS_T PG1SPCIHbits;
+volatile uint16_t PG1SPCIL;
+volatile HOST_PG1SPCILBITS_T PG1SPCILbits;
+volatile uint16_t PG1STAT;
+volatile HOST_PG1STATBITS_T host_PG1STATbits;
+volatile HOST_PG1STATBITS_T *host_sfr_PG1STATbits(void)
+{
+    HostSfrAccess(HOST_SFR_ID_PG1STAT, &host_PG1STATbits);
+    return &host_PG1STATbits;
+}
+volatile uint16_t PG1TRIGA;
+volatile uint16_t PG1TRIGB;
+volatile uint16_t PG1TRIGC;
+volatile uint16_t PG2CLPCIH;
+volatile uint16_t PG2CLPCIL;
+volatile uint16_t PG2CONH;
+volatile HOST_PG2CONHBITS_T PG2CONHbits;
+volatile uint16_t PG2CONL;
+volatile HOST_PG2CONLBITS_T PG2CONLbits;
+volatile uint16_t PG2DC;
+volatile uint16_t PG2DCA;
+volatile uint16_t PG2DTH;
+volatile uint16_t PG2DTL;
+volatile uint16_t PG2EVTH;
+volatile HOST_PG2EVTHBITS_T PG2EVTHbits;
+volatile uint16_t PG2EVTL;
+volatile HOST_PG2EVTLBITS_T PG2EVTLbits;
+volatile uint16_t PG2FFPCIH;
+volatile uint16_t PG2FFPCIL;
+volatile uint16_t PG2FPCIH;
+volatile HOST_PG2FPCIHBITS_T PG2FPCIHbits;
+volatile uint16_t PG2FPCIL;
+volatile HOST_PG2FPCILBITS_T PG2FPCILbits;
+volatile uint16_t PG2IOCONH;
+volatile HOST_PG2IOCONHBITS_T PG2IOCONHbits;
+volatile HOST_PG2IOCONL_T host_PG2IOCONL;
+volatile uint16_t PG2LEBH;
+volatile HOST_PG2LEBHBITS_T PG2LEBHbits;
+volatile uint16_t PG2LEBL;
+volatile uint16_t PG2PER;
+volatile uint16_t PG2PHASE;
+volatile uint16_t PG2SPCIH;
+volatile HOST_PG2SPCIHBITS_T PG2SPCIHbits;
+volatile uint16_t PG2SPCIL;
+volatile HOST_PG2SPCILBITS_T PG2SPCILbits;
+volatile uint16_t PG2STAT;
+volatile uint16_t PG2TRIGA;
+volatile uint16_t PG2TRIGB;
+volatile uint16_t PG2TRIGC;
+volatile uint16_t PG3CLPCIH;
+volatile uint16_t PG3CLPCIL;
+volatile uint16_t PG3CONH;
+volatile HOST_PG3CONHBITS_T PG3CONHbits;
+volatile uint16_t PG3CONL;
+volatile HOST_PG3CONLBITS_T PG3CONLbits;
+volatile uint16_t PG3DC;
+volatile uint16_t PG3DCA;
+volatile uint16_t PG3DTH;
+volatile uint16_t PG3DTL;
+volatile uint16_t PG3EVTH;
+volatile HOST_PG3EVTHBITS_T PG3EVTHbits;
+volatile uint16_t PG3EVTL;
+volatile HOST_PG3EVTLBITS_T PG3EVTLbits;
+volatile uint16_t PG3FFPCIH;
+volatile uint16_t PG3FFPCIL;
+volatile uint16_t PG3FPCIH;
+volatile HOST_PG3FPCIHBITS_T PG3FPCIHbits;
+volatile uint16_t PG3FPCIL;
+volatile HOST_PG3FPCILBITS_T PG3FPCILbits;
+volatile uint16_t PG3IOCONH;
+volatile HOST_PG3IOCONHBITS_T PG3IOCONHbits;
+volatile HOST_PG3IOCONL_T host_PG3IOCONL;
+volatile uint16_t PG3LEBH;
+volatile HOST_PG3LEBHBITS_T PG3LEBHbits;
+volatile uint16_t PG3LEBL;
+volatile uint16_t PG3PER;
+volatile uint16_t PG3PHASE;
+volatile uint16_t PG3SPCIH;
+volatile uint16_t PG3SPCIL;
+volatile HOST_PG3SPCILBITS_T PG3SPCILbits;
+volatile uint16_t PG3STAT;
+volatile uint16_t PG3TRIGA;
+volatile uint16_t PG3TRIGB;
+volatile uint16_t PG3TRIGC;
+volatile uint16_t PG5CLPCIH;
+volatile uint16_t PG5CLPCIL;
+volatile uint16_t PG5CONH;
+volatile HOST_PG5CONHBITS_T PG5CONHbits;
+volatile uint16_t PG5CONL;
+volatile HOST_PG5CONLBITS_T PG5CONLbits;
+volatile uint16_t PG5DC;
+volatile uint16_t PG5DCA;
+volatile uint16_t PG5DTH;
+volatile uint16_t PG5DTL;
+volatile uint16_t PG5EVTH;
+volatile HOST_PG5EVTHBITS_T PG5EVTHbits;
+volatile uint16_t PG5EVTL;
+volatile HOST_PG5EVTLBITS_T PG5EVTLbits;
+volatile uint16_t PG5FFPCIH;
+volatile uint16_t PG5FFPCIL;
+volatile uint16_t PG5FPCIH;
+volatile HOST_PG5FPCIHBITS_T PG5FPCIHbits;
+volatile uint16_t PG5FPCIL;
+volatile HOST_PG5FPCILBITS_T PG5FPCILbits;
+volatile uint16_t PG5IOCONH;
+volatile HOST_PG5IOCONHBITS_T PG5IOCONHbits;
+volatile HOST_PG5IOCONL_T host_PG5IOCONL;
+volatile uint16_t PG5LEBH;
+volatile uint16_t PG5LEBL;
+volatile uint16_t PG5PER;
+volatile uint16_t PG5PHASE;
+volatile uint16_t PG5SPCIH;
+volatile HOST_PG5SPCIHBITS_T PG5SPCIHbits;
+volatile uint16_t PG5SPCIL;
+volatile HOST_PG5SPCILBITS_T PG5SPCILbits;
+volatile uint16_t PG5STAT;
+volatile uint16_t PG5TRIGA;
+volatile uint16_t PG5TRIGB;
+volatile uint16_t PG5TRIGC;
+volatile uint16_t host_PG6CAP;
+volatile uint16_t *host_sfr_PG6CAP(void)
+{
+    HostSfrAccess(HOST_SFR_ID_PG6CAP, &host_PG6CAP);
+    return &host_PG6CAP;
+}
+volatile uint16_t PG6CLPCIH;
+volatile uint16_t PG6CLPCIL;
+volatile uint16_t PG6CONH;
+volatile HOST_PG6CONHBITS_T PG6CONHbits;
+volatile uint16_t PG6CONL;
+volatile HOST_PG6CONLBITS_T PG6CONLbits;
+volatile uint16_t PG6DC;
+volatile uint16_t PG6DCA;
+volatile uint16_t PG6DTH;
+volatile uint16_t PG6DTL;
+volatile uint16_t PG6EVTH;
+volatile HOST_PG6EVTHBITS_T PG6EVTHbits;
+volatile uint16_t PG6EVTL;
+volatile HOST_PG6EVTLBITS_T PG6EVTLbits;
+volatile uint16_t PG6FFPCIH;
+volatile uint16_t PG6FFPCIL;
+volatile uint16_t PG6FPCIH;
+volatile HOST_PG6FPCIHBITS_T PG6FPCIHbits;
+volatile uint16_t PG6FPCIL;
+volatile HOST_PG6FPCILBITS_T PG6FPCILbits;
+volatile uint16_t PG6IOCONH;
+volatile HOST_PG6IOCONHBITS_T PG6IOCONHbits;
+volatile HOST_PG6IOCONL_T host_PG6IOCONL;
+volatile uint16_t PG6LEBH;
+volatile HOST_PG6LEBHBITS_T PG6LEBHbits;
+volatile uint16_t PG6LEBL;
+volatile uint16_t PG6PER;
+volatile uint16_t PG6PHASE;
+volatile uint16_t PG6SPCIH;
+volatile HOST_PG6SPCIHBITS_T PG6SPCIHbits;
+volatile uint16_t PG6SPCIL;
+volatile HOST_PG6SPCILBITS_T PG6SPCILbits;
+volatile uint16_t PG6STAT;
+volatile HOST_PG6STATBITS_T host_PG6STATbits;
+volatile HOST_PG6STATBITS_T *host_sfr_PG6STATbits(void)
+{
+    HostSfrAccess(HOST_SFR_ID_PG6STAT, &host_PG6STATbits);
+    return &host_PG6STATbits;
+}
+volatile uint16_t PG6TRIGA;
+volatile uint16_t PG6TRIGB;
+volatile uint16_t PG6TRIGC;
+volatile uint16_t PG7CLPCIH;
+volatile uint16_t PG7CLPCIL;
+volatile uint16_t PG7CONH;
+volatile HOST_PG7CONHBITS_T PG7CONHbits;
+volatile uint16_t PG7CONL;
+volatile HOST_PG7CONLBITS_T PG7CONLbits;
+volatile uint16_t PG7DC;
+volatile uint16_t PG7DCA;
+volatile uint16_t PG7DTH;
+volatile uint16_t PG7DTL;
+volatile uint16_t PG7EVTH;
+volatile HOST_PG7EVTHBITS_T PG7EVTHbits;
+volatile uint16_t PG7EVTL;
+volatile HOST_PG7EVTLBITS_T PG7EVTLbits;
+volatile uint16_t PG7FFPCIH;
+volatile uint16_t PG7FFPCIL;
+volatile uint16_t PG7FPCIH;
+volatile HOST_PG7FPCIHBITS_T PG7FPCIHbits;
+volatile uint16_t PG7FPCIL;
+volatile HOST_PG7FPCILBITS_T PG7FPCILbits;
+volatile uint16_t PG7IOCONH;
+volatile HOST_PG7IOCONHBITS_T PG7IOCONHbits;
+volatile HOST_PG7IOCONL_T host_PG7IOCONL;
+volatile uint16_t PG7LEBH;
+volatile HOST_PG7LEBHBITS_T PG7LEBHbits;
+volatile uint16_t PG7LEBL;
+volatile uint16_t PG7PER;
+volatile uint16_t PG7PHASE;
+volatile uint16_t PG7SPCIH;
+volatile HOST_PG7SPCIHBITS_T PG7SPCIHbits;
+volatile uint16_t PG7SPCIL;
+volatile HOST_PG7SPCILBITS_T PG7SPCILbits;
+volatile uint16_t PG7STAT;
+volatile uint16_t PG7TRIGA;
+volatile uint16_t PG7TRIGB;
+volatile uint16_t PG7TRIGC;
+volatile uint16_t PG8CLPCIH;
+volatile uint16_t PG8CLPCIL;
+volatile uint16_t PG8CONH;
+volatile HOST_PG8CONHBITS_T PG8CONHbits;
+volatile uint16_t PG8CONL;
+volatile HOST_PG8CONLBITS_T PG8CONLbits;
+volatile uint16_t PG8DC;
+volatile uint16_t PG8DCA;
+volatile uint16_t PG8DTH;
+volatile uint16_t PG8DTL;
+volatile uint16_t PG8EVTH;
+volatile HOST_PG8EVTHBITS_T PG8EVTHbits;
+volatile uint16_t PG8EVTL;
+volatile HOST_PG8EVTLBITS_T PG8EVTLbits;
+volatile uint16_t PG8FFPCIH;
+volatile uint16_t PG8FFPCIL;
+volatile uint16_t PG8FPCIH;
+volatile HOST_PG8FPCIHBITS_T PG8FPCIHbits;
+volatile uint16_t PG8FPCIL;
+volatile HOST_PG8FPCILBITS_T PG8FPCILbits;
+volatile uint16_t PG8IOCONH;
+volatile HOST_PG8IOCONHBITS_T PG8IOCONHbits;
+volatile HOST_PG8IOCONL_T host_PG8IOCONL;
+volatile uint16_t PG8LEBH;
+volatile HOST_PG8LEBHBITS_T PG8LEBHbits;
+volatile uint16_t PG8LEBL;
+volatile uint16_t PG8PER;
+volatile uint16_t PG8PHASE;
+volatile uint16_t PG8SPCIH;
+volatile HOST_PG8SPCIHBITS_T PG8SPCIHbits;
+volatile uint16_t PG8SPCIL;
+volatile HOST_PG8SPCILBITS_T PG8SPCILbits;
+volatile uint16_t PG8STAT;
+volatile uint16_t PG8TRIGA;
+volatile uint16_t PG8TRIGB;
+volatile uint16_t PG8TRIGC;
+volatile uint16_t PLLDIV;
+volatile HOST_PLLDIVBITS_T PLLDIVbits;
+volatile uint16_t PLLFBD;
+volatile HOST_PLLFBDBITS_T PLLFBDbits;
+volatile uint16_t PORTE;
+volatile HOST_PORTEBITS_T PORTEbits;
+volatile uint16_t PR1;
+volatile uint16_t PWMEVTA;
+volatile HOST_PWMEVTABITS_T PWMEVTAbits;
+volatile uint16_t PWMEVTB;
+volatile uint16_t PWMEVTC;
+volatile uint16_t PWMEVTD;
+volatile uint16_t PWMEVTE;
+volatile uint16_t PWMEVTF;
+volatile uint16_t REFOCONH;
+volatile HOST_REFOCONHBITS_T REFOCONHbits;
+volatile uint16_t REFOCONL;
+volatile HOST_REFOCONLBITS_T REFOCONLbits;
+volatile uint16_t SI1MBX0D;
+volatile uint16_t SI1MBX10D;
+volatile uint16_t SI1MBX11D;
+volatile uint16_t SI1MBX12D;
+volatile uint16_t SI1MBX13D;
+volatile uint16_t SI1MBX14D;
+volatile uint16_t host_SI1MBX15D;
+volatile uint16_t *host_sfr_SI1MBX15D(void)
+{
+    HostSfrAccess(HOST_SFR_ID_SI1MBX15D, &host_SI1MBX15D);
+    return &host_SI1MBX15D;
+}
+volatile uint16_t SI1MBX1D;
+volatile uint16_t SI1MBX2D;
+volatile uint16_t SI1MBX3D;
+volatile uint16_t SI1MBX4D;
+volatile uint16_t SI1MBX5D;
+volatile uint16_t host_SI1MBX6D;
+volatile uint16_t *host_sfr_SI1MBX6D(void)
+{
+    HostSfrAccess(HOST_SFR_ID_SI1MBX6D, &host_SI1MBX6D);
+    return &host_SI1MBX6D;
+}
+volatile uint16_t SI1MBX7D;
+volatile uint16_t SI1MBX8D;
+volatile uint16_t SI1MBX9D;
+volatile uint16_t SI1MBXS;
+volatile HOST_SI1MBXSBITS_T host_SI1MBXSbits;
+volatile HOST_SI1MBXSBITS_T *host_sfr_SI1MBXSbits(void)
+{
+    HostSfrAccess(HOST_SFR_ID_SI1MBXS, &host_SI1MBXSbits);
+    return &host_SI1MBXSbits;
+}
+volatile uint16_t T1CON;
+volatile HOST_T1CONBITS_T T1CONbits;
+volatile uint16_t host_TMR1;
+volatile uint16_t *host_sfr_TMR1(void)
+{
+    HostSfrAccess(HOST_SFR_ID_TMR1, &host_TMR1);
+    return &host_TMR1;
+}
+volatile uint16_t TRISA;
+volatile HOST_TRISABITS_T TRISAbits;
+volatile uint16_t TRISB;
+volatile HOST_TRISBBITS_T TRISBbits;
+volatile uint16_t TRISC;
+volatile HOST_TRISCBITS_T TRISCbits;
+volatile uint16_t TRISD;
+volatile HOST_TRISDBITS_T TRISDbits;
+volatile uint16_t TRISE;
+volatile HOST_TRISEBITS_T TRISEbits;
+volatile uint16_t U1BRG;
+volatile uint16_t U1BRGH;
+volatile uint16_t U1INT;
+volatile HOST_U1INTBITS_T U1INTbits;
+volatile uint16_t U1MODE;
+volatile HOST_U1MODEBITS_T U1MODEbits;
+volatile uint16_t U1MODEH;
+volatile HOST_U1MODEHBITS_T U1MODEHbits;
+volatile uint16_t U1P1;
+volatile uint16_t U1P2;
+volatile uint16_t U1P3;
+volatile uint16_t U1P3H;
+volatile uint16_t U1RXCHK;
+volatile uint16_t U1RXREG;
+volatile HOST_U1RXREGBITS_T U1RXREGbits;
+volatile uint16_t U1SCCON;
+volatile uint16_t U1SCINT;
+volatile uint16_t U1STA;
+volatile HOST_U1STABITS_T U1STAbits;
+volatile uint16_t U1STAH;
+volatile HOST_U1STAHBITS_T U1STAHbits;
+volatile uint16_t U1TXCHK;
+volatile uint16_t U1TXREG;
+volatile HOST_U1TXREGBITS_T U1TXREGbits;
+volatile uint16_t _ADCAN0IE;
+volatile uint16_t _ADCAN0IF;
+volatile uint16_t _ADCAN0IP;
+volatile uint16_t _ADCAN10IE;
+volatile uint16_t _ADCAN10IF;
+volatile uint16_t _ADCAN10IP;
+volatile uint16_t _ADCAN15IE;
+volatile uint16_t _ADCAN15IF;
+volatile uint16_t _ADCAN15IP;
+volatile uint16_t _ADCAN18IE;
+volatile uint16_t _ADCAN18IF;
+volatile uint16_t _ADCAN18IP;
+volatile uint16_t _ADCAN1IE;
+volatile uint16_t _ADCAN1IF;
+volatile uint16_t _ADCAN1IP;
+volatile uint16_t _IE0;
+volatile uint16_t _IE1;
+volatile uint16_t _IE10;
+volatile uint16_t _IE15;
+volatile uint16_t _IE18;
+volatile uint16_t _PWM1IF;
+volatile uint16_t _PWM6IF;
+volatile uint16_t _RP43R;
+volatile uint16_t _RP46R;
+volatile uint16_t _T1IE;
+volatile uint16_t _T1IF;
+volatile uint16_t _T1IP;
+volatile uint16_t _U1RXIE;
+volatile uint16_t _U1RXIF;
+volatile uint16_t _U1RXR;
+volatile uint16_t _U1TXIE;
+volatile uint16_t _U1TXIF;
@@ -0,0 +1,1597 @@
+/**
+ * @file host_sfr.h
+ *
+ * @brief Special function registers of the secondary core for the host build.
+ *        Generated by tools/gen_sfr.py from the firmware sources, do not
+ *        edit.
+ */
+#ifndef HOST_SFR_H
+#define HOST_SFR_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+    HOST_SFR_ID_ADFL0CON,
+    HOST_SFR_ID_ADFL1CON,
+    HOST_SFR_ID_ADSTATH,
+    HOST_SFR_ID_ADSTATL,
+    HOST_SFR_ID_PG1CAP,
+    HOST_SFR_ID_PG1STAT,
+    HOST_SFR_ID_PG6CAP,
+    HOST_SFR_ID_PG6STAT,
+    HOST_SFR_ID_SI1MBX15D,
+    HOST_SFR_ID_SI1MBX6D,
+    HOST_SFR_ID_SI1MBXS,
+    HOST_SFR_ID_TMR1,
+    HOST_SFR_ID_COUNT
+} HOST_SFR_ID_T;
+
+/* Implemented by the host port, called before each access */
+void HostSfrAccess(HOST_SFR_ID_T id, volatile void *storage);
+
+extern volatile uint16_t ADCBUF0;
+extern volatile uint16_t ADCBUF1;
+extern volatile uint16_t ADCBUF10;
+extern volatile uint16_t ADCBUF13;
+extern volatile uint16_t ADCBUF15;
+extern volatile uint16_t ADCBUF18;
+extern volatile uint16_t ADCON1H;
+typedef struct
+{
+    uint16_t FORM;
+    uint16_t SHRRES;
+} HOST_ADCON1HBITS_T;
+extern volatile HOST_ADCON1HBITS_T ADCON1Hbits;
+extern volatile uint16_t ADCON1L;
+typedef struct
+{
+    uint16_t ADON;
+    uint16_t ADSIDL;
+} HOST_ADCON1LBITS_T;
+extern volatile HOST_ADCON1LBITS_T ADCON1Lbits;
+extern volatile uint16_t ADCON2H;
+typedef struct
+{
+    uint16_t SHREISEL;
+    uint16_t SHRSAMC;
+} HOST_ADCON2HBITS_T;
+extern volatile HOST_ADCON2HBITS_T ADCON2Hbits;
+extern volatile uint16_t ADCON2L;
+typedef struct
+{
+    uint16_t EIEN;
+    uint16_t SHRADCS;
+} HOST_ADCON2LBITS_T;
+extern volatile HOST_ADCON2LBITS_T ADCON2Lbits;
+extern volatile uint16_t ADCON3H;
+typedef struct
+{
+    uint16_t C0EN;
+    uint16_t C1EN;
+    uint16_t CLKDIV;
+    uint16_t CLKSEL;
+    uint16_t SHREN;
+} HOST_ADCON3HBITS_T;
+extern volatile HOST_ADCON3HBITS_T ADCON3Hbits;
+extern volatile uint16_t ADCON3L;
+typedef struct
+{
+    uint16_t REFSEL;
+} HOST_ADCON3LBITS_T;
+extern volatile HOST_ADCON3LBITS_T ADCON3Lbits;
+extern volatile uint16_t ADCON4H;
+typedef struct
+{
+    uint16_t C0CHS;
+    uint16_t C1CHS;
+} HOST_ADCON4HBITS_T;
+extern volatile HOST_ADCON4HBITS_T ADCON4Hbits;
+extern volatile uint16_t ADCON4L;
+typedef struct
+{
+    uint16_t SAMC0EN;
+    uint16_t SAMC1EN;
+} HOST_ADCON4LBITS_T;
+extern volatile HOST_ADCON4LBITS_T ADCON4Lbits;
+extern volatile uint16_t ADCON5H;
+typedef struct
+{
+    uint16_t SHRCIE;
+    uint16_t WARMTIME;
+} HOST_ADCON5HBITS_T;
+extern volatile HOST_ADCON5HBITS_T ADCON5Hbits;
+extern volatile uint16_t ADCON5L;
+typedef struct
+{
+    uint16_t C0PWR;
+    uint16_t C0RDY;
+    uint16_t C1PWR;
+    uint16_t C1RDY;
+    uint16_t SHRPWR;
+    uint16_t SHRRDY;
+} HOST_ADCON5LBITS_T;
+extern volatile HOST_ADCON5LBITS_T ADCON5Lbits;
+extern volatile uint16_t ADCORE0H;
+typedef struct
+{
+    uint16_t ADCS;
+    uint16_t RES;
+} HOST_ADCORE0HBITS_T;
+extern volatile HOST_ADCORE0HBITS_T ADCORE0Hbits;
+extern volatile uint16_t ADCORE0L;
+typedef struct
+{
+    uint16_t SAMC;
+} HOST_ADCORE0LBITS_T;
+extern volatile HOST_ADCORE0LBITS_T ADCORE0Lbits;
+extern volatile uint16_t ADCORE1H;
+typedef struct
+{
+    uint16_t ADCS;
+    uint16_t RES;
+} HOST_ADCORE1HBITS_T;
+extern volatile HOST_ADCORE1HBITS_T ADCORE1Hbits;
+extern volatile uint16_t ADCORE1L;
+typedef struct
+{
+    uint16_t SAMC;
+} HOST_ADCORE1LBITS_T;
+extern volatile HOST_ADCORE1LBITS_T ADCORE1Lbits;
+extern volatile uint16_t ADEIEH;
+typedef struct
+{
+    uint16_t EIEN18;
+} HOST_ADEIEHBITS_T;
+extern volatile HOST_ADEIEHBITS_T ADEIEHbits;
+extern volatile uint16_t ADEIEL;
+typedef struct
+{
+    uint16_t EIEN15;
+} HOST_ADEIELBITS_T;
+extern volatile HOST_ADEIELBITS_T ADEIELbits;
+extern volatile uint16_t ADEISTATH;
+extern volatile uint16_t ADEISTATL;
+extern volatile uint16_t ADFL0CON;
+typedef struct
+{
+    uint16_t FLCHSEL;
+    uint16_t FLEN;
+    uint16_t IE;
+    uint16_t MODE;
+    uint16_t OVRSAM;
+    uint16_t RDY;
+} HOST_ADFL0CONBITS_T;
+extern volatile HOST_ADFL0CONBITS_T host_ADFL0CONbits;
+volatile HOST_ADFL0CONBITS_T *host_sfr_ADFL0CONbits(void);
+#define ADFL0CONbits (*host_sfr_ADFL0CONbits())
+extern volatile uint16_t ADFL0DAT;
+extern volatile uint16_t ADFL1CON;
+typedef struct
+{
+    uint16_t FLCHSEL;
+    uint16_t FLEN;
+    uint16_t IE;
+    uint16_t MODE;
+    uint16_t OVRSAM;
+    uint16_t RDY;
+} HOST_ADFL1CONBITS_T;
+extern volatile HOST_ADFL1CONBITS_T host_ADFL1CONbits;
+volatile HOST_ADFL1CONBITS_T *host_sfr_ADFL1CONbits(void);
+#define ADFL1CONbits (*host_sfr_ADFL1CONbits())
+extern volatile uint16_t ADFL1DAT;
+extern volatile uint16_t ADIEH;
+extern volatile uint16_t ADIEL;
+extern volatile uint16_t ADMOD0H;
+typedef struct
+{
+    uint16_t SIGN10;
+    uint16_t SIGN13;
+    uint16_t SIGN15;
+} HOST_ADMOD0HBITS_T;
+extern volatile HOST_ADMOD0HBITS_T ADMOD0Hbits;
+extern volatile uint16_t ADMOD0L;
+typedef struct
+{
+    uint16_t SIGN0;
+    uint16_t SIGN1;
+} HOST_ADMOD0LBITS_T;
+extern volatile HOST_ADMOD0LBITS_T ADMOD0Lbits;
+extern volatile uint16_t ADMOD1L;
+typedef struct
+{
+    uint16_t SIGN18;
+} HOST_ADMOD1LBITS_T;
+extern volatile HOST_ADMOD1LBITS_T ADMOD1Lbits;
+extern volatile uint16_t ADSTATH;
+typedef struct
+{
+    uint16_t AN18RDY;
+} HOST_ADSTATHBITS_T;
+extern volatile HOST_ADSTATHBITS_T host_ADSTATHbits;
+volatile HOST_ADSTATHBITS_T *host_sfr_ADSTATHbits(void);
+#define ADSTATHbits (*host_sfr_ADSTATHbits())
+extern volatile uint16_t ADSTATL;
+typedef struct
+{
+    uint16_t AN15RDY;
+} HOST_ADSTATLBITS_T;
+extern volatile HOST_ADSTATLBITS_T host_ADSTATLbits;
+volatile HOST_ADSTATLBITS_T *host_sfr_ADSTATLbits(void);
+#define ADSTATLbits (*host_sfr_ADSTATLbits())
+extern volatile uint16_t ADTRIG0L;
+typedef struct
+{
+    uint16_t TRGSRC0;
+    uint16_t TRGSRC1;
+} HOST_ADTRIG0LBITS_T;
+extern volatile HOST_ADTRIG0LBITS_T ADTRIG0Lbits;
+extern volatile uint16_t ADTRIG2H;
+typedef struct
+{
+    uint16_t TRGSRC10;
+} HOST_ADTRIG2HBITS_T;
+extern volatile HOST_ADTRIG2HBITS_T ADTRIG2Hbits;
+extern volatile uint16_t ADTRIG3H;
+typedef struct
+{
+    uint16_t TRGSRC15;
+} HOST_ADTRIG3HBITS_T;
+extern volatile HOST_ADTRIG3HBITS_T ADTRIG3Hbits;
+extern volatile uint16_t ADTRIG3L;
+typedef struct
+{
+    uint16_t TRGSRC13;
+} HOST_ADTRIG3LBITS_T;
+extern volatile HOST_ADTRIG3LBITS_T ADTRIG3Lbits;
+extern volatile uint16_t ADTRIG4H;
+typedef struct
+{
+    uint16_t TRGSRC18;
+} HOST_ADTRIG4HBITS_T;
+extern volatile HOST_ADTRIG4HBITS_T ADTRIG4Hbits;
+extern volatile uint16_t ANSELA;
+typedef struct
+{
+    uint16_t ANSELA1;
+    uint16_t ANSELA3;
+    uint16_t ANSELA4;
+} HOST_ANSELABITS_T;
+extern volatile HOST_ANSELABITS_T ANSELAbits;
+extern volatile uint16_t ANSELB;
+typedef struct
+{
+    uint16_t ANSELB3;
+} HOST_ANSELBBITS_T;
+extern volatile HOST_ANSELBBITS_T ANSELBbits;
+extern volatile uint16_t ANSELC;
+typedef struct
+{
+    uint16_t ANSELC0;
+    uint16_t ANSELC1;
+    uint16_t ANSELC2;
+} HOST_ANSELCBITS_T;
+extern volatile HOST_ANSELCBITS_T ANSELCbits;
+extern volatile uint16_t ANSELD;
+typedef struct
+{
+    uint16_t ANSELD10;
+} HOST_ANSELDBITS_T;
+extern volatile HOST_ANSELDBITS_T ANSELDbits;
+extern volatile uint16_t CLKDIV;
+typedef struct
+{
+    uint16_t DOZEN;
+    uint16_t FRCDIV;
+    uint16_t PLLPRE;
+} HOST_CLKDIVBITS_T;
+extern volatile HOST_CLKDIVBITS_T CLKDIVbits;
+extern volatile uint16_t CMBTRIGH;
+extern volatile uint16_t CMBTRIGL;
+extern volatile uint16_t FSCL;
+extern volatile uint16_t FSMINPER;
+extern volatile uint16_t IEC4;
+typedef struct
+{
+    uint16_t PWM1IE;
+} HOST_IEC4BITS_T;
+extern volatile HOST_IEC4BITS_T IEC4bits;
+extern volatile uint16_t IFS4;
+typedef struct
+{
+    uint16_t PWM1IF;
+} HOST_IFS4BITS_T;
+extern volatile HOST_IFS4BITS_T IFS4bits;
+extern volatile uint16_t IPC16;
+typedef struct
+{
+    uint16_t PWM1IP;
+} HOST_IPC16BITS_T;
+extern volatile HOST_IPC16BITS_T IPC16bits;
+extern volatile uint16_t LATE;
+typedef struct
+{
+    uint16_t LATE2;
+    uint16_t LATE3;
+} HOST_LATEBITS_T;
+extern volatile HOST_LATEBITS_T LATEbits;
+extern volatile uint16_t LFSR;
+extern volatile uint16_t LOGCONA;
+extern volatile uint16_t LOGCONB;
+extern volatile uint16_t LOGCONC;
+extern volatile uint16_t LOGCOND;
+extern volatile uint16_t LOGCONE;
+extern volatile uint16_t LOGCONF;
+extern volatile uint16_t MDC;
+extern volatile uint16_t MPER;
+extern volatile uint16_t MPHASE;
+extern volatile uint16_t OSCCON;
+typedef struct
+{
+    uint16_t LOCK;
+    uint16_t OSWEN;
+} HOST_OSCCONBITS_T;
+extern volatile HOST_OSCCONBITS_T OSCCONbits;
+extern volatile uint16_t PCLKCON;
+typedef struct
+{
+    uint16_t DIVSEL;
+    uint16_t LOCK;
+    uint16_t MCLKSEL;
+} HOST_PCLKCONBITS_T;
+extern volatile HOST_PCLKCONBITS_T PCLKCONbits;
+extern volatile uint16_t host_PG1CAP;
+volatile uint16_t *host_sfr_PG1CAP(void);
+#define PG1CAP (*host_sfr_PG1CAP())
+extern volatile uint16_t PG1CLPCIH;
+extern volatile uint16_t PG1CLPCIL;
+extern volatile uint16_t PG1CONH;
+typedef struct
+{
+    uint16_t MDCSEL;
+    uint16_t MPERSEL;
+    uint16_t MPHSEL;
+    uint16_t MSTEN;
+    uint16_t SOCS;
+    uint16_t TRGMOD;
+    uint16_t UPDMOD;
+} HOST_PG1CONHBITS_T;
+extern volatile HOST_PG1CONHBITS_T PG1CONHbits;
+extern volatile uint16_t PG1CONL;
+typedef struct
+{
+    uint16_t CLKSEL;
+    uint16_t MODSEL;
+    uint16_t ON;
+    uint16_t TRGCNT;
+} HOST_PG1CONLBITS_T;
+extern volatile HOST_PG1CONLBITS_T PG1CONLbits;
+extern volatile uint16_t PG1DC;
+extern volatile uint16_t PG1DCA;
+extern volatile uint16_t PG1DTH;
+extern volatile uint16_t PG1DTL;
+extern volatile uint16_t PG1EVTH;
+typedef struct
+{
+    uint16_t ADTR1OFS;
+    uint16_t ADTR2EN1;
+    uint16_t ADTR2EN2;
+    uint16_t ADTR2EN3;
+    uint16_t CLIEN;
+    uint16_t FFIEN;
+    uint16_t FLTIEN;
+    uint16_t IEVTSEL;
+    uint16_t SIEN;
+} HOST_PG1EVTHBITS_T;
+extern volatile HOST_PG1EVTHBITS_T PG1EVTHbits;
+extern volatile uint16_t PG1EVTL;
+typedef struct
+{
+    uint16_t ADTR1EN1;
+    uint16_t ADTR1EN2;
+    uint16_t ADTR1EN3;
+    uint16_t ADTR1PS;
+    uint16_t PGTRGSEL;
+    uint16_t UPDTRG;
+} HOST_PG1EVTLBITS_T;
+extern volatile HOST_PG1EVTLBITS_T PG1EVTLbits;
+extern volatile uint16_t PG1FFPCIH;
+extern volatile uint16_t PG1FFPCIL;
+extern volatile uint16_t PG1FPCIH;
+typedef struct
+{
+    uint16_t ACP;
+    uint16_t BPEN;
+    uint16_t BPSEL;
+    uint16_t PCIGT;
+    uint16_t TQPS;
+    uint16_t TQSS;
+} HOST_PG1FPCIHBITS_T;
+extern volatile HOST_PG1FPCIHBITS_T PG1FPCIHbits;
+extern volatile uint16_t PG1FPCIL;
+typedef struct
+{
+    uint16_t AQPS;
+    uint16_t AQSS;
+    uint16_t PPS;
+    uint16_t PSS;
+    uint16_t PSYNC;
+    uint16_t TERM;
+    uint16_t TSYNCDIS;
+} HOST_PG1FPCILBITS_T;
+extern volatile HOST_PG1FPCILBITS_T PG1FPCILbits;
+extern volatile uint16_t PG1IOCONH;
+typedef struct
+{
+    uint16_t CAPSRC;
+    uint16_t DTCMPSEL;
+    uint16_t PENH;
+    uint16_t PENL;
+    uint16_t PMOD;
+    uint16_t POLH;
+    uint16_t POLL;
+} HOST_PG1IOCONHBITS_T;
+extern volatile HOST_PG1IOCONHBITS_T PG1IOCONHbits;
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        uint16_t DBDAT:2;
+        uint16_t FFDAT:2;
+        uint16_t CLDAT:2;
+        uint16_t FLTDAT:2;
+        uint16_t OSYNC:2;
+        uint16_t OVRDAT:2;
+        uint16_t OVRENL:1;
+        uint16_t OVRENH:1;
+        uint16_t SWAP:1;
+        uint16_t CLMOD:1;
+    } bits;
+} HOST_PG1IOCONL_T;
+extern volatile HOST_PG1IOCONL_T host_PG1IOCONL;
+#define PG1IOCONL host_PG1IOCONL.reg
+#define PG1IOCONLbits host_PG1IOCONL.bits
+extern volatile uint16_t PG1LEBH;
+typedef struct
+{
+    uint16_t PWMPCI;
+} HOST_PG1LEBHBITS_T;
+extern volatile HOST_PG1LEBHBITS_T PG1LEBHbits;
+extern volatile uint16_t PG1LEBL;
+extern volatile uint16_t PG1PER;
+extern volatile uint16_t PG1PHASE;
+extern volatile uint16_t PG1SPCIH;
+typedef struct
+{
+    uint16_t ACP;
+} HOST_PG1SPCIHBITS_T;
+extern volatile HOST_PG1SPCIHBITS_T PG1SPCIHbits;
+extern volatile uint16_t PG1SPCIL;
+typedef struct
+{
+    uint16_t PPS;
+    uint16_t PSS;
+} HOST_PG1SPCILBITS_T;
+extern volatile HOST_PG1SPCILBITS_T PG1SPCILbits;
+extern volatile uint16_t PG1STAT;
+typedef struct
+{
+    uint16_t CAHALF;
+} HOST_PG1STATBITS_T;
+extern volatile HOST_PG1STATBITS_T host_PG1STATbits;
+volatile HOST_PG1STATBITS_T *host_sfr_PG1STATbits(void);
+#define PG1STATbits (*host_sfr_PG1STATbits())
+extern volatile uint16_t PG1TRIGA;
+extern volatile uint16_t PG1TRIGB;
+extern volatile uint16_t PG1TRIGC;
+extern volatile uint16_t PG2CLPCIH;
+extern volatile uint16_t PG2CLPCIL;
+extern volatile uint16_t PG2CONH;
+typedef struct
+{
+    uint16_t MDCSEL;
+    uint16_t MPERSEL;
+    uint16_t MPHSEL;
+    uint16_t MSTEN;
+    uint16_t SOCS;
+    uint16_t TRGMOD;
+    uint16_t UPDMOD;
+} HOST_PG2CONHBITS_T;
+extern volatile HOST_PG2CONHBITS_T PG2CONHbits;
+extern volatile uint16_t PG2CONL;
+typedef struct
+{
+    uint16_t CLKSEL;
+    uint16_t MODSEL;
+    uint16_t ON;
+    uint16_t TRGCNT;
+} HOST_PG2CONLBITS_T;
+extern volatile HOST_PG2CONLBITS_T PG2CONLbits;
+extern volatile uint16_t PG2DC;
+extern volatile uint16_t PG2DCA;
+extern volatile uint16_t PG2DTH;
+extern volatile uint16_t PG2DTL;
+extern volatile uint16_t PG2EVTH;
+typedef struct
+{
+    uint16_t ADTR1OFS;
+    uint16_t ADTR2EN1;
+    uint16_t ADTR2EN2;
+    uint16_t ADTR2EN3;
+    uint16_t CLIEN;
+    uint16_t FFIEN;
+    uint16_t FLTIEN;
+    uint16_t IEVTSEL;
+    uint16_t SIEN;
+} HOST_PG2EVTHBITS_T;
+extern volatile HOST_PG2EVTHBITS_T PG2EVTHbits;
+extern volatile uint16_t PG2EVTL;
+typedef struct
+{
+    uint16_t ADTR1EN1;
+    uint16_t ADTR1EN2;
+    uint16_t ADTR1EN3;
+    uint16_t ADTR1PS;
+    uint16_t PGTRGSEL;
+    uint16_t UPDTRG;
+} HOST_PG2EVTLBITS_T;
+extern volatile HOST_PG2EVTLBITS_T PG2EVTLbits;
+extern volatile uint16_t PG2FFPCIH;
+extern volatile uint16_t PG2FFPCIL;
+extern volatile uint16_t PG2FPCIH;
+typedef struct
+{
+    uint16_t ACP;
+    uint16_t BPEN;
+    uint16_t BPSEL;
+    uint16_t PCIGT;
+    uint16_t TQPS;
+    uint16_t TQSS;
+} HOST_PG2FPCIHBITS_T;
+extern volatile HOST_PG2FPCIHBITS_T PG2FPCIHbits;
+extern volatile uint16_t PG2FPCIL;
+typedef struct
+{
+    uint16_t AQPS;
+    uint16_t AQSS;
+    uint16_t PPS;
+    uint16_t PSS;
+    uint16_t PSYNC;
+    uint16_t TERM;
+    uint16_t TSYNCDIS;
+} HOST_PG2FPCILBITS_T;
+extern volatile HOST_PG2FPCILBITS_T PG2FPCILbits;
+extern volatile uint16_t PG2IOCONH;
+typedef struct
+{
+    uint16_t CAPSRC;
+    uint16_t DTCMPSEL;
+    uint16_t PENH;
+    uint16_t PENL;
+    uint16_t PMOD;
+    uint16_t POLH;
+    uint16_t POLL;
+} HOST_PG2IOCONHBITS_T;
+extern volatile HOST_PG2IOCONHBITS_T PG2IOCONHbits;
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        uint16_t DBDAT:2;
+        uint16_t FFDAT:2;
+        uint16_t CLDAT:2;
+        uint16_t FLTDAT:2;
+        uint16_t OSYNC:2;
+        uint16_t OVRDAT:2;
+        uint16_t OVRENL:1;
+        uint16_t OVRENH:1;
+        uint16_t SWAP:1;
+        uint16_t CLMOD:1;
+    } bits;
+} HOST_PG2IOCONL_T;
+extern volatile HOST_PG2IOCONL_T host_PG2IOCONL;
+#define PG2IOCONL host_PG2IOCONL.reg
+#define PG2IOCONLbits host_PG2IOCONL.bits
+extern volatile uint16_t PG2LEBH;
+typedef struct
+{
+    uint16_t PWMPCI;
+} HOST_PG2LEBHBITS_T;
+extern volatile HOST_PG2LEBHBITS_T PG2LEBHbits;
+extern volatile uint16_t PG2LEBL;
+extern volatile uint16_t PG2PER;
+extern volatile uint16_t PG2PHASE;
+extern volatile uint16_t PG2SPCIH;
+typedef struct
+{
+    uint16_t ACP;
+} HOST_PG2SPCIHBITS_T;
+extern volatile HOST_PG2SPCIHBITS_T PG2SPCIHbits;
+extern volatile uint16_t PG2SPCIL;
+typedef struct
+{
+    uint16_t PPS;
+    uint16_t PSS;
+} HOST_PG2SPCILBITS_T;
+extern volatile HOST_PG2SPCILBITS_T PG2SPCILbits;
+extern volatile uint16_t PG2STAT;
+extern volatile uint16_t PG2TRIGA;
+extern volatile uint16_t PG2TRIGB;
+extern volatile uint16_t PG2TRIGC;
+extern volatile uint16_t PG3CLPCIH;
+extern volatile uint16_t PG3CLPCIL;
+extern volatile uint16_t PG3CONH;
+typedef struct
+{
+    uint16_t MDCSEL;
+    uint16_t MPERSEL;
+    uint16_t MPHSEL;
+    uint16_t MSTEN;
+    uint16_t SOCS;
+    uint16_t TRGMOD;
+    uint16_t UPDMOD;
+} HOST_PG3CONHBITS_T;
+extern volatile HOST_PG3CONHBITS_T PG3CONHbits;
+extern volatile uint16_t PG3CONL;
+typedef struct
+{
+    uint16_t CLKSEL;
+    uint16_t MODSEL;
+    uint16_t ON;
+    uint16_t TRGCNT;
+} HOST_PG3CONLBITS_T;
+extern volatile HOST_PG3CONLBITS_T PG3CONLbits;
+extern volatile uint16_t PG3DC;
+extern volatile uint16_t PG3DCA;
+extern volatile uint16_t PG3DTH;
+extern volatile uint16_t PG3DTL;
+extern volatile uint16_t PG3EVTH;
+typedef struct
+{
+    uint16_t ADTR1OFS;
+    uint16_t ADTR2EN1;
+    uint16_t ADTR2EN2;
+    uint16_t ADTR2EN3;
+    uint16_t CLIEN;
+    uint16_t FFIEN;
+    uint16_t FLTIEN;
+    uint16_t IEVTSEL;
+    uint16_t SIEN;
+} HOST_PG3EVTHBITS_T;
+extern volatile HOST_PG3EVTHBITS_T PG3EVTHbits;
+extern volatile uint16_t PG3EVTL;
+typedef struct
+{
+    uint16_t ADTR1EN1;
+    uint16_t ADTR1EN2;
+    uint16_t ADTR1EN3;
+    uint16_t ADTR1PS;
+    uint16_t PGTRGSEL;
+    uint16_t UPDTRG;
+} HOST_PG3EVTLBITS_T;
+extern volatile HOST_PG3EVTLBITS_T PG3EVTLbits;
+extern volatile uint16_t PG3FFPCIH;
+extern volatile uint16_t PG3FFPCIL;
+extern volatile uint16_t PG3FPCIH;
+typedef struct
+{
+    uint16_t ACP;
+    uint16_t BPEN;
+    uint16_t BPSEL;
+    uint16_t PCIGT;
+    uint16_t TQPS;
+    uint16_t TQSS;
+} HOST_PG3FPCIHBITS_T;
+extern volatile HOST_PG3FPCIHBITS_T PG3FPCIHbits;
+extern volatile uint16_t PG3FPCIL;
+typedef struct
+{
+    uint16_t AQPS;
+    uint16_t AQSS;
+    uint16_t PPS;
+    uint16_t PSS;
+    uint16_t PSYNC;
+    uint16_t TERM;
+    uint16_t TSYNCDIS;
+} HOST_PG3FPCILBITS_T;
+extern volatile HOST_PG3FPCILBITS_T PG3FPCILbits;
+extern volatile uint16_t PG3IOCONH;
+typedef struct
+{
+    uint16_t CAPSRC;
+    uint16_t DTCMPSEL;
+    uint16_t PENH;
+    uint16_t PENL;
+    uint16_t PMOD;
+    uint16_t POLH;
+    uint16_t POLL;
+} HOST_PG3IOCONHBITS_T;
+extern volatile HOST_PG3IOCONHBITS_T PG3IOCONHbits;
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        uint16_t DBDAT:2;
+        uint16_t FFDAT:2;
+        uint16_t CLDAT:2;
+        uint16_t FLTDAT:2;
+        uint16_t OSYNC:2;
+        uint16_t OVRDAT:2;
+        uint16_t OVRENL:1;
+        uint16_t OVRENH:1;
+        uint16_t SWAP:1;
+        uint16_t CLMOD:1;
+    } bits;
+} HOST_PG3IOCONL_T;
+extern volatile HOST_PG3IOCONL_T host_PG3IOCONL;
+#define PG3IOCONL host_PG3IOCONL.reg
+#define PG3IOCONLbits host_PG3IOCONL.bits
+extern volatile uint16_t PG3LEBH;
+typedef struct
+{
+    uint16_t PWMPCI;
+} HOST_PG3LEBHBITS_T;
+extern volatile HOST_PG3LEBHBITS_T PG3LEBHbits;
+extern volatile uint16_t PG3LEBL;
+extern volatile uint16_t PG3PER;
+extern volatile uint16_t PG3PHASE;
+extern volatile uint16_t PG3SPCIH;
+extern volatile uint16_t PG3SPCIL;
+typedef struct
+{
+    uint16_t PPS;
+    uint16_t PSS;
+} HOST_PG3SPCILBITS_T;
+extern volatile HOST_PG3SPCILBITS_T PG3SPCILbits;
+extern volatile uint16_t PG3STAT;
+extern volatile uint16_t PG3TRIGA;
+extern volatile uint16_t PG3TRIGB;
+extern volatile uint16_t PG3TRIGC;
+extern volatile uint16_t PG5CLPCIH;
+extern volatile uint16_t PG5CLPCIL;
+extern volatile uint16_t PG5CONH;
+typedef struct
+{
+    uint16_t MDCSEL;
+    uint16_t MPERSEL;
+    uint16_t MPHSEL;
+    uint16_t MSTEN;
+    uint16_t SOCS;
+    uint16_t TRGMOD;
+    uint16_t UPDMOD;
+} HOST_PG5CONHBITS_T;
+extern volatile HOST_PG5CONHBITS_T PG5CONHbits;
+extern volatile uint16_t PG5CONL;
+typedef struct
+{
+    uint16_t CLKSEL;
+    uint16_t MODSEL;
+    uint16_t ON;
+    uint16_t TRGCNT;
+} HOST_PG5CONLBITS_T;
+extern volatile HOST_PG5CONLBITS_T PG5CONLbits;
+extern volatile uint16_t PG5DC;
+extern volatile uint16_t PG5DCA;
+extern volatile uint16_t PG5DTH;
+extern volatile uint16_t PG5DTL;
+extern volatile uint16_t PG5EVTH;
+typedef struct
+{
+    uint16_t ADTR1OFS;
+    uint16_t ADTR2EN1;
+    uint16_t ADTR2EN2;
+    uint16_t ADTR2EN3;
+    uint16_t CLIEN;
+    uint16_t FFIEN;
+    uint16_t FLTIEN;
+    uint16_t IEVTSEL;
+    uint16_t SIEN;
+} HOST_PG5EVTHBITS_T;
+extern volatile HOST_PG5EVTHBITS_T PG5EVTHbits;
+extern volatile uint16_t PG5EVTL;
+typedef struct
+{
+    uint16_t ADTR1EN1;
+    uint16_t ADTR1EN2;
+    uint16_t ADTR1EN3;
+    uint16_t ADTR1PS;
+    uint16_t PGTRGSEL;
+    uint16_t UPDTRG;
+} HOST_PG5EVTLBITS_T;
+extern volatile HOST_PG5EVTLBITS_T PG5EVTLbits;
+extern volatile uint16_t PG5FFPCIH;
+extern volatile uint16_t PG5FFPCIL;
+extern volatile uint16_t PG5FPCIH;
+typedef struct
+{
+    uint16_t ACP;
+    uint16_t BPEN;
+    uint16_t BPSEL;
+    uint16_t PCIGT;
+    uint16_t TQPS;
+    uint16_t TQSS;
+} HOST_PG5FPCIHBITS_T;
+extern volatile HOST_PG5FPCIHBITS_T PG5FPCIHbits;
+extern volatile uint16_t PG5FPCIL;
+typedef struct
+{
+    uint16_t AQPS;
+    uint16_t AQSS;
+    uint16_t PPS;
+    uint16_t PSS;
+    uint16_t PSYNC;
+    uint16_t TERM;
+    uint16_t TSYNCDIS;
+} HOST_PG5FPCILBITS_T;
+extern volatile HOST_PG5FPCILBITS_T PG5FPCILbits;
+extern volatile uint16_t PG5IOCONH;
+typedef struct
+{
+    uint16_t CAPSRC;
+    uint16_t DTCMPSEL;
+    uint16_t PENH;
+    uint16_t PENL;
+    uint16_t PMOD;
+    uint16_t POLH;
+    uint16_t POLL;
+} HOST_PG5IOCONHBITS_T;
+extern volatile HOST_PG5IOCONHBITS_T PG5IOCONHbits;
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        uint16_t DBDAT:2;
+        uint16_t FFDAT:2;
+        uint16_t CLDAT:2;
+        uint16_t FLTDAT:2;
+        uint16_t OSYNC:2;
+        uint16_t OVRDAT:2;
+        uint16_t OVRENL:1;
+        uint16_t OVRENH:1;
+        uint16_t SWAP:1;
+        uint16_t CLMOD:1;
+    } bits;
+} HOST_PG5IOCONL_T;
+extern volatile HOST_PG5IOCONL_T host_PG5IOCONL;
+#define PG5IOCONL host_PG5IOCONL.reg
+#define PG5IOCONLbits host_PG5IOCONL.bits
+extern volatile uint16_t PG5LEBH;
+extern volatile uint16_t PG5LEBL;
+extern volatile uint16_t PG5PER;
+extern volatile uint16_t PG5PHASE;
+extern volatile uint16_t PG5SPCIH;
+typedef struct
+{
+    uint16_t ACP;
+    uint16_t BPEN;
+    uint16_t BPSEL;
+    uint16_t PCIGT;
+    uint16_t TQPS;
+    uint16_t TQSS;
+} HOST_PG5SPCIHBITS_T;
+extern volatile HOST_PG5SPCIHBITS_T PG5SPCIHbits;
+extern volatile uint16_t PG5SPCIL;
+typedef struct
+{
+    uint16_t AQPS;
+    uint16_t AQSS;
+    uint16_t PPS;
+    uint16_t PSS;
+    uint16_t PSYNC;
+    uint16_t TERM;
+    uint16_t TSYNCDIS;
+} HOST_PG5SPCILBITS_T;
+extern volatile HOST_PG5SPCILBITS_T PG5SPCILbits;
+extern volatile uint16_t PG5STAT;
+extern volatile uint16_t PG5TRIGA;
+extern volatile uint16_t PG5TRIGB;
+extern volatile uint16_t PG5TRIGC;
+extern volatile uint16_t host_PG6CAP;
+volatile uint16_t *host_sfr_PG6CAP(void);
+#define PG6CAP (*host_sfr_PG6CAP())
+extern volatile uint16_t PG6CLPCIH;
+extern volatile uint16_t PG6CLPCIL;
+extern volatile uint16_t PG6CONH;
+typedef struct
+{
+    uint16_t MDCSEL;
+    uint16_t MPERSEL;
+    uint16_t MPHSEL;
+    uint16_t MSTEN;
+    uint16_t SOCS;
+    uint16_t TRGMOD;
+    uint16_t UPDMOD;
+} HOST_PG6CONHBITS_T;
+extern volatile HOST_PG6CONHBITS_T PG6CONHbits;
+extern volatile uint16_t PG6CONL;
+typedef struct
+{
+    uint16_t CLKSEL;
+    uint16_t MODSEL;
+    uint16_t ON;
+    uint16_t TRGCNT;
+} HOST_PG6CONLBITS_T;
+extern volatile HOST_PG6CONLBITS_T PG6CONLbits;
+extern volatile uint16_t PG6DC;
+extern volatile uint16_t PG6DCA;
+extern volatile uint16_t PG6DTH;
+extern volatile uint16_t PG6DTL;
+extern volatile uint16_t PG6EVTH;
+typedef struct
+{
+    uint16_t ADTR1OFS;
+    uint16_t ADTR2EN1;
+    uint16_t ADTR2EN2;
+    uint16_t ADTR2EN3;
+    uint16_t CLIEN;
+    uint16_t FFIEN;
+    uint16_t FLTIEN;
+    uint16_t IEVTSEL;
+    uint16_t SIEN;
+} HOST_PG6EVTHBITS_T;
+extern volatile HOST_PG6EVTHBITS_T PG6EVTHbits;
+extern volatile uint16_t PG6EVTL;
+typedef struct
+{
+    uint16_t ADTR1EN1;
+    uint16_t ADTR1EN2;
+    uint16_t ADTR1EN3;
+    uint16_t ADTR1PS;
+    uint16_t PGTRGSEL;
+    uint16_t UPDTRG;
+} HOST_PG6EVTLBITS_T;
+extern volatile HOST_PG6EVTLBITS_T PG6EVTLbits;
+extern volatile uint16_t PG6FFPCIH;
+extern volatile uint16_t PG6FFPCIL;
+extern volatile uint16_t PG6FPCIH;
+typedef struct
+{
+    uint16_t ACP;
+    uint16_t BPEN;
+    uint16_t BPSEL;
+    uint16_t PCIGT;
+    uint16_t TQPS;
+    uint16_t TQSS;
+} HOST_PG6FPCIHBITS_T;
+extern volatile HOST_PG6FPCIHBITS_T PG6FPCIHbits;
+extern volatile uint16_t PG6FPCIL;
+typedef struct
+{
+    uint16_t AQPS;
+    uint16_t AQSS;
+    uint16_t PPS;
+    uint16_t PSS;
+    uint16_t PSYNC;
+    uint16_t TERM;
+    uint16_t TSYNCDIS;
+} HOST_PG6FPCILBITS_T;
+extern volatile HOST_PG6FPCILBITS_T PG6FPCILbits;
+extern volatile uint16_t PG6IOCONH;
+typedef struct
+{
+    uint16_t CAPSRC;
+    uint16_t DTCMPSEL;
+    uint16_t PENH;
+    uint16_t PENL;
+    uint16_t PMOD;
+    uint16_t POLH;
+    uint16_t POLL;
+} HOST_PG6IOCONHBITS_T;
+extern volatile HOST_PG6IOCONHBITS_T PG6IOCONHbits;
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        uint16_t DBDAT:2;
+        uint16_t FFDAT:2;
+        uint16_t CLDAT:2;
+        uint16_t FLTDAT:2;
+        uint16_t OSYNC:2;
+        uint16_t OVRDAT:2;
+        uint16_t OVRENL:1;
+        uint16_t OVRENH:1;
+        uint16_t SWAP:1;
+        uint16_t CLMOD:1;
+    } bits;
+} HOST_PG6IOCONL_T;
+extern volatile HOST_PG6IOCONL_T host_PG6IOCONL;
+#define PG6IOCONL host_PG6IOCONL.reg
+#define PG6IOCONLbits host_PG6IOCONL.bits
+extern volatile uint16_t PG6LEBH;
+typedef struct
+{
+    uint16_t PWMPCI;
+} HOST_PG6LEBHBITS_T;
+extern volatile HOST_PG6LEBHBITS_T PG6LEBHbits;
+extern volatile uint16_t PG6LEBL;
+extern volatile uint16_t PG6PER;
+extern volatile uint16_t PG6PHASE;
+extern volatile uint16_t PG6SPCIH;
+typedef struct
+{
+    uint16_t ACP;
+} HOST_PG6SPCIHBITS_T;
+extern volatile HOST_PG6SPCIHBITS_T PG6SPCIHbits;
+extern volatile uint16_t PG6SPCIL;
+typedef struct
+{
+    uint16_t PPS;
+    uint16_t PSS;
+} HOST_PG6SPCILBITS_T;
+extern volatile HOST_PG6SPCILBITS_T PG6SPCILbits;
+extern volatile uint16_t PG6STAT;
+typedef struct
+{
+    uint16_t CAHALF;
+} HOST_PG6STATBITS_T;
+extern volatile HOST_PG6STATBITS_T host_PG6STATbits;
+volatile HOST_PG6STATBITS_T *host_sfr_PG6STATbits(void);
+#define PG6STATbits (*host_sfr_PG6STATbits())
+extern volatile uint16_t PG6TRIGA;
+extern volatile uint16_t PG6TRIGB;
+extern volatile uint16_t PG6TRIGC;
+extern volatile uint16_t PG7CLPCIH;
+extern volatile uint16_t PG7CLPCIL;
+extern volatile uint16_t PG7CONH;
+typedef struct
+{
+    uint16_t MDCSEL;
+    uint16_t MPERSEL;
+    uint16_t MPHSEL;
+    uint16_t MSTEN;
+    uint16_t SOCS;
+    uint16_t TRGMOD;
+    uint16_t UPDMOD;
+} HOST_PG7CONHBITS_T;
+extern volatile HOST_PG7CONHBITS_T PG7CONHbits;
+extern volatile uint16_t PG7CONL;
+typedef struct
+{
+    uint16_t CLKSEL;
+    uint16_t MODSEL;
+    uint16_t ON;
+    uint16_t TRGCNT;
+} HOST_PG7CONLBITS_T;
+extern volatile HOST_PG7CONLBITS_T PG7CONLbits;
+extern volatile uint16_t PG7DC;
+extern volatile uint16_t PG7DCA;
+extern volatile uint16_t PG7DTH;
+extern volatile uint16_t PG7DTL;
+extern volatile uint16_t PG7EVTH;
+typedef struct
+{
+    uint16_t ADTR1OFS;
+    uint16_t ADTR2EN1;
+    uint16_t ADTR2EN2;
+    uint16_t ADTR2EN3;
+    uint16_t CLIEN;
+    uint16_t FFIEN;
+    uint16_t FLTIEN;
+    uint16_t IEVTSEL;
+    uint16_t SIEN;
+} HOST_PG7EVTHBITS_T;
+extern volatile HOST_PG7EVTHBITS_T PG7EVTHbits;
+extern volatile uint16_t PG7EVTL;
+typedef struct
+{
+    uint16_t ADTR1EN1;
+    uint16_t ADTR1EN2;
+    uint16_t ADTR1EN3;
+    uint16_t ADTR1PS;
+    uint16_t PGTRGSEL;
+    uint16_t UPDTRG;
+} HOST_PG7EVTLBITS_T;
+extern volatile HOST_PG7EVTLBITS_T PG7EVTLbits;
+extern volatile uint16_t PG7FFPCIH;
+extern volatile uint16_t PG7FFPCIL;
+extern volatile uint16_t PG7FPCIH;
+typedef struct
+{
+    uint16_t ACP;
+    uint16_t BPEN;
+    uint16_t BPSEL;
+    uint16_t PCIGT;
+    uint16_t TQPS;
+    uint16_t TQSS;
+} HOST_PG7FPCIHBITS_T;
+extern volatile HOST_PG7FPCIHBITS_T PG7FPCIHbits;
+extern volatile uint16_t PG7FPCIL;
+typedef struct
+{
+    uint16_t AQPS;
+    uint16_t AQSS;
+    uint16_t PPS;
+    uint16_t PSS;
+    uint16_t PSYNC;
+    uint16_t TERM;
+    uint16_t TSYNCDIS;
+} HOST_PG7FPCILBITS_T;
+extern volatile HOST_PG7FPCILBITS_T PG7FPCILbits;
+extern volatile uint16_t PG7IOCONH;
+typedef struct
+{
+    uint16_t CAPSRC;
+    uint16_t DTCMPSEL;
+    uint16_t PENH;
+    uint16_t PENL;
+    uint16_t PMOD;
+    uint16_t POLH;
+    uint16_t POLL;
+} HOST_PG7IOCONHBITS_T;
+extern volatile HOST_PG7IOCONHBITS_T PG7IOCONHbits;
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        uint16_t DBDAT:2;
+        uint16_t FFDAT:2;
+        uint16_t CLDAT:2;
+        uint16_t FLTDAT:2;
+        uint16_t OSYNC:2;
+        uint16_t OVRDAT:2;
+        uint16_t OVRENL:1;
+        uint16_t OVRENH:1;
+        uint16_t SWAP:1;
+        uint16_t CLMOD:1;
+    } bits;
+} HOST_PG7IOCONL_T;
+extern volatile HOST_PG7IOCONL_T host_PG7IOCONL;
+#define PG7IOCONL host_PG7IOCONL.reg
+#define PG7IOCONLbits host_PG7IOCONL.bits
+extern volatile uint16_t PG7LEBH;
+typedef struct
+{
+    uint16_t PWMPCI;
+} HOST_PG7LEBHBITS_T;
+extern volatile HOST_PG7LEBHBITS_T PG7LEBHbits;
+extern volatile uint16_t PG7LEBL;
+extern volatile uint16_t PG7PER;
+extern volatile uint16_t PG7PHASE;
+extern volatile uint16_t PG7SPCIH;
+typedef struct
+{
+    uint16_t ACP;
+} HOST_PG7SPCIHBITS_T;
+extern volatile HOST_PG7SPCIHBITS_T PG7SPCIHbits;
+extern volatile uint16_t PG7SPCIL;
+typedef struct
+{
+    uint16_t PPS;
+    uint16_t PSS;
+} HOST_PG7SPCILBITS_T;
+extern volatile HOST_PG7SPCILBITS_T PG7SPCILbits;
+extern volatile uint16_t PG7STAT;
+extern volatile uint16_t PG7TRIGA;
+extern volatile uint16_t PG7TRIGB;
+extern volatile uint16_t PG7TRIGC;
+extern volatile uint16_t PG8CLPCIH;
+extern volatile uint16_t PG8CLPCIL;
+extern volatile uint16_t PG8CONH;
+typedef struct
+{
+    uint16_t MDCSEL;
+    uint16_t MPERSEL;
+    uint16_t MPHSEL;
+    uint16_t MSTEN;
+    uint16_t SOCS;
+    uint16_t TRGMOD;
+    uint16_t UPDMOD;
+} HOST_PG8CONHBITS_T;
+extern volatile HOST_PG8CONHBITS_T PG8CONHbits;
+extern volatile uint16_t PG8CONL;
+typedef struct
+{
+    uint16_t CLKSEL;
+    uint16_t MODSEL;
+    uint16_t ON;
+    uint16_t TRGCNT;
+} HOST_PG8CONLBITS_T;
+extern volatile HOST_PG8CONLBITS_T PG8CONLbits;
+extern volatile uint16_t PG8DC;
+extern volatile uint16_t PG8DCA;
+extern volatile uint16_t PG8DTH;
+extern volatile uint16_t PG8DTL;
+extern volatile uint16_t PG8EVTH;
+typedef struct
+{
+    uint16_t ADTR1OFS;
+    uint16_t ADTR2EN1;
+    uint16_t ADTR2EN2;
+    uint16_t ADTR2EN3;
+    uint16_t CLIEN;
+    uint16_t FFIEN;
+    uint16_t FLTIEN;
+    uint16_t IEVTSEL;
+    uint16_t SIEN;
+} HOST_PG8EVTHBITS_T;
+extern volatile HOST_PG8EVTHBITS_T PG8EVTHbits;
+extern volatile uint16_t PG8EVTL;
+typedef struct
+{
+    uint16_t ADTR1EN1;
+    uint16_t ADTR1EN2;
+    uint16_t ADTR1EN3;
+    uint16_t ADTR1PS;
+    uint16_t PGTRGSEL;
+    uint16_t UPDTRG;
+} HOST_PG8EVTLBITS_T;
+extern volatile HOST_PG8EVTLBITS_T PG8EVTLbits;
+extern volatile uint16_t PG8FFPCIH;
+extern volatile uint16_t PG8FFPCIL;
+extern volatile uint16_t PG8FPCIH;
+typedef struct
+{
+    uint16_t ACP;
+    uint16_t BPEN;
+    uint16_t BPSEL;
+    uint16_t PCIGT;
+    uint16_t TQPS;
+    uint16_t TQSS;
+} HOST_PG8FPCIHBITS_T;
+extern volatile HOST_PG8FPCIHBITS_T PG8FPCIHbits;
+extern volatile uint16_t PG8FPCIL;
+typedef struct
+{
+    uint16_t AQPS;
+    uint16_t AQSS;
+    uint16_t PPS;
+    uint16_t PSS;
+    uint16_t PSYNC;
+    uint16_t TERM;
+    uint16_t TSYNCDIS;
+} HOST_PG8FPCILBITS_T;
+extern volatile HOST_PG8FPCILBITS_T PG8FPCILbits;
+extern volatile uint16_t PG8IOCONH;
+typedef struct
+{
+    uint16_t CAPSRC;
+    uint16_t DTCMPSEL;
+    uint16_t PENH;
+    uint16_t PENL;
+    uint16_t PMOD;
+    uint16_t POLH;
+    uint16_t POLL;
+} HOST_PG8IOCONHBITS_T;
+extern volatile HOST_PG8IOCONHBITS_T PG8IOCONHbits;
+typedef union
+{
+    uint16_t reg;
+    struct
+    {
+        uint16_t DBDAT:2;
+        uint16_t FFDAT:2;
+        uint16_t CLDAT:2;
+        uint16_t FLTDAT:2;
+        uint16_t OSYNC:2;
+        uint16_t OVRDAT:2;
+        uint16_t OVRENL:1;
+        uint16_t OVRENH:1;
+        uint16_t SWAP:1;
+        uint16_t CLMOD:1;
+    } bits;
+} HOST_PG8IOCONL_T;
+extern volatile HOST_PG8IOCONL_T host_PG8IOCONL;
+#define PG8IOCONL host_PG8IOCONL.reg
+#define PG8IOCONLbits host_PG8IOCONL.bits
+extern volatile uint16_t PG8LEBH;
+typedef struct
+{
+    uint16_t PWMPCI;
+} HOST_PG8LEBHBITS_T;
+extern volatile HOST_PG8LEBHBITS_T PG8LEBHbits;
+extern volatile uint16_t PG8LEBL;
+extern volatile uint16_t PG8PER;
+extern volatile uint16_t PG8PHASE;
+extern volatile uint16_t PG8SPCIH;
+typedef struct
+{
+    uint16_t ACP;
+} HOST_PG8SPCIHBITS_T;
+extern volatile HOST_PG8SPCIHBITS_T PG8SPCIHbits;
+extern volatile uint16_t PG8SPCIL;
+typedef struct
+{
+    uint16_t PPS;
+    uint16_t PSS;
+} HOST_PG8SPCILBITS_T;
+extern volatile HOST_PG8SPCILBITS_T PG8SPCILbits;
+extern volatile uint16_t PG8STAT;
+extern volatile uint16_t PG8TRIGA;
+extern volatile uint16_t PG8TRIGB;
+extern volatile uint16_t PG8TRIGC;
+extern volatile uint16_t PLLDIV;
+typedef struct
+{
+    uint16_t POST1DIV;
+    uint16_t POST2DIV;
+    uint16_t VCODIV;
+} HOST_PLLDIVBITS_T;
+extern volatile HOST_PLLDIVBITS_T PLLDIVbits;
+extern volatile uint16_t PLLFBD;
+typedef struct
+{
+    uint16_t PLLFBDIV;
+} HOST_PLLFBDBITS_T;
+extern volatile HOST_PLLFBDBITS_T PLLFBDbits;
+extern volatile uint16_t PORTE;
+typedef struct
+{
+    uint16_t RE4;
+    uint16_t RE5;
+} HOST_PORTEBITS_T;
+extern volatile HOST_PORTEBITS_T PORTEbits;
+extern volatile uint16_t PR1;
+extern volatile uint16_t PWMEVTA;
+typedef struct
+{
+    uint16_t EVTAOEN;
+    uint16_t EVTAPGS;
+    uint16_t EVTAPOL;
+    uint16_t EVTASEL;
+    uint16_t EVTASTRD;
+    uint16_t EVTASYNC;
+} HOST_PWMEVTABITS_T;
+extern volatile HOST_PWMEVTABITS_T PWMEVTAbits;
+extern volatile uint16_t PWMEVTB;
+extern volatile uint16_t PWMEVTC;
+extern volatile uint16_t PWMEVTD;
+extern volatile uint16_t PWMEVTE;
+extern volatile uint16_t PWMEVTF;
+extern volatile uint16_t REFOCONH;
+typedef struct
+{
+    uint16_t RODIV;
+} HOST_REFOCONHBITS_T;
+extern volatile HOST_REFOCONHBITS_T REFOCONHbits;
+extern volatile uint16_t REFOCONL;
+typedef struct
+{
+    uint16_t ROACTIVE;
+    uint16_t ROEN;
+    uint16_t ROOUT;
+    uint16_t ROSEL;
+    uint16_t ROSIDL;
+    uint16_t ROSLP;
+} HOST_REFOCONLBITS_T;
+extern volatile HOST_REFOCONLBITS_T REFOCONLbits;
+extern volatile uint16_t SI1MBX0D;
+extern volatile uint16_t SI1MBX10D;
+extern volatile uint16_t SI1MBX11D;
+extern volatile uint16_t SI1MBX12D;
+extern volatile uint16_t SI1MBX13D;
+extern volatile uint16_t SI1MBX14D;
+extern volatile uint16_t host_SI1MBX15D;
+volatile uint16_t *host_sfr_SI1MBX15D(void);
+#define SI1MBX15D (*host_sfr_SI1MBX15D())
+extern volatile uint16_t SI1MBX1D;
+extern volatile uint16_t SI1MBX2D;
+extern volatile uint16_t SI1MBX3D;
+extern volatile uint16_t SI1MBX4D;
+extern volatile uint16_t SI1MBX5D;
+extern volatile uint16_t host_SI1MBX6D;
+volatile uint16_t *host_sfr_SI1MBX6D(void);
+#define SI1MBX6D (*host_sfr_SI1MBX6D())
+extern volatile uint16_t SI1MBX7D;
+extern volatile uint16_t SI1MBX8D;
+extern volatile uint16_t SI1MBX9D;
+extern volatile uint16_t SI1MBXS;
+typedef struct
+{
+    uint16_t DTRDYA;
+    uint16_t DTRDYB;
+} HOST_SI1MBXSBITS_T;
+extern volatile HOST_SI1MBXSBITS_T host_SI1MBXSbits;
+volatile HOST_SI1MBXSBITS_T *host_sfr_SI1MBXSbits(void);
+#define SI1MBXSbits (*host_sfr_SI1MBXSbits())
+extern volatile uint16_t T1CON;
+typedef struct
+{
+    uint16_t TCKPS;
+    uint16_t TCS;
+    uint16_t TGATE;
+    uint16_t TON;
+    uint16_t TSIDL;
+    uint16_t TSYNC;
+} HOST_T1CONBITS_T;
+extern volatile HOST_T1CONBITS_T T1CONbits;
+extern volatile uint16_t host_TMR1;
+volatile uint16_t *host_sfr_TMR1(void);
+#define TMR1 (*host_sfr_TMR1())
+extern volatile uint16_t TRISA;
+typedef struct
+{
+    uint16_t TRISA1;
+    uint16_t TRISA3;
+    uint16_t TRISA4;
+} HOST_TRISABITS_T;
+extern volatile HOST_TRISABITS_T TRISAbits;
+extern volatile uint16_t TRISB;
+typedef struct
+{
+    uint16_t TRISB11;
+    uint16_t TRISB3;
+    uint16_t TRISB7;
+} HOST_TRISBBITS_T;
+extern volatile HOST_TRISBBITS_T TRISBbits;
+extern volatile uint16_t TRISC;
+typedef struct
+{
+    uint16_t TRISC0;
+    uint16_t TRISC1;
+    uint16_t TRISC10;
+    uint16_t TRISC11;
+    uint16_t TRISC14;
+    uint16_t TRISC15;
+    uint16_t TRISC2;
+    uint16_t TRISC4;
+    uint16_t TRISC5;
+} HOST_TRISCBITS_T;
+extern volatile HOST_TRISCBITS_T TRISCbits;
+extern volatile uint16_t TRISD;
+typedef struct
+{
+    uint16_t TRISD10;
+    uint16_t TRISD15;
+    uint16_t TRISD2;
+    uint16_t TRISD3;
+    uint16_t TRISD4;
+    uint16_t TRISD5;
+    uint16_t TRISD6;
+    uint16_t TRISD7;
+} HOST_TRISDBITS_T;
+extern volatile HOST_TRISDBITS_T TRISDbits;
+extern volatile uint16_t TRISE;
+typedef struct
+{
+    uint16_t TRISE2;
+    uint16_t TRISE3;
+    uint16_t TRISE4;
+    uint16_t TRISE5;
+} HOST_TRISEBITS_T;
+extern volatile HOST_TRISEBITS_T TRISEbits;
+extern volatile uint16_t U1BRG;
+extern volatile uint16_t U1BRGH;
+extern volatile uint16_t U1INT;
+typedef struct
+{
+    uint16_t ABDIE;
+    uint16_t ABDIF;
+    uint16_t WUIF;
+} HOST_U1INTBITS_T;
+extern volatile HOST_U1INTBITS_T U1INTbits;
+extern volatile uint16_t U1MODE;
+typedef struct
+{
+    uint16_t ABAUD;
+    uint16_t BRGH;
+    uint16_t BRKOVR;
+    uint16_t MOD;
+    uint16_t RXBIMD;
+    uint16_t UARTEN;
+    uint16_t URXEN;
+    uint16_t USIDL;
+    uint16_t UTXBRK;
+    uint16_t UTXEN;
+    uint16_t WAKE;
+} HOST_U1MODEBITS_T;
+extern volatile HOST_U1MODEBITS_T U1MODEbits;
+extern volatile uint16_t U1MODEH;
+typedef struct
+{
+    uint16_t ACTIVE;
+    uint16_t BCLKSEL;
+    uint16_t C0EN;
+    uint16_t FLO;
+    uint16_t HALFDPLX;
+    uint16_t RUNOVF;
+    uint16_t SLPEN;
+    uint16_t STSEL;
+    uint16_t URXINV;
+    uint16_t UTXINV;
+} HOST_U1MODEHBITS_T;
+extern volatile HOST_U1MODEHBITS_T U1MODEHbits;
+extern volatile uint16_t U1P1;
+extern volatile uint16_t U1P2;
+extern volatile uint16_t U1P3;
+extern volatile uint16_t U1P3H;
+extern volatile uint16_t U1RXCHK;
+extern volatile uint16_t U1RXREG;
+typedef struct
+{
+    uint16_t RXREG;
+} HOST_U1RXREGBITS_T;
+extern volatile HOST_U1RXREGBITS_T U1RXREGbits;
+extern volatile uint16_t U1SCCON;
+extern volatile uint16_t U1SCINT;
+extern volatile uint16_t U1STA;
+typedef struct
+{
+    uint16_t ABDOVE;
+    uint16_t ABDOVF;
+    uint16_t CERIE;
+    uint16_t CERIF;
+    uint16_t FERIE;
+    uint16_t FERR;
+    uint16_t OERIE;
+    uint16_t OERR;
+    uint16_t PERIE;
+    uint16_t PERR;
+    uint16_t RXBKIE;
+    uint16_t RXBKIF;
+    uint16_t TRMT;
+    uint16_t TXCIE;
+    uint16_t TXCIF;
+    uint16_t TXMTIE;
+} HOST_U1STABITS_T;
+extern volatile HOST_U1STABITS_T U1STAbits;
+extern volatile uint16_t U1STAH;
+typedef struct
+{
+    uint16_t RIDLE;
+    uint16_t STPMD;
+    uint16_t TXWRE;
+    uint16_t URXBE;
+    uint16_t URXBF;
+    uint16_t URXISEL;
+    uint16_t UTXBE;
+    uint16_t UTXBF;
+    uint16_t UTXISEL;
+    uint16_t XON;
+} HOST_U1STAHBITS_T;
+extern volatile HOST_U1STAHBITS_T U1STAHbits;
+extern volatile uint16_t U1TXCHK;
+extern volatile uint16_t U1TXREG;
+typedef struct
+{
+    uint16_t LAST;
+    uint16_t TXREG;
+} HOST_U1TXREGBITS_T;
+extern volatile HOST_U1TXREGBITS_T U1TXREGbits;
+extern volatile uint16_t _ADCAN0IE;
+extern volatile uint16_t _ADCAN0IF;
+extern volatile uint16_t _ADCAN0IP;
+extern volatile uint16_t _ADCAN10IE;
+extern volatile uint16_t _ADCAN10IF;
+extern volatile uint16_t _ADCAN10IP;
+extern volatile uint16_t _ADCAN15IE;
+extern volatile uint16_t _ADCAN15IF;
+extern volatile uint16_t _ADCAN15IP;
+extern volatile uint16_t _ADCAN18IE;
+extern volatile uint16_t _ADCAN18IF;
+extern volatile uint16_t _ADCAN18IP;
+extern volatile uint16_t _ADCAN1IE;
+extern volatile uint16_t _ADCAN1IF;
+extern volatile uint16_t _ADCAN1IP;
+extern volatile uint16_t _IE0;
+extern volatile uint16_t _IE1;
+extern volatile uint16_t _IE10;
+extern volatile uint16_t _IE15;
+extern volatile uint16_t _IE18;
+extern volatile uint16_t _PWM1IF;
+extern volatile uint16_t _PWM6IF;
+extern volatile uint16_t _RP43R;
+extern volatile uint16_t _RP46R;
+extern volatile uint16_t _T1IE;
+extern volatile uint16_t _T1IF;
+extern volatile uint16_t _T1IP;
+extern volatile uint16_t _U1RXIE;
+extern volatile uint16_t _U1RXIF;
+extern volatile uint16_t _U1RXR;
+extern volatile uint16_t _U1TXIE;
+extern volatile uint16_t _U1TXIF;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_SFR_H */
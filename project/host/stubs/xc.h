@@ -0,0 +1,19 @@
+/**
+ * @file xc.h
+ *
+ * @brief Device header of the host build : special function registers of
+ *        the core being built (host_sfr.h, generated by tools/gen_sfr.py)
+ *        and the emulated DSP builtins.
+ */
+#ifndef HOST_XC_H
+#define HOST_XC_H
+
+#include <stdint.h>
+
+#include "host_dsp.h"
+#include "host_sfr.h"
+
+#define Nop()       ((void)0)
+#define ClrWdt()    ((void)0)
+
+#endif /* HOST_XC_H */
@@ -0,0 +1,244 @@
+/**
+ * @file cmdstress.c
+ *
+ * @brief Command buffer stress test of both motors : the ADC ISR, which
+ *        adopts the active command block (MCAPP_MCxCommandAdopt), preempts
+ *        MCAPP_MCxInputBufferSet of the Timer1 ISR at each of its
+ *        instruction boundaries.
+ *
+ * Usage : cmdstress [secondary image]
+ *
+ * InputBufferSet is single stepped with the trap flag of the host CPU; at
+ * step k of an execution the SIGTRAP handler runs the unmodified ADC ISR of
+ * the motor, as the ADC interrupt would, and the pair the ISR adopted is
+ * checked : the previously published pair or the new one, never the run
+ * command of one with the target velocity of the other. After
+ * InputBufferSet returns, the next ISR must adopt the new pair.
+ *
+ * Exit status 1 if an adoption is torn or a published pair is lost; 77
+ * (skipped) on hosts other than x86-64.
+ */
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mc1_init.h"
+#include "mc2_init.h"
+
+#include "sim.h"
+
+#define CMDSTRESS_SKIPPED       77
+#define CMDSTRESS_PAIRS         4       /* Pairs published per step */
+#define CMDSTRESS_STEPS_MAX     4096
+
+typedef struct
+{
+    const char *name;
+    const char *data;               /* MCx APP_DATA_T */
+    const char *inputBufferSet;
+    const char *isr;                /* ADC ISR of the motor */
+} CMDSTRESS_MOTOR_T;
+
+static const CMDSTRESS_MOTOR_T motor[] =
+{
+    {"mc1", "mc1", "MCAPP_MC1InputBufferSet", "_ADCAN15Interrupt"},
+    {"mc2", "mc2", "MCAPP_MC2InputBufferSet", "_ADCAN18Interrupt"},
+};
+
+#define MOTORS  (sizeof(motor) / sizeof(motor[0]))
+
+typedef struct
+{
+    int16_t runCmd;
+    int16_t qTargetVelocity;        /* As written to the block */
+} CMDSTRESS_PAIR_T;
+
+/* Adopted pair : runCmdBuffer and qTargetVelocity of MC1APP_DATA_T and
+   MC2APP_DATA_T */
+typedef struct
+{
+    const int16_t *pRunCmd;
+    const int16_t *pTargetVelocity;
+    const MCAPP_MOTOR_T *pMotor;
+} CMDSTRESS_ADOPTED_T;
+
+static void (*isr)(void);
+static volatile long step, inject;
+static volatile int injected;
+static CMDSTRESS_ADOPTED_T adopted;
+static CMDSTRESS_PAIR_T seen;
+
+#if defined(__x86_64__)
+
+static void TrapFlagSet(void)
+{
+    __asm__ volatile ("pushfq\n\torq $0x100, (%%rsp)\n\tpopfq" ::: "memory");
+}
+
+static void TrapFlagClear(void)
+{
+    __asm__ volatile ("pushfq\n\tandq $~0x100, (%%rsp)\n\tpopfq" :::
+                      "memory");
+}
+
+/* Runs with the trap flag cleared, after each instruction between
+   TrapFlagSet() and TrapFlagClear() */
+static void Trap(int signal)
+{
+    (void)signal;
+    if (step++ == inject)
+    {
+        isr();
+        seen.runCmd = *adopted.pRunCmd;
+        seen.qTargetVelocity = *adopted.pTargetVelocity;
+        injected = 1;
+    }
+}
+
+#endif
+
+static CMDSTRESS_PAIR_T Pair(const MCAPP_MOTOR_T *pMotor, int n)
+{
+    CMDSTRESS_PAIR_T pair;
+    const int16_t velocity = (int16_t)((n * 7919) & 0x7FFF);
+
+    pair.runCmd = n & 1;
+    /* MCAPP_MCxInputBufferSet() */
+    pair.qTargetVelocity = pMotor->qMinSpeed +
+            (int16_t)(((int32_t)(pMotor->qMaxSpeed - pMotor->qMinSpeed) *
+                                                            velocity) >> 15);
+    return pair;
+}
+
+static int Equal(CMDSTRESS_PAIR_T a, CMDSTRESS_PAIR_T b)
+{
+    return (a.runCmd == b.runCmd) && (a.qTargetVelocity == b.qTargetVelocity);
+}
+
+static CMDSTRESS_PAIR_T Adopted(void)
+{
+    CMDSTRESS_PAIR_T pair = {*adopted.pRunCmd, *adopted.pTargetVelocity};
+
+    return pair;
+}
+
+/* Publishes pair n, with the ISR injected at step inject (-1 : none).
+   Returns the number of steps of the execution. */
+static long Publish(void (*inputBufferSet)(int16_t, int16_t), int n,
+                    long at)
+{
+    const int16_t velocity = (int16_t)((n * 7919) & 0x7FFF);
+
+    step = 0;
+    inject = at;
+    injected = 0;
+#if defined(__x86_64__)
+    TrapFlagSet();
+    inputBufferSet(n & 1, velocity);
+    TrapFlagClear();
+#endif
+    return step;
+}
+
+static int Stress(const HOST_IMAGE_T *pImage, const CMDSTRESS_MOTOR_T *pMotor)
+{
+    void (*inputBufferSet)(int16_t, int16_t) =
+                                    pImage->symbol(pMotor->inputBufferSet);
+    const MCAPP_MOTOR_T *pParameters;
+    long steps, k;
+    int n = 1, interleavings = 0, old = 0, torn = 0, lost = 0, p;
+
+    isr = pImage->symbol(pMotor->isr);
+    if (strcmp(pMotor->name, "mc1") == 0)
+    {
+        MC1APP_DATA_T *pData = pImage->symbol(pMotor->data);
+
+        adopted.pRunCmd = &pData->runCmdBuffer;
+        adopted.pTargetVelocity = &pData->qTargetVelocity;
+        pParameters = pData->pMotor;
+    }
+    else
+    {
+        MC2APP_DATA_T *pData = pImage->symbol(pMotor->data);
+
+        adopted.pRunCmd = &pData->runCmdBuffer;
+        adopted.pTargetVelocity = &pData->qTargetVelocity;
+        pParameters = pData->pMotor;
+    }
+
+    /* Steps of an execution without preemption */
+    steps = Publish(inputBufferSet, n++, -1);
+    isr();
+    if (steps > CMDSTRESS_STEPS_MAX)
+    {
+        steps = CMDSTRESS_STEPS_MAX;
+    }
+
+    for (k = 0; k < steps; k++)
+    {
+        for (p = 0; p < CMDSTRESS_PAIRS; p++, n++)
+        {
+            const CMDSTRESS_PAIR_T previous = Pair(pParameters, n - 1);
+            const CMDSTRESS_PAIR_T next = Pair(pParameters, n);
+
+            Publish(inputBufferSet, n, k);
+            if (injected)
+            {
+                interleavings++;
+                if (Equal(seen, previous))
+                {
+                    old++;
+                }
+                else if (!Equal(seen, next))
+                {
+                    torn++;
+                }
+            }
+            isr();
+            if (!Equal(Adopted(), next))
+            {
+                lost++;
+            }
+        }
+    }
+
+    printf("%s : %ld instruction boundaries, %d preemptions (%d adopted "
+           "the previous pair), %d torn, %d lost\n", pMotor->name, steps,
+           interleavings, old, torn, lost);
+    return (interleavings > 0) && (torn == 0) && (lost == 0);
+}
+
+int main(int argc, char **argv)
+{
+    static SIM_T sim;
+    const char *name = (argc > 1) ? argv[1] : "secondary";
+    const HOST_IMAGE_T *pImage = SimImage(name);
+    size_t i;
+    int pass = 1;
+
+#if !defined(__x86_64__)
+    printf("cmdstress: single stepping needs an x86-64 host, skipped\n");
+    return CMDSTRESS_SKIPPED;
+#endif
+    if (pImage == NULL)
+    {
+        fprintf(stderr, "cmdstress: no image %s\n", name);
+        return EXIT_FAILURE;
+    }
+    SimInit(&sim, 1.0e-3, NULL, NULL, NULL);
+    SimStart(&sim, pImage);
+    /* Peripherals configured, then the simulation stops : the ADC ISRs
+       run only when injected */
+    SimRun(&sim, 0.01);
+
+#if defined(__x86_64__)
+    signal(SIGTRAP, Trap);
+#endif
+    for (i = 0; i < MOTORS; i++)
+    {
+        pass &= Stress(pImage, &motor[i]);
+    }
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file fxp.c
+ *
+ * @brief Fixed point check, see fxp.h.
+ */
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "fxp.h"
+
+static void Add(FXP_VARIABLE_T *pVariable, double fixed, double reference,
+                double error)
+{
+    const double range = (pVariable->range > 0) ? pVariable->range :
+                                                  FXP_LIMIT;
+
+    pVariable->samples++;
+    if ((fixed >= range - 1) || (fixed <= -range))
+    {
+        pVariable->saturations++;
+    }
+    if ((reference > range - 1) || (reference < -range))
+    {
+        pVariable->overflows++;
+    }
+    if (fabs(reference) > pVariable->referenceMax)
+    {
+        pVariable->referenceMax = fabs(reference);
+    }
+    error = fabs(error);
+    if (error > pVariable->errorMax)
+    {
+        pVariable->errorMax = error;
+    }
+    pVariable->errorSquares += error * error;
+}
+
+void FxpCompare(FXP_VARIABLE_T *pVariable, double fixed, double reference)
+{
+    Add(pVariable, fixed, reference, fixed - reference);
+}
+
+void FxpAngleCompare(FXP_VARIABLE_T *pVariable, double fixed,
+                     double reference)
+{
+    const double range = (pVariable->range > 0) ? pVariable->range :
+                                                  FXP_LIMIT;
+    double error = fmod(fixed - reference, 2 * range);
+
+    if (error >= range)
+    {
+        error -= 2 * range;
+    }
+    else if (error < -range)
+    {
+        error += 2 * range;
+    }
+    /* An angle wraps by design : no saturation or overflow */
+    Add(pVariable, 0, 0, error);
+}
+
+int FxpReport(FILE *pFile, const char *title, const FXP_VARIABLE_T *pVariable,
+              int count, const FXP_DSP_T *pDsp)
+{
+    int failures = 0;
+    int i;
+
+    fprintf(pFile, "%s\n", title);
+    fprintf(pFile, "  %-34s %8s %6s %6s %8s %9s %9s %9s\n", "variable",
+            "samples", "sat", "ovf", "headroom", "errMax", "errRms",
+            "tolerance");
+    for (i = 0; i < count; i++, pVariable++)
+    {
+        const double range = (pVariable->range > 0) ? pVariable->range :
+                                                      FXP_LIMIT;
+        const int fail = (pVariable->samples == 0) ||
+                         (pVariable->errorMax > pVariable->tolerance);
+        char headroom[16];
+
+        if (pVariable->referenceMax > 0)
+        {
+            snprintf(headroom, sizeof(headroom), "%.2f",
+                     log2(range / pVariable->referenceMax));
+        }
+        else
+        {
+            snprintf(headroom, sizeof(headroom), "-");
+        }
+        fprintf(pFile, "  %-34s %8u %6u %6u %8s %9.2f %9.3f %9.1f%s\n",
+                pVariable->name, pVariable->samples, pVariable->saturations,
+                pVariable->overflows, headroom, pVariable->errorMax,
+                (pVariable->samples > 0) ?
+                    sqrt(pVariable->errorSquares / pVariable->samples) : 0.0,
+                pVariable->tolerance, fail ? "  FAIL" : "");
+        failures += fail;
+    }
+    fprintf(pFile, "  DSP builtins : %u accumulator saturations, %u store "
+            "saturations, %u division overflows\n", pDsp->accSaturation,
+            pDsp->storeSaturation, pDsp->divOverflow);
+    if ((pDsp->accSaturation != 0) || (pDsp->storeSaturation != 0) ||
+        (pDsp->divOverflow != 0))
+    {
+        failures++;
+    }
+    return failures;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file fxp.h
+ *
+ * @brief Fixed point check : firmware variables against a double precision
+ *        reference of the same computation.
+ *
+ * After each execution of a control ISR the reference recomputes the
+ * variables of the ISR in double precision from the state the ISR started
+ * with (the firmware state after the previous execution) and the inputs it
+ * used. The error of a variable is the rounding, truncation and overflow of
+ * the fixed point code of one execution, in LSB of the variable.
+ *
+ * Reported per variable :
+ * - saturations : firmware value at the limits of its 16 bit range
+ * - overflows   : reference value beyond the 16 bit range (the fixed point
+ *                 code has saturated or wrapped)
+ * - headroom    : bits between the largest reference value and the limit
+ * - error       : largest and rms error (LSB)
+ */
+#ifndef FXP_H
+#define FXP_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "host_image.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FXP_LIMIT           32768.0     /* Range of a 16 bit variable */
+
+typedef struct
+{
+    const char *name;
+    double tolerance;           /* Largest error of the check (LSB) */
+    double range;               /* Limit of the variable, FXP_LIMIT */
+    uint32_t samples;
+    uint32_t saturations;
+    uint32_t overflows;
+    double referenceMax;        /* Largest magnitude of the reference */
+    double errorMax;
+    double errorSquares;
+} FXP_VARIABLE_T;
+
+/* DSP builtin counters of an image (see host_dsp.h) */
+typedef struct
+{
+    uint32_t accSaturation, storeSaturation, divOverflow;
+} FXP_DSP_T;
+
+/* Adds one sample of a variable */
+void FxpCompare(FXP_VARIABLE_T *pVariable, double fixed, double reference);
+/* Adds one sample of an angle (error modulo the range) */
+void FxpAngleCompare(FXP_VARIABLE_T *pVariable, double fixed,
+                     double reference);
+/* Prints the variables of a check, returns the number of variables with
+   an error above their tolerance, plus 1 if the DSP builtins saturated */
+int FxpReport(FILE *pFile, const char *title, const FXP_VARIABLE_T *pVariable,
+              int count, const FXP_DSP_T *pDsp);
+
+/* Checks of the Secondary core (MC1 control ISR) and Main core (PFC ISR),
+   called after each ISR of the image */
+void FxpSecondaryInit(const HOST_IMAGE_T *pImage);
+void FxpSecondaryIsr(const char *vector);
+int FxpSecondaryReport(FILE *pFile);
+void FxpMainInit(const HOST_IMAGE_T *pImage);
+void FxpMainIsr(const char *vector);
+int FxpMainReport(FILE *pFile);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FXP_H */
@@ -0,0 +1,129 @@
+/**
+ * @file fxp_main.c
+ *
+ * @brief Fixed point check of the PFC ISR : current reference, current and
+ *        voltage controllers (pfc.c, pfc_pi.s), see fxp.h.
+ *
+ * Compiled with the firmware headers of the Main core image.
+ */
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "pfc.h"
+#include "pwm.h"
+
+#include "fxp.h"
+
+#define FXP_PFC_VECTOR      "_ADCAN12Interrupt"
+
+enum
+{
+    CURRENT_REFERENCE, PI_CURRENT_INTEGRAL, PI_CURRENT_OUT, DUTY,
+    PI_VOLTAGE_INTEGRAL, PI_VOLTAGE_OUT,
+    VARIABLES
+};
+
+static FXP_VARIABLE_T variable[VARIABLES] =
+{
+    /* Step 1 (>> 18) truncates the product to a few LSB at light load */
+    [CURRENT_REFERENCE] = {"currentReference", 12},
+    [PI_CURRENT_INTEGRAL] = {"piCurrent.integralOut", 1},
+    [PI_CURRENT_OUT] = {"piCurrent.output", 1},
+    [DUTY] = {"duty", 1, PFC_LOOPTIME_TCY + 1},
+    [PI_VOLTAGE_INTEGRAL] = {"piVoltage.integralOut", 1},
+    [PI_VOLTAGE_OUT] = {"piVoltage.output", 1},
+};
+
+static PFC_T *pPFC;
+static const HOST_DSP_COUNT_T *pDspCount;
+static HOST_DSP_COUNT_T dspStart;
+
+/* PFC state after the previous execution of the ISR */
+static PFC_T last;
+static int lastValid;
+
+void FxpMainInit(const HOST_IMAGE_T *pImage)
+{
+    pPFC = pImage->symbol("pfcParam");
+    pDspCount = pImage->symbol("hostDspCount");
+    dspStart = *pDspCount;
+    lastValid = 0;
+}
+
+static double Limit(double x, double min, double max)
+{
+    return (x > max) ? max : ((x < min) ? min : x);
+}
+
+/* PFC_PIController() : integral and proportional terms of error */
+static void Controller(const PFC_PI_T *pLast, const PFC_PI_T *pPI,
+                         FXP_VARIABLE_T *pIntegral, FXP_VARIABLE_T *pOut)
+{
+    const double error = pPI->error;
+    const double integral = pLast->integralOut +
+                    pPI->ki * error * ldexp(1.0, pPI->kiScale) / FXP_LIMIT;
+    const double out = Limit(integral + pPI->kp * error *
+                    ldexp(1.0, pPI->kpScale) / FXP_LIMIT,
+                    pPI->minOutput, pPI->maxOutput);
+
+    FxpCompare(pIntegral, pPI->integralOut, integral);
+    FxpCompare(pOut, pPI->output, out);
+}
+
+void FxpMainIsr(const char *vector)
+{
+    const PFC_T *pData = pPFC;
+
+    if (strcmp(vector, FXP_PFC_VECTOR) != 0)
+    {
+        return;
+    }
+    if (lastValid && (last.state == PFC_CTRL_RUN) &&
+        (pData->state == PFC_CTRL_RUN) && (pData->duty != 0))
+    {
+        double reference, duty;
+
+        /* Voltage loop at VOLTAGE_LOOP_EXE_RATE */
+        if ((pData->voltLoopExeRate == 0) && (last.voltLoopExeRate != 0))
+        {
+            Controller(&last.piVoltage, &pData->piVoltage,
+                       &variable[PI_VOLTAGE_INTEGRAL],
+                       &variable[PI_VOLTAGE_OUT]);
+        }
+
+        /* (Voltage PI output) * (rectified Vac) * KMUL / VacRMS^2 */
+        if (pData->vacRMS.sqrOutput > 0)
+        {
+            reference = (double)pData->piVoltage.output *
+                pData->rectifiedVac * KMUL /
+                ((double)pData->vacRMS.sqrOutput * FXP_LIMIT);
+            FxpCompare(&variable[CURRENT_REFERENCE],
+                pData->currentReference, Limit(reference, 0, Q15(0.999)));
+        }
+
+        /* Duty limit resets the integral : compared within the limits */
+        duty = pData->piCurrent.output * (double)PFC_LOOPTIME_TCY / FXP_LIMIT;
+        if ((duty < PFC_MAX_DUTY) && (duty > PFC_MIN_DUTY))
+        {
+            Controller(&last.piCurrent, &pData->piCurrent,
+                       &variable[PI_CURRENT_INTEGRAL],
+                       &variable[PI_CURRENT_OUT]);
+            FxpCompare(&variable[DUTY], pData->duty, duty);
+        }
+    }
+    last = *pData;
+    lastValid = 1;
+}
+
+int FxpMainReport(FILE *pFile)
+{
+    FXP_DSP_T dsp =
+    {
+        pDspCount->accSaturation - dspStart.accSaturation,
+        pDspCount->storeSaturation - dspStart.storeSaturation,
+        pDspCount->divOverflow - dspStart.divOverflow
+    };
+
+    return FxpReport(pFile, "Main core, PFC ISR", variable, VARIABLES, &dsp);
+}
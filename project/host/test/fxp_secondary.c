@@ -0,0 +1,213 @@
+/**
+ * @file fxp_secondary.c
+ *
+ * @brief Fixed point check of the MC1 control ISR : PLL estimator
+ *        (estim_pll.c) and current controllers (foc.c, sat_pi.c), see fxp.h.
+ *
+ * Compiled with the firmware headers of the Secondary core image.
+ */
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mc1_init.h"
+
+#include "fxp.h"
+
+#define FXP_MC1_VECTOR      "_ADCAN15Interrupt"
+
+enum
+{
+    VIND_ALPHA, VIND_BETA, BEMF_ALPHA, BEMF_BETA, BEMF_D, BEMF_Q,
+    ESDF, ESQF, OMEGA, THETA, OMEGA_FILT,
+    PI_D_OUT, PI_D_INTEGRATOR, PI_Q_OUT, PI_Q_INTEGRATOR,
+    VARIABLES
+};
+
+static FXP_VARIABLE_T variable[VARIABLES] =
+{
+    [VIND_ALPHA] = {"estimPLL.qVIndalpha", 1},
+    [VIND_BETA] = {"estimPLL.qVIndbeta", 1},
+    [BEMF_ALPHA] = {"estimPLL.BEMFAlphaBeta.alpha", 2},
+    [BEMF_BETA] = {"estimPLL.BEMFAlphaBeta.beta", 2},
+    [BEMF_D] = {"estimPLL.BEMFdq.d", 4},
+    [BEMF_Q] = {"estimPLL.BEMFdq.q", 4},
+    [ESDF] = {"estimPLL.qEsdf", 2},
+    [ESQF] = {"estimPLL.qEsqf", 2},
+    [OMEGA] = {"estimPLL.qOmega", 4},
+    [THETA] = {"estimPLL.qTheta", 2},
+    [OMEGA_FILT] = {"estimPLL.qOmegaFilt", 2},
+    [PI_D_OUT] = {"piDCurrent output (vdq.d)", 1},
+    [PI_D_INTEGRATOR] = {"piDCurrent.integrator (Q15)", 1},
+    [PI_Q_OUT] = {"piQCurrent output (vdq.q)", 1},
+    [PI_Q_INTEGRATOR] = {"piQCurrent.integrator (Q15)", 1},
+};
+
+static MC1APP_ISR_DATA_T *pIsr;
+static const HOST_DSP_COUNT_T *pDspCount;
+static HOST_DSP_COUNT_T dspStart;
+
+/* FOC state after the previous execution of the ISR */
+static MCAPP_FOC_T last;
+static int lastValid;
+
+void FxpSecondaryInit(const HOST_IMAGE_T *pImage)
+{
+    pIsr = pImage->symbol("mc1Isr");
+    pDspCount = pImage->symbol("hostDspCount");
+    dspStart = *pDspCount;
+    lastValid = 0;
+}
+
+/* x * y * 2^-scale : product of a signal and a parameter with its Q
+   value, MCAPP_EstimatorPairProduct() */
+static double Scaled(double x, double y, int scale)
+{
+    return x * y * ldexp(1.0, -scale);
+}
+
+static void Estimator(const MCAPP_ESTIMATOR_PLL_T *pLast,
+                      const MCAPP_ESTIMATOR_PLL_T *pEstim)
+{
+    const MCAPP_MOTOR_T *pMotor = pEstim->pMotor;
+    const double iAlpha = pEstim->pIAlphaBeta->alpha;
+    const double iBeta = pEstim->pIAlphaBeta->beta;
+    const int lowSpeed = (abs(pLast->qOmegaFilt) <
+                                        pLast->qThresholdSpeedDerivative);
+    const double theta = pLast->qTheta * M_PI / FXP_LIMIT;
+    double vIndAlpha, vIndBeta, eAlpha, eBeta, ed, eq, esdf, esqf;
+    double omega, thetaState, omegaFilt;
+    int scale;
+
+    /* Current differences are integers of the same inputs : the firmware
+       values are exact */
+    scale = lowSpeed ? pMotor->qLsDtScale + 2 : pMotor->qLsDtScale;
+    vIndAlpha = Scaled(pEstim->qDIalpha, pMotor->qLsDt, scale);
+    vIndBeta = Scaled(pEstim->qDIbeta, pMotor->qLsDt, scale);
+    FxpCompare(&variable[VIND_ALPHA], pEstim->qVIndalpha, vIndAlpha);
+    FxpCompare(&variable[VIND_BETA], pEstim->qVIndbeta, vIndBeta);
+
+    eAlpha = pEstim->qValpha - Scaled(iAlpha, pMotor->qRs, pMotor->qRsScale)
+                - vIndAlpha;
+    eBeta = pEstim->qVbeta - Scaled(iBeta, pMotor->qRs, pMotor->qRsScale)
+                - vIndBeta;
+    FxpCompare(&variable[BEMF_ALPHA], pEstim->BEMFAlphaBeta.alpha, eAlpha);
+    FxpCompare(&variable[BEMF_BETA], pEstim->BEMFAlphaBeta.beta, eBeta);
+
+    ed = eAlpha * cos(theta) + eBeta * sin(theta);
+    eq = -eAlpha * sin(theta) + eBeta * cos(theta);
+    FxpCompare(&variable[BEMF_D], pEstim->BEMFdq.d, ed);
+    FxpCompare(&variable[BEMF_Q], pEstim->BEMFdq.q, eq);
+
+    esdf = (pLast->qEsdStateVar + (ed - pLast->qEsdf) *
+                                        pLast->qKfilterEsdq) / FXP_LIMIT;
+    esqf = (pLast->qEsqStateVar + (eq - pLast->qEsqf) *
+                                        pLast->qKfilterEsdq) / FXP_LIMIT;
+    FxpCompare(&variable[ESDF], pEstim->qEsdf, esdf);
+    FxpCompare(&variable[ESQF], pEstim->qEsqf, esqf);
+
+    /* Sign of the d axis term as decided by the firmware */
+    if (abs(pLast->qOmegaFilt) > pLast->qThresholdSpeedBEMF)
+    {
+        omega = (pEstim->qEsqf > 0) ? esqf - esdf : esqf + esdf;
+    }
+    else
+    {
+        omega = (pLast->qOmegaFilt > 0) ? esqf - esdf : esqf + esdf;
+    }
+    omega = Scaled(omega, pLast->qInvKfiConst, pLast->qInvKfiConstScale);
+    FxpCompare(&variable[OMEGA], pEstim->qOmega, omega);
+
+    thetaState = pLast->qThetaStateVar + omega * pLast->qDeltaT;
+    FxpAngleCompare(&variable[THETA], pEstim->qTheta, thetaState / FXP_LIMIT);
+
+    omegaFilt = (pLast->qOmegaStateVar + (omega - pLast->qOmegaFilt) *
+                                        pLast->qOmegaFiltConst) / FXP_LIMIT;
+    FxpCompare(&variable[OMEGA_FILT], pEstim->qOmegaFilt, omegaFilt);
+}
+
+/* MCAPP_ControllerPIUpdate() : the integrator is a 1.31 accumulator value,
+   2^16 of a Q15 output */
+static void CurrentController(const MCAPP_PISTATE_T *pLast,
+                              const MCAPP_PISTATE_T *pPI, int16_t reference,
+                              int16_t measured, int16_t output,
+                              FXP_VARIABLE_T *pOut,
+                              FXP_VARIABLE_T *pIntegrator)
+{
+    double error = (double)reference - measured;
+    double out, outSat, integrator;
+
+    if (error > FXP_LIMIT - 1)
+    {
+        error = FXP_LIMIT - 1;
+    }
+    else if (error < -FXP_LIMIT)
+    {
+        error = -FXP_LIMIT;
+    }
+    out = Scaled(pLast->kp * error, 1, 15 - pLast->nkp) +
+                                        pLast->integrator / 65536.0;
+    outSat = out;
+    if (outSat > pPI->outMax)
+    {
+        outSat = pPI->outMax;
+    }
+    else if (outSat < pPI->outMin)
+    {
+        outSat = pPI->outMin;
+    }
+    FxpCompare(pOut, output, outSat);
+
+    integrator = pLast->integrator / 65536.0 +
+                Scaled(pLast->ki * error, 1, 15 - pLast->nki) -
+                Scaled(pLast->kc * (out - outSat), 1, 15);
+    FxpCompare(pIntegrator, pPI->integrator / 65536.0, integrator);
+}
+
+static int Running(int16_t focState)
+{
+    return (focState == FOC_RTR_LOCK) || (focState == FOC_OPEN_LOOP) ||
+           (focState == FOC_CLOSE_LOOP);
+}
+
+void FxpSecondaryIsr(const char *vector)
+{
+    const MCAPP_FOC_T *pFOC = &pIsr->controlScheme;
+
+    if (strcmp(vector, FXP_MC1_VECTOR) != 0)
+    {
+        return;
+    }
+    if (lastValid && (last.focState == pFOC->focState) &&
+        Running(pFOC->focState))
+    {
+        if (pFOC->focState != FOC_RTR_LOCK)
+        {
+            Estimator(&last.estimPLL, &pFOC->estimPLL);
+        }
+        CurrentController(&last.piDCurrent, &pFOC->piDCurrent,
+                pFOC->ctrlParam.qIdRef, pFOC->idq.d,
+                pFOC->vdq.d - pFOC->decoupling.vdFF,
+                &variable[PI_D_OUT], &variable[PI_D_INTEGRATOR]);
+        CurrentController(&last.piQCurrent, &pFOC->piQCurrent,
+                pFOC->ctrlParam.qIqRef, pFOC->idq.q,
+                pFOC->vdq.q - pFOC->decoupling.vqFF,
+                &variable[PI_Q_OUT], &variable[PI_Q_INTEGRATOR]);
+    }
+    last = *pFOC;
+    lastValid = 1;
+}
+
+int FxpSecondaryReport(FILE *pFile)
+{
+    FXP_DSP_T dsp =
+    {
+        pDspCount->accSaturation - dspStart.accSaturation,
+        pDspCount->storeSaturation - dspStart.storeSaturation,
+        pDspCount->divOverflow - dspStart.divOverflow
+    };
+
+    return FxpReport(pFile, "Secondary core, MC1 control ISR", variable,
+                     VARIABLES, &dsp);
+}
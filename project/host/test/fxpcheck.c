@@ -0,0 +1,70 @@
+/**
+ * @file fxpcheck.c
+ *
+ * @brief Fixed point check of both cores (see fxp.h) over a start of the
+ *        board : PFC soft start, MC1 start up to closed loop, a load step
+ *        and a speed step.
+ *
+ * Usage : fxpcheck [secondary image] [main image]
+ * Exit status 1 if an error exceeds the tolerance of its variable.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fxp.h"
+#include "sim.h"
+
+static void Isr(SIM_T *pSim, int core, int vector, void *context)
+{
+    HOST_ISR_STATS_T stats;
+
+    (void)context;
+    pSim->core[core].pImage->isrStats(vector, &stats);
+    if (core == SIM_SECONDARY)
+    {
+        FxpSecondaryIsr(stats.name);
+    }
+    else
+    {
+        FxpMainIsr(stats.name);
+    }
+}
+
+static const HOST_IMAGE_T *Image(const char *name)
+{
+    const HOST_IMAGE_T *pImage = SimImage(name);
+
+    if (pImage == NULL)
+    {
+        fprintf(stderr, "fxpcheck: no image %s\n", name);
+        exit(EXIT_FAILURE);
+    }
+    return pImage;
+}
+
+int main(int argc, char **argv)
+{
+    static SIM_T sim;
+    const HOST_IMAGE_T *pSecondary = Image((argc > 1) ? argv[1] : "secondary");
+    const HOST_IMAGE_T *pMain = Image((argc > 2) ? argv[2] : "main");
+    int failures;
+
+    SimInit(&sim, 0.1, NULL, Isr, NULL);
+    SimStart(&sim, pMain);
+    SimStart(&sim, pSecondary);
+    FxpMainInit(pMain);
+    FxpSecondaryInit(pSecondary);
+
+    sim.pot = 0.6;
+    SimRun(&sim, 0.5);
+    SimButton(&sim, 1, 0.1);
+    SimRun(&sim, 4.0);
+    sim.plant.motor[0].loadTorque = 0.3;
+    SimRun(&sim, 5.0);
+    sim.pot = 0.9;
+    SimRun(&sim, 6.0);
+
+    failures = FxpSecondaryReport(stdout);
+    failures += FxpMainReport(stdout);
+    return (failures > 0) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,192 @@
+/**
+ * @file isrmap.c
+ *
+ * @brief Data map of the control ISR of both motors : where each field of
+ *        the ISR state (MCx APP_ISR_DATA_T) and of the motor parameters
+ *        lands, and where the data the ISR reaches through pointers of the
+ *        control scheme (identification, load observer, KPI) is kept.
+ *
+ * Usage : isrmap [secondary image]
+ *
+ * Offsets and sizes are those of the host build (64 bit pointers), the
+ * order of the fields is that of the device; addresses on the device are
+ * in the map file of the XC16 build (mc1Isr, mc2Isr, mc1Motor, mc2Motor,
+ * mc1, mc2).
+ *
+ * Exit status 1 if data kept out of the ISR state lies within it.
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "mc1_init.h"
+#include "mc2_init.h"
+
+#include "sim.h"
+
+typedef struct
+{
+    const char *name;
+    size_t offset;
+    size_t size;
+} ISRMAP_FIELD_T;
+
+#define ISRMAP_MEMBER_SIZE(type, member)    sizeof(((type *)0)->member)
+#define ISRMAP_FIELD(type, member) \
+    {#member, offsetof(type, member), ISRMAP_MEMBER_SIZE(type, member)}
+#define ISRMAP_FOC(type, member) \
+    ISRMAP_FIELD(type, controlScheme.member)
+
+/* Fields of the ISR state in the order of the structures, MC1APP_ISR_DATA_T
+   and MC2APP_ISR_DATA_T have the same layout */
+#define ISRMAP_FIELDS(type) \
+{ \
+    ISRMAP_FIELD(type, motorInputs), \
+    ISRMAP_FOC(type, pIa), \
+    ISRMAP_FOC(type, pIb), \
+    ISRMAP_FOC(type, pVdc), \
+    ISRMAP_FOC(type, faultStatus), \
+    ISRMAP_FOC(type, focState), \
+    ISRMAP_FOC(type, vMaxFactor), \
+    ISRMAP_FOC(type, piQCurrent), \
+    ISRMAP_FOC(type, piDCurrent), \
+    ISRMAP_FOC(type, piSpeed), \
+    ISRMAP_FOC(type, sincosTheta), \
+    ISRMAP_FOC(type, vdq), \
+    ISRMAP_FOC(type, idq), \
+    ISRMAP_FOC(type, iabc), \
+    ISRMAP_FOC(type, vabc), \
+    ISRMAP_FOC(type, vabcScaled), \
+    ISRMAP_FOC(type, vabcCompDC), \
+    ISRMAP_FOC(type, ialphabeta), \
+    ISRMAP_FOC(type, ialphabetaFundamental), \
+    ISRMAP_FOC(type, valphabetaPerturbed), \
+    ISRMAP_FOC(type, valphabeta), \
+    ISRMAP_FOC(type, pPWMDuty), \
+    ISRMAP_FOC(type, fluxControl), \
+    ISRMAP_FOC(type, overmod), \
+    ISRMAP_FOC(type, deadTimeComp), \
+    ISRMAP_FOC(type, decoupling), \
+    ISRMAP_FOC(type, singleShunt), \
+    ISRMAP_FOC(type, speedTraj), \
+    ISRMAP_FOC(type, vdcLimit), \
+    ISRMAP_FOC(type, rideThrough), \
+    ISRMAP_FOC(type, estimPLL), \
+    ISRMAP_FOC(type, estimInterface), \
+    ISRMAP_FOC(type, ctrlParam), \
+    ISRMAP_FOC(type, pMotor), \
+    ISRMAP_FOC(type, pMechId), \
+    ISRMAP_FOC(type, pLoadObserver), \
+    ISRMAP_FOC(type, pKpi), \
+    ISRMAP_FOC(type, pwmPeriod), \
+    ISRMAP_FIELD(type, PWMDuty), \
+}
+
+static const ISRMAP_FIELD_T mc1Field[] = ISRMAP_FIELDS(MC1APP_ISR_DATA_T);
+static const ISRMAP_FIELD_T mc2Field[] = ISRMAP_FIELDS(MC2APP_ISR_DATA_T);
+
+#define FIELDS  (sizeof(mc1Field) / sizeof(mc1Field[0]))
+
+/* Data reached from the ISR through pointers, outside of the ISR state */
+typedef struct
+{
+    const char *name;
+    const void *address;
+    size_t size;
+} ISRMAP_REGION_T;
+
+static const void *Symbol(const HOST_IMAGE_T *pImage, const char *name)
+{
+    const void *address = pImage->symbol(name);
+
+    if (address == NULL)
+    {
+        fprintf(stderr, "isrmap: no symbol %s\n", name);
+        exit(EXIT_FAILURE);
+    }
+    return address;
+}
+
+static int Map(const char *motor, const void *pIsr, size_t isrSize,
+               const ISRMAP_FIELD_T *pField, const void *pMotor,
+               const ISRMAP_REGION_T *pRegion, size_t regions)
+{
+    const uintptr_t start = (uintptr_t)pIsr, end = start + isrSize;
+    size_t i;
+    int inside = 0;
+
+    printf("%sIsr : %zu bytes at %p\n", motor, isrSize, pIsr);
+    printf("  %-40s %6s %6s\n", "field", "offset", "size");
+    for (i = 0; i < FIELDS; i++)
+    {
+        printf("  %-40s %6zu %6zu\n", pField[i].name, pField[i].offset,
+               pField[i].size);
+    }
+    printf("%sMotor : %zu bytes at %p\n", motor, sizeof(MCAPP_MOTOR_T),
+           pMotor);
+    printf("%s (out of the ISR state) :\n", motor);
+    for (i = 0; i < regions; i++)
+    {
+        const uintptr_t address = (uintptr_t)pRegion[i].address;
+        const int overlap = (address < end) &&
+                            (address + pRegion[i].size > start);
+
+        printf("  %-40s %6zu bytes at %p%s\n", pRegion[i].name,
+               pRegion[i].size, pRegion[i].address,
+               overlap ? " WITHIN THE ISR STATE" : "");
+        inside += overlap;
+    }
+    printf("\n");
+    return inside;
+}
+
+int main(int argc, char **argv)
+{
+    static SIM_T sim;
+    const char *name = (argc > 1) ? argv[1] : "secondary";
+    const HOST_IMAGE_T *pImage = SimImage(name);
+    const MC1APP_DATA_T *pMC1;
+    const MC2APP_DATA_T *pMC2;
+    int inside;
+
+    if (pImage == NULL)
+    {
+        fprintf(stderr, "isrmap: no image %s\n", name);
+        return EXIT_FAILURE;
+    }
+    /* Started : pointers of the control scheme are set by the firmware */
+    SimInit(&sim, 1.0e-3, NULL, NULL, NULL);
+    SimStart(&sim, pImage);
+    pMC1 = Symbol(pImage, "mc1");
+    pMC2 = Symbol(pImage, "mc2");
+
+    {
+        const ISRMAP_REGION_T mc1Region[] =
+        {
+            {"mechId", pMC1->pControlScheme->pMechId, sizeof(pMC1->mechId)},
+            {"loadObserver", pMC1->pControlScheme->pLoadObserver,
+                                            sizeof(pMC1->loadObserver)},
+            {"kpi", pMC1->pControlScheme->pKpi, sizeof(pMC1->kpi)},
+            {"paramId", &pMC1->paramId, sizeof(pMC1->paramId)},
+        };
+        const ISRMAP_REGION_T mc2Region[] =
+        {
+            {"mechId", pMC2->pControlScheme->pMechId, sizeof(pMC2->mechId)},
+            {"loadObserver", pMC2->pControlScheme->pLoadObserver,
+                                            sizeof(pMC2->loadObserver)},
+            {"kpi", pMC2->pControlScheme->pKpi, sizeof(pMC2->kpi)},
+            {"paramId", &pMC2->paramId, sizeof(pMC2->paramId)},
+        };
+
+        inside = Map("mc1", Symbol(pImage, "mc1Isr"),
+                     sizeof(MC1APP_ISR_DATA_T), mc1Field,
+                     Symbol(pImage, "mc1Motor"), mc1Region,
+                     sizeof(mc1Region) / sizeof(mc1Region[0]));
+        inside += Map("mc2", Symbol(pImage, "mc2Isr"),
+                      sizeof(MC2APP_ISR_DATA_T), mc2Field,
+                      Symbol(pImage, "mc2Motor"), mc2Region,
+                      sizeof(mc2Region) / sizeof(mc2Region[0]));
+    }
+    return (inside > 0) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,329 @@
+/**
+ * @file msistress.c
+ *
+ * @brief MSI protocol test : the Main core writes commands (block A) and
+ *        reads feedback (block B), the Secondary core writes feedback and
+ *        reads commands, each core in its own thread, through the
+ *        unmodified HAL of the cores (hal/msi.c) and the mailbox emulation
+ *        of the host (host_msi.h).
+ *
+ * Usage : msistress [secondary image] [main image]
+ *
+ * Every field of block n carries a pattern of n : a block with fields of
+ * different blocks is torn. A block is written when the previous one has
+ * been read (data ready flag), so the reader sees every block once and in
+ * order. Reported per block : blocks, torn, lost and repeated blocks, and
+ * the time from the commit of the last register to the read on the host
+ * clock. It measures the handshake, not the timing of the device : the
+ * delay of the exchange schedule is reported by hostsim xcore_speed_step.
+ *
+ * The speed scaling and the limits of the outer loops of the Main core
+ * (supervisor_params.h) are checked against the motor parameters of the
+ * Secondary core.
+ *
+ * Exit status 1 if a block is torn, lost or repeated, or if the scaling of
+ * the cores differs.
+ */
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "mc1_init.h"
+#include "mc2_init.h"
+#include "msi_protocol.h"
+
+#include "sim.h"
+
+#define MSISTRESS_BLOCKS        50000
+#define MSISTRESS_STAMPS        4       /* Writer is at most 1 block ahead */
+
+typedef bool (*MSI_COMMAND_WRITE_T)(const MSI_COMMAND_T *);
+typedef bool (*MSI_COMMAND_READ_T)(MSI_COMMAND_T *);
+typedef bool (*MSI_FEEDBACK_WRITE_T)(const MSI_FEEDBACK_T *);
+typedef bool (*MSI_FEEDBACK_READ_T)(MSI_FEEDBACK_T *);
+
+/* Block exchanged in one direction */
+typedef struct
+{
+    const char *name;
+    volatile double stamp[MSISTRESS_STAMPS]; /* Commit time of block n */
+    long written;
+    long read;
+    long torn;
+    long lost;                      /* Lost or repeated */
+    double latencySum;
+    double latencyMax;
+} MSISTRESS_BLOCK_T;
+
+/* One core : writes one block, reads the other */
+typedef struct
+{
+    MSISTRESS_BLOCK_T *pWrite;
+    MSISTRESS_BLOCK_T *pRead;
+    bool (*write)(long n);
+    bool (*read)(long n);
+    void (*commit)(void);           /* MSI commit of the port of the core */
+} MSISTRESS_CORE_T;
+
+static MSISTRESS_BLOCK_T command = {"command (block A)"};
+static MSISTRESS_BLOCK_T feedback = {"feedback (block B)"};
+
+static MSI_COMMAND_WRITE_T commandWrite;
+static MSI_COMMAND_READ_T commandRead;
+static MSI_FEEDBACK_WRITE_T feedbackWrite;
+static MSI_FEEDBACK_READ_T feedbackRead;
+
+static double Now(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1.0e-9;
+}
+
+/* Field k of block n. Field 0 is the sequence. */
+static uint16_t Pattern(long n, int k)
+{
+    return (uint16_t)((k == 0) ? n : (n * 40503L + k * 10007L) ^ (k << 12));
+}
+
+static bool CommandWrite(long n)
+{
+    MSI_COMMAND_T block;
+
+    block.velocityRefMC1 = (int16_t)Pattern(n, 0);
+    block.iqRefMC1 = (int16_t)Pattern(n, 1);
+    block.idRefMC1 = (int16_t)Pattern(n, 2);
+    block.velocityRefMC2 = (int16_t)Pattern(n, 3);
+    block.iqRefMC2 = (int16_t)Pattern(n, 4);
+    block.idRefMC2 = (int16_t)Pattern(n, 5);
+    block.flags = Pattern(n, 6);
+    return commandWrite(&block);
+}
+
+static bool CommandRead(long n)
+{
+    MSI_COMMAND_T block;
+    int k, torn = 0;
+
+    if (!commandRead(&block))
+    {
+        return false;
+    }
+    {
+        const uint16_t value[] =
+        {
+            (uint16_t)block.velocityRefMC1, (uint16_t)block.iqRefMC1,
+            (uint16_t)block.idRefMC1, (uint16_t)block.velocityRefMC2,
+            (uint16_t)block.iqRefMC2, (uint16_t)block.idRefMC2, block.flags,
+        };
+        const long m = n + (int16_t)(value[0] - (uint16_t)n);
+
+        if (m != n)
+        {
+            command.lost++;
+        }
+        for (k = 1; k < 7; k++)
+        {
+            torn |= (value[k] != Pattern(m, k));
+        }
+    }
+    command.torn += torn;
+    return true;
+}
+
+static bool FeedbackWrite(long n)
+{
+    MSI_FEEDBACK_T block;
+
+    block.potentiometer = (int16_t)Pattern(n, 0);
+    block.velocityMC1 = (int16_t)Pattern(n, 1);
+    block.velocityMC2 = (int16_t)Pattern(n, 2);
+    block.iqRefMC1 = (int16_t)Pattern(n, 3);
+    block.iqRefMC2 = (int16_t)Pattern(n, 4);
+    block.voltageErrorMC1 = (int16_t)Pattern(n, 5);
+    block.voltageErrorMC2 = (int16_t)Pattern(n, 6);
+    block.voltageDemand = (int16_t)Pattern(n, 7);
+    block.status = Pattern(n, 8);
+    return feedbackWrite(&block);
+}
+
+static bool FeedbackRead(long n)
+{
+    MSI_FEEDBACK_T block;
+    int k, torn = 0;
+
+    if (!feedbackRead(&block))
+    {
+        return false;
+    }
+    {
+        const uint16_t value[] =
+        {
+            (uint16_t)block.potentiometer, (uint16_t)block.velocityMC1,
+            (uint16_t)block.velocityMC2, (uint16_t)block.iqRefMC1,
+            (uint16_t)block.iqRefMC2, (uint16_t)block.voltageErrorMC1,
+            (uint16_t)block.voltageErrorMC2, (uint16_t)block.voltageDemand,
+            block.status,
+        };
+        const long m = n + (int16_t)(value[0] - (uint16_t)n);
+
+        if (m != n)
+        {
+            feedback.lost++;
+        }
+        for (k = 1; k < 9; k++)
+        {
+            torn |= (value[k] != Pattern(m, k));
+        }
+    }
+    feedback.torn += torn;
+    return true;
+}
+
+static void *Core(void *context)
+{
+    MSISTRESS_CORE_T *pCore = context;
+    MSISTRESS_BLOCK_T *pWrite = pCore->pWrite, *pRead = pCore->pRead;
+
+    while ((pWrite->written < MSISTRESS_BLOCKS) ||
+           (pRead->read < MSISTRESS_BLOCKS))
+    {
+        const long progress = pWrite->written + pRead->read;
+
+        if (pWrite->written < MSISTRESS_BLOCKS)
+        {
+            /* Stamped before the commit, which releases the block */
+            pWrite->stamp[pWrite->written % MSISTRESS_STAMPS] = Now();
+            if (pCore->write(pWrite->written))
+            {
+                pCore->commit();
+                pWrite->written++;
+            }
+        }
+        if ((pRead->read < MSISTRESS_BLOCKS) &&
+            pCore->read(pRead->read))
+        {
+            const double latency = Now() -
+                            pRead->stamp[pRead->read % MSISTRESS_STAMPS];
+
+            pRead->latencySum += latency;
+            if (latency > pRead->latencyMax)
+            {
+                pRead->latencyMax = latency;
+            }
+            pRead->read++;
+        }
+        /* Waiting for the other core : on a single CPU host it runs only
+           when this thread yields */
+        if (pWrite->written + pRead->read == progress)
+        {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void *Symbol(const HOST_IMAGE_T *pImage, const char *name)
+{
+    void *address = pImage->symbol(name);
+
+    if (address == NULL)
+    {
+        fprintf(stderr, "msistress: no symbol %s in the %s image\n", name,
+                pImage->core);
+        exit(EXIT_FAILURE);
+    }
+    return address;
+}
+
+static int Report(const MSISTRESS_BLOCK_T *pBlock)
+{
+    printf("%-20s : %ld blocks, %ld torn, %ld lost or repeated, latency "
+           "mean %.2f us, max %.1f us\n", pBlock->name, pBlock->read,
+           pBlock->torn, pBlock->lost,
+           pBlock->latencySum / pBlock->read * 1.0e6,
+           pBlock->latencyMax * 1.0e6);
+    return (pBlock->torn == 0) && (pBlock->lost == 0);
+}
+
+/* Scaling of one motor : Main core probe against the Secondary core value */
+static int Scaling(const SIM_T *pSim, const char *probe, int secondary)
+{
+    const int main = (int)SimRead(pSim, SIM_MAIN, probe);
+
+    printf("%-36s : Main %6d, Secondary %6d%s\n", probe, main, secondary,
+           (main != secondary) ? " DIFFERS" : "");
+    return main == secondary;
+}
+
+int main(int argc, char **argv)
+{
+    static SIM_T sim;
+    const HOST_IMAGE_T *pSecondary = SimImage((argc > 1) ? argv[1] : "xcore");
+    const HOST_IMAGE_T *pMain = SimImage((argc > 2) ? argv[2] : "xcore_main");
+    const MC1APP_DATA_T *pMC1;
+    const MC2APP_DATA_T *pMC2;
+    MSISTRESS_CORE_T mainCore, secondaryCore;
+    pthread_t thread[2];
+    int pass = 1;
+
+    if ((pSecondary == NULL) || (pMain == NULL))
+    {
+        fprintf(stderr, "msistress: no image\n");
+        return EXIT_FAILURE;
+    }
+    /* Started to their main loop : the threads replace the interrupts */
+    SimInit(&sim, 1.0e-3, NULL, NULL, NULL);
+    SimStart(&sim, pSecondary);
+    SimStart(&sim, pMain);
+
+    pMC1 = Symbol(pSecondary, "mc1");
+    pMC2 = Symbol(pSecondary, "mc2");
+    pass &= Scaling(&sim, "supervisor.mc1.qMinSpeed", pMC1->pMotor->qMinSpeed);
+    pass &= Scaling(&sim, "supervisor.mc1.qMaxSpeed", pMC1->pMotor->qMaxSpeed);
+    pass &= Scaling(&sim, "supervisor.mc1.qNominalSpeed",
+                    pMC1->pMotor->qNominalSpeed);
+    pass &= Scaling(&sim, "supervisor.mc1.piSpeed.outMax",
+                    pMC1->loadObserver.iqLimit);
+    pass &= Scaling(&sim, "supervisor.mc1.piFluxWeakening.outMin",
+            pMC1->pControlScheme->fluxControl.feedBackFW.IdRefMin);
+    pass &= Scaling(&sim, "supervisor.mc2.qMinSpeed", pMC2->pMotor->qMinSpeed);
+    pass &= Scaling(&sim, "supervisor.mc2.qMaxSpeed", pMC2->pMotor->qMaxSpeed);
+    pass &= Scaling(&sim, "supervisor.mc2.qNominalSpeed",
+                    pMC2->pMotor->qNominalSpeed);
+    pass &= Scaling(&sim, "supervisor.mc2.piSpeed.outMax",
+                    pMC2->loadObserver.iqLimit);
+    pass &= Scaling(&sim, "supervisor.mc2.piFluxWeakening.outMin",
+            pMC2->pControlScheme->fluxControl.feedBackFW.IdRefMin);
+
+    commandWrite = (MSI_COMMAND_WRITE_T)Symbol(pMain, "HAL_MSICommandWrite");
+    feedbackRead = (MSI_FEEDBACK_READ_T)Symbol(pMain, "HAL_MSIFeedbackRead");
+    commandRead = (MSI_COMMAND_READ_T)Symbol(pSecondary, "HAL_MSICommandRead");
+    feedbackWrite = (MSI_FEEDBACK_WRITE_T)Symbol(pSecondary,
+                                                 "HAL_MSIFeedbackWrite");
+
+    /* Blocks pending from the start of the images are read first */
+    while (feedbackRead(&(MSI_FEEDBACK_T){0}) ||
+           commandRead(&(MSI_COMMAND_T){0}))
+    {
+    }
+
+    mainCore = (MSISTRESS_CORE_T){&command, &feedback, CommandWrite,
+                    FeedbackRead, (void (*)(void))Symbol(pMain, "MsiCommit")};
+    secondaryCore = (MSISTRESS_CORE_T){&feedback, &command, FeedbackWrite,
+                    CommandRead,
+                    (void (*)(void))Symbol(pSecondary, "MsiCommit")};
+    pthread_create(&thread[0], NULL, Core, &mainCore);
+    pthread_create(&thread[1], NULL, Core, &secondaryCore);
+    pthread_join(thread[0], NULL);
+    pthread_join(thread[1], NULL);
+
+    pass &= Report(&command);
+    pass &= Report(&feedback);
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
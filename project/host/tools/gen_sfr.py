@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+"""Generate the special function register stubs of a core for the host build.
+
+The firmware sources of the core are compiled (syntax only) against the host
+stubs; every identifier reported as undeclared is a register of the device
+header and is added to host_sfr.h / host_sfr.c, until the sources compile.
+'<reg>bits.<field>' accesses found in the sources give the bit structures.
+
+Registers are plain 16 bit variables and bit structures hold one 16 bit
+member per field, so firmware writes are kept but a register and its bits
+do not alias. Registers read by the host peripheral models get their real
+bit layout (LAYOUTS) : register and bits are then a union.
+Registers and bit structures the firmware polls or which have side effects
+on access (HOOKED_REGS, HOOKED_BITS) are accessed through a function that
+calls HostSfrAccess(<id>, <storage>) of the host port first : the port
+updates status bits from the simulated time (ADC ready, PWM half cycle,
+timer count) and emulates the MSI mailbox data ready flags.
+
+Sources are compiled as they are and with the given compile time options
+(see variant.py), which should enable every option, so that the registers
+of both the default build and of the options are found.
+
+Usage: gen_sfr.py <out dir> <project dir> <core> [option ...]
+Run from project/host, e.g.
+  tools/gen_sfr.py stubs/secondary .. secondary ENABLE_SECOND_MOTOR ...
+"""
+
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+STUBS = os.path.join(HERE, '..', 'stubs')
+
+# Bit layout (field, position, width) of registers read by the host models
+LAYOUTS = {
+    r'PG\d+IOCONL': [('DBDAT', 0, 2), ('FFDAT', 2, 2), ('CLDAT', 4, 2),
+                     ('FLTDAT', 6, 2), ('OSYNC', 8, 2), ('OVRDAT', 10, 2),
+                     ('OVRENL', 12, 1), ('OVRENH', 13, 1), ('SWAP', 14, 1),
+                     ('CLMOD', 15, 1)],
+}
+# Bit structures and registers accessed through the port hook
+HOOKED_BITS = r'PG\d+STAT|ADSTAT[LH]|ADFL\dCON|M?SI1MBXS'
+HOOKED_REGS = r'PG\d+CAP|TMR1|M?SI1MBX(6|15)D'
+
+HEADER = '''/**
+ * @file host_sfr.h
+ *
+ * @brief Special function registers of the %s core for the host build.
+ *        Generated by tools/gen_sfr.py from the firmware sources, do not
+ *        edit.
+ */
+#ifndef HOST_SFR_H
+#define HOST_SFR_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+'''
+
+FOOTER = '''
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_SFR_H */
+'''
+
+
+def layout_of(name):
+    for pattern, layout in LAYOUTS.items():
+        if re.fullmatch(pattern, name):
+            return layout
+    return None
+
+
+def write(out_dir, core, registers, fields):
+    h = [HEADER % core]
+    c = ['/* Generated by tools/gen_sfr.py, do not edit */\n',
+         '#include "host_sfr.h"\n\n']
+    hooked = sorted(r for r in registers
+                    if re.fullmatch(HOOKED_REGS, r) or
+                    (r in fields and re.fullmatch(HOOKED_BITS, r)))
+    h.append('typedef enum\n{\n')
+    for reg in hooked:
+        h.append('    HOST_SFR_ID_%s,\n' % reg)
+    h.append('    HOST_SFR_ID_COUNT\n} HOST_SFR_ID_T;\n\n')
+    h.append('/* Implemented by the host port, called before each access */\n'
+             'void HostSfrAccess(HOST_SFR_ID_T id, volatile void *storage);'
+             '\n\n')
+    for reg in sorted(registers):
+        layout = layout_of(reg)
+        if layout is not None:
+            h.append('typedef union\n{\n    uint16_t reg;\n    struct\n    {\n')
+            for field, _, width in sorted(layout, key=lambda f: f[1]):
+                h.append('        uint16_t %s:%d;\n' % (field, width))
+            h.append('    } bits;\n} HOST_%s_T;\n' % reg)
+            h.append('extern volatile HOST_%s_T host_%s;\n' % (reg, reg))
+            h.append('#define %s host_%s.reg\n' % (reg, reg))
+            h.append('#define %sbits host_%s.bits\n' % (reg, reg))
+            c.append('volatile HOST_%s_T host_%s;\n' % (reg, reg))
+            continue
+        if re.fullmatch(HOOKED_REGS, reg):
+            h.append('extern volatile uint16_t host_%s;\n' % reg)
+            h.append('volatile uint16_t *host_sfr_%s(void);\n' % reg)
+            h.append('#define %s (*host_sfr_%s())\n' % (reg, reg))
+            c.append('volatile uint16_t host_%s;\n' % reg)
+            c.append('volatile uint16_t *host_sfr_%s(void)\n{\n'
+                     '    HostSfrAccess(HOST_SFR_ID_%s, &host_%s);\n'
+                     '    return &host_%s;\n}\n' % (reg, reg, reg, reg))
+        else:
+            h.append('extern volatile uint16_t %s;\n' % reg)
+            c.append('volatile uint16_t %s;\n' % reg)
+        if reg in fields:
+            h.append('typedef struct\n{\n')
+            for field in sorted(fields[reg]):
+                h.append('    uint16_t %s;\n' % field)
+            h.append('} HOST_%sBITS_T;\n' % reg)
+            if re.fullmatch(HOOKED_BITS, reg):
+                h.append('extern volatile HOST_%sBITS_T host_%sbits;\n'
+                         % (reg, reg))
+                h.append('volatile HOST_%sBITS_T *host_sfr_%sbits(void);\n'
+                         % (reg, reg))
+                h.append('#define %sbits (*host_sfr_%sbits())\n' % (reg, reg))
+                c.append('volatile HOST_%sBITS_T host_%sbits;\n' % (reg, reg))
+                c.append('volatile HOST_%sBITS_T *host_sfr_%sbits(void)\n{\n'
+                         '    HostSfrAccess(HOST_SFR_ID_%s, &host_%sbits);\n'
+                         '    return &host_%sbits;\n}\n'
+                         % (reg, reg, reg, reg, reg))
+            else:
+                h.append('extern volatile HOST_%sBITS_T %sbits;\n'
+                         % (reg, reg))
+                c.append('volatile HOST_%sBITS_T %sbits;\n' % (reg, reg))
+    h.append(FOOTER)
+    with open(os.path.join(out_dir, 'host_sfr.h'), 'w') as f:
+        f.write(''.join(h))
+    with open(os.path.join(out_dir, 'host_sfr.c'), 'w') as f:
+        f.write(''.join(c))
+
+
+def sources_of(tmp, core):
+    includes, sources, texts = [], [], ''
+    for tree in (os.path.join(tmp, core), os.path.join(tmp, 'common')):
+        for root, dirs, files in os.walk(tree):
+            if any(f.endswith('.h') for f in files):
+                includes.append('-I' + root)
+            for name in files:
+                if name.endswith('.c'):
+                    sources.append(os.path.join(root, name))
+                if name.endswith(('.c', '.h')):
+                    with open(os.path.join(root, name),
+                              encoding='latin-1') as f:
+                        texts += f.read()
+    return includes, sources, texts
+
+
+def main():
+    out_dir, project, core = sys.argv[1:4]
+    variants = []
+    for options in ([], sys.argv[4:]):
+        tmp = tempfile.mkdtemp()
+        subprocess.run([sys.executable, os.path.join(HERE, 'variant.py'),
+                        project, core, tmp] + options, check=True)
+        variants.append(sources_of(tmp, core))
+    fields = {}
+    for reg, field in re.findall(r'\b(\w+)bits\.(\w+)',
+                                 ''.join(v[2] for v in variants)):
+        fields.setdefault(reg, set()).add(field)
+
+    registers = set()
+    os.makedirs(out_dir, exist_ok=True)
+    while True:
+        write(out_dir, core, registers, fields)
+        found = set()
+        for includes, sources, _ in variants:
+            for source in sources:
+                cmd = ['gcc', '-std=gnu99', '-fsyntax-only', '-w',
+                       '-include', os.path.join(STUBS, 'host_prelude.h'),
+                       '-I' + out_dir, '-I' + STUBS] + includes + [source]
+                result = subprocess.run(cmd, capture_output=True, text=True,
+                                        env=dict(os.environ, LC_ALL='C'))
+                for name in re.findall(r"'(\w+)' undeclared", result.stderr):
+                    if name.endswith('bits'):
+                        name = name[:-4]
+                    found.add(name)
+        if not found - registers:
+            break
+        registers |= found
+    print('%d registers' % len(registers))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,20 @@
+#!/bin/sh
+# Regenerate the register stubs of both cores (run from project/host).
+# Every compile time option of the firmware is enabled, so that the stubs
+# cover the registers of all the variants built by CMakeLists.txt.
+set -e
+cd "$(dirname "$0")/.."
+tools/gen_sfr.py stubs/secondary .. secondary \
+    ENABLE_CURRENT_OVERSAMPLING ENABLE_ADC_EARLY_INTERRUPT \
+    ENABLE_MC1_SINGLE_SHUNT ENABLE_SECOND_MOTOR ENABLE_OVERMODULATION \
+    ENABLE_DECOUPLING_FEEDFORWARD ENABLE_DEADTIME_COMPENSATION ENABLE_MTPA \
+    ENABLE_SPEED_TRAJECTORY ENABLE_PARAMETER_IDENTIFICATION \
+    ENABLE_MECHANICAL_IDENTIFICATION ENABLE_INERTIA_ESTIMATION \
+    ENABLE_SPEED_GAIN_SCHEDULING ENABLE_LOAD_OBSERVER \
+    ENABLE_REPETITIVE_FEEDFORWARD ENABLE_VDC_OVERVOLTAGE_CONTROL \
+    ENABLE_RIDE_THROUGH ENABLE_CONTROL_KPI ENABLE_CROSS_CORE_SUPERVISOR \
+    ENABLE_ADC_TRACE SINGLE_SHUNT_CURRENT_FEEDBACK
+tools/gen_sfr.py stubs/main .. main \
+    PFC_KPI ENABLE_PFC_VOLTAGE_NOTCH ENABLE_PFC_DCM_CORRECTION \
+    ENABLE_PFC_ADAPTIVE_VDC ENABLE_PFC_LIGHT_LOAD \
+    ENABLE_CROSS_CORE_SUPERVISOR ENABLE_ADC_TRACE
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+"""Copy the firmware sources of a core (and of project/common, shared by the
+cores) with compile time options changed.
+
+Options of the firmware are '#define NAME [value]' / '#undef NAME' lines in
+its headers. Each option argument rewrites the matching lines of the copy :
+
+  NAME          #define NAME (keeps the value of an existing #define)
+  NAME=VALUE    #define NAME VALUE
+  !NAME         #undef NAME
+  file.h:OPTION restricts the option to headers named file.h
+
+Every option must match at least one line. Files are only written when their
+content changes, so unchanged variants are not rebuilt.
+
+Usage: variant.py <project dir> <core> <out dir> [option ...]
+Sources are copied to <out dir>/<core> and <out dir>/common.
+"""
+
+import os
+import re
+import sys
+
+LINE = r'^([ \t]*)#[ \t]*(define|undef)[ \t]+%s\b([^\n]*)$'
+
+
+def parse(option):
+    scope = None
+    if ':' in option:
+        scope, option = option.split(':', 1)
+    undef = option.startswith('!')
+    name, _, value = option.lstrip('!').partition('=')
+    return scope, name, undef, value
+
+
+def rewrite(text, name, undef, value):
+    def replace(match):
+        indent, old, rest = match.groups()
+        if undef:
+            return '%s#undef %s' % (indent, name)
+        if value:
+            return '%s#define %s %s' % (indent, name, value)
+        if old == 'define' and rest.strip():
+            return '%s#define %s%s' % (indent, name, rest)
+        return '%s#define %s' % (indent, name)
+    return re.subn(LINE % re.escape(name), replace, text, flags=re.M)
+
+
+def main():
+    project, core, out_dir = sys.argv[1:4]
+    options = [parse(o) for o in sys.argv[4:]]
+    matched = [0] * len(options)
+    for tree in (core, 'common'):
+        for root, dirs, files in os.walk(os.path.join(project, tree)):
+            dirs[:] = [d for d in dirs if not d.endswith('.X')]
+            for name in files:
+                if not name.endswith(('.c', '.h', '.s')):
+                    continue
+                path = os.path.join(root, name)
+                with open(path, encoding='latin-1', newline='') as f:
+                    text = f.read()
+                if name.endswith('.h'):
+                    for i, (scope, option, undef, value) in enumerate(options):
+                        if scope in (None, name):
+                            text, count = rewrite(text, option, undef, value)
+                            matched[i] += count
+                out = os.path.join(out_dir, os.path.relpath(path, project))
+                os.makedirs(os.path.dirname(out), exist_ok=True)
+                if os.path.exists(out):
+                    with open(out, encoding='latin-1', newline='') as f:
+                        if f.read() == text:
+                            continue
+                with open(out, 'w', encoding='latin-1', newline='') as f:
+                    f.write(text)
+    missing = [sys.argv[4 + i] for i, n in enumerate(matched) if n == 0]
+    if missing:
+        sys.exit('variant.py: options not found: %s' % ' '.join(missing))
+
+
+if __name__ == '__main__':
+    main()
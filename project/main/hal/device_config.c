@@ -127,13 +127,13 @@
 #pragma config CTXT4 = OFF              // Specifies Interrupt Priority Level (IPL) Associated to Alternate Working Register 4 bits (Not Assigned)
 
 // FMBXM
-#pragma config MBXM0 = S2M              // Mailbox 0 data direction (Mailbox register configured for Main data read (Secondary to Main data transfer))
-#pragma config MBXM1 = S2M              // Mailbox 1 data direction (Mailbox register configured for Main data read (Secondary to Main data transfer))
-#pragma config MBXM2 = S2M              // Mailbox 2 data direction (Mailbox register configured for Main data read (Secondary to Main data transfer))
-#pragma config MBXM3 = S2M              // Mailbox 3 data direction (Mailbox register configured for Main data read (Secondary to Main data transfer))
-#pragma config MBXM4 = S2M              // Mailbox 4 data direction (Mailbox register configured for Main data read (Secondary to Main data transfer))
-#pragma config MBXM5 = S2M              // Mailbox 5 data direction (Mailbox register configured for Main data read (Secondary to Main data transfer))
-#pragma config MBXM6 = S2M              // Mailbox 6 data direction (Mailbox register configured for Main data read (Secondary to Main data transfer))
+#pragma config MBXM0 = M2S              // Mailbox 0 data direction (Mailbox register configured for Main data write (Main to Secondary data transfer))
+#pragma config MBXM1 = M2S              // Mailbox 1 data direction (Mailbox register configured for Main data write (Main to Secondary data transfer))
+#pragma config MBXM2 = M2S              // Mailbox 2 data direction (Mailbox register configured for Main data write (Main to Secondary data transfer))
+#pragma config MBXM3 = M2S              // Mailbox 3 data direction (Mailbox register configured for Main data write (Main to Secondary data transfer))
+#pragma config MBXM4 = M2S              // Mailbox 4 data direction (Mailbox register configured for Main data write (Main to Secondary data transfer))
+#pragma config MBXM5 = M2S              // Mailbox 5 data direction (Mailbox register configured for Main data write (Main to Secondary data transfer))
+#pragma config MBXM6 = M2S              // Mailbox 6 data direction (Mailbox register configured for Main data write (Main to Secondary data transfer))
 #pragma config MBXM7 = S2M              // Mailbox 7 data direction (Mailbox register configured for Main data read (Secondary to Main data transfer))
 #pragma config MBXM8 = S2M              // Mailbox 8 data direction (Mailbox register configured for Main data read (Secondary to Main data transfer))
 #pragma config MBXM9 = S2M              // Mailbox 9 data direction (Mailbox register configured for Main data read (Secondary to Main data transfer))
@@ -145,7 +145,7 @@
 #pragma config MBXM15 = S2M             // Mailbox 15 data direction (Mailbox register configured for Main data read (Secondary to Main data transfer))
 
 // FMBXHS1
-#pragma config MBXHSA = MBX15           // Mailbox handshake protocol block A register assignment (MSIxMBXD15 assigned to mailbox handshake protocol block A)
+#pragma config MBXHSA = MBX6            // Mailbox handshake protocol block A register assignment (MSIxMBXD6 assigned to mailbox handshake protocol block A)
 #pragma config MBXHSB = MBX15           // Mailbox handshake protocol block B register assignment (MSIxMBXD15 assigned to mailbox handshake protocol block B)
 #pragma config MBXHSC = MBX15           // Mailbox handshake protocol block C register assignment (MSIxMBXD15 assigned to mailbox handshake protocol block C)
 #pragma config MBXHSD = MBX15           // Mailbox handshake protocol block D register assignment (MSIxMBXD15 assigned to mailbox handshake protocol block D)
@@ -157,14 +157,14 @@
 #pragma config MBXHSH = MBX15           // Mailbox handshake protocol block H register assignment (MSIxMBXD15 assigned to mailbox handshake protocol block H)
 
 // FMBXHSEN
-#pragma config HSAEN = OFF              // Mailbox A data flow control protocol block enable (Mailbox data flow control handshake protocol block disabled.)
-#pragma config HSBEN = OFF              // Mailbox B data flow control protocol block enable (Mailbox data flow control handshake protocol block disabled.)
-#pragma config HSCEN = ON               // Mailbox C data flow control protocol block enable (Mailbox data flow control handshake protocol block enabled)
-#pragma config HSDEN = ON               // Mailbox D data flow control protocol block enable (Mailbox data flow control handshake protocol block enabled)
-#pragma config HSEEN = ON               // Mailbox E data flow control protocol block enable (Mailbox data flow control handshake protocol block enabled)
-#pragma config HSFEN = ON               // Mailbox F data flow control protocol block enable (Mailbox data flow control handshake protocol block enabled)
-#pragma config HSGEN = ON               // Mailbox G data flow control protocol block enable (Mailbox data flow control handshake protocol block enabled)
-#pragma config HSHEN = ON               // Mailbox H data flow control protocol block enable (Mailbox data flow control handshake protocol block enabled)
+#pragma config HSAEN = ON               // Mailbox A data flow control protocol block enable (Mailbox data flow control handshake protocol block enabled.)
+#pragma config HSBEN = ON               // Mailbox B data flow control protocol block enable (Mailbox data flow control handshake protocol block enabled.)
+#pragma config HSCEN = OFF              // Mailbox C data flow control protocol block enable (Mailbox data flow control handshake protocol block disabled)
+#pragma config HSDEN = OFF              // Mailbox D data flow control protocol block enable (Mailbox data flow control handshake protocol block disabled)
+#pragma config HSEEN = OFF              // Mailbox E data flow control protocol block enable (Mailbox data flow control handshake protocol block disabled)
+#pragma config HSFEN = OFF              // Mailbox F data flow control protocol block enable (Mailbox data flow control handshake protocol block disabled)
+#pragma config HSGEN = OFF              // Mailbox G data flow control protocol block enable (Mailbox data flow control handshake protocol block disabled)
+#pragma config HSHEN = OFF              // Mailbox H data flow control protocol block enable (Mailbox data flow control handshake protocol block disabled)
 
 // FCFGPRA0
 #pragma config CPRA0 = MAIN             // Pin RA0 Ownership Bits (Main core owns pin.)
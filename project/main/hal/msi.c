@@ -0,0 +1,122 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * msi.c
+ *
+ * This file includes subroutines to exchange data with the Secondary core 
+ * through the MSI mailboxes.
+ * 
+ * Definitions in this file are for dsPIC33CH512MP508.
+ * 
+ * Component: Master Core - HAL - MSI
+ * 
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#ifdef __XC16__  // See comments at the top of this header file
+    #include <xc.h>
+#endif // __XC16__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "msi.h"
+
+// </editor-fold> 
+
+// <editor-fold defaultstate="collapsed" desc="INTERFACE FUNCTIONS ">
+
+/**
+ * <B> Function: HAL_MSICommandWrite(const MSI_COMMAND_T *)  </B>
+ * @brief Function writes the command to the Secondary core (protocol block A)
+ *        when the previous command has been read. Writing the last register
+ *        (MBX6) sets the data ready flag of the block.
+ * @param Pointer to the command.
+ * @return true - command written, false - previous command not yet read.
+ * @example
+ * <code>
+ * status = HAL_MSICommandWrite(&msiCommand);
+ * </code>
+ */
+bool HAL_MSICommandWrite(const MSI_COMMAND_T *pCommand)
+{
+    if (MSI1MBXSbits.DTRDYA)
+    {
+        return false;
+    }
+    MSI1MBX0D = (uint16_t)pCommand->velocityRefMC1;
+    MSI1MBX1D = (uint16_t)pCommand->iqRefMC1;
+    MSI1MBX2D = (uint16_t)pCommand->idRefMC1;
+    MSI1MBX3D = (uint16_t)pCommand->velocityRefMC2;
+    MSI1MBX4D = (uint16_t)pCommand->iqRefMC2;
+    MSI1MBX5D = (uint16_t)pCommand->idRefMC2;
+    MSI1MBX6D = pCommand->flags;
+    return true;
+}
+
+/**
+ * <B> Function: HAL_MSIFeedbackRead(MSI_FEEDBACK_T *)  </B>
+ * @brief Function reads the feedback of the Secondary core (protocol block B)
+ *        when a new feedback is ready. Reading the last register (MBX15) 
+ *        releases the block for the next feedback.
+ * @param Pointer to the feedback.
+ * @return true - new feedback read, false - no new feedback.
+ * @example
+ * <code>
+ * status = HAL_MSIFeedbackRead(&msiFeedback);
+ * </code>
+ */
+bool HAL_MSIFeedbackRead(MSI_FEEDBACK_T *pFeedback)
+{
+    if (MSI1MBXSbits.DTRDYB == 0)
+    {
+        return false;
+    }
+    pFeedback->potentiometer = (int16_t)MSI1MBX7D;
+    pFeedback->velocityMC1 = (int16_t)MSI1MBX8D;
+    pFeedback->velocityMC2 = (int16_t)MSI1MBX9D;
+    pFeedback->iqRefMC1 = (int16_t)MSI1MBX10D;
+    pFeedback->iqRefMC2 = (int16_t)MSI1MBX11D;
+    pFeedback->voltageErrorMC1 = (int16_t)MSI1MBX12D;
+    pFeedback->voltageErrorMC2 = (int16_t)MSI1MBX13D;
+    pFeedback->voltageDemand = (int16_t)MSI1MBX14D;
+    pFeedback->status = MSI1MBX15D;
+    return true;
+}
+
+// </editor-fold>
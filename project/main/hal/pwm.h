@@ -94,8 +94,28 @@
 /* Maximum duty cycle in terms of PWM period */
 #define PFC_MAX_DUTY                (uint16_t)(PFC_MAX_DUTY_PU*PFC_LOOPTIME_TCY)
 
-#define SYNC_COUNT                  (uint16_t)(0*PFC_LOOPTIME_TCY)         
- /*Mention value of PWM Counter value at which MCPWM will be synchronized with PFC PWM*/       
+/* Phase of the PFC carrier at which the motor PWM cycle starts, in degrees
+   of the PFC period (0 to 359). Secondary PG5 is restarted by Master PWM 
+   Event C, that is PG4 ADC Trigger 1 (PG4TRIGC) postscaled 1:4 : the motor
+   period (62.5 us at 200 MHz) is 4 PFC periods (15.622 us at 180 MHz) plus
+   11 ns, which the restart takes up every motor cycle, so that the phase 
+   of the carriers is fixed. It sets when the active vectors of the 
+   inverters fall in the boost diode conduction, i.e. how much of the 
+   inverter current the PFC supplies directly instead of the DC link 
+   capacitor. PFC ADC trigger (PG4TRIGA, ADC Trigger 2) is not affected. */
+#define PFC_MC_SYNC_PHASE_DEG       0
+#if (PFC_MC_SYNC_PHASE_DEG < 0) || (PFC_MC_SYNC_PHASE_DEG >= 360)
+    #error PFC_MC_SYNC_PHASE_DEG out of range
+#endif
+ /*Mention value of PWM Counter value at which MCPWM will be synchronized with 
+   PFC PWM : center aligned, PGxTRIGy bit 15 selects the second half*/
+#if (PFC_MC_SYNC_PHASE_DEG < 180)
+#define SYNC_COUNT                  (uint16_t)(((uint32_t)(PFC_LOOPTIME_TCY+1)* \
+                                            PFC_MC_SYNC_PHASE_DEG)/180)
+#else
+#define SYNC_COUNT                  (uint16_t)(32768+((uint32_t)(PFC_LOOPTIME_TCY+1)* \
+                                            (PFC_MC_SYNC_PHASE_DEG-180))/180)
+#endif
 #define PFC_Sync_MC_Value           SYNC_COUNT  
 // </editor-fold>           
 
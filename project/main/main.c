@@ -6,6 +6,9 @@
 #include "board_service.h"
 #include "diagnostics.h"
 #include "pfc.h"
+#include "msi.h"
+#include "supervisor.h"
+
 // *****************************************************************************
 /* Function:
    main()
@@ -53,6 +56,9 @@ int main(void)
 
     LED1 = 1;
     PFC_ServiceInit();
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+    SupervisorInit();
+#endif
     
     while(1)
     {
@@ -81,6 +87,9 @@ void __attribute__((__interrupt__,__auto_psv__)) _T1Interrupt (void)
         DiagnosticsStepIsr();
     #endif
     BoardServiceStepIsr();
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+    SupervisorStepIsr();
+#endif
     TIMER1_InterruptFlagClear();
 }
-// </editor-fold>
\ No newline at end of file
+// </editor-fold>
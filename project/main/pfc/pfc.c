@@ -52,6 +52,7 @@
 #include "libq.h"
 #include "pfc.h"
 #include "board_service.h"
+#include "adc_trace.h"
 
 // </editor-fold> 
 
@@ -61,6 +62,10 @@ static int16_t PFC_SignalRectification(PFC_MEASURE_VOLTAGE_T *);
 static int16_t PFC_CurrentSampleCorrection(PFC_T *);
 static void PFC_Average(PFC_AVG_T *,int16_t);
 static void PFC_SquaredRMSCalculate(PFC_RMS_SQUARE_T *,int16_t);
+#ifdef ENABLE_PFC_VOLTAGE_NOTCH
+static void PFC_NotchFilter(PFC_NOTCH_T *,int16_t,int16_t);
+static void PFC_NotchFilterReset(PFC_NOTCH_T *);
+#endif
 
 inline static void PFC_CurrentRefGenerate(PFC_T *);
 inline static void PFC_CurrentControlLoop(PFC_T *);
@@ -68,6 +73,16 @@ inline static void PFC_CurrentControlLoop(PFC_T *);
 static void PFC_ParamsInit(PFC_T *);
 static void PFC_ResetParams(PFC_T *);
 static void PFC_FaultCheck(PFC_T *);
+#ifdef ENABLE_PFC_LIGHT_LOAD
+static uint16_t PFC_LightLoadManage(PFC_T *);
+#endif
+#ifdef ENABLE_ADC_TRACE
+static void PFC_TraceInit(PFC_T *);
+static uint16_t PFC_TraceSignature(PFC_T *);
+#endif
+#ifdef PFC_KPI
+static void PFC_KPIUpdate(PFC_T *);
+#endif
 void PFC_StateMachine(PFC_T *);
 
 // </editor-fold> 
@@ -76,6 +91,23 @@ void PFC_StateMachine(PFC_T *);
 
 PFC_T pfcParam;
 
+#ifdef ENABLE_ADC_TRACE
+ADC_TRACE_T pfcTrace;
+/* Region of PFC_TraceInit() */
+ADC_TRACE_SNAPSHOT_CHECK(pfc, sizeof(PFC_T));
+#endif
+
+/* Ratio of actual duty and ideal duty in DCM = duty/(1 - Vac/Vdc). Table of
+ * 1/(1 - m) is indexed by m = Vac/Vdc in steps of 1/PFC_DCM_TABLE_SIZE, 
+ * Q format PFC_DCM_TABLE_QVALUE. */
+static const int16_t dcmRatioTable[PFC_DCM_TABLE_SIZE] =
+{
+      512,   529,   546,   565,   585,   607,   630,   655,
+      683,   712,   745,   780,   819,   862,   910,   964,
+     1024,  1092,  1170,  1260,  1365,  1489,  1638,  1820,
+     2048,  2341,  2731,  3277,  4096,  5461,  8192, 16384
+};
+
 // </editor-fold>
 
 // <editor-fold defaultstate="collapsed" desc="INTERFACE FUNCTIONS ">
@@ -91,12 +123,30 @@ PFC_T pfcParam;
 */
 void __attribute__((__interrupt__,no_auto_psv)) PFC_ADCInterrupt()
 {  
+#ifdef ENABLE_ADC_TRACE
+    uint16_t traceState;
+#endif
+#ifdef PFC_KPI
+    const uint16_t isrStart = TIMER1_CounterRead();
+    PFC_KPI_T *pKPI = &pfcParam.kpi;
+    uint16_t isrEnd;
+#endif
     /** Load ADC Buffer data to respective variables */
     pfcParam.pfcVoltage.vdc  = ADCBUF_VDC;
     pfcParam.pfcVoltage.vac  = ADCBUF_PFC_VAC;
     pfcParam.pfcCurrent.iL   = ADCBUF_PFC_IL;     
             
+#ifdef ENABLE_ADC_TRACE
+    traceState = ADCTraceInputs(&pfcTrace);
+#endif
     PFC_StateMachine(&pfcParam);
+#ifdef PFC_KPI
+    PFC_KPIUpdate(&pfcParam);
+#endif
+#ifdef ENABLE_ADC_TRACE
+    ADCTraceOutputs(&pfcTrace, PFC_TraceSignature(&pfcParam), 
+                                        (pfcParam.state == PFC_FAULT));
+#endif
 
 #ifdef DEBUG_BOOST
     PFC_ENABLE_SIGNAL = 1;
@@ -104,8 +154,28 @@ void __attribute__((__interrupt__,no_auto_psv)) PFC_ADCInterrupt()
 #endif
     
     PFC_PWM_PDC = pfcParam.duty;    
+#ifdef ENABLE_ADC_TRACE
+    if ((traceState == ADC_TRACE_REPLAY) || (traceState == ADC_TRACE_DONE))
+    {
+        /** Replayed state must not drive the boost switch */
+        HAL_PFCPWMDisableOutputs();
+        PFC_PWM_PDC = 0;
+    }
+#endif
     LED1 = 0;
     ClearPFCADCIF();
+#ifdef PFC_KPI
+    isrEnd = TIMER1_CounterRead();
+    if (isrEnd < isrStart)
+    {
+        isrEnd += TIMER1_PERIOD_COUNT + 1;
+    }
+    pKPI->isrCycles = (isrEnd - isrStart) * TIMER1_CLOCK_PRESCALER;
+    if (pKPI->isrCycles > pKPI->isrCyclesMax)
+    {
+        pKPI->isrCyclesMax = pKPI->isrCycles;
+    }
+#endif
 }
 /**
  * <B> Function: PFC_StateMachine(PFC_T *pfcData)  </B>
@@ -138,6 +208,13 @@ void PFC_StateMachine(PFC_T *pfcData)
 
     /** Calculate RMS Square of rectified input voltage  */
     PFC_SquaredRMSCalculate(&pfcData->vacRMS,pfcData->rectifiedVac);
+
+#ifdef ENABLE_PFC_VOLTAGE_NOTCH
+    /** Average PFC output voltage over half line cycle to notch the twice 
+        line frequency ripple */
+    PFC_NotchFilter(&pfcData->vdcNotch,pVoltage->vdc,
+                                pVoltage->vac - pVoltage->offsetVac);
+#endif
     
     switch(pfcState)
     {
@@ -167,7 +244,11 @@ void PFC_StateMachine(PFC_T *pfcData)
         break;
         case PFC_WAIT_1CYCLE:
 
+#ifdef ENABLE_PFC_VOLTAGE_NOTCH
+            if((pfcData->vacRMS.status == 1) && (pfcData->vdcNotch.status == 1))
+#else
             if(pfcData->vacRMS.status == 1)
+#endif
             {  
                 HAL_PFCPWMEnableOutputs();
                 pfcState = PFC_CTRL_RUN;
@@ -184,8 +265,10 @@ void PFC_StateMachine(PFC_T *pfcData)
 
             if(pfcData->faultStatus == PFC_FAULT_NONE)
             {
-                /** Perform soft start when enabled */
-                if (pfcData->piVoltage.reference < PFC_OUPUT_VOLTAGE_REFERENCE)
+                /** Perform soft start when enabled. Changes of the output
+                    voltage reference (efficiency mode) are ramped at the 
+                    same rate */
+                if (pfcData->piVoltage.reference < pfcData->vdcReference)
                 {
                     if(pfcData->rampRate == 0)
                     {
@@ -197,22 +280,34 @@ void PFC_StateMachine(PFC_T *pfcData)
                         pfcData->rampRate--;
                     }
                 }
+                else if (pfcData->piVoltage.reference > 
+                            (pfcData->vdcReference + RAMP_COUNT))
+                {
+                    if(pfcData->rampRate == 0)
+                    {
+                        pfcData->piVoltage.reference = pfcData->piVoltage.reference - RAMP_COUNT;
+                        pfcData->rampRate = RAMP_RATE;
+                    }
+                    else
+                    {
+                        pfcData->rampRate--;
+                    }
+                }
                 else
                 {
-                    pfcData->piVoltage.reference = PFC_OUPUT_VOLTAGE_REFERENCE; 
+                    pfcData->piVoltage.reference = pfcData->vdcReference; 
                 }
 
-                PFC_CurrentRefGenerate(pfcData);                
-
-                if(pVoltage->vdc > 0)
+#ifdef ENABLE_PFC_LIGHT_LOAD
+                if (PFC_LightLoadManage(pfcData) == 0)
                 {
-                    /** Calculate the ideal value of boost converter duty ratio 
-                        based on current value of Vdc and Vac. 
-                        Boost Duty Ratio = (1 - (Vac/Vdc))
-                                         = ((Vdc-Vac)/Vdc) */
-                    pfcData->boostDutyRatio = __builtin_divf(pVoltage->vdc - 
-                                pfcData->rectifiedVac, pVoltage->vdc) ;
+                    /** Switching stopped : control loops are frozen */
+                    pfcData->duty = 0;
+                    pfcData->piCurrent.integralOut = 0;
+                    break;
                 }
+#endif
+                PFC_CurrentRefGenerate(pfcData);                
 
                 PFC_CurrentControlLoop(pfcData);
                 
@@ -244,6 +339,8 @@ void PFC_StateMachine(PFC_T *pfcData)
                 pfcData->piVoltage.integralOut = 0;
                 pfcData->piCurrent.integralOut = 0;
                 pfcData->piVoltage.reference = pfcData->vdcAVG.output;
+                pfcData->lightLoad.state = PFC_LOAD_NORMAL;
+                pfcData->lightLoad.standbyCount = 0;
                 pfcState = PFC_CTRL_RUN;
                 HAL_PFCPWMEnableOutputs();
             }
@@ -271,12 +368,111 @@ void PFC_ServiceInit(void)
 	DisablePFCADCInterrupt();
     
     PFC_ParamsInit(&pfcParam);
+#ifdef ENABLE_ADC_TRACE
+    PFC_TraceInit(&pfcParam);
+#endif
     
     /* Enable ADC interrupt and begin main loop timing */
     ClearPFCADCIF();
     ClearPFCADCIF_ReadADCBUF();
     EnablePFCADCInterrupt(); 
 }
+/**
+* <B> Function: PFC_IsFault()     </B>
+* 
+* @brief Function returns the PFC fault status, used by the supervisory tasks
+*       to withdraw the motor run permission.
+* @param none.
+* @return true - PFC is in fault state.
+* @example
+* <CODE> status = PFC_IsFault();        </CODE>
+*
+*/
+bool PFC_IsFault(void)
+{
+    return (pfcParam.state == PFC_FAULT);
+}
+/**
+* <B> Function: PFC_IsLineLoss()     </B>
+* 
+* @brief Function returns true when input under voltage is the only PFC 
+*       fault (mains loss), which is ridden through by the motors.
+* @param none.
+* @return true - PFC is in fault state due to input under voltage only.
+* @example
+* <CODE> status = PFC_IsLineLoss();        </CODE>
+*
+*/
+bool PFC_IsLineLoss(void)
+{
+    return ((pfcParam.state == PFC_FAULT) && 
+            (pfcParam.faultStatus == PFC_FAULT_IP_UV));
+}
+/**
+* <B> Function: PFC_VoltageDemandSet(int16_t)     </B>
+* 
+* @brief Function adapts the PFC output voltage reference to the DC link 
+*       voltage demand of the motors (efficiency mode). Reference is the 
+*       demand plus margin, limited between the minimum and nominal reference
+*       and kept above the input voltage peak, so that the boost converter
+*       remains in control. Reference is raised at once and reduced with 
+*       hysteresis; the PFC state machine ramps towards it.
+* @param DC link voltage demand normalized to PFC_VOLTAGE_BASE, 
+*       INT16_MAX selects the nominal reference.
+* @return none.
+* @example
+* <CODE> PFC_VoltageDemandSet(voltageDemand);        </CODE>
+*
+*/
+void PFC_VoltageDemandSet(int16_t demand)
+{
+    int32_t reference, vacPeakSqr;
+    int16_t vacPeak;
+
+    reference = (int32_t)demand + PFC_ADAPTIVE_VDC_MARGIN_NORM;
+
+    /** Vac peak = sqrt(2 * Vac RMS^2) */
+    vacPeakSqr = (int32_t)pfcParam.vacRMS.sqrOutput << 1;
+    if (vacPeakSqr > INT16_MAX)
+    {
+        vacPeakSqr = INT16_MAX;
+    }
+    vacPeak = _Q15sqrt((int16_t)vacPeakSqr);
+    if (reference < ((int32_t)vacPeak + PFC_ADAPTIVE_VDC_BOOST_MARGIN_NORM))
+    {
+        reference = (int32_t)vacPeak + PFC_ADAPTIVE_VDC_BOOST_MARGIN_NORM;
+    }
+
+    if (reference < PFC_ADAPTIVE_VDC_MIN_REFERENCE)
+    {
+        reference = PFC_ADAPTIVE_VDC_MIN_REFERENCE;
+    }
+    else if (reference > PFC_OUPUT_VOLTAGE_REFERENCE)
+    {
+        reference = PFC_OUPUT_VOLTAGE_REFERENCE;
+    }
+
+    if ((reference > pfcParam.vdcReference) || 
+        (reference < (pfcParam.vdcReference - PFC_ADAPTIVE_VDC_HYSTERESIS_NORM)))
+    {
+        pfcParam.vdcReference = (int16_t)reference;
+    }
+}
+/**
+* <B> Function: PFC_StandbyRequest(bool)     </B>
+* 
+* @brief Function requests PFC standby (passive rectification) when the 
+*       motors are idle. Withdrawing the request restarts switching at once.
+* @param true - motors are idle, standby permitted.
+* @return none.
+* @example
+* <CODE> PFC_StandbyRequest(true);        </CODE>
+*
+*/
+void PFC_StandbyRequest(bool request)
+{
+    pfcParam.lightLoad.standbyRequest = (request) ? 1 : 0;
+}
 /**
  * <B> Function: PFC_ParamsInit(PFC_T *pfcData)  </B>
  * 
@@ -298,6 +494,12 @@ void PFC_ParamsInit(PFC_T *pfcData)
     pfcData->vdcAVG.sampleLimit = 1<<pfcData->vdcAVG.scaler;
     
     pfcData->vacAVG.sampleLimit = PFC_INPUT_FREQUENCY_COUNTER;
+#ifdef ENABLE_PFC_VOLTAGE_NOTCH
+    /** Initialize line period to the nominal input frequency */
+    pfcData->vdcNotch.linePeriod = PFC_INPUT_FREQUENCY_COUNTER;
+    pfcData->vdcNotch.lineCount = 0;
+    pfcData->vdcNotch.polarity = 0;
+#endif
 
 /** Initialize PI controlling PFC Current Loop */    
     pfcData->piCurrent.kp = KP_I;
@@ -317,7 +519,32 @@ void PFC_ParamsInit(PFC_T *pfcData)
     
     pfcData->state = PFC_INIT;
     pfcData->faultStatus = PFC_FAULT_NONE;
+#ifdef ENABLE_PFC_DCM_CORRECTION
+    pfcData->sampleCorrectionEnable = 1;
+#else
     pfcData->sampleCorrectionEnable = 0;
+#endif
+    pfcData->vdcInverse = 0;
+    
+    pfcData->lightLoad.state = PFC_LOAD_NORMAL;
+    pfcData->lightLoad.standbyRequest = 0;
+    pfcData->lightLoad.standbyCount = 0;
+    pfcData->lightLoad.burstCount = 0;
+    pfcData->vdcReference = PFC_OUPUT_VOLTAGE_REFERENCE;
+    
+    pfcData->kpi.powerSum = 0;
+    pfcData->kpi.voltageSqrSum = 0;
+    pfcData->kpi.currentSqrSum = 0;
+    pfcData->kpi.samples = 0;
+    pfcData->kpi.runCount = 0;
+    pfcData->kpi.softStartTime = 0;
+    pfcData->kpi.vdcMin = INT16_MAX;
+    pfcData->kpi.vdcMax = 0;
+    pfcData->kpi.vdcRipple = 0;
+    pfcData->kpi.vdcRippleMax = 0;
+    pfcData->kpi.powerFactor = 0;
+    pfcData->kpi.isrCycles = 0;
+    pfcData->kpi.isrCyclesMax = 0;
 }
 /**
  * <B> Function: PFC_ResetParams(PFC_T *pData)  </B>
@@ -347,6 +574,11 @@ void PFC_ResetParams(PFC_T *pData)
     pData->vacRMS.peak = 0;
     pData->vacRMS.status = 0;
 
+#ifdef ENABLE_PFC_VOLTAGE_NOTCH
+    /** Initialize variables related to line synchronous moving average */
+    PFC_NotchFilterReset(&pData->vdcNotch);
+#endif
+
     /** Initialize variables related to PI integrator */
     pData->piVoltage.integralOut = 0;
     pData->piCurrent.integralOut = 0;
@@ -359,7 +591,12 @@ void PFC_ResetParams(PFC_T *pData)
  * <B> Function: PFC_CurrentSampleCorrection(PFC_T *pData)  </B>
  * 
  * @brief Function to calculate average value of current in discontinuous 
- * conduction mode.
+ * conduction mode. Conduction mode is detected every PWM cycle :
+ * - Ratio of actual duty and ideal duty (1 - Vac/Vdc) is less than 1 in DCM.
+ *   It is computed from the reciprocal of average Vdc (updated at voltage 
+ *   loop rate) and a look up table of 1/(1 - Vac/Vdc), without division.
+ * - Sample is below half the current ripple in DCM. Correction is blended 
+ *   out above half the ripple, so the transition to CCM is seamless.
  * @param Pointer to the data structure containing PFC related variables
  * @return average current output
  * @example
@@ -369,24 +606,55 @@ void PFC_ResetParams(PFC_T *pData)
  */
 static int16_t PFC_CurrentSampleCorrection(PFC_T *pData)
 {
-    int16_t output = Q15(0.9999);
+    int32_t ratio, weight;
+    int16_t vacByVdc, index, delta, halfRipple;
+    
+    /** Half current ripple : sample at or above it + blend band is CCM */
+    halfRipple = (int16_t)(__builtin_mulss((int16_t)(__builtin_mulss(
+                    pData->rectifiedVac, pData->piCurrent.output) >> 15),
+                    PFC_RIPPLE_GAIN) >> 15);
+    weight = (int32_t)pData->iL - halfRipple;
+    if ((weight >= (1 << PFC_CCM_BLEND_SHIFT)) || (pData->vdcInverse == 0))
+    {
+        return pData->iL;
+    }
     
-    /** Check if ideal duty is positive value */
-    if(pData->boostDutyRatio > 0)
+    /** Vac/Vdc and ideal duty ratio (1 - Vac/Vdc) */
+    ratio = __builtin_mulss(pData->rectifiedVac, pData->vdcInverse) >> 12;
+    if (ratio > INT16_MAX)
     {
-        /** Calculate ratio of actual duty and ideal duty */
-        output = __builtin_divf(pData->piCurrent.output, pData->boostDutyRatio);
+        ratio = INT16_MAX;
     }
-    /** Check if ratio previous result is greater than 0 */
-    if(output > 0)
+    vacByVdc = (int16_t)ratio;
+    pData->boostDutyRatio = INT16_MAX - vacByVdc;
+    
+    /** Ratio of actual duty and ideal duty = duty * 1/(1 - Vac/Vdc) */
+    index = vacByVdc >> PFC_DCM_TABLE_SHIFT;
+    if (index >= (PFC_DCM_TABLE_SIZE - 1))
     {
-        output = (int16_t)((__builtin_mulss(pData->iL,output)) >> 15);
+        ratio = dcmRatioTable[PFC_DCM_TABLE_SIZE - 1];
     }
     else
     {
-        output = pData->iL;
+        delta = vacByVdc & ((1 << PFC_DCM_TABLE_SHIFT) - 1);
+        ratio = dcmRatioTable[index] + 
+            (__builtin_mulss((dcmRatioTable[index + 1] - dcmRatioTable[index]),
+                                                        delta) >> PFC_DCM_TABLE_SHIFT);
     }
-    return(output);
+    ratio = __builtin_mulss(pData->piCurrent.output, (int16_t)ratio) >> 
+                                                        PFC_DCM_TABLE_QVALUE;
+    if (ratio > INT16_MAX)
+    {
+        ratio = INT16_MAX;
+    }
+    
+    /** Blend : ratio + weight*(1 - ratio), weight 0 (DCM) to 1 (CCM) */
+    if (weight > 0)
+    {
+        weight = weight << (15 - PFC_CCM_BLEND_SHIFT);
+        ratio = ratio + ((weight * (INT16_MAX - ratio)) >> 15);
+    }
+    return (int16_t)(__builtin_mulss(pData->iL, (int16_t)ratio) >> 15);
 }
 /**
  * <B> Function: PFC_CurrentControlLoop(PFC_T *pData)  </B>
@@ -457,7 +725,11 @@ inline static void PFC_CurrentRefGenerate(PFC_T *pData)
         Voltage PI is called at the rate specified by VOLTAGE_LOOP_EXE_RATE */
     if (pData->voltLoopExeRate > VOLTAGE_LOOP_EXE_RATE)
     {
+#ifdef ENABLE_PFC_VOLTAGE_NOTCH
+        pData->piVoltage.error = pData->piVoltage.reference-pData->vdcNotch.output;
+#else
         pData->piVoltage.error = pData->piVoltage.reference-pData->vdcAVG.output;
+#endif
 
         if((pData->piVoltage.error > 700) || (pData->piVoltage.error < -700 ))
         {
@@ -469,6 +741,17 @@ inline static void PFC_CurrentRefGenerate(PFC_T *pData)
         }
         PFC_PIController(&pData->piVoltage,pData->piVoltage.error);
         pData->voltLoopExeRate = 0;
+        
+        /** Reciprocal of average Vdc (Q12) for DCM sample correction */
+        if (pData->vdcAVG.output > (1 << 12))
+        {
+            pData->vdcInverse = (int16_t)__builtin_divsd((int32_t)1 << 27, 
+                                                    pData->vdcAVG.output);
+        }
+        else
+        {
+            pData->vdcInverse = 0;
+        }
     }
     else
     {
@@ -587,6 +870,137 @@ static void PFC_Average(PFC_AVG_T *pData,int16_t input)
     }
 }
 
+#ifdef ENABLE_PFC_VOLTAGE_NOTCH
+/**
+ * <B> Function: PFC_NotchFilter(PFC_NOTCH_T *pData,int16_t input,
+ *                                                  int16_t vac)  </B>
+ * 
+ * @brief Function to calculate moving average of an input signal over one
+ * half line cycle. Line period is measured between positive zero crossings
+ * of the input AC voltage (with hysteresis) and the window length is 
+ * rounded to an integral number of blocks. Average over half line cycle 
+ * rejects the twice line frequency ripple and all its harmonics.
+ * @param Pointer to the data structure containing variables related to 
+ * moving average calculation, current value of signal, input AC voltage 
+ * without offset
+ * @return none.
+ * @example
+ * <code>
+ * PFC_NotchFilter(&pData->vdcNotch,vdc,vac);
+ * </code>
+ */
+static void PFC_NotchFilter(PFC_NOTCH_T *pData,int16_t input,int16_t vac)
+{
+    uint16_t length,i;
+    
+    /** Line period measurement */
+    if (pData->lineCount < UINT16_MAX)
+    {
+        pData->lineCount++;
+    }
+    if ((pData->polarity == 0) && (vac > PFC_ZERO_CROSS_THRESHOLD))
+    {
+        pData->polarity = 1;
+        if ((pData->lineCount >= PFC_LINE_PERIOD_MIN) && 
+                (pData->lineCount <= PFC_LINE_PERIOD_MAX))
+        {
+            pData->linePeriod = pData->lineCount;
+        }
+        pData->lineCount = 0;
+    }
+    else if ((pData->polarity == 1) && (vac < -PFC_ZERO_CROSS_THRESHOLD))
+    {
+        pData->polarity = 0;
+    }
+    
+    pData->blockSum = pData->blockSum + input;
+    pData->blockSamples++;
+    if (pData->blockSamples < (1 << PFC_NOTCH_BLOCK_SCALER))
+    {
+        return;
+    }
+    
+    /** Window length in blocks = half line period / block length */
+    length = ((pData->linePeriod >> 1) + (1 << (PFC_NOTCH_BLOCK_SCALER - 1)))
+                                                    >> PFC_NOTCH_BLOCK_SCALER;
+    if (length > PFC_NOTCH_BUFFER_SIZE)
+    {
+        length = PFC_NOTCH_BUFFER_SIZE;
+    }
+    
+    /** Store block average, the oldest block leaves the window */
+    i = pData->index + PFC_NOTCH_BUFFER_SIZE - pData->length;
+    if (i >= PFC_NOTCH_BUFFER_SIZE)
+    {
+        i -= PFC_NOTCH_BUFFER_SIZE;
+    }
+    pData->sum = pData->sum - pData->buffer[i];
+    pData->buffer[pData->index] = 
+            (int16_t)(pData->blockSum >> PFC_NOTCH_BLOCK_SCALER);
+    pData->sum = pData->sum + pData->buffer[pData->index];
+    pData->blockSum = 0;
+    pData->blockSamples = 0;
+    pData->index++;
+    if (pData->index >= PFC_NOTCH_BUFFER_SIZE)
+    {
+        pData->index = 0;
+    }
+    if (pData->blocks < PFC_NOTCH_BUFFER_SIZE)
+    {
+        pData->blocks++;
+    }
+    
+    /** Line frequency changed : sum is recalculated over the new window */
+    if (length != pData->length)
+    {
+        pData->length = length;
+        pData->sum = 0;
+        i = pData->index;
+        while (length > 0)
+        {
+            i = (i == 0) ? (PFC_NOTCH_BUFFER_SIZE - 1) : (i - 1);
+            pData->sum = pData->sum + pData->buffer[i];
+            length--;
+        }
+    }
+    
+    if (pData->blocks >= pData->length)
+    {
+        pData->output = (int16_t)(__builtin_divsd(pData->sum,pData->length));
+        pData->status = 1;
+    }
+}
+/**
+ * <B> Function: PFC_NotchFilterReset(PFC_NOTCH_T *pData)  </B>
+ * 
+ * @brief Function to reset the line synchronous moving average. Measured
+ * line period is retained.
+ * @param Pointer to the data structure containing variables related to 
+ * moving average calculation
+ * @return none.
+ * @example
+ * <code>
+ * PFC_NotchFilterReset(&pData->vdcNotch);
+ * </code>
+ */
+static void PFC_NotchFilterReset(PFC_NOTCH_T *pData)
+{
+    uint16_t i;
+    
+    for (i = 0; i < PFC_NOTCH_BUFFER_SIZE; i++)
+    {
+        pData->buffer[i] = 0;
+    }
+    pData->sum = 0;
+    pData->blockSum = 0;
+    pData->blockSamples = 0;
+    pData->index = 0;
+    pData->blocks = 0;
+    pData->length = 1;
+    pData->output = 0;
+    pData->status = 0;
+}
+#endif
 
 /**
  * <B> Function: PFC_FaultCheck(PFC_T *pData)  </B>
@@ -617,4 +1031,218 @@ void PFC_FaultCheck(PFC_T *pData)
         pData->faultStatus += PFC_FAULT_IP_OV;
     }
 }
-// </editor-fold>
\ No newline at end of file
+#ifdef ENABLE_PFC_LIGHT_LOAD
+/**
+ * <B> Function: PFC_LightLoadManage(PFC_T *pData)  </B>
+ * 
+ * @brief Function to manage PFC switching at light load. In burst mode 
+ * switching is stopped while Vdc is within hysteresis below the reference. 
+ * In standby switching is stopped and the converter operates as passive 
+ * rectifier until the standby request is withdrawn, then it restarts with 
+ * soft start from the actual Vdc.
+ * @param Pointer to the data structure containing PFC related variables
+ * @return 1 - switch in this PWM cycle, 0 - switching stopped.
+ * @example
+ * <code>
+ * status = PFC_LightLoadManage(&pfcParam);
+ * </code>
+ */
+static uint16_t PFC_LightLoadManage(PFC_T *pData)
+{
+    PFC_LIGHT_LOAD_T *pLightLoad = &pData->lightLoad;
+    
+    if (pLightLoad->state == PFC_LOAD_STANDBY)
+    {
+        if (pLightLoad->standbyRequest)
+        {
+            return 0;
+        }
+        /** Motor start : restart from actual Vdc */
+        pData->piVoltage.reference = pData->vdcAVG.output;
+        pData->piVoltage.integralOut = 0;
+        pData->piCurrent.integralOut = 0;
+        pLightLoad->standbyCount = 0;
+        pLightLoad->state = PFC_LOAD_NORMAL;
+        HAL_PFCPWMEnableOutputs();
+        return 1;
+    }
+    
+    if (pLightLoad->standbyRequest && 
+            (pData->piVoltage.output < PFC_STANDBY_POWER_Q15))
+    {
+        if (pLightLoad->standbyCount < PFC_STANDBY_DELAY_COUNT)
+        {
+            pLightLoad->standbyCount++;
+        }
+        else
+        {
+            pLightLoad->state = PFC_LOAD_STANDBY;
+            HAL_PFCPWMDisableOutputs();
+            return 0;
+        }
+    }
+    else
+    {
+        pLightLoad->standbyCount = 0;
+    }
+    
+    if (pLightLoad->state == PFC_LOAD_BURST_OFF)
+    {
+        if (pData->vdcAVG.output < 
+                (pData->piVoltage.reference - PFC_BURST_HYSTERESIS_NORM))
+        {
+            pLightLoad->state = PFC_LOAD_NORMAL;
+            return 1;
+        }
+        return 0;
+    }
+    
+    if ((pData->piVoltage.output < PFC_BURST_POWER_Q15) && 
+            (pData->vdcAVG.output >= pData->piVoltage.reference))
+    {
+        pLightLoad->state = PFC_LOAD_BURST_OFF;
+        pLightLoad->burstCount++;
+        return 0;
+    }
+    return 1;
+}
+#endif
+// </editor-fold>
+#ifdef ENABLE_ADC_TRACE
+/**
+ * <B> Function: PFC_TraceInit(PFC_T *pData)  </B>
+ * 
+ * @brief Function to initialize the ADC trace of PFC. Trace restores the 
+ * PFC data structure on replay, channels are the raw ADC inputs.
+ * @param Pointer to the data structure containing PFC related variables
+ * @return none
+ * @example
+ * <code>
+ * PFC_TraceInit(&pfcParam);
+ * </code>
+ */
+static void PFC_TraceInit(PFC_T *pData)
+{
+    ADCTraceInit(&pfcTrace, pData, sizeof(PFC_T));
+    ADCTraceChannelAdd(&pfcTrace, &pData->pfcVoltage.vdc);
+    ADCTraceChannelAdd(&pfcTrace, &pData->pfcVoltage.vac);
+    ADCTraceChannelAdd(&pfcTrace, &pData->pfcCurrent.iL);
+}
+/**
+ * <B> Function: PFC_TraceSignature(PFC_T *pData)  </B>
+ * 
+ * @brief Function returns the signature of the PFC state trajectory : 
+ * state, fault status, current reference and duty.
+ * @param Pointer to the data structure containing PFC related variables
+ * @return Signature
+ * @example
+ * <code>
+ * signature = PFC_TraceSignature(&pfcParam);
+ * </code>
+ */
+static uint16_t PFC_TraceSignature(PFC_T *pData)
+{
+    uint16_t signature = 0;
+    
+    signature = ADCTraceSignatureAdd(signature, pData->state);
+    signature = ADCTraceSignatureAdd(signature, pData->faultStatus);
+    signature = ADCTraceSignatureAdd(signature, pData->currentReference);
+    signature = ADCTraceSignatureAdd(signature, pData->duty);
+    
+    return signature;
+}
+#endif
+#ifdef PFC_KPI
+/**
+ * <B> Function: PFC_KPIUpdate(PFC_T *pData)  </B>
+ * 
+ * @brief Function to measure PFC KPIs while the control runs. Soft start 
+ * time is counted from the start of control until Vdc is within the 
+ * settling band of the final reference. Over each half line cycle, DC link 
+ * voltage ripple (peak to peak) and power factor are computed :
+ *      PF = mean(Vac*IL)/(Vac_rms*IL_rms)
+ * @param Pointer to the data structure containing PFC related variables
+ * @return none
+ * @example
+ * <code>
+ * PFC_KPIUpdate(&pfcParam);
+ * </code>
+ */
+static void PFC_KPIUpdate(PFC_T *pData)
+{
+    PFC_KPI_T *pKPI = &pData->kpi;
+    int16_t vdc = pData->pfcVoltage.vdc;
+    int16_t power, voltageRMS, currentRMS, apparentPower, band;
+    
+    if (pData->state != PFC_CTRL_RUN)
+    {
+        pKPI->runCount = 0;
+        pKPI->softStartTime = 0;
+        return;
+    }
+    
+    if (pKPI->runCount < UINT32_MAX)
+    {
+        pKPI->runCount++;
+    }
+    band = (int16_t)(__builtin_mulss(pData->vdcReference,
+                                        PFC_KPI_SETTLE_BAND) >> 15);
+    if ((pKPI->softStartTime == 0) && 
+        (pData->piVoltage.reference == pData->vdcReference) &&
+        (_Q15abs(pData->piVoltage.reference - pData->vdcAVG.output) <= band))
+    {
+        pKPI->softStartTime = pKPI->runCount;
+    }
+    
+    if (vdc > pKPI->vdcMax)
+    {
+        pKPI->vdcMax = vdc;
+    }
+    if (vdc < pKPI->vdcMin)
+    {
+        pKPI->vdcMin = vdc;
+    }
+    pKPI->powerSum += __builtin_mulss(pData->rectifiedVac, 
+                                        pData->averageCurrent) >> 15;
+    pKPI->voltageSqrSum += __builtin_mulss(pData->rectifiedVac, 
+                                        pData->rectifiedVac) >> 15;
+    pKPI->currentSqrSum += __builtin_mulss(pData->averageCurrent, 
+                                        pData->averageCurrent) >> 15;
+    pKPI->samples++;
+    
+    if (pKPI->samples >= PFC_RMS_SQUARE_COUNTMAX)
+    {
+        pKPI->vdcRipple = pKPI->vdcMax - pKPI->vdcMin;
+        if (pKPI->vdcRipple > pKPI->vdcRippleMax)
+        {
+            pKPI->vdcRippleMax = pKPI->vdcRipple;
+        }
+        
+        power = __builtin_divsd(pKPI->powerSum, pKPI->samples);
+        voltageRMS = _Q15sqrt(__builtin_divsd(pKPI->voltageSqrSum, 
+                                                        pKPI->samples));
+        currentRMS = _Q15sqrt(__builtin_divsd(pKPI->currentSqrSum, 
+                                                        pKPI->samples));
+        apparentPower = (int16_t)(__builtin_mulss(voltageRMS, currentRMS) >> 15);
+        if (power <= 0)
+        {
+            pKPI->powerFactor = 0;
+        }
+        else if (power < apparentPower)
+        {
+            pKPI->powerFactor = __builtin_divf(power, apparentPower);
+        }
+        else
+        {
+            pKPI->powerFactor = Q15(0.999);
+        }
+        
+        pKPI->powerSum = 0;
+        pKPI->voltageSqrSum = 0;
+        pKPI->currentSqrSum = 0;
+        pKPI->samples = 0;
+        pKPI->vdcMin = INT16_MAX;
+        pKPI->vdcMax = 0;
+    }
+}
+#endif
@@ -87,6 +87,44 @@ typedef struct
     uint16_t status;
 }PFC_RMS_SQUARE_T;
 
+/* Line synchronous moving average : window of one half line cycle, made of
+   block averages */
+typedef struct
+{
+    int32_t sum;
+    int32_t blockSum;
+    int16_t buffer[PFC_NOTCH_BUFFER_SIZE];
+    int16_t output;
+    uint16_t blockSamples;
+    uint16_t index;
+    uint16_t blocks;
+    uint16_t length;
+    uint16_t lineCount;
+    uint16_t linePeriod;
+    uint16_t polarity;
+    uint16_t status;
+}PFC_NOTCH_T;
+
+/* PFC KPIs : times in PFC ISR samples (32 bit, a 16 bit count saturates
+   after 1 s at the 64 kHz ISR rate), ripple in Vdc counts, power factor
+   in Q15 */
+typedef struct
+{
+    int32_t powerSum;
+    int32_t voltageSqrSum;
+    int32_t currentSqrSum;
+    uint16_t samples;
+    uint32_t runCount;
+    uint32_t softStartTime;
+    int16_t vdcMin;
+    int16_t vdcMax;
+    int16_t vdcRipple;
+    int16_t vdcRippleMax;
+    int16_t powerFactor;
+    uint16_t isrCycles;
+    uint16_t isrCyclesMax;
+}PFC_KPI_T;
+
 typedef enum
 {
     PFC_INIT = 0,
@@ -96,6 +134,21 @@ typedef enum
     PFC_FAULT = 4,       
 }PFC_CTRL_STATE_T;
 
+typedef enum
+{
+    PFC_LOAD_NORMAL = 0,        /* Continuous switching */
+    PFC_LOAD_BURST_OFF = 1,     /* Burst mode, switching stopped */
+    PFC_LOAD_STANDBY = 2,       /* Passive rectification */
+}PFC_LOAD_STATE_T;
+
+typedef struct
+{
+    PFC_LOAD_STATE_T state;
+    volatile uint16_t standbyRequest;
+    uint16_t standbyCount;
+    uint16_t burstCount;
+}PFC_LIGHT_LOAD_T;
+
 typedef enum
 {
     PFC_FAULT_NONE = 0,
@@ -112,12 +165,15 @@ typedef struct
     int16_t  rampRate;
     int16_t  voltLoopExeRate;
     volatile int16_t boostDutyRatio;
+    int16_t vdcInverse;
     volatile int16_t currentReference;
     uint16_t faultStatus;
     uint16_t sampleCorrectionEnable;
+    volatile int16_t vdcReference;
     PFC_AVG_T vdcAVG;
     PFC_AVG_T vacAVG;
     PFC_RMS_SQUARE_T vacRMS;
+    PFC_NOTCH_T vdcNotch;
     PFC_PI_T piVoltage;
     PFC_PI_T piCurrent;
     PFC_CTRL_STATE_T state;
@@ -126,12 +182,18 @@ typedef struct
     int16_t iL;
     int16_t rectifiedVac;
     int16_t outputVdc;
+    PFC_KPI_T kpi;
+    PFC_LIGHT_LOAD_T lightLoad;
 }PFC_T;
 
 // </editor-fold> 
 
 // <editor-fold defaultstate="collapsed" desc="INTERFACE FUNCTIONS ">
 void PFC_ServiceInit(void);
+bool PFC_IsFault(void);
+bool PFC_IsLineLoss(void);
+void PFC_VoltageDemandSet(int16_t);
+void PFC_StandbyRequest(bool);
 
 // </editor-fold>
 
@@ -66,6 +66,11 @@ extern "C" {
 // <editor-fold defaultstate="collapsed" desc="DEFINITIONS/MACROS ">    
 /** Calculate nominal value of PFC output voltage operating range*/  
 #define PFC_OUPUT_VOLTAGE_REFERENCE             Q15(NORM_VALUE(PFC_OUPUT_VOLTAGE_NOMINAL,PFC_VOLTAGE_BASE))
+/** Efficiency mode : output voltage reference limits, margins and hysteresis */
+#define PFC_ADAPTIVE_VDC_MIN_REFERENCE          Q15(NORM_VALUE(PFC_ADAPTIVE_VDC_MIN,PFC_VOLTAGE_BASE))
+#define PFC_ADAPTIVE_VDC_MARGIN_NORM            Q15(NORM_VALUE(PFC_ADAPTIVE_VDC_MARGIN,PFC_VOLTAGE_BASE))
+#define PFC_ADAPTIVE_VDC_BOOST_MARGIN_NORM      Q15(NORM_VALUE(PFC_ADAPTIVE_VDC_BOOST_MARGIN,PFC_VOLTAGE_BASE))
+#define PFC_ADAPTIVE_VDC_HYSTERESIS_NORM        Q15(NORM_VALUE(PFC_ADAPTIVE_VDC_HYSTERESIS,PFC_VOLTAGE_BASE))
  
 /** Normalized RMS square: Input under voltage lower limit in Vrms^2*/
 #define PFC_INPUT_UNDER_VOLTAGE_LO_RMS_SQUARE   NORM_RMS_SQUARE(PFC_INPUT_UNDER_VOLTAGE_LO,PFC_VOLTAGE_BASE)       
@@ -80,6 +85,25 @@ extern "C" {
 /**  Normalize PFC output under voltage with PFC full scale DC output voltage */
 #define PFC_OUTPUT_UNDER_VOLTAGE_NORMALIZED     NORM_VALUE(PFC_OUTPUT_UNDER_VOLTAGE,PFC_VOLTAGE_BASE)
     
+/** Half current ripple gain : Vbase*Ts/(2*L*Ibase), half ripple = 
+    gain*Vac*duty in current counts */
+#define PFC_RIPPLE_GAIN                         Q15(PFC_VOLTAGE_BASE*PFC_LOOPTIME_SEC/(2.0*PFC_BOOST_INDUCTANCE*PFC_INPUT_MAX_CURRENT))
+/** Size of 1/(1 - Vac/Vdc) look up table and its Q format */
+#define PFC_DCM_TABLE_SIZE                      32
+#define PFC_DCM_TABLE_QVALUE                    9
+/** Table index = (Vac/Vdc) >> PFC_DCM_TABLE_SHIFT */
+#define PFC_DCM_TABLE_SHIFT                     10
+
+/** Light load management : burst hysteresis and standby delay in PFC 
+    samples */
+#define PFC_BURST_HYSTERESIS_NORM               Q15(NORM_VALUE(PFC_BURST_HYSTERESIS,PFC_VOLTAGE_BASE))
+#define PFC_STANDBY_DELAY_COUNT                 (uint16_t)(PFC_STANDBY_DELAY*PFC_PWMFREQUENCY_HZ)
+
+/** Line period limits in PFC samples and zero crossing threshold */
+#define PFC_LINE_PERIOD_MIN                     (uint16_t)(PFC_PWMFREQUENCY_HZ/PFC_INPUT_FREQUENCY_MAX)
+#define PFC_LINE_PERIOD_MAX                     (uint16_t)(PFC_PWMFREQUENCY_HZ/PFC_INPUT_FREQUENCY_MIN)
+#define PFC_ZERO_CROSS_THRESHOLD                Q15(NORM_VALUE(PFC_ZERO_CROSS_HYSTERESIS,PFC_VOLTAGE_BASE))
+    
 /** Fault limits are converted to Q15 Representation and used by the firmware */
 #define PFC_OUTPUT_OVER_VOLTAGE_LIMIT           Q15(PFC_OUTPUT_OVER_VOLTAGE_NORMALIZED)
 #define PFC_INPUT_UNDER_VOLTAGE_LIMIT_LO        Q15(PFC_INPUT_UNDER_VOLTAGE_LO_RMS_SQUARE)  
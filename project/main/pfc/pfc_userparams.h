@@ -83,6 +83,12 @@
 /** When defined, operates in power reference control. 
    That is the voltage PI output correspond to the input power. */
 #define PFC_POWER_CONTROL   
+
+/** When defined, measures PFC KPIs : soft start time (until Vdc is within 
+   PFC_KPI_SETTLE_BAND of the final reference), DC link voltage ripple and 
+   power factor over each half line cycle, and ISR execution time. */
+#undef PFC_KPI
+#define PFC_KPI_SETTLE_BAND             Q15(0.02)
         
 /* Define PFC input AC voltage frequency in Hz */
 #define PFC_INPUT_FREQUENCY             50 
@@ -95,6 +101,23 @@
       The scaler is chosen as power of 2 ,such that shifting is done 
       to calculate average from the sum of samples.  */        
 #define PFC_AVG_SCALER                  7   //2^7 = 128 samples average 
+
+/** When defined, voltage loop feedback is the DC link voltage averaged over
+   one half line cycle. The moving average window tracks the line period 
+   measured between positive zero crossings of the input voltage, so that 
+   the twice line frequency ripple and its harmonics are notched and the 
+   voltage loop gains can be raised without distorting the input current. 
+   Window is made of blocks of 2^PFC_NOTCH_BLOCK_SCALER samples and holds up
+   to PFC_NOTCH_BUFFER_SIZE blocks (half line cycle at 
+   PFC_INPUT_FREQUENCY_MIN). */
+#undef ENABLE_PFC_VOLTAGE_NOTCH
+#define PFC_NOTCH_BLOCK_SCALER          4   //2^4 = 16 samples per block
+#define PFC_NOTCH_BUFFER_SIZE           48
+/* Input frequency range in Hz accepted by line period measurement */
+#define PFC_INPUT_FREQUENCY_MIN         45
+#define PFC_INPUT_FREQUENCY_MAX         65
+/* Input voltage zero crossing detection hysteresis in V */
+#define PFC_ZERO_CROSS_HYSTERESIS       20.0
         
 /* Counter for RMS calculation of rectified input AC voltage in terms of 
  * PWM clock period*/       
@@ -124,6 +147,19 @@
 		Therefore, maximum current or base current  = 22A */ 
 #define PFC_INPUT_MAX_CURRENT           22.0
                 
+/* Specify PFC boost inductance in H */
+#define PFC_BOOST_INDUCTANCE            0.0007
+
+/** When defined, inductor current sample is corrected in discontinuous 
+   conduction mode (DCM), detected every PWM cycle. Sample taken in the 
+   middle of the on time is the average current only in continuous 
+   conduction mode (CCM). In DCM average current = sample*(duty/ideal duty). 
+   Correction is fully applied when the sample is below half the current 
+   ripple estimated from Vac, duty and PFC_BOOST_INDUCTANCE and is blended 
+   out over 2^PFC_CCM_BLEND_SHIFT current counts above it. */
+#undef ENABLE_PFC_DCM_CORRECTION
+#define PFC_CCM_BLEND_SHIFT             8
+
 /* PFC Fault Limits - Input voltage,Input current and Output voltages */
         
 /* PFC Input over current limit in A (rms)*/
@@ -151,6 +187,20 @@
      
 /* Specify PFC output voltage reference in V */
 #define PFC_OUPUT_VOLTAGE_NOMINAL       380.0
+
+/** When defined, PFC output voltage reference follows the DC link voltage 
+   demand of the motors (efficiency mode), received from the Secondary core 
+   (requires ENABLE_CROSS_CORE_SUPERVISOR). Reference = demand + 
+   PFC_ADAPTIVE_VDC_MARGIN, limited between PFC_ADAPTIVE_VDC_MIN and 
+   PFC_OUPUT_VOLTAGE_NOMINAL and kept PFC_ADAPTIVE_VDC_BOOST_MARGIN above the
+   input voltage peak. Reference is raised at once, reduced only when it 
+   falls by more than PFC_ADAPTIVE_VDC_HYSTERESIS and changed at the soft 
+   start rate (RAMP_COUNT, RAMP_RATE). Voltages in V */
+#undef ENABLE_PFC_ADAPTIVE_VDC
+#define PFC_ADAPTIVE_VDC_MIN            340.0
+#define PFC_ADAPTIVE_VDC_MARGIN         20.0
+#define PFC_ADAPTIVE_VDC_BOOST_MARGIN   15.0
+#define PFC_ADAPTIVE_VDC_HYSTERESIS     10.0
         
 /* Specify Soft start ramp rate and ramp count .This is specified at the rate 
 of PFC control loop execution rate  */
@@ -162,6 +212,22 @@ of PFC control loop execution rate  */
  * This implements burst control at very low load.*/   
         
 #define PFC_MIN_CURRENTREF_PEAK_Q15     100        
+
+/** When defined, enables light load management of the PFC :
+   - Burst mode : switching is stopped when voltage control output is below 
+     PFC_BURST_POWER_Q15 and Vdc has reached the reference, and resumed when
+     Vdc falls PFC_BURST_HYSTERESIS (V) below the reference.
+   - Standby : switching is stopped and the converter operates as passive 
+     rectifier when the motors are idle (requested by the supervisory tasks,
+     requires ENABLE_CROSS_CORE_SUPERVISOR) and voltage control output is 
+     below PFC_STANDBY_POWER_Q15 for PFC_STANDBY_DELAY (s). Switching 
+     resumes with soft start from the actual Vdc as soon as the request is 
+     withdrawn (motor start). */
+#undef ENABLE_PFC_LIGHT_LOAD
+#define PFC_BURST_POWER_Q15             600
+#define PFC_BURST_HYSTERESIS            5.0
+#define PFC_STANDBY_POWER_Q15           1500
+#define PFC_STANDBY_DELAY               0.5
 /* Define Voltage loop execution rate . 
     * This is specified in integral number of PFC current control loop execution 
       rate. 
@@ -190,10 +256,19 @@ of PFC control loop execution rate  */
 #define KI_I_INTGRAL_OUT_MAX            Q15(PFC_MAX_DUTY_PU)
         
 /** Voltage  loop Coefficients */
+#ifdef ENABLE_PFC_VOLTAGE_NOTCH
+/* Twice line frequency ripple is removed from the feedback : bandwidth is 
+   doubled */
+#define KP_V                            Q15(0.8752)
+#define KI_V                            Q15(0.0110)  
+#define KP_V_SCALE                      3
+#define KI_V_SCALE                      0        
+#else
 #define KP_V                            Q15(0.8752)
 #define KI_V                            Q15(0.0055)  
 #define KP_V_SCALE                      2
 #define KI_V_SCALE                      0        
+#endif
 
 // </editor-fold>
         
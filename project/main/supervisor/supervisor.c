@@ -0,0 +1,422 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * supervisor.c
+ *
+ * This file includes the supervisory motor tasks and the outer motor control
+ * loops run by the Main core : speed potentiometer, target velocities and 
+ * run permissions, velocity reference ramps, speed and flux weakening 
+ * controllers of both motors. The Secondary core runs the current loops and
+ * applies the current references (ENABLE_CROSS_CORE_SUPERVISOR).
+ * 
+ * Component: SUPERVISOR
+ * 
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#ifdef __XC16__  // See comments at the top of this header file
+    #include <xc.h>
+#endif // __XC16__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "supervisor.h"
+#include "supervisor_params.h"
+#include "pfc.h"
+
+// </editor-fold> 
+
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLES ">
+
+SUPERVISOR_T supervisor;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+static void SupervisorMotorStep(SUPERVISOR_MOTOR_T *, uint16_t, int16_t, 
+                                                int16_t, int16_t, int16_t);
+static void SupervisorPIReset(SUPERVISOR_PI_T *, int16_t);
+static int16_t SupervisorPIUpdate(SUPERVISOR_PI_T *, int16_t);
+static int16_t SupervisorSat16(int32_t);
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: SupervisorInit()  </B>
+*
+* @brief Function initializes the supervisory motor tasks and the outer 
+*        loops of both motors. Motors are not permitted to run until the 
+*        first command is sent.
+*
+*/
+void SupervisorInit(void)
+{
+    SUPERVISOR_MOTOR_T *pMotor;
+    
+    supervisor.command.velocityRefMC1 = 0;
+    supervisor.command.iqRefMC1 = 0;
+    supervisor.command.idRefMC1 = 0;
+    supervisor.command.velocityRefMC2 = 0;
+    supervisor.command.iqRefMC2 = 0;
+    supervisor.command.idRefMC2 = 0;
+    supervisor.command.flags = 0;
+    supervisor.exchangeCount = 0;
+    supervisor.commandMissed = 0;
+    supervisor.feedbackAge = MSI_FEEDBACK_TIMEOUT;
+    supervisor.potFilt = 0;
+    supervisor.potFiltStateVar = 0;
+    
+    pMotor = &supervisor.mc1;
+    pMotor->qMinSpeed = SUPERVISOR_NORM_VALUE(MC1_MINIMUM_SPEED_RPM, 
+                                                        MC1_PEAK_SPEED_RPM);
+    pMotor->qMaxSpeed = SUPERVISOR_NORM_VALUE(MC1_MAXIMUM_SPEED_RPM, 
+                                                        MC1_PEAK_SPEED_RPM);
+    pMotor->qNominalSpeed = SUPERVISOR_NORM_VALUE(MC1_NOMINAL_SPEED_RPM, 
+                                                        MC1_PEAK_SPEED_RPM);
+    pMotor->speedRampStep = MC1_SPEED_RAMP_STEP;
+    pMotor->piSpeed.kp = MC1_SPEEDCNTR_PTERM;
+    pMotor->piSpeed.ki = MC1_SPEEDCNTR_ITERM;
+    pMotor->piSpeed.kc = SUPERVISOR_Q15(0.9999);
+    pMotor->piSpeed.nkp = MC1_SPEEDCNTR_PTERM_SCALE;
+    pMotor->piSpeed.nki = MC1_SPEEDCNTR_ITERM_SCALE;
+    pMotor->piSpeed.outMax = MC1_SPEEDCNTR_OUTMAX;
+    pMotor->piSpeed.outMin = -MC1_SPEEDCNTR_OUTMAX;
+    pMotor->piFluxWeakening.kp = MC1_FD_WEAK_PI_KP;
+    pMotor->piFluxWeakening.ki = MC1_FD_WEAK_PI_KI;
+    pMotor->piFluxWeakening.kc = SUPERVISOR_Q15(0.9999);
+    pMotor->piFluxWeakening.nkp = MC1_FD_WEAK_PI_KPSCALE;
+    pMotor->piFluxWeakening.nki = 0;
+    pMotor->piFluxWeakening.outMax = 0;
+    pMotor->piFluxWeakening.outMin = MC1_ID_REF_MIN;
+    
+    pMotor = &supervisor.mc2;
+    pMotor->qMinSpeed = SUPERVISOR_NORM_VALUE(MC2_MINIMUM_SPEED_RPM, 
+                                                        MC2_PEAK_SPEED_RPM);
+    pMotor->qMaxSpeed = SUPERVISOR_NORM_VALUE(MC2_MAXIMUM_SPEED_RPM, 
+                                                        MC2_PEAK_SPEED_RPM);
+    pMotor->qNominalSpeed = SUPERVISOR_NORM_VALUE(MC2_NOMINAL_SPEED_RPM, 
+                                                        MC2_PEAK_SPEED_RPM);
+    pMotor->speedRampStep = MC2_SPEED_RAMP_STEP;
+    pMotor->piSpeed.kp = MC2_SPEEDCNTR_PTERM;
+    pMotor->piSpeed.ki = MC2_SPEEDCNTR_ITERM;
+    pMotor->piSpeed.kc = SUPERVISOR_Q15(0.9999);
+    pMotor->piSpeed.nkp = MC2_SPEEDCNTR_PTERM_SCALE;
+    pMotor->piSpeed.nki = MC2_SPEEDCNTR_ITERM_SCALE;
+    pMotor->piSpeed.outMax = MC2_SPEEDCNTR_OUTMAX;
+    pMotor->piSpeed.outMin = -MC2_SPEEDCNTR_OUTMAX;
+    pMotor->piFluxWeakening.kp = MC2_FD_WEAK_PI_KP;
+    pMotor->piFluxWeakening.ki = MC2_FD_WEAK_PI_KI;
+    pMotor->piFluxWeakening.kc = SUPERVISOR_Q15(0.9999);
+    pMotor->piFluxWeakening.nkp = MC2_FD_WEAK_PI_KPSCALE;
+    pMotor->piFluxWeakening.nki = 0;
+    pMotor->piFluxWeakening.outMax = 0;
+    pMotor->piFluxWeakening.outMin = MC2_ID_REF_MIN;
+    
+    supervisor.mc1.flags = 0;
+    supervisor.mc2.flags = 0;
+}
+
+/**
+* <B> Function: SupervisorStepIsr()  </B>
+*
+* @brief Function executes the supervisory motor tasks every 
+*        MSI_EXCHANGE_PERIOD : reads the Secondary core feedback and, on a 
+*        new feedback, filters the speed potentiometer, generates the target
+*        velocities and executes the outer loops of both motors. It then 
+*        sends the references and run permissions. Run permissions are 
+*        withdrawn on PFC fault, except on mains loss which the motors ride
+*        through. A command is counted as missed when the Secondary core has
+*        not read the previous one; references of a motor are marked invalid
+*        when the feedback is lost.
+*        In efficiency mode the voltage demand of the motors is passed to the
+*        PFC; the nominal DC link voltage is requested when the feedback is
+*        lost. PFC standby is requested while both motors are idle without
+*        run command, and withdrawn on a run command or feedback loss.
+*
+*/
+void SupervisorStepIsr(void)
+{
+    MSI_COMMAND_T *pCommand = &supervisor.command;
+    const MSI_FEEDBACK_T *pFeedback = &supervisor.feedback;
+    int32_t potValueNormalized;
+    uint16_t status;
+    
+    supervisor.exchangeCount++;
+    if (supervisor.exchangeCount < MSI_EXCHANGE_PERIOD)
+    {
+        return;
+    }
+    supervisor.exchangeCount = 0;
+    
+    if (HAL_MSIFeedbackRead(&supervisor.feedback))
+    {
+        supervisor.potFiltStateVar += __builtin_mulss(
+            (pFeedback->potentiometer - supervisor.potFilt), POT_FILTER_COEF);
+        supervisor.potFilt = (int16_t)(supervisor.potFiltStateVar >> 15);
+        supervisor.feedbackAge = 0;
+        
+        potValueNormalized = __builtin_mulss(supervisor.potFilt, 
+                                                        POT_NOM_FACTOR) >> 14;
+        status = pFeedback->status;
+        SupervisorMotorStep(&supervisor.mc1, status & MSI_FLAGS_MASK, 
+                pFeedback->velocityMC1, pFeedback->iqRefMC1, 
+                pFeedback->voltageErrorMC1, 
+                SupervisorSat16(potValueNormalized));
+        SupervisorMotorStep(&supervisor.mc2, 
+                (status >> MSI_FLAGS_SHIFT_MC2) & MSI_FLAGS_MASK,
+                pFeedback->velocityMC2, pFeedback->iqRefMC2, 
+                pFeedback->voltageErrorMC2, MC2_TARGET_VELOCITY);
+    }
+    else if (supervisor.feedbackAge < MSI_FEEDBACK_TIMEOUT)
+    {
+        supervisor.feedbackAge++;
+    }
+    if (supervisor.feedbackAge >= MSI_FEEDBACK_TIMEOUT)
+    {
+        supervisor.mc1.flags = 0;
+        supervisor.mc2.flags = 0;
+    }
+#ifdef ENABLE_PFC_ADAPTIVE_VDC
+    if (supervisor.feedbackAge < MSI_FEEDBACK_TIMEOUT)
+    {
+        PFC_VoltageDemandSet(pFeedback->voltageDemand);
+    }
+    else
+    {
+        PFC_VoltageDemandSet(INT16_MAX);
+    }
+#endif
+#ifdef ENABLE_PFC_LIGHT_LOAD
+    status = pFeedback->status & 
+        ((MSI_RUN_CMD | MSI_IDLE) | ((MSI_RUN_CMD | MSI_IDLE) << MSI_FLAGS_SHIFT_MC2));
+    PFC_StandbyRequest((supervisor.feedbackAge < MSI_FEEDBACK_TIMEOUT) &&
+                        (status == (MSI_IDLE | (MSI_IDLE << MSI_FLAGS_SHIFT_MC2))));
+#endif
+    
+    pCommand->velocityRefMC1 = supervisor.mc1.qVelRef;
+    pCommand->iqRefMC1 = supervisor.mc1.qIqRef;
+    pCommand->idRefMC1 = supervisor.mc1.qIdRef;
+    pCommand->velocityRefMC2 = supervisor.mc2.qVelRef;
+    pCommand->iqRefMC2 = supervisor.mc2.qIqRef;
+    pCommand->idRefMC2 = supervisor.mc2.qIdRef;
+    pCommand->flags = supervisor.mc1.flags | 
+                            (supervisor.mc2.flags << MSI_FLAGS_SHIFT_MC2);
+    if (!(PFC_IsFault() && !PFC_IsLineLoss()))
+    {
+        pCommand->flags |= MSI_RUN_PERMIT | 
+                                (MSI_RUN_PERMIT << MSI_FLAGS_SHIFT_MC2);
+    }
+    if (!HAL_MSICommandWrite(pCommand))
+    {
+        supervisor.commandMissed++;
+    }
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: SupervisorMotorStep(SUPERVISOR_MOTOR_T *, uint16_t, int16_t,
+*                                   int16_t, int16_t, int16_t)  </B>
+*
+* @brief Function executes the outer loops of a motor on its feedback. 
+*        While the speed loop of the Secondary core is active the velocity 
+*        reference ramps to the target and the speed controller computes the
+*        q axis current reference. When the speed loop (re)starts (new 
+*        epoch) the ramp restarts from the estimated velocity and the 
+*        controller from the q axis current reference of the Secondary 
+*        core, so that the transfer is bumpless; otherwise the velocity 
+*        reference follows the estimated velocity. In closed loop, above 
+*        half the nominal speed, the flux weakening controller computes the
+*        d axis current reference from the voltage error.
+*
+* @param Pointer to the outer loops of the motor.
+* @param Status flags and epoch of the motor.
+* @param Estimated velocity.
+* @param q axis current reference less the load torque feedforward.
+* @param Flux weakening voltage error.
+* @param Target velocity (potentiometer scale).
+* @return none.
+*
+*/
+static void SupervisorMotorStep(SUPERVISOR_MOTOR_T *pMotor, uint16_t status,
+        int16_t velocity, int16_t iqRef, int16_t voltageError, int16_t target)
+{
+    const uint16_t epoch = status & MSI_EPOCH_MASK;
+    int32_t targetRef;
+    
+    pMotor->qTargetVelocity = pMotor->qMinSpeed + (int16_t)(__builtin_mulss(
+                    (pMotor->qMaxSpeed - pMotor->qMinSpeed), target) >> 15);
+    
+    if ((status & MSI_SPEED_LOOP_ACTIVE) == 0)
+    {
+        pMotor->velocityRef = (int32_t)velocity << 16;
+        pMotor->flags = 0;
+    }
+    else
+    {
+        if (((pMotor->flags & MSI_SPEED_LOOP) == 0) || 
+            ((pMotor->flags & MSI_EPOCH_MASK) != epoch))
+        {
+            pMotor->velocityRef = (int32_t)velocity << 16;
+            SupervisorPIReset(&pMotor->piSpeed, iqRef);
+        }
+        
+        targetRef = (int32_t)pMotor->qTargetVelocity << 16;
+        if (pMotor->velocityRef < (targetRef - pMotor->speedRampStep))
+        {
+            pMotor->velocityRef += pMotor->speedRampStep;
+        }
+        else if (pMotor->velocityRef > (targetRef + pMotor->speedRampStep))
+        {
+            pMotor->velocityRef -= pMotor->speedRampStep;
+        }
+        else
+        {
+            pMotor->velocityRef = targetRef;
+        }
+        
+        pMotor->qIqRef = SupervisorPIUpdate(&pMotor->piSpeed, SupervisorSat16(
+                (int32_t)(int16_t)(pMotor->velocityRef >> 16) - velocity));
+        pMotor->flags = MSI_SPEED_LOOP | epoch;
+    }
+    pMotor->qVelRef = (int16_t)(pMotor->velocityRef >> 16);
+    
+    if (status & MSI_CLOSE_LOOP)
+    {
+        if (pMotor->qVelRef > (pMotor->qNominalSpeed >> 1))
+        {
+            pMotor->qIdRef = SupervisorPIUpdate(&pMotor->piFluxWeakening, 
+                                                            voltageError);
+        }
+        else
+        {
+            pMotor->qIdRef = 0;
+            SupervisorPIReset(&pMotor->piFluxWeakening, 0);
+        }
+        pMotor->flags |= MSI_FLUX_WEAKENING;
+    }
+    else
+    {
+        pMotor->qIdRef = 0;
+        SupervisorPIReset(&pMotor->piFluxWeakening, 0);
+    }
+}
+
+/**
+* <B> Function: SupervisorPIReset(SUPERVISOR_PI_T *, int16_t)  </B>
+*
+* @brief Function sets the integrator of a PI controller to an output.
+*
+*/
+static void SupervisorPIReset(SUPERVISOR_PI_T *pPI, int16_t value)
+{
+    pPI->integrator = (int32_t)value << 16;
+}
+
+/**
+* <B> Function: SupervisorPIUpdate(SUPERVISOR_PI_T *, int16_t)  </B>
+*
+* @brief Function executes a PI controller with anti windup, as 
+*        MCAPP_ControllerPIUpdate() of the Secondary core (sat_pi.c) without 
+*        saturation state. Integer arithmetic : the DSP accumulators are 
+*        not used in the TIMER1 ISR, PFC_PIController() (pfc_pi.s) called 
+*        from the PFC ISR does not save them.
+*
+* @param Pointer to the PI controller.
+* @param Error (reference - measurement).
+* @return Output, limited.
+*
+*/
+static int16_t SupervisorPIUpdate(SUPERVISOR_PI_T *pPI, int16_t error)
+{
+    int64_t sum;
+    int16_t out, outSat;
+    
+    /* Proportional term and integrator, output in the upper word */
+    sum = (((int64_t)error * pPI->kp) << (1 + pPI->nkp)) + pPI->integrator;
+    out = SupervisorSat16((int32_t)((sum + 0x8000) >> 16));
+    outSat = out;
+    if (outSat > pPI->outMax)
+    {
+        outSat = pPI->outMax;
+    }
+    else if (outSat < pPI->outMin)
+    {
+        outSat = pPI->outMin;
+    }
+    
+    /* Integral term less the excess over the limits */
+    sum = pPI->integrator + (((int64_t)error * pPI->ki) << (1 + pPI->nki)) -
+            (((int64_t)((int32_t)out - outSat) * pPI->kc) << 1);
+    if (sum > INT32_MAX)
+    {
+        sum = INT32_MAX;
+    }
+    else if (sum < INT32_MIN)
+    {
+        sum = INT32_MIN;
+    }
+    pPI->integrator = (int32_t)sum;
+    return outSat;
+}
+
+static int16_t SupervisorSat16(int32_t value)
+{
+    if (value > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+    else if (value < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+    return (int16_t)value;
+}
+
+// </editor-fold>
+
+#endif
@@ -0,0 +1,136 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file supervisor.h
+ *
+ * @brief This header file lists the data types and interface functions of 
+ * the supervisory motor tasks and outer motor control loops run by the Main
+ * core (ENABLE_CROSS_CORE_SUPERVISOR of msi_protocol.h).
+ *
+ * Component: SUPERVISOR
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+#ifndef __SUPERVISOR_H
+#define __SUPERVISOR_H
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "msi.h"
+
+// </editor-fold> 
+
+#ifdef __cplusplus  // Provide C++ Compatability
+    extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
+
+/* PI controller of the outer loops : gains, limits and integrator as in 
+   MCAPP_PISTATE_T of the Secondary core (sat_pi.h) */
+typedef struct
+{
+    int32_t
+        integrator;             /* Integrator sum, output in the upper word */
+    int16_t
+        kp,                     /* Proportional gain */
+        ki,                     /* Integral gain */
+        kc,                     /* Anti windup gain */
+        nkp,                    /* Proportional gain scale (left shift) */
+        nki,                    /* Integral gain scale (left shift) */
+        outMax,                 /* Maximum output */
+        outMin;                 /* Minimum output */
+}SUPERVISOR_PI_T;
+
+/* Outer loops of a motor */
+typedef struct
+{
+    int32_t
+        velocityRef,            /* Velocity reference, Q16 of qVelRef */
+        speedRampStep;          /* Velocity reference ramp step, Q16 */
+    int16_t
+        qTargetVelocity,        /* Target velocity */
+        qVelRef,                /* Velocity reference */
+        qIqRef,                 /* q axis current reference */
+        qIdRef,                 /* d axis current reference (flux 
+                                   weakening) */
+        qMinSpeed,              /* Minimum target velocity */
+        qMaxSpeed,              /* Maximum target velocity */
+        qNominalSpeed;          /* Flux weakening above half nominal speed */
+    uint16_t
+        flags;                  /* Command flags and epoch of the motor */
+    SUPERVISOR_PI_T
+        piSpeed,                /* Speed controller */
+        piFluxWeakening;        /* Flux weakening controller */
+}SUPERVISOR_MOTOR_T;
+
+typedef struct
+{
+    MSI_COMMAND_T
+        command;                /* Last command sent */
+    MSI_FEEDBACK_T
+        feedback;               /* Last feedback received */
+    uint16_t
+        exchangeCount,          /* TIMER1 periods since the last exchange */
+        commandMissed,          /* Commands not read by the Secondary core */
+        feedbackAge;            /* Exchange periods since the last feedback */
+    int16_t
+        potFilt;                /* Filtered potentiometer */
+    int32_t
+        potFiltStateVar;        /* Potentiometer filter state */
+    SUPERVISOR_MOTOR_T
+        mc1,                    /* Outer loops of motor 1 */
+        mc2;                    /* Outer loops of motor 2 */
+}SUPERVISOR_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="INTERFACE FUNCTIONS ">
+
+void SupervisorInit(void);
+void SupervisorStepIsr(void);
+
+// </editor-fold> 
+
+#ifdef __cplusplus  // Provide C++ Compatibility
+    }
+#endif
+#endif      // end of __SUPERVISOR_H
@@ -0,0 +1,152 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file supervisor_params.h
+ *
+ * @brief This file has the parameters of the outer motor control loops run 
+ * by the Main core (ENABLE_CROSS_CORE_SUPERVISOR) : velocity reference ramps,
+ * speed controllers and flux weakening controllers of both motors.
+ * 
+ * Velocities and currents are exchanged in the scaling of the Secondary 
+ * core : the motor and board parameters below must be those of 
+ * mc1_user_params.h and mc2_user_params.h.
+ *
+ * Component: SUPERVISOR
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+#ifndef __SUPERVISOR_PARAMS_H
+#define __SUPERVISOR_PARAMS_H
+
+#ifdef __cplusplus  // Provide C++ Compatability
+    extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include "msi.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS/MACROS ">
+
+/* Fixed point conversion of the Secondary core (FIXEDPT() of general.h) */
+#define SUPERVISOR_Q15(x)           ((int16_t)((x) * 32768.0 + 0.5))
+/* Normalized value of the Secondary core (NORM_VALUE() of general.h) */
+#define SUPERVISOR_NORM_VALUE(actual, base) \
+                            SUPERVISOR_Q15((float)(actual) / (float)(base))
+
+/* Outer loops are executed every MSI_EXCHANGE_PERIOD TIMER1 periods, on 
+   each new feedback of the Secondary core */
+#define SUPERVISOR_SAMPLE_TIME_SEC  (MSI_EXCHANGE_PERIOD * 100.0e-6)
+/* Control period of the Secondary core (LOOPTIME_SEC of its pwm.h), used to
+   convert the gains and ramp rates of mcx_user_params.h */
+#define SUPERVISOR_SECONDARY_LOOPTIME_SEC   0.0000625
+
+/* Potentiometer filter and normalization to the target velocity */
+#define POT_FILTER_COEF             10000
+#define POT_NOM_FACTOR              23900
+/* MC2 target velocity, potentiometer scale */
+#define MC2_TARGET_VELOCITY         600
+
+/** Motor 1 : board and motor parameters of mc1_user_params.h */
+#define MC1_PEAK_CURRENT            22
+#define MC1_NOMINAL_CURRENT_PEAK    (float)(3 * 1.414)
+#define MC1_NOMINAL_SPEED_RPM       3000
+#define MC1_MAXIMUM_SPEED_RPM       5000
+#define MC1_MINIMUM_SPEED_RPM       500
+#define MC1_PEAK_SPEED_RPM          (2.5 * MC1_NOMINAL_SPEED_RPM)
+
+/* Velocity reference ramp : SPEED_RAMP_RATE_COUNT counts every 
+   RAMP_UP_TIME_MULTIPLIER control periods of the Secondary core, counts per
+   sample in Q16 */
+#define MC1_SPEED_RAMP_STEP         (int32_t)(1.0 / (20 * \
+        SUPERVISOR_SECONDARY_LOOPTIME_SEC) * SUPERVISOR_SAMPLE_TIME_SEC * 65536.0)
+
+/* Speed controller : SPEEDCNTR_xxx, integral gain scaled from the control 
+   period of the Secondary core to the sample time */
+#define MC1_SPEEDCNTR_PTERM         SUPERVISOR_Q15(0.401)
+#define MC1_SPEEDCNTR_PTERM_SCALE   1
+#define MC1_SPEEDCNTR_ITERM         SUPERVISOR_Q15(0.00022 * \
+        SUPERVISOR_SAMPLE_TIME_SEC / SUPERVISOR_SECONDARY_LOOPTIME_SEC)
+#define MC1_SPEEDCNTR_ITERM_SCALE   0
+#define MC1_SPEEDCNTR_OUTMAX        SUPERVISOR_NORM_VALUE( \
+                                    MC1_NOMINAL_CURRENT_PEAK, MC1_PEAK_CURRENT)
+
+/* Flux weakening controller : FD_WEAK_PI_xxx and ID_REF_MIN */
+#define MC1_FD_WEAK_PI_KP           305
+#define MC1_FD_WEAK_PI_KPSCALE      1
+#define MC1_FD_WEAK_PI_KI           (int16_t)(2 * \
+        SUPERVISOR_SAMPLE_TIME_SEC / SUPERVISOR_SECONDARY_LOOPTIME_SEC + 0.5)
+#define MC1_ID_REF_MIN              SUPERVISOR_NORM_VALUE( \
+                            (-MC1_NOMINAL_CURRENT_PEAK * 0.8), MC1_PEAK_CURRENT)
+
+/** Motor 2 : board and motor parameters of mc2_user_params.h */
+#define MC2_PEAK_CURRENT            22
+#define MC2_NOMINAL_CURRENT_PEAK    (float)(3 * 1.414)
+#define MC2_NOMINAL_SPEED_RPM       3000
+#define MC2_MAXIMUM_SPEED_RPM       5000
+#define MC2_MINIMUM_SPEED_RPM       500
+#define MC2_PEAK_SPEED_RPM          (2.5 * MC2_NOMINAL_SPEED_RPM)
+
+#define MC2_SPEED_RAMP_STEP         (int32_t)(1.0 / (20 * \
+        SUPERVISOR_SECONDARY_LOOPTIME_SEC) * SUPERVISOR_SAMPLE_TIME_SEC * 65536.0)
+
+#define MC2_SPEEDCNTR_PTERM         SUPERVISOR_Q15(0.401)
+#define MC2_SPEEDCNTR_PTERM_SCALE   1
+#define MC2_SPEEDCNTR_ITERM         SUPERVISOR_Q15(0.00022 * \
+        SUPERVISOR_SAMPLE_TIME_SEC / SUPERVISOR_SECONDARY_LOOPTIME_SEC)
+#define MC2_SPEEDCNTR_ITERM_SCALE   0
+#define MC2_SPEEDCNTR_OUTMAX        SUPERVISOR_NORM_VALUE( \
+                                    MC2_NOMINAL_CURRENT_PEAK, MC2_PEAK_CURRENT)
+
+#define MC2_FD_WEAK_PI_KP           305
+#define MC2_FD_WEAK_PI_KPSCALE      1
+#define MC2_FD_WEAK_PI_KI           (int16_t)(2 * \
+        SUPERVISOR_SAMPLE_TIME_SEC / SUPERVISOR_SECONDARY_LOOPTIME_SEC + 0.5)
+#define MC2_ID_REF_MIN              SUPERVISOR_NORM_VALUE( \
+                            (-MC2_NOMINAL_CURRENT_PEAK * 0.8), MC2_PEAK_CURRENT)
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatibility
+    }
+#endif
+#endif      // end of __SUPERVISOR_PARAMS_H
@@ -71,6 +71,7 @@ typedef enum
 {
     MCAPP_FAULT_NONE = 0,             
     MCAPP_OVERCURRENT_FAULT = 1,      
+    MCAPP_ADC_FAULT = 2,
 
 } MCAPP_FAULT_STATE_T;
    
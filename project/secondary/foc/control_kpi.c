@@ -0,0 +1,323 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file control_kpi.c
+ *
+ * @brief This module measures performance indicators of the speed control :
+ * time to closed loop, speed step response, RMS control errors and ISR
+ * execution time.
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <libq.h>
+#include "control_kpi.h"
+#include "foc_types.h"
+#include "general.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+static void MCAPP_ControlKPIStep(MCAPP_CONTROL_KPI_T *);
+static void MCAPP_ControlKPIStepResponse(MCAPP_CONTROL_KPI_T *);
+static void MCAPP_ControlKPIRms(MCAPP_CONTROL_KPI_T *);
+static uint16_t MCAPP_ControlKPIError(int16_t, int16_t);
+static int16_t MCAPP_ControlKPISqrt(uint32_t);
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_ControlKPIInit(MCAPP_CONTROL_KPI_T *) </B>
+*
+* @brief Function to reset variables used for control KPI measurement.
+*
+* @param Pointer to the data structure containing control KPI parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_ControlKPIInit(&kpi); </CODE>
+*
+*/
+void MCAPP_ControlKPIInit(MCAPP_CONTROL_KPI_T *pKPI)
+{
+    pKPI->focStatePrev = FOC_INIT;
+    pKPI->speedStart = 0;
+    pKPI->speedTarget = 0;
+    pKPI->overshootPeak = 0;
+    pKPI->overshoot = 0;
+    pKPI->closeLoopAngleError = 0;
+    pKPI->speedErrorRms = 0;
+    pKPI->currentErrorRms = 0;
+    pKPI->startCount = 0;
+    pKPI->closeLoopTime = 0;
+    pKPI->stepCount = 0;
+    pKPI->settleTime = 0;
+    pKPI->rmsCount = 0;
+    pKPI->speedErrorSum = 0;
+    pKPI->currentErrorSum = 0;
+}
+
+/**
+* <B> Function: MCAPP_ControlKPI(MCAPP_CONTROL_KPI_T *) </B>
+*
+* @brief Function measures the control KPIs, executed every control sample
+*        after the FOC state machine :
+*        - samples from start (rotor lock) to closed loop and the angle error
+*          between open loop and estimator angle at closed loop entry,
+*        - response to closed loop entry and to target speed steps : overshoot
+*          and samples until the speed enters the settling band for good,
+*        - RMS speed error (at constant speed reference) and RMS q axis
+*          current error.
+*
+* @param Pointer to the data structure containing control KPI parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_ControlKPI(&kpi); </CODE>
+*
+*/
+void MCAPP_ControlKPI(MCAPP_CONTROL_KPI_T *pKPI)
+{
+    const int16_t focState = *pKPI->pFocState;
+
+    if (pKPI->enable == 0)
+    {
+        return;
+    }
+
+    if ((focState == FOC_RTR_LOCK) || (focState == FOC_OPEN_LOOP))
+    {
+        if (pKPI->focStatePrev == FOC_INIT)
+        {
+            pKPI->startCount = 0;
+        }
+        if (pKPI->startCount < 0xFFFF)
+        {
+            pKPI->startCount++;
+        }
+    }
+    else if (focState == FOC_CLOSE_LOOP)
+    {
+        if (pKPI->focStatePrev != FOC_CLOSE_LOOP)
+        {
+            /* Closed loop entry is measured as a step from present speed */
+            pKPI->closeLoopTime = pKPI->startCount;
+            pKPI->closeLoopAngleError = *pKPI->pThetaOffset;
+            pKPI->speedStart = *pKPI->pVelEstim;
+            MCAPP_ControlKPIStep(pKPI);
+        }
+        else if (_Q15abs(UTIL_SatShrS16((int32_t)pKPI->pCtrlParam->
+                qTargetVelocity - pKPI->speedTarget, 0)) >= pKPI->stepMin)
+        {
+            pKPI->speedStart = pKPI->speedTarget;
+            MCAPP_ControlKPIStep(pKPI);
+        }
+        MCAPP_ControlKPIStepResponse(pKPI);
+        MCAPP_ControlKPIRms(pKPI);
+    }
+    pKPI->focStatePrev = focState;
+}
+
+// </editor-fold>
+
+/**
+* <B> Function: MCAPP_ControlKPIStep(MCAPP_CONTROL_KPI_T *) </B>
+*
+* @brief Function starts the step response measurement.
+*
+* @param Pointer to the data structure containing control KPI parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_ControlKPIStep(&kpi); </CODE>
+*
+*/
+static void MCAPP_ControlKPIStep(MCAPP_CONTROL_KPI_T *pKPI)
+{
+    pKPI->speedTarget = pKPI->pCtrlParam->qTargetVelocity;
+    pKPI->overshootPeak = 0;
+    pKPI->overshoot = 0;
+    pKPI->stepCount = 0;
+    pKPI->settleTime = 0;
+}
+
+/**
+* <B> Function: MCAPP_ControlKPIStepResponse(MCAPP_CONTROL_KPI_T *) </B>
+*
+* @brief Function updates overshoot and settling time of the step response.
+*
+* @param Pointer to the data structure containing control KPI parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_ControlKPIStepResponse(&kpi); </CODE>
+*
+*/
+static void MCAPP_ControlKPIStepResponse(MCAPP_CONTROL_KPI_T *pKPI)
+{
+    int16_t step, error, band;
+
+    if (pKPI->stepCount < 0xFFFF)
+    {
+        pKPI->stepCount++;
+    }
+    step = _Q15abs(UTIL_SatShrS16(
+                    (int32_t)pKPI->speedTarget - pKPI->speedStart, 0));
+    error = UTIL_SatShrS16((int32_t)*pKPI->pVelEstim - pKPI->speedTarget, 0);
+    if (pKPI->speedTarget < pKPI->speedStart)
+    {
+        error = -error;
+    }
+
+    if (error > pKPI->overshootPeak)
+    {
+        pKPI->overshootPeak = error;
+        if (error < step)
+        {
+            pKPI->overshoot = __builtin_divf(error, step);
+        }
+        else
+        {
+            pKPI->overshoot = 0x7FFF;
+        }
+    }
+
+    band = (int16_t)(__builtin_mulss(step, pKPI->settleBand) >> 15);
+    if (_Q15abs(error) > band)
+    {
+        pKPI->settleTime = pKPI->stepCount;
+    }
+}
+
+/**
+* <B> Function: MCAPP_ControlKPIRms(MCAPP_CONTROL_KPI_T *) </B>
+*
+* @brief Function computes RMS speed error, accumulated while the speed
+*        reference is constant, and RMS q axis current error. Errors are
+*        limited to CONTROL_KPI_ERROR_MAX so that the sums do not overflow.
+*
+* @param Pointer to the data structure containing control KPI parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_ControlKPIRms(&kpi); </CODE>
+*
+*/
+static void MCAPP_ControlKPIRms(MCAPP_CONTROL_KPI_T *pKPI)
+{
+    const MCAPP_CONTROL_T *pCtrlParam = pKPI->pCtrlParam;
+    uint16_t error;
+
+    if (pCtrlParam->qVelRef != pCtrlParam->qTargetVelocity)
+    {
+        return;
+    }
+
+    error = MCAPP_ControlKPIError(*pKPI->pVelEstim, pCtrlParam->qVelRef);
+    pKPI->speedErrorSum += __builtin_muluu(error, error);
+    error = MCAPP_ControlKPIError(pCtrlParam->qIqRef, *pKPI->pIq);
+    pKPI->currentErrorSum += __builtin_muluu(error, error);
+
+    pKPI->rmsCount++;
+    if (pKPI->rmsCount >= (1 << CONTROL_KPI_RMS_SHIFT))
+    {
+        pKPI->speedErrorRms = MCAPP_ControlKPISqrt(
+                            pKPI->speedErrorSum >> CONTROL_KPI_RMS_SHIFT);
+        pKPI->currentErrorRms = MCAPP_ControlKPISqrt(
+                            pKPI->currentErrorSum >> CONTROL_KPI_RMS_SHIFT);
+        pKPI->speedErrorSum = 0;
+        pKPI->currentErrorSum = 0;
+        pKPI->rmsCount = 0;
+    }
+}
+
+/**
+* <B> Function: MCAPP_ControlKPIError(int16_t, int16_t) </B>
+*
+* @brief Function returns the magnitude of the difference of two values
+*        limited to CONTROL_KPI_ERROR_MAX.
+*
+* @param Reference.
+* @param Measured value.
+* @return Error magnitude.
+* @example
+* <CODE> error = MCAPP_ControlKPIError(qIqRef, iq); </CODE>
+*
+*/
+static uint16_t MCAPP_ControlKPIError(int16_t reference, int16_t measured)
+{
+    int32_t error = (int32_t)reference - measured;
+
+    if (error < 0)
+    {
+        error = -error;
+    }
+    if (error > CONTROL_KPI_ERROR_MAX)
+    {
+        error = CONTROL_KPI_ERROR_MAX;
+    }
+    return (uint16_t)error;
+}
+
+/**
+* <B> Function: MCAPP_ControlKPISqrt(uint32_t) </B>
+*
+* @brief Function returns the integer square root of a 32 bit value.
+*
+* @param Value.
+* @return Square root.
+* @example
+* <CODE> rms = MCAPP_ControlKPISqrt(sum >> CONTROL_KPI_RMS_SHIFT); </CODE>
+*
+*/
+static int16_t MCAPP_ControlKPISqrt(uint32_t value)
+{
+    uint16_t root = 0, bit;
+
+    for (bit = 0x8000; bit > 0; bit >>= 1)
+    {
+        root |= bit;
+        if (__builtin_muluu(root, root) > value)
+        {
+            root &= ~bit;
+        }
+    }
+    return (int16_t)root;
+}
@@ -0,0 +1,193 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file control_kpi.h
+ *
+ * @brief This module measures performance indicators of the speed control :
+ * time to closed loop, speed step response, RMS control errors and ISR
+ * execution time.
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+#ifndef CONTROL_KPI_H
+#define	CONTROL_KPI_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include "foc_control_types.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS/MACROS ">
+
+/* RMS errors are computed over 2^CONTROL_KPI_RMS_SHIFT samples, errors are
+   limited to CONTROL_KPI_ERROR_MAX */
+#define CONTROL_KPI_RMS_SHIFT       10
+#define CONTROL_KPI_ERROR_MAX       2047
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
+
+typedef struct
+{
+    int16_t
+        enable,             /* Control KPI enable */
+        stepMin,            /* Minimum target speed change detected as step */
+        settleBand,         /* Settling band as a fraction of the step (Q15) */
+        focStatePrev,       /* FOC state of the previous sample */
+        speedStart,         /* Speed at the start of the step */
+        speedTarget,        /* Target speed of the step */
+        overshootPeak,      /* Peak speed beyond the target */
+        overshoot,          /* Overshoot as a fraction of the step (Q15) */
+        closeLoopAngleError,/* Estimator angle error at closed loop entry */
+        speedErrorRms,      /* RMS speed error at constant reference */
+        currentErrorRms;    /* RMS q axis current error */
+
+    uint16_t
+        startCount,         /* Samples since start */
+        closeLoopTime,      /* Samples from start to closed loop */
+        stepCount,          /* Samples since the step */
+        settleTime,         /* Samples from step to final entry in band */
+        rmsCount,           /* Samples accumulated for RMS errors */
+        isrCycles,          /* ISR execution time in instruction cycles */
+        isrCyclesMax,       /* Maximum ISR execution time */
+        isrLatency,         /* ADC trigger to ISR entry in PWM clock periods */
+        isrLatencyMin,      /* Minimum ISR latency */
+        isrLatencyMax,      /* Maximum ISR latency */
+        isrJitter;          /* ISR start jitter : isrLatencyMax-isrLatencyMin */
+
+    uint32_t
+        speedErrorSum,      /* Sum of squared speed errors */
+        currentErrorSum;    /* Sum of squared current errors */
+
+    const MCAPP_CONTROL_T *pCtrlParam;
+    const int16_t *pFocState;
+    const int16_t *pVelEstim;
+    const int16_t *pIq;
+    const int16_t *pThetaOffset;
+
+} MCAPP_CONTROL_KPI_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+void MCAPP_ControlKPIInit(MCAPP_CONTROL_KPI_T *);
+void MCAPP_ControlKPI(MCAPP_CONTROL_KPI_T *);
+
+/**
+* <B> Function: MCAPP_ControlKPIIsrTime(MCAPP_CONTROL_KPI_T *, uint16_t,
+*                                       uint16_t, uint16_t, uint16_t) </B>
+*
+* @brief Function updates the ISR execution time from timer counts read at
+*        ISR entry and exit.
+*
+* @param Pointer to the data structure containing control KPI parameters.
+* @param Timer count at ISR entry.
+* @param Timer count at ISR exit.
+* @param Timer period count.
+* @param Timer prescaler (instruction cycles per count).
+* @return none.
+* @example
+* <CODE> MCAPP_ControlKPIIsrTime(&kpi, start, TMR1, PR1, 8); </CODE>
+*
+*/
+inline static void MCAPP_ControlKPIIsrTime(MCAPP_CONTROL_KPI_T *pKPI,
+            uint16_t start, uint16_t end, uint16_t period, uint16_t prescaler)
+{
+    if (pKPI->enable)
+    {
+        if (end < start)
+        {
+            end += period + 1;
+        }
+        pKPI->isrCycles = (end - start) * prescaler;
+        if (pKPI->isrCycles > pKPI->isrCyclesMax)
+        {
+            pKPI->isrCyclesMax = pKPI->isrCycles;
+        }
+    }
+}
+
+/**
+* <B> Function: MCAPP_ControlKPIIsrLatency(MCAPP_CONTROL_KPI_T *, uint16_t) </B>
+*
+* @brief Function updates the ISR latency from ADC trigger to ISR entry and
+*        the ISR start jitter (spread of the latency).
+*
+* @param Pointer to the data structure containing control KPI parameters.
+* @param Latency measured at ISR entry.
+* @return none.
+* @example
+* <CODE> MCAPP_ControlKPIIsrLatency(&kpi, latency); </CODE>
+*
+*/
+inline static void MCAPP_ControlKPIIsrLatency(MCAPP_CONTROL_KPI_T *pKPI,
+                                                        uint16_t latency)
+{
+    if (pKPI->enable)
+    {
+        pKPI->isrLatency = latency;
+        if (latency < pKPI->isrLatencyMin)
+        {
+            pKPI->isrLatencyMin = latency;
+        }
+        if (latency > pKPI->isrLatencyMax)
+        {
+            pKPI->isrLatencyMax = latency;
+        }
+        pKPI->isrJitter = pKPI->isrLatencyMax - pKPI->isrLatencyMin;
+    }
+}
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* CONTROL_KPI_H */
@@ -0,0 +1,226 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file deadtime_comp.c
+ *
+ * @brief This module implements inverter dead time and device voltage drop
+ * compensation of the PWM duty cycles.
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include "deadtime_comp.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS/MACROS ">
+
+#define Q15_ONE_BY_3        10923 /* 1/3 */
+#define Q15_ONE_BY_SQRT_3   18919 /* 1/sqrt(3) */
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+static int16_t MCAPP_DeadTimeCurrentSign(const MCAPP_DEADTIME_COMP_T *, int16_t);
+static int16_t MCAPP_DeadTimeDutyUpdate(const MCAPP_DEADTIME_COMP_T *,
+                                                    uint16_t *, int16_t);
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_DeadTimeCompensationInit(MCAPP_DEADTIME_COMP_T *) </B>
+*
+* @brief Function to reset variables used for dead time compensation.
+*
+* @param Pointer to the data structure containing dead time compensation
+*        parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_DeadTimeCompensationInit(&deadTimeComp); </CODE>
+*
+*/
+void MCAPP_DeadTimeCompensationInit(MCAPP_DEADTIME_COMP_T *pDTComp)
+{
+    pDTComp->errorCounts = 0;
+    pDTComp->valphabeta.alpha = 0;
+    pDTComp->valphabeta.beta = 0;
+}
+
+/**
+* <B> Function: MCAPP_DeadTimeCompensation(MCAPP_DEADTIME_COMP_T *, uint16_t,
+*                                               MC_DUTYCYCLEOUT_T *) </B>
+*
+* @brief Function compensates the duty cycles for the voltage error caused by
+*        inverter dead time and device voltage drop.
+*        Voltage error of each phase is opposite to the phase current polarity.
+*        A smooth polarity function (linear within a current band around zero)
+*        avoids chattering of the correction at current zero crossings.
+*        Phase voltage actually applied (commanded voltage + applied
+*        correction - voltage error) is computed for the estimator.
+*
+* @param Pointer to the data structure containing dead time compensation
+*        parameters.
+* @param PWM period.
+* @param Pointer to the duty cycles, updated with the compensation.
+* @return none.
+* @example
+* <CODE> MCAPP_DeadTimeCompensation(&deadTimeComp, period, &duty); </CODE>
+*
+*/
+void MCAPP_DeadTimeCompensation(MCAPP_DEADTIME_COMP_T *pDTComp,
+                            uint16_t period, MC_DUTYCYCLEOUT_T *pDuty)
+{
+    const int16_t vdc = *pDTComp->pVdc;
+    int16_t errorNorm, deviationAlpha, deviationBeta;
+
+    /* Voltage error normalized to Vdc : dead time and device voltage drop */
+    errorNorm = pDTComp->errorDuty;
+    if (vdc > pDTComp->deviceDrop)
+    {
+        errorNorm += __builtin_divf(pDTComp->deviceDrop, vdc);
+    }
+    pDTComp->errorCounts = (int16_t)(__builtin_muluu(period, errorNorm) >> 15);
+
+    pDTComp->currentSign.a = MCAPP_DeadTimeCurrentSign(pDTComp, pDTComp->pIabc->a);
+    pDTComp->currentSign.b = MCAPP_DeadTimeCurrentSign(pDTComp, pDTComp->pIabc->b);
+    pDTComp->currentSign.c = MCAPP_DeadTimeCurrentSign(pDTComp, pDTComp->pIabc->c);
+
+    pDTComp->dutyDeviation.a = MCAPP_DeadTimeDutyUpdate(pDTComp,
+                            &pDuty->dutycycle1, pDTComp->currentSign.a);
+    pDTComp->dutyDeviation.b = MCAPP_DeadTimeDutyUpdate(pDTComp,
+                            &pDuty->dutycycle2, pDTComp->currentSign.b);
+    pDTComp->dutyDeviation.c = MCAPP_DeadTimeDutyUpdate(pDTComp,
+                            &pDuty->dutycycle3, pDTComp->currentSign.c);
+
+    /* Clarke transform of the deviation : alpha = (2a-b-c)/3,
+       beta = (b-c)/sqrt(3) , normalized to Vdc */
+    deviationAlpha = (int16_t)(__builtin_mulss(((pDTComp->dutyDeviation.a << 1) -
+                        pDTComp->dutyDeviation.b - pDTComp->dutyDeviation.c),
+                        Q15_ONE_BY_3) >> 15);
+    deviationBeta = (int16_t)(__builtin_mulss((pDTComp->dutyDeviation.b -
+                        pDTComp->dutyDeviation.c), Q15_ONE_BY_SQRT_3) >> 15);
+    deviationAlpha = __builtin_divsd(((int32_t)deviationAlpha << 15), period);
+    deviationBeta = __builtin_divsd(((int32_t)deviationBeta << 15), period);
+
+    /* Scale to control base voltage : deviation*Vdc*(PEAK_VOLTAGE/BASE_VOLTAGE) */
+    deviationAlpha = (int16_t)(__builtin_mulss(deviationAlpha, vdc) >> 15);
+    deviationBeta = (int16_t)(__builtin_mulss(deviationBeta, vdc) >> 15);
+    deviationAlpha = (int16_t)(__builtin_mulss(deviationAlpha, pDTComp->vdcGain) >> 14);
+    deviationBeta = (int16_t)(__builtin_mulss(deviationBeta, pDTComp->vdcGain) >> 14);
+
+    pDTComp->valphabeta.alpha = pDTComp->pVAlphaBeta->alpha + deviationAlpha;
+    pDTComp->valphabeta.beta = pDTComp->pVAlphaBeta->beta + deviationBeta;
+}
+
+// </editor-fold>
+
+/**
+* <B> Function: MCAPP_DeadTimeCurrentSign(const MCAPP_DEADTIME_COMP_T *,
+*                                                           int16_t) </B>
+*
+* @brief Function computes the smooth polarity of a phase current :
+*        current*signGain saturated to +/-1.
+*
+* @param Pointer to the data structure containing dead time compensation
+*        parameters.
+* @param Phase current.
+* @return Smooth polarity (Q15).
+* @example
+* <CODE> sign = MCAPP_DeadTimeCurrentSign(&deadTimeComp, ia); </CODE>
+*
+*/
+static int16_t MCAPP_DeadTimeCurrentSign(const MCAPP_DEADTIME_COMP_T *pDTComp,
+                                                            int16_t current)
+{
+    int32_t sign = __builtin_mulss(current, pDTComp->signGain) >>
+                                                    pDTComp->signGainScale;
+    if (sign > 32767)
+    {
+        sign = 32767;
+    }
+    else if (sign < -32767)
+    {
+        sign = -32767;
+    }
+    return (int16_t)sign;
+}
+
+/**
+* <B> Function: MCAPP_DeadTimeDutyUpdate(const MCAPP_DEADTIME_COMP_T *,
+*                                               uint16_t *, int16_t) </B>
+*
+* @brief Function adds the compensation to a duty cycle and returns the
+*        deviation of the applied voltage from the commanded voltage.
+*
+* @param Pointer to the data structure containing dead time compensation
+*        parameters.
+* @param Pointer to the duty cycle.
+* @param Smooth polarity of the phase current.
+* @return Applied correction - voltage error in PWM counts.
+* @example
+* <CODE> dev = MCAPP_DeadTimeDutyUpdate(&deadTimeComp, &duty1, sign); </CODE>
+*
+*/
+static int16_t MCAPP_DeadTimeDutyUpdate(const MCAPP_DEADTIME_COMP_T *pDTComp,
+                                uint16_t *pDutyCycle, int16_t currentSign)
+{
+    int16_t error, duty;
+
+    error = (int16_t)(__builtin_mulss(currentSign, pDTComp->errorCounts) >> 15);
+
+    duty = (int16_t)(*pDutyCycle) + error;
+    if (duty < (int16_t)pDTComp->dutyMin)
+    {
+        duty = (int16_t)pDTComp->dutyMin;
+    }
+    else if (duty > (int16_t)pDTComp->dutyMax)
+    {
+        duty = (int16_t)pDTComp->dutyMax;
+    }
+    error = duty - (int16_t)(*pDutyCycle) - error;
+    *pDutyCycle = (uint16_t)duty;
+
+    return error;
+}
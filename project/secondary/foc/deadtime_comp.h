@@ -0,0 +1,107 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file deadtime_comp.h
+ *
+ * @brief This module implements inverter dead time and device voltage drop
+ * compensation of the PWM duty cycles.
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+#ifndef DEADTIME_COMP_H
+#define	DEADTIME_COMP_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include "motor_control.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
+
+typedef struct
+{
+    int16_t
+        enable,             /* Dead time compensation enable */
+        errorDuty,          /* Dead time voltage error : error time/PWM period */
+        deviceDrop,         /* Device voltage drop */
+        signGain,           /* Gain of smooth current polarity function */
+        signGainScale,      /* Scale of signGain */
+        vdcGain,            /* Vdc to control base voltage ratio (Q14) */
+        errorCounts;        /* Voltage error in PWM counts */
+
+    uint16_t
+        dutyMin,            /* Minimum duty count */
+        dutyMax;            /* Maximum duty count */
+
+    MC_ABC_T
+        currentSign,        /* Smooth polarity of phase currents */
+        dutyDeviation;      /* Applied voltage - commanded voltage in counts */
+
+    MC_ALPHABETA_T
+        valphabeta;         /* Corrected Voltage_alphaBeta for estimator */
+
+    const MC_ABC_T *pIabc;
+    const MC_ALPHABETA_T *pVAlphaBeta;
+    const int16_t *pVdc;
+
+} MCAPP_DEADTIME_COMP_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+void MCAPP_DeadTimeCompensationInit(MCAPP_DEADTIME_COMP_T *);
+void MCAPP_DeadTimeCompensation(MCAPP_DEADTIME_COMP_T *, uint16_t,
+                                                    MC_DUTYCYCLEOUT_T *);
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* DEADTIME_COMP_H */
@@ -56,19 +56,37 @@
 
 #include "id_ref.h"
 #include "estim_pll.h"
+#include "overmodulation.h"
+#include "deadtime_comp.h"
 #include "port_config.h" 
 #include "mc1_calc_params.h"
 // </editor-fold>
 
 // <editor-fold defaultstate="collapsed" desc="Definitions ">
 #define Q14_SQRT_3  28377 /* sqrt(3)  */
+
+/* Outer loops of the Main core replace the local velocity reference and 
+   speed controller : options that act on them are not supported */
+#if defined(ENABLE_CROSS_CORE_SUPERVISOR) && \
+    (defined(ENABLE_SPEED_TRAJECTORY) || \
+     defined(ENABLE_MECHANICAL_IDENTIFICATION) || \
+     defined(ENABLE_INERTIA_ESTIMATION) || \
+     defined(ENABLE_SPEED_GAIN_SCHEDULING))
+#error "ENABLE_CROSS_CORE_SUPERVISOR : speed trajectory, mechanical identification, inertia estimation and speed gain scheduling need the local speed loop"
+#endif
 // </editor-fold>
 
 // <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
 
 static void MCAPP_FOCFeedbackPath(MCAPP_FOC_T *);
 static void MCAPP_FOCForwardPath(MCAPP_FOC_T *);
-static void MCAPP_SpeedReferenceRamp(MCAPP_CONTROL_T *);
+static void MCAPP_FOCDecouplingFeedforward(MCAPP_FOC_T *);
+static void MCAPP_SpeedControl(MCAPP_FOC_T *);
+static void MCAPP_SpeedControlResume(MCAPP_FOC_T *);
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+static void MCAPP_SpeedControlRemote(MCAPP_FOC_T *);
+#endif
+static void MCAPP_SpeedReferenceRamp(MCAPP_CONTROL_T *, int16_t);
 static void MCAPP_CalculateModulationSiganl(MC_ABC_T *, MC_ABC_T *);
 static void MCAPP_DCLinkVoltageCompensation(MC_ABC_T *, MC_ABC_T *, int16_t* );
 
@@ -100,6 +118,15 @@ void MCAPP_FOCInit(MCAPP_FOC_T *pFOC)
     
     MCAPP_FluxWeakeningControlInit(&pFOC->fluxControl);
     MCAPP_EstimatorPLLInit(&pFOC->estimPLL); 
+    MCAPP_OvermodulationInit(&pFOC->overmod);
+    MCAPP_DeadTimeCompensationInit(&pFOC->deadTimeComp);
+    MCAPP_MechIdInit(pFOC->pMechId);
+    MCAPP_LoadObserverInit(pFOC->pLoadObserver);
+    MCAPP_ControlKPIInit(pFOC->pKpi);
+    MCAPP_SingleShuntInit(&pFOC->singleShunt);
+    MCAPP_SpeedTrajectoryInit(&pFOC->speedTraj);
+    MCAPP_VdcLimitInit(&pFOC->vdcLimit);
+    MCAPP_RideThroughInit(&pFOC->rideThrough);
     
     pCtrlParam->lockTime = 0;
     pCtrlParam->speedRampSkipCnt = 0;
@@ -109,6 +136,10 @@ void MCAPP_FOCInit(MCAPP_FOC_T *pFOC)
     pCtrlParam->qIdRef = 0;
     pCtrlParam->qIqRef = 0;
     
+    pFOC->estimInterface.qVelEstim = 0;
+    pFOC->decoupling.vdFF = 0;
+    pFOC->decoupling.vqFF = 0;
+    
     pFOC->faultStatus = 0;
     
     pFOC->pPWMDuty->dutycycle3 = 0;
@@ -131,6 +162,7 @@ void MCAPP_FOCInit(MCAPP_FOC_T *pFOC)
 void MCAPP_FOCStateMachine(MCAPP_FOC_T *pFOC)
 {
     MCAPP_CONTROL_T *pCtrlParam = &pFOC->ctrlParam;
+    MCAPP_LOAD_OBSERVER_T *pLoadObserver = pFOC->pLoadObserver;
 
     switch (pFOC->focState)
     {
@@ -195,7 +227,23 @@ void MCAPP_FOCStateMachine(MCAPP_FOC_T *pFOC)
                 /* Reset speed PI controller */
                 MCAPP_ControllerPIReset(&pFOC->piSpeed, pFOC->idq.q);                 
                 pCtrlParam->speedRampSkipCnt = 0;          
+                MCAPP_SpeedTrajectoryReset(&pFOC->speedTraj, pCtrlParam->qVelRef);
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+                pFOC->outerLoop.epoch++;
+#endif
                 pFOC->focState = FOC_CLOSE_LOOP;
+                /* The open loop current controller outputs already contain 
+                   the BEMF voltage : hand them over less the feedforward 
+                   voltages, which are added from this cycle on */
+                pFOC->estimInterface.qVelEstim = pFOC->estimPLL.qOmegaFilt;
+                if (pFOC->decoupling.enable)
+                {
+                    MCAPP_FOCDecouplingFeedforward(pFOC);
+                    MCAPP_ControllerPIReset(&pFOC->piDCurrent, UTIL_SatShrS16(
+                        (int32_t)pFOC->vdq.d - pFOC->decoupling.vdFF, 0));
+                    MCAPP_ControllerPIReset(&pFOC->piQCurrent, UTIL_SatShrS16(
+                        (int32_t)pFOC->vdq.q - pFOC->decoupling.vqFF, 0));
+                }
             }
             MCAPP_EstimatorPLL(&pFOC->estimPLL);
             /* Calculate open loop theta */
@@ -238,15 +286,35 @@ void MCAPP_FOCStateMachine(MCAPP_FOC_T *pFOC)
             pFOC->estimInterface.qTheta  = pFOC->estimPLL.qTheta + pFOC->estimInterface.qThetaOffset ;                                   
             pFOC->estimInterface.qVelEstim = pFOC->estimPLL.qOmegaFilt ;
 			
-            MCAPP_SpeedReferenceRamp(pCtrlParam);
-
-            /* Execute Outer Speed Loop - Iq Reference Generation */
-            MCAPP_ControllerPIUpdate(pCtrlParam->qVelRef, pFOC->estimInterface.qVelEstim, 
-            &pFOC->piSpeed, MCAPP_SAT_NONE, &pCtrlParam->qIqRef,
-            pCtrlParam->qVelRef);
+            /* Mains loss ride through : DC link voltage controller 
+               overrides the speed controller */
+            MCAPP_RideThrough(&pFOC->rideThrough);
+            if (pFOC->rideThrough.state == RIDE_THROUGH_ACTIVE)
+            {
+                pCtrlParam->qIqRef = UTIL_LimitS16(pFOC->rideThrough.iqRef,
+                            -pLoadObserver->iqLimit, pLoadObserver->iqLimit);
+            }
+            else
+            {
+                if (pFOC->rideThrough.state == RIDE_THROUGH_EXIT)
+                {
+                    MCAPP_SpeedControlResume(pFOC);
+                }
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+                MCAPP_SpeedControlRemote(pFOC);
+#else
+                MCAPP_SpeedControl(pFOC);
+#endif
+            }
             
             /* Id Reference generation- Flux Weakening  */
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+            MCAPP_FluxWeakeningControlRemote(&pFOC->fluxControl, 
+                    (pFOC->outerLoop.flags & MSI_FLUX_WEAKENING) ? 
+                                            pFOC->outerLoop.qIdRef : 0);
+#else
             MCAPP_FluxWeakeningControl(&pFOC->fluxControl);
+#endif
             pCtrlParam->qIdRef = pFOC->fluxControl.feedBackFW.IdRef;
  
             MCAPP_FOCForwardPath(pFOC);
@@ -261,6 +329,8 @@ void MCAPP_FOCStateMachine(MCAPP_FOC_T *pFOC)
             break;
 
     } /* End Of switch - case */
+    
+    MCAPP_ControlKPI(pFOC->pKpi);
 }
 
 /**
@@ -276,9 +346,21 @@ void MCAPP_FOCStateMachine(MCAPP_FOC_T *pFOC)
 */
 static void MCAPP_FOCFeedbackPath(MCAPP_FOC_T *pFOC)
 {
-    pFOC->iabc.a = *(pFOC->pIa);
-    pFOC->iabc.b = *(pFOC->pIb);
-    pFOC->iabc.c = -pFOC->iabc.a - pFOC->iabc.b;
+    if (pFOC->singleShunt.enable)
+    {
+        MCAPP_SingleShuntReconstruct(&pFOC->singleShunt);
+    }
+    
+    if (pFOC->singleShunt.feedback)
+    {
+        pFOC->iabc = pFOC->singleShunt.iabc;
+    }
+    else
+    {
+        pFOC->iabc.a = *(pFOC->pIa);
+        pFOC->iabc.b = *(pFOC->pIb);
+        pFOC->iabc.c = -pFOC->iabc.a - pFOC->iabc.b;
+    }
     
     /* Perform Clark & Park transforms to generate d axis and q axis currents */
     MC_TransformClarke_Assembly(&pFOC->iabc, &pFOC->ialphabeta);
@@ -301,29 +383,50 @@ static void MCAPP_FOCFeedbackPath(MCAPP_FOC_T *pFOC)
 
 static void MCAPP_FOCForwardPath(MCAPP_FOC_T *pFOC)
 {
-    int16_t vqSquaredLimit, vdSquared, vPhaseMax, vMaxSquare;
+    int16_t vqSquaredLimit, vdSquared, vPhaseMax, vMaxSquare, vqMax;
+    MCAPP_DECOUPLING_T *pDecoupling = &pFOC->decoupling;
     
+    /* Calculate dq decoupling and BEMF feedforward voltages */
+    MCAPP_FOCDecouplingFeedforward(pFOC);
+    
+    /* Voltage limit based on available DC link voltage; PI output limits 
+       are offset by the feedforward voltages so that the total voltage 
+       (PI output + feedforward) is saturated by the circular limit */
+    vPhaseMax = (int16_t)(__builtin_mulss(pFOC->vMaxFactor, (*pFOC->pVdc))>>15);
+    pDecoupling->vdFF = UTIL_LimitS16(pDecoupling->vdFF, -vPhaseMax, vPhaseMax);
+    pFOC->piDCurrent.outMax = 
+            UTIL_SatShrS16((int32_t)vPhaseMax - pDecoupling->vdFF, 0);
+    pFOC->piDCurrent.outMin = 
+            UTIL_SatShrS16(-(int32_t)vPhaseMax - pDecoupling->vdFF, 0);
+
     /** Execute inner current control loops */
-    /* Execute PI Control of Q axis. */
+    /* Execute PI Control of D axis. */
     MCAPP_ControllerPIUpdate(pFOC->ctrlParam.qIdRef,  pFOC->idq.d, 
             &pFOC->piDCurrent, MCAPP_SAT_NONE, &pFOC->vdq.d,
             pFOC->ctrlParam.qIdRef);
+    pFOC->vdq.d = UTIL_LimitS16(
+            UTIL_SatShrS16((int32_t)pFOC->vdq.d + pDecoupling->vdFF, 0),
+            -vPhaseMax, vPhaseMax);
 
     /* Generate Q axis current reference based on available voltage and D axis
        voltage */
-    vPhaseMax = (int16_t)(__builtin_mulss(VMAX_FACTOR, (*pFOC->pVdc))>>15);
     vMaxSquare = (int16_t)(__builtin_mulss(vPhaseMax, vPhaseMax)>>15);
     vdSquared  = (int16_t)(__builtin_mulss(pFOC->vdq.d, pFOC->vdq.d)>>15);
     vqSquaredLimit = vMaxSquare - vdSquared;  
-    pFOC->piDCurrent.outMax = vPhaseMax;
-    pFOC->piDCurrent.outMin = -vPhaseMax; 
-    pFOC->piQCurrent.outMax = _Q15sqrt(vqSquaredLimit);
-    pFOC->piQCurrent.outMin = -(pFOC->piQCurrent.outMax); 
+    vqMax = _Q15sqrt(vqSquaredLimit);
+    pDecoupling->vqFF = UTIL_LimitS16(pDecoupling->vqFF, -vqMax, vqMax);
+    pFOC->piQCurrent.outMax = 
+            UTIL_SatShrS16((int32_t)vqMax - pDecoupling->vqFF, 0);
+    pFOC->piQCurrent.outMin = 
+            UTIL_SatShrS16(-(int32_t)vqMax - pDecoupling->vqFF, 0);
     
     /* Execute PI Control of Q axis. */ 
     MCAPP_ControllerPIUpdate(pFOC->ctrlParam.qIqRef,  pFOC->idq.q, 
             &pFOC->piQCurrent, MCAPP_SAT_NONE, &pFOC->vdq.q,
             pFOC->ctrlParam.qIqRef);
+    pFOC->vdq.q = UTIL_LimitS16(
+            UTIL_SatShrS16((int32_t)pFOC->vdq.q + pDecoupling->vqFF, 0),
+            -vqMax, vqMax);
     
     /* Calculate sin and cos of theta (angle) */
     MC_CalculateSineCosine_Assembly_Ram(pFOC->estimInterface.qTheta, 
@@ -339,24 +442,239 @@ static void MCAPP_FOCForwardPath(MCAPP_FOC_T *pFOC)
     /* DC Link voltage compensation */
     MCAPP_DCLinkVoltageCompensation(&pFOC->vabc, &pFOC->vabcCompDC, pFOC->pVdc);
     
-    /* Calculate modulation signal input for MC_CalculateSpaceVector_Assembly */
-    MCAPP_CalculateModulationSiganl(&pFOC->vabcCompDC, &pFOC->vabcScaled);
+    /* Generate PWM duty cycles by overmodulation when the voltage reference
+       exceeds the linear range of space vector modulation */
+    if (MCAPP_Overmodulation(&pFOC->overmod, &pFOC->vabcCompDC, 
+                                pFOC->pwmPeriod, pFOC->pPWMDuty) == 0)
+    {
+        /* Calculate modulation signal input for MC_CalculateSpaceVector_Assembly */
+        MCAPP_CalculateModulationSiganl(&pFOC->vabcCompDC, &pFOC->vabcScaled);
+
+        /* Execute space vector modulation and generate PWM duty cycles */
+        MC_CalculateSpaceVector_Assembly(&pFOC->vabcScaled, pFOC->pwmPeriod,
+                                                        pFOC->pPWMDuty);
+    }
+
+    /* Dead time compensation of duty cycles and estimator voltage */
+    if (pFOC->deadTimeComp.enable)
+    {
+        MCAPP_DeadTimeCompensation(&pFOC->deadTimeComp, pFOC->pwmPeriod,
+                                                        pFOC->pPWMDuty);
+    }
+
+    /* Edge shift of duty cycles and bus current sample of the next period */
+    if (pFOC->singleShunt.enable)
+    {
+        MCAPP_SingleShuntDutyShift(&pFOC->singleShunt, pFOC->pwmPeriod,
+                                                        pFOC->pPWMDuty);
+    }
+}
+
+
+
+/**
+* <B> Function: void MCAPP_FOCDecouplingFeedforward(MCAPP_FOC_T *)  </B>
+*
+* @brief Calculates dq cross coupling decoupling and BEMF feedforward 
+*        voltages from estimated speed and current references:
+*        vdFF = -omega*Lq*iq , vqFF = omega*Ld*id + omega*psi.
+*
+* @param Pointer to the data structure containing FOC parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_FOCDecouplingFeedforward(&mc); </CODE>
+*
+*/
+static void MCAPP_FOCDecouplingFeedforward(MCAPP_FOC_T *pFOC)
+{
+    MCAPP_DECOUPLING_T *pDecoupling = &pFOC->decoupling;
+    const int16_t omega = pFOC->estimInterface.qVelEstim;
+    int16_t omegaXd, omegaXq;
+
+    if ((pDecoupling->enable == 0) || (pFOC->focState != FOC_CLOSE_LOOP))
+    {
+        pDecoupling->vdFF = 0;
+        pDecoupling->vqFF = 0;
+    }
+    else
+    {
+        omegaXd = (int16_t)(__builtin_mulss(omega, pDecoupling->xd) 
+                                                    >> pDecoupling->xScale);
+        omegaXq = (int16_t)(__builtin_mulss(omega, pDecoupling->xq) 
+                                                    >> pDecoupling->xScale);
+
+        pDecoupling->vdFF = -(int16_t)(__builtin_mulss(omegaXq, 
+                                        pFOC->ctrlParam.qIqRef) >> 15);
+        pDecoupling->vqFF = UTIL_SatShrS16(
+                    (__builtin_mulss(omegaXd, pFOC->ctrlParam.qIdRef) >> 15) +
+                    (__builtin_mulss(omega, pDecoupling->kfi) 
+                                            >> pDecoupling->kfiScale), 0);
+    }
+}
+
+/**
+* <B> Function: void MCAPP_SpeedControl(MCAPP_FOC_T *)  </B>
+*
+* @brief Function generates the velocity reference and executes the speed 
+*        controller, which computes the q axis current reference.
+*
+* @param Pointer to the data structure containing FOC parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_SpeedControl(&foc); </CODE>
+*
+*/
+static void MCAPP_SpeedControl(MCAPP_FOC_T *pFOC)
+{
+    MCAPP_CONTROL_T *pCtrlParam = &pFOC->ctrlParam;
+    MCAPP_LOAD_OBSERVER_T *pLoadObserver = pFOC->pLoadObserver;
+    MCAPP_VDC_LIMIT_T *pVdcLimit = &pFOC->vdcLimit;
+    int16_t qTargetVelocity;
+
+    /* Mechanical identification overrides speed target */
+    MCAPP_MechanicalIdentification(pFOC->pMechId);
+    
+    /* DC link overvoltage control holds the deceleration */
+    MCAPP_VdcLimit(pVdcLimit);
+    qTargetVelocity = MCAPP_VdcLimitTarget(pVdcLimit, 
+                    pCtrlParam->qVelRef, pCtrlParam->qTargetVelocity);
+    if (pFOC->speedTraj.enable)
+    {
+        MCAPP_SpeedTrajectory(&pFOC->speedTraj, qTargetVelocity);
+        pCtrlParam->qVelRef = pFOC->speedTraj.qVelRef;
+    }
+    else
+    {
+        MCAPP_SpeedReferenceRamp(pCtrlParam, qTargetVelocity);
+    }
+
+    /* Load torque feedforward; speed controller output limits are
+       offset so that the total reference (PI output + feedforward)
+       is limited */
+    MCAPP_LoadObserver(pLoadObserver, 
+                        pCtrlParam->qIqRef - pLoadObserver->iqFF);
+    pFOC->piSpeed.outMax = UTIL_SatShrS16(
+            (int32_t)pLoadObserver->iqLimit - pLoadObserver->iqFF, 0);
+    pFOC->piSpeed.outMin = UTIL_SatShrS16(
+            -(int32_t)pLoadObserver->iqLimit - pLoadObserver->iqFF, 0);
+    
+    /* Regenerative current (opposite to the velocity) is limited
+       by the DC link overvoltage control */
+    if (pVdcLimit->regenLimit < pLoadObserver->iqLimit)
+    {
+        if (pFOC->estimInterface.qVelEstim >= 0)
+        {
+            pFOC->piSpeed.outMin = UTIL_SatShrS16(
+                -(int32_t)pVdcLimit->regenLimit - pLoadObserver->iqFF, 0);
+        }
+        else
+        {
+            pFOC->piSpeed.outMax = UTIL_SatShrS16(
+                (int32_t)pVdcLimit->regenLimit - pLoadObserver->iqFF, 0);
+        }
+    }
 
-    /* Execute space vector modulation and generate PWM duty cycles */
-    MC_CalculateSpaceVector_Assembly(&pFOC->vabcScaled, pFOC->pwmPeriod,
-                                                    pFOC->pPWMDuty);
+    /* Execute Outer Speed Loop - Iq Reference Generation */
+    MCAPP_ControllerPIUpdate(pCtrlParam->qVelRef, pFOC->estimInterface.qVelEstim, 
+                &pFOC->piSpeed, MCAPP_SAT_NONE, &pCtrlParam->qIqRef,
+                pCtrlParam->qVelRef);
+    pCtrlParam->qIqRef = UTIL_LimitS16(
+        UTIL_SatShrS16((int32_t)pCtrlParam->qIqRef + pLoadObserver->iqFF, 0),
+        -pLoadObserver->iqLimit, pLoadObserver->iqLimit);
 }
 
+/**
+* <B> Function: void MCAPP_SpeedControlResume(MCAPP_FOC_T *)  </B>
+*
+* @brief Function restarts the velocity reference from the estimated 
+*        velocity and the speed controller from the present q axis current
+*        reference, e.g. after mains loss ride through. Estimator is not 
+*        re-initialized.
+*
+* @param Pointer to the data structure containing FOC parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_SpeedControlResume(&foc); </CODE>
+*
+*/
+static void MCAPP_SpeedControlResume(MCAPP_FOC_T *pFOC)
+{
+    MCAPP_CONTROL_T *pCtrlParam = &pFOC->ctrlParam;
+
+    pCtrlParam->qVelRef = pFOC->estimInterface.qVelEstim;
+    pCtrlParam->speedRampSkipCnt = 0;
+    MCAPP_SpeedTrajectoryReset(&pFOC->speedTraj, pCtrlParam->qVelRef);
+    MCAPP_ControllerPIReset(&pFOC->piSpeed, UTIL_SatShrS16(
+            (int32_t)pCtrlParam->qIqRef - pFOC->pLoadObserver->iqFF, 0));
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+    pFOC->outerLoop.epoch++;
+#endif
+}
 
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+/**
+* <B> Function: void MCAPP_SpeedControlRemote(MCAPP_FOC_T *)  </B>
+*
+* @brief Function applies the velocity and q axis current references of the
+*        speed loop run by the Main core (ENABLE_CROSS_CORE_SUPERVISOR). 
+*        References are applied while the command carries the epoch of the
+*        present speed loop; until the Main core has restarted its loop 
+*        from the feedback of this epoch the q axis current reference is 
+*        held. Load torque feedforward and the current limits (including 
+*        the regenerative limit of the DC link overvoltage control) are 
+*        applied here, at the control rate.
+*
+* @param Pointer to the data structure containing FOC parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_SpeedControlRemote(&foc); </CODE>
+*
+*/
+static void MCAPP_SpeedControlRemote(MCAPP_FOC_T *pFOC)
+{
+    MCAPP_CONTROL_T *pCtrlParam = &pFOC->ctrlParam;
+    MCAPP_LOAD_OBSERVER_T *pLoadObserver = pFOC->pLoadObserver;
+    MCAPP_VDC_LIMIT_T *pVdcLimit = &pFOC->vdcLimit;
+    const MCAPP_OUTER_LOOP_T *pOuterLoop = &pFOC->outerLoop;
+    int16_t iqMax = pLoadObserver->iqLimit, iqMin = -pLoadObserver->iqLimit;
+
+    MCAPP_VdcLimit(pVdcLimit);
+    MCAPP_LoadObserver(pLoadObserver, 
+                        pCtrlParam->qIqRef - pLoadObserver->iqFF);
+    
+    if (((pOuterLoop->flags & MSI_SPEED_LOOP) == 0) ||
+        (((pOuterLoop->flags & MSI_EPOCH_MASK) >> MSI_EPOCH_SHIFT) != 
+                                            (pOuterLoop->epoch & 0x000F)))
+    {
+        return;
+    }
+    pCtrlParam->qVelRef = pOuterLoop->qVelRef;
+    pCtrlParam->qTargetVelocity = pOuterLoop->qVelRef;
+    
+    if (pVdcLimit->regenLimit < pLoadObserver->iqLimit)
+    {
+        if (pFOC->estimInterface.qVelEstim >= 0)
+        {
+            iqMin = -pVdcLimit->regenLimit;
+        }
+        else
+        {
+            iqMax = pVdcLimit->regenLimit;
+        }
+    }
+    pCtrlParam->qIqRef = UTIL_LimitS16(UTIL_SatShrS16(
+        (int32_t)pOuterLoop->qIqRef + pLoadObserver->iqFF, 0), iqMin, iqMax);
+}
+#endif
 
 /**
-* <B> Function: void MCAPP_SpeedReferenceRamp(MCAPP_CONTROL_T *)  </B>
+* <B> Function: void MCAPP_SpeedReferenceRamp(MCAPP_CONTROL_T *, int16_t)  </B>
 *
 */
-static void MCAPP_SpeedReferenceRamp(MCAPP_CONTROL_T *pCtrlParam)
+static void MCAPP_SpeedReferenceRamp(MCAPP_CONTROL_T *pCtrlParam, 
+                                                    int16_t qTargetVelocity)
 {
-    int16_t deltaSpeed = pCtrlParam->qVelRef - 
-                                (int16_t)pCtrlParam->qTargetVelocity;
+    int16_t deltaSpeed = pCtrlParam->qVelRef - qTargetVelocity;
     if(deltaSpeed < 0)
     {
         if(pCtrlParam->speedRampSkipCnt >= pCtrlParam->speedRampIncLimit)
@@ -65,6 +65,16 @@ extern "C" {
 #include "motor_params.h"
 #include "sat_pi/sat_pi.h"
 #include "id_ref.h"
+#include "overmodulation.h"
+#include "deadtime_comp.h"
+#include "mech_id.h"
+#include "load_observer.h"
+#include "control_kpi.h"
+#include "single_shunt.h"
+#include "speed_trajectory.h"
+#include "vdc_limit.h"
+#include "ride_through.h"
+#include "msi_protocol.h"
     
 // </editor-fold>
 
@@ -84,6 +94,35 @@ typedef enum
 
 // <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
 
+typedef struct
+{
+    int16_t
+        enable,             /* Decoupling feedforward enable */
+        xd,                 /* d axis reactance at peak speed */
+        xq,                 /* q axis reactance at peak speed */
+        xScale,             /* Scaling for xd and xq */
+        kfi,                /* BEMF constant */
+        kfiScale,           /* Scaling for kfi */
+        vdFF,               /* d axis feedforward voltage */
+        vqFF;               /* q axis feedforward voltage */
+
+}MCAPP_DECOUPLING_T;
+
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+/* Outer loops run by the Main core (msi_protocol.h) : references are 
+   applied while the flags carry the epoch of the present speed loop */
+typedef struct
+{
+    int16_t
+        epoch,              /* Incremented when the speed loop (re)starts */
+        flags,              /* Outer loop flags and epoch of the command */
+        qVelRef,            /* Velocity reference */
+        qIqRef,             /* q axis current reference less feedforward */
+        qIdRef;             /* d axis current reference (flux weakening) */
+
+}MCAPP_OUTER_LOOP_T;
+#endif
+
 typedef struct
 {
     int16_t
@@ -91,7 +130,8 @@ typedef struct
         *pIb,               /* Pointer for Ib */
         *pVdc,              /* Pointer for Vdc */
         faultStatus,        /* Fault Status */
-        focState;           /* FOC State */       
+        focState,           /* FOC State */       
+        vMaxFactor;         /* Voltage vector limit as a factor of Vdc */
     
     MCAPP_PISTATE_T
         piQCurrent,               /* Parameters for PI Q axis controllers */
@@ -122,6 +162,32 @@ typedef struct
 
     MCAPP_ID_REFERENCE_T
         fluxControl;
+
+    MCAPP_OVERMODULATION_T
+        overmod;            /* Overmodulation Structure */
+
+    MCAPP_DEADTIME_COMP_T
+        deadTimeComp;       /* Dead time compensation Structure */
+
+    MCAPP_DECOUPLING_T
+        decoupling;         /* dq Decoupling feedforward Structure */
+
+    MCAPP_SINGLE_SHUNT_T
+        singleShunt;        /* Single shunt reconstruction Structure */
+
+    MCAPP_SPEED_TRAJECTORY_T
+        speedTraj;          /* Speed trajectory Structure */
+
+    MCAPP_VDC_LIMIT_T
+        vdcLimit;           /* DC link overvoltage control Structure */
+
+    MCAPP_RIDE_THROUGH_T
+        rideThrough;        /* Mains loss ride through Structure */
+
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+    MCAPP_OUTER_LOOP_T
+        outerLoop;          /* Outer loops of the Main core */
+#endif
 	
     MCAPP_ESTIMATOR_PLL_T
         estimPLL;         	/* Estimator Structure */
@@ -134,6 +200,17 @@ typedef struct
 
     MCAPP_MOTOR_T
         *pMotor;            /* Pointer for Motor Parameters */
+
+    /* Identification, load observer and KPI data are not updated every
+       control period and are kept out of the ISR state */
+    MCAPP_MECH_ID_T
+        *pMechId;           /* Pointer for Mechanical identification */
+
+    MCAPP_LOAD_OBSERVER_T
+        *pLoadObserver;     /* Pointer for Load torque observer */
+
+    MCAPP_CONTROL_KPI_T
+        *pKpi;              /* Pointer for Control KPI */
     
     uint16_t pwmPeriod;     /* PWM Period */
     
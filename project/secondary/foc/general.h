@@ -105,6 +105,23 @@ inline static int16_t UTIL_SatShrS16(int32_t x, uint16_t q)
     }
     return ylo;
 }    
+
+/**
+ * Converts a positive gain x (Q15, may exceed 1.0) to the gain/scale format
+ * of the PI controller : x = gain*2^scale, where gain fits in int16_t.
+ */
+inline static int16_t UTIL_GainScaleS16(int32_t x, int16_t *pScale)
+{
+    int16_t scale = 0;
+
+    while (x > 32767)
+    {
+        x >>= 1;
+        scale++;
+    }
+    *pScale = scale;
+    return (int16_t)x;
+}
     
     
     
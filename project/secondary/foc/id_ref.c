@@ -48,6 +48,7 @@
 // <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
 
 #include <stdint.h>
+#include <math.h>
 #include <libq.h>
 #include "id_ref.h"
 #include "mc1_user_params.h"
@@ -58,7 +59,11 @@
 
 // <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
 static void MCAPP_FluxControlVoltFeedback(MCAPP_FLUX_WEAKENING_VOLT_FB_T *);
+static void MCAPP_FluxControlVoltMagnitude(MCAPP_FLUX_WEAKENING_VOLT_FB_T *);
+static void MCAPP_FluxControlIdRefFilter(MCAPP_FLUX_WEAKENING_VOLT_FB_T *, 
+                                                                    int16_t);
 static void MCAPP_FluxControlVoltFeedbackInit(MCAPP_FLUX_WEAKENING_VOLT_FB_T *);
+static void MCAPP_MTPAIdReference(MCAPP_MTPA_T *);
 // </editor-fold>
 
 // <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
@@ -93,11 +98,87 @@ void MCAPP_FluxWeakeningControl(MCAPP_ID_REFERENCE_T *pIdRefGen)
 {
     MCAPP_FLUX_WEAKENING_VOLT_FB_T *pFeedBackFW = &pIdRefGen->feedBackFW;
 
+    /* Calculate MTPA current, used as base for Flux Weakening Control */
+    MCAPP_MTPAIdReference(&pIdRefGen->mtpa);
+    pFeedBackFW->IdRefBase = pIdRefGen->mtpa.IdRef;
+
     /* Calculate Flux Weakening Control current */
 
     MCAPP_FluxControlVoltFeedback(pFeedBackFW);
 }
 
+/**
+* <B> Function: MCAPP_FluxWeakeningControlRemote(MCAPP_ID_REFERENCE_T *,
+*                                                int16_t) </B>
+*
+* @brief Function generates the d axis current reference from the flux 
+*        weakening controller output computed by the Main core 
+*        (ENABLE_CROSS_CORE_SUPERVISOR) : the output is added to the base 
+*        (MTPA) reference with the limits of the local controller, which is
+*        held reset. Voltage magnitude is computed for the feedback.
+*        
+* @param Pointer to the data structure containing Id reference parameters.
+* @param Flux weakening controller output.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_FluxWeakeningControlRemote(&fluxControl, qIdRef); </CODE>
+*
+*/
+void MCAPP_FluxWeakeningControlRemote(MCAPP_ID_REFERENCE_T *pIdRefGen,
+                                                        int16_t fluxWeakening)
+{
+    MCAPP_FLUX_WEAKENING_VOLT_FB_T *pFeedBackFW = &pIdRefGen->feedBackFW;
+
+    MCAPP_MTPAIdReference(&pIdRefGen->mtpa);
+    pFeedBackFW->IdRefBase = pIdRefGen->mtpa.IdRef;
+
+    MCAPP_FluxControlVoltMagnitude(pFeedBackFW);
+    MCAPP_ControllerPIReset(&pFeedBackFW->FWeakPI, 0);
+    MCAPP_FluxControlIdRefFilter(pFeedBackFW, pFeedBackFW->IdRefBase +
+            UTIL_LimitS16(fluxWeakening, pFeedBackFW->FWeakPI.outMin, 
+                                            pFeedBackFW->FWeakPI.outMax));
+}
+
+/**
+* <B> Function: MCAPP_MTPATableInit(MCAPP_MTPA_T *) </B>
+*
+* @brief Function builds the MTPA look up table from the motor constants.
+*        For an interior PM motor the MTPA Id reference for a given Iq is
+*        Id = a - sqrt(a^2 + Iq^2) = -Iq^2/(a + sqrt(a^2 + Iq^2)),
+*        where a = psi/(2*(Lq-Ld)).
+*        Function uses floating point and must be called once during
+*        application initialization, not from the control interrupt.
+*
+* @param Pointer to the data structure containing MTPA parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_MTPATableInit(&mtpa); </CODE>
+*
+*/
+void MCAPP_MTPATableInit(MCAPP_MTPA_T *pMTPA)
+{
+    uint16_t index;
+    float constA, iq, id;
+
+    constA = (float)pMTPA->constA / (float)(1 << pMTPA->constAScale);
+
+    for (index = 0; index < MTPA_TABLE_SIZE; index++)
+    {
+        iq = (float)((int32_t)index << MTPA_TABLE_SHIFT) / 32768.0;
+        if (constA > 0)
+        {
+            id = -(iq * iq) / (constA + sqrtf(constA * constA + iq * iq));
+        }
+        else
+        {
+            id = 0;
+        }
+        pMTPA->table[index] = (int16_t)(id * 32767.0);
+    }
+    pMTPA->IdRef = 0;
+}
+
 /**
 * <B> Function: MCAPP_FluxControlVoltFeedbackInit(MCAPP_FLUX_WEAKENING_VOLT_FB_T * )  </B>
 *
@@ -116,6 +197,39 @@ static void  MCAPP_FluxControlVoltFeedbackInit(MCAPP_FLUX_WEAKENING_VOLT_FB_T *p
     pFdWeak->FWeakPI.integrator = 0;
     pFdWeak->IdRefFiltStateVar = 0;
     pFdWeak->IdRef = 0;
+    pFdWeak->IdRefBase = 0;
+}
+
+/**
+* <B> Function: MCAPP_MTPAIdReference(MCAPP_MTPA_T * )  </B>
+*
+* @brief Function computes the MTPA Id reference from the magnitude of Iq 
+*        reference by linear interpolation of the MTPA look up table.
+*
+* @param Pointer to the data structure containing MTPA parameters.
+* @return   none.
+* @example
+* <CODE> MCAPP_MTPAIdReference(&mtpa); </CODE>
+*
+*/
+static void MCAPP_MTPAIdReference(MCAPP_MTPA_T *pMTPA)
+{
+    int16_t iqRef, index, delta;
+
+    if (pMTPA->enable == 0)
+    {
+        pMTPA->IdRef = 0;
+    }
+    else
+    {
+        iqRef = _Q15abs(pMTPA->pCtrlParam->qIqRef);
+        index = iqRef >> MTPA_TABLE_SHIFT;
+        delta = iqRef & ((1 << MTPA_TABLE_SHIFT) - 1);
+
+        pMTPA->IdRef = pMTPA->table[index] + 
+            (int16_t)(__builtin_mulss((pMTPA->table[index + 1] - 
+                    pMTPA->table[index]), delta) >> MTPA_TABLE_SHIFT);
+    }
 }
 
 /**
@@ -133,32 +247,69 @@ static void  MCAPP_FluxControlVoltFeedbackInit(MCAPP_FLUX_WEAKENING_VOLT_FB_T *p
 
 static void MCAPP_FluxControlVoltFeedback(MCAPP_FLUX_WEAKENING_VOLT_FB_T *pFdWeak)
 {    
-    const MC_DQ_T *pVdq         = pFdWeak->pVdq;
     const MCAPP_MOTOR_T *pMotor = pFdWeak->pMotor;
     MCAPP_CONTROL_T *pCtrlParam = pFdWeak->pCtrlParam;
 
-    int16_t vdSqr, vqSqr, IdRefOut; 
+    int16_t IdRefOut; 
 
-    /* Compute voltage vector magnitude */
-    vdSqr  = (int16_t)(__builtin_mulss(pVdq->d, pVdq->d) >> 15);
-    vqSqr  = (int16_t)(__builtin_mulss(pVdq->q, pVdq->q) >> 15);
-    pFdWeak->voltageMag = _Q15sqrt(vdSqr+vqSqr);
+    MCAPP_FluxControlVoltMagnitude(pFdWeak);
     
     if((pCtrlParam->qVelRef > (pMotor->qNominalSpeed>>1)))
     { 
         /* Compute PI output: pFdWeak->IdRef */
         MCAPP_ControllerPIUpdate(pFdWeak->voltageMagRef, pFdWeak->voltageMag, 
             &pFdWeak->FWeakPI, MCAPP_SAT_NONE, &IdRefOut, pFdWeak->voltageMagRef); 
+        IdRefOut = IdRefOut + pFdWeak->IdRefBase;
     }
     else
     {
-        IdRefOut = 0 ;
+        IdRefOut = pFdWeak->IdRefBase;
         
         /* Reset PI integrator to Nominal Idrefernce value for smooth transition
          * when switching to PI output computation. */
         MCAPP_ControllerPIReset(&pFdWeak->FWeakPI, 0);
     }
 
+    MCAPP_FluxControlIdRefFilter(pFdWeak, IdRefOut);
+}
+
+/**
+* <B> Function: MCAPP_FluxControlVoltMagnitude(MCAPP_FLUX_WEAKENING_VOLT_FB_T * )  </B>
+*
+* @brief Function limits the base (MTPA) Id reference and the flux weakening
+*        controller output, such that their sum does not exceed IdRefMin, 
+*        and computes the voltage vector magnitude.
+*
+*/
+static void MCAPP_FluxControlVoltMagnitude(MCAPP_FLUX_WEAKENING_VOLT_FB_T *pFdWeak)
+{
+    const MC_DQ_T *pVdq = pFdWeak->pVdq;
+    int16_t vdSqr, vqSqr;
+
+    /* Flux Weakening PI output is added to the base (MTPA) Id reference and
+       limited such that the sum does not exceed IdRefMin */
+    if (pFdWeak->IdRefBase < pFdWeak->IdRefMin)
+    {
+        pFdWeak->IdRefBase = pFdWeak->IdRefMin;
+    }
+    pFdWeak->FWeakPI.outMin = pFdWeak->IdRefMin - pFdWeak->IdRefBase;
+
+    /* Compute voltage vector magnitude */
+    vdSqr  = (int16_t)(__builtin_mulss(pVdq->d, pVdq->d) >> 15);
+    vqSqr  = (int16_t)(__builtin_mulss(pVdq->q, pVdq->q) >> 15);
+    pFdWeak->voltageMag = _Q15sqrt(vdSqr+vqSqr);
+}
+
+/**
+* <B> Function: MCAPP_FluxControlIdRefFilter(MCAPP_FLUX_WEAKENING_VOLT_FB_T *,
+*                                            int16_t)  </B>
+*
+* @brief Function filters the Id reference (ID_REFERNCE_FILTER_ENABLE).
+*
+*/
+static void MCAPP_FluxControlIdRefFilter(MCAPP_FLUX_WEAKENING_VOLT_FB_T *pFdWeak,
+                                                            int16_t IdRefOut)
+{
     /*Filter for the FW Idref current*/
 #ifdef ID_REFERNCE_FILTER_ENABLE
     pFdWeak->IdRefFiltStateVar +=
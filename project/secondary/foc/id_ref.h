@@ -62,6 +62,14 @@ extern "C" {
 #include "sat_pi/sat_pi.h"
 
 // </editor-fold>    
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS/MACROS ">
+
+/* MTPA table : Id reference at |Iq reference| = index*2^MTPA_TABLE_SHIFT */
+#define MTPA_TABLE_SHIFT    11
+#define MTPA_TABLE_SIZE     17
+
+// </editor-fold>
     
 // <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
 
@@ -73,7 +81,8 @@ typedef struct
         IdRefFiltConst,     /* Filter constant for Id */
         IdRefMin,           /* Lower limit on IdRef */
         voltageMag,         /* Voltage vector magnitude */
-        voltageMagRef;      /* Voltage vector magnitude reference */
+        voltageMagRef,      /* Voltage vector magnitude reference */
+        IdRefBase;          /* Id reference without flux weakening (MTPA) */
             
     int32_t
         IdRefFiltStateVar;  /* Accumulation variable for IdRef filter */
@@ -85,6 +94,23 @@ typedef struct
     const MCAPP_MOTOR_T *pMotor;
 
 } MCAPP_FLUX_WEAKENING_VOLT_FB_T;
+
+/*
+ * Maximum Torque Per Ampere (MTPA) data type
+ */
+
+typedef struct
+{
+    int16_t
+        enable,             /* MTPA enable */
+        IdRef,              /* MTPA Id current reference */
+        constA,             /* psi/(2*(Lq-Ld)) normalized to peak current */
+        constAScale,        /* Scaling for constA */
+        table[MTPA_TABLE_SIZE]; /* Id reference versus |Iq reference| */
+
+    const MCAPP_CONTROL_T *pCtrlParam;
+
+} MCAPP_MTPA_T;
     
 /*
  * Flux weakening control data type
@@ -97,6 +123,9 @@ typedef struct
     
     MCAPP_FLUX_WEAKENING_VOLT_FB_T 
         feedBackFW;         /* Voltage feedback based Flux Weakening Structure */
+
+    MCAPP_MTPA_T
+        mtpa;               /* MTPA Id reference Structure */
     
 } MCAPP_ID_REFERENCE_T;
 
@@ -106,6 +135,8 @@ typedef struct
 
 void MCAPP_FluxWeakeningControlInit(MCAPP_ID_REFERENCE_T *);
 void MCAPP_FluxWeakeningControl(MCAPP_ID_REFERENCE_T *);
+void MCAPP_FluxWeakeningControlRemote(MCAPP_ID_REFERENCE_T *, int16_t);
+void MCAPP_MTPATableInit(MCAPP_MTPA_T *);
 
 // </editor-fold>
 
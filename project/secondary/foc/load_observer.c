@@ -0,0 +1,272 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file load_observer.c
+ *
+ * @brief This module implements the load torque disturbance observer and the
+ * angle synchronised repetitive feedforward of the speed controller.
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include "load_observer.h"
+#include "general.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+static int32_t MCAPP_LoadObserverInertiaTerm(const MCAPP_LOAD_OBSERVER_T *);
+static void MCAPP_LoadObserverAngle(MCAPP_LOAD_OBSERVER_T *);
+static void MCAPP_LoadObserverRepetitive(MCAPP_LOAD_OBSERVER_T *, int16_t);
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_LoadObserverInit(MCAPP_LOAD_OBSERVER_T *) </B>
+*
+* @brief Function to reset variables used for load torque observer and 
+*        repetitive feedforward, including the learned feedforward table.
+*        Called at motor start and when the observer is enabled.
+*
+* @param Pointer to the data structure containing load observer variables.
+* @return none.
+* @example
+* <CODE> MCAPP_LoadObserverInit(&loadObserver); </CODE>
+*
+*/
+void MCAPP_LoadObserverInit(MCAPP_LOAD_OBSERVER_T *pObserver)
+{
+    int16_t i;
+
+    pObserver->active = 0;
+    pObserver->loadEstim = 0;
+    pObserver->repetitiveFF = 0;
+    pObserver->iqFF = 0;
+    pObserver->elecRev = 0;
+    pObserver->thetaPrev = *pObserver->pTheta;
+    pObserver->index = 0;
+    pObserver->enablePrev = pObserver->enable;
+    for (i = 0; i < LOAD_OBS_TABLE_SIZE; i++)
+    {
+        pObserver->table[i] = 0;
+    }
+}
+
+/**
+* <B> Function: MCAPP_LoadObserver(MCAPP_LOAD_OBSERVER_T *, int16_t) </B>
+*
+* @brief Function computes the load current feedforward of the speed 
+*        controller.
+*        Observer : load = iq - tm*d(speed)/dt is estimated through a first
+*        order filter of bandwidth g without differentiating the speed :
+*        x = x + g*Ts*(iq + g*tm*speed - x), load = x - g*tm*speed.
+*        Repetitive feedforward learns, per mechanical angle, the current 
+*        still supplied by the speed controller for periodic loads.
+*
+* @param Pointer to the data structure containing load observer variables.
+* @param Speed controller output of the previous sample.
+* @return none.
+* @example
+* <CODE> MCAPP_LoadObserver(&loadObserver, iqPI); </CODE>
+*
+*/
+void MCAPP_LoadObserver(MCAPP_LOAD_OBSERVER_T *pObserver, int16_t iqPI)
+{
+    const int16_t speed = *pObserver->pVelEstim;
+    int32_t inertiaTerm, iqFF;
+
+    if (pObserver->enable != pObserver->enablePrev)
+    {
+        /* Learn from an empty table after the observer is enabled */
+        MCAPP_LoadObserverInit(pObserver);
+    }
+
+    if (pObserver->enable == 0)
+    {
+        return;
+    }
+
+    /* Mechanical angle is tracked below minimum speed as well, so that the
+       learned table stays aligned when the observer resumes */
+    MCAPP_LoadObserverAngle(pObserver);
+
+    if ((speed < pObserver->speedMin) && (speed > -pObserver->speedMin))
+    {
+        /* Hold the table, no feedforward */
+        pObserver->active = 0;
+        pObserver->loadEstim = 0;
+        pObserver->repetitiveFF = 0;
+        pObserver->iqFF = 0;
+        return;
+    }
+
+    inertiaTerm = MCAPP_LoadObserverInertiaTerm(pObserver);
+    if (pObserver->active == 0)
+    {
+        /* Start with zero load estimate */
+        pObserver->state = inertiaTerm;
+        pObserver->active = 1;
+    }
+
+    pObserver->state += ((int32_t)(*pObserver->pIq - pObserver->loadEstim) *
+                                                    pObserver->gain) >> 15;
+    pObserver->loadEstim = UTIL_SatShrS16(pObserver->state - inertiaTerm, 0);
+
+    if (pObserver->repetitiveEnable == 1)
+    {
+        MCAPP_LoadObserverRepetitive(pObserver, iqPI);
+    }
+
+    iqFF = (int32_t)pObserver->loadEstim + pObserver->repetitiveFF;
+    if (iqFF > pObserver->iqLimit)
+    {
+        iqFF = pObserver->iqLimit;
+    }
+    else if (iqFF < -pObserver->iqLimit)
+    {
+        iqFF = -pObserver->iqLimit;
+    }
+    pObserver->iqFF = (int16_t)iqFF;
+}
+
+// </editor-fold>
+
+/**
+* <B> Function: MCAPP_LoadObserverInertiaTerm(const MCAPP_LOAD_OBSERVER_T *)</B>
+*
+* @brief Function computes the observer term g*Ts*tm*speed, tm being the 
+*        mechanical time constant in PWM periods.
+*
+* @param Pointer to the data structure containing load observer variables.
+* @return Observer inertia term.
+* @example
+* <CODE> term = MCAPP_LoadObserverInertiaTerm(&loadObserver); </CODE>
+*
+*/
+static int32_t MCAPP_LoadObserverInertiaTerm(const MCAPP_LOAD_OBSERVER_T *pObserver)
+{
+    int16_t gainTm, gainTmScale;
+
+    gainTm = UTIL_GainScaleS16((int32_t)pObserver->gain * (*pObserver->pTm), 
+                                                            &gainTmScale);
+    return (__builtin_mulss(gainTm, *pObserver->pVelEstim) >> 15) << gainTmScale;
+}
+
+/**
+* <B> Function: MCAPP_LoadObserverAngle(MCAPP_LOAD_OBSERVER_T *) </B>
+*
+* @brief Function tracks the mechanical angle from the electrical angle and
+*        pole pairs and computes the table index at the mechanical angle.
+*
+* @param Pointer to the data structure containing load observer variables.
+* @return none.
+* @example
+* <CODE> MCAPP_LoadObserverAngle(&loadObserver); </CODE>
+*
+*/
+static void MCAPP_LoadObserverAngle(MCAPP_LOAD_OBSERVER_T *pObserver)
+{
+    const uint16_t theta = (uint16_t)(*pObserver->pTheta);
+    const uint16_t thetaPrev = (uint16_t)pObserver->thetaPrev;
+    const int16_t deltaTheta = (int16_t)(theta - thetaPrev);
+
+    /* Count electrical revolutions within a mechanical revolution */
+    if ((theta < thetaPrev) && (deltaTheta > 0))
+    {
+        pObserver->elecRev++;
+        if (pObserver->elecRev >= pObserver->polePairs)
+        {
+            pObserver->elecRev = 0;
+        }
+    }
+    else if ((theta > thetaPrev) && (deltaTheta < 0))
+    {
+        pObserver->elecRev--;
+        if (pObserver->elecRev < 0)
+        {
+            pObserver->elecRev = pObserver->polePairs - 1;
+        }
+    }
+    pObserver->thetaPrev = (int16_t)theta;
+
+    pObserver->index = __builtin_divsd(((int32_t)pObserver->elecRev << 
+            LOAD_OBS_TABLE_SHIFT) + (theta >> (16 - LOAD_OBS_TABLE_SHIFT)),
+            pObserver->polePairs);
+}
+
+/**
+* <B> Function: MCAPP_LoadObserverRepetitive(MCAPP_LOAD_OBSERVER_T *, 
+*                                                           int16_t) </B>
+*
+* @brief Function updates the table entry at the mechanical angle with the
+*        speed controller output and applies the entry ahead as feedforward.
+*
+* @param Pointer to the data structure containing load observer variables.
+* @param Speed controller output of the previous sample.
+* @return none.
+* @example
+* <CODE> MCAPP_LoadObserverRepetitive(&loadObserver, iqPI); </CODE>
+*
+*/
+static void MCAPP_LoadObserverRepetitive(MCAPP_LOAD_OBSERVER_T *pObserver,
+                                                            int16_t iqPI)
+{
+    int32_t *pEntry;
+
+    pEntry = &pObserver->table[pObserver->index];
+    *pEntry += (__builtin_mulss(iqPI, pObserver->learnGain) << 1) - 
+                                        (*pEntry >> LOAD_OBS_LEAK_SHIFT);
+    if (*pEntry > ((int32_t)pObserver->iqLimit << 16))
+    {
+        *pEntry = ((int32_t)pObserver->iqLimit << 16);
+    }
+    else if (*pEntry < -((int32_t)pObserver->iqLimit << 16))
+    {
+        *pEntry = -((int32_t)pObserver->iqLimit << 16);
+    }
+
+    pObserver->repetitiveFF = (int16_t)(pObserver->table[(pObserver->index + 
+            LOAD_OBS_TABLE_LEAD) & (LOAD_OBS_TABLE_SIZE - 1)] >> 16);
+}
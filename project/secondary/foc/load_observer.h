@@ -0,0 +1,120 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file load_observer.h
+ *
+ * @brief This module implements the load torque disturbance observer and the
+ * angle synchronised repetitive feedforward of the speed controller.
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+#ifndef LOAD_OBSERVER_H
+#define	LOAD_OBSERVER_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS/MACROS ">
+
+/* Repetitive feedforward table : 2^LOAD_OBS_TABLE_SHIFT entries per 
+   mechanical revolution */
+#define LOAD_OBS_TABLE_SHIFT        5
+#define LOAD_OBS_TABLE_SIZE         (1 << LOAD_OBS_TABLE_SHIFT)
+/* Table entries ahead of the learning position applied as feedforward, 
+   compensates the delay of the speed loop */
+#define LOAD_OBS_TABLE_LEAD         1
+/* Leakage of the table entries : entry -= entry/2^LOAD_OBS_LEAK_SHIFT */
+#define LOAD_OBS_LEAK_SHIFT         10
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
+
+typedef struct
+{
+    int16_t
+        enable,             /* Load torque observer enable */
+        enablePrev,         /* Enable of the previous sample */
+        repetitiveEnable,   /* Repetitive feedforward enable */
+        active,             /* Observer running */
+        gain,               /* Observer bandwidth : omega*Ts */
+        learnGain,          /* Repetitive feedforward learning gain */
+        speedMin,           /* Minimum speed for observer operation */
+        iqLimit,            /* Limit of total q axis current reference */
+        polePairs,          /* Motor pole pairs */
+        loadEstim,          /* Estimated load current (torque) */
+        repetitiveFF,       /* Repetitive feedforward current */
+        iqFF,               /* Total feedforward current */
+        elecRev,            /* Electrical revolution within mechanical */
+        thetaPrev,          /* Previous electrical angle */
+        index;              /* Table index at mechanical angle */
+
+    int32_t
+        state,              /* Observer state */
+        table[LOAD_OBS_TABLE_SIZE];   /* Repetitive feedforward table */
+
+    const int16_t *pIq;
+    const int16_t *pVelEstim;
+    const int16_t *pTheta;
+    const int32_t *pTm;     /* Mechanical time constant in PWM periods */
+
+}MCAPP_LOAD_OBSERVER_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+void MCAPP_LoadObserverInit(MCAPP_LOAD_OBSERVER_T *);
+void MCAPP_LoadObserver(MCAPP_LOAD_OBSERVER_T *, int16_t);
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* LOAD_OBSERVER_H */
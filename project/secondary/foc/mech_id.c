@@ -0,0 +1,399 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file mech_id.c
+ *
+ * @brief This module implements identification of the mechanical parameters
+ * (inertia, viscous and Coulomb friction), online inertia estimation and
+ * gain scheduling of the speed controller.
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include "mech_id.h"
+#include "general.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+static int16_t MCAPP_MechIdAverage(MCAPP_MECH_ID_T *);
+static void MCAPP_MechIdCalculate(MCAPP_MECH_ID_T *, int16_t, int16_t);
+static void MCAPP_MechIdInertiaEstimation(MCAPP_MECH_ID_T *);
+static int16_t MCAPP_MechIdFriction(const MCAPP_MECH_ID_T *, int16_t);
+static void MCAPP_MechIdSpeedGains(MCAPP_MECH_ID_T *);
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_MechIdInit(MCAPP_MECH_ID_T *) </B>
+*
+* @brief Function to reset variables used for mechanical identification and
+*        online inertia estimation. Identified parameters are retained and,
+*        with gain scheduling enabled, the speed controller gains are 
+*        computed from them.
+*
+* @param Pointer to the data structure containing mechanical identification
+*        variables.
+* @return none.
+* @example
+* <CODE> MCAPP_MechIdInit(&mechId); </CODE>
+*
+*/
+void MCAPP_MechIdInit(MCAPP_MECH_ID_T *pMechId)
+{
+    pMechId->state = MECH_ID_IDLE;
+    pMechId->counter = 0;
+    pMechId->windowCounter = 0;
+    MCAPP_MechIdSpeedGains(pMechId);
+}
+
+/**
+* <B> Function: MCAPP_MechanicalIdentification(MCAPP_MECH_ID_T *) </B>
+*
+* @brief Function executes the mechanical identification in closed loop
+*        speed control, when requested :
+*        (1) Mean current at constant low and high speeds gives the viscous
+*            (slope) and Coulomb (offset) friction.
+*        (2) Mean current during the speed ramp from low to high speed, 
+*            minus friction, divided by the acceleration gives the inertia
+*            as mechanical time constant.
+*        Speed target is overridden during identification. Otherwise the
+*        inertia is estimated online from accelerations exceeding a 
+*        threshold. With gain scheduling enabled, speed controller gains
+*        are updated from the inertia and friction.
+*
+* @param Pointer to the data structure containing mechanical identification
+*        variables.
+* @return none.
+* @example
+* <CODE> MCAPP_MechanicalIdentification(&mechId); </CODE>
+*
+*/
+void MCAPP_MechanicalIdentification(MCAPP_MECH_ID_T *pMechId)
+{
+    MCAPP_CONTROL_T *pCtrlParam = pMechId->pCtrlParam;
+    MCAPP_MECH_ID_REPORT_T *pReport = &pMechId->report;
+    int16_t iqHigh, speedHighMeas;
+
+    if ((pMechId->request == 1) && (pMechId->enable == 1) &&
+        (pMechId->state != MECH_ID_SPEED_LOW) &&
+        (pMechId->state != MECH_ID_ACCEL) &&
+        (pMechId->state != MECH_ID_SPEED_HIGH))
+    {
+        pMechId->request = 0;
+        pMechId->counter = 0;
+        pReport->status = MECH_ID_STATUS_NONE;
+        pMechId->state = MECH_ID_SPEED_LOW;
+    }
+
+    switch (pMechId->state)
+    {
+        case MECH_ID_SPEED_LOW:
+            pCtrlParam->qTargetVelocity = pMechId->speedLow;
+            if (pCtrlParam->qVelRef != pMechId->speedLow)
+            {
+                pMechId->counter = 0;
+            }
+            else if (MCAPP_MechIdAverage(pMechId))
+            {
+                pMechId->iqLow = (int16_t)(pMechId->sumCurrent >> MECH_ID_AVG_SHIFT);
+                pMechId->speedLowMeas = (int16_t)(pMechId->sumSpeed >> MECH_ID_AVG_SHIFT);
+                pMechId->state = MECH_ID_ACCEL;
+            }
+            break;
+
+        case MECH_ID_ACCEL:
+            pCtrlParam->qTargetVelocity = pMechId->speedHigh;
+            if (pCtrlParam->qVelRef >= pMechId->speedHigh)
+            {
+                /* Speed ramp ended before the measurement */
+                pReport->status = MECH_ID_STATUS_ERROR;
+                pMechId->state = MECH_ID_FAULT;
+            }
+            else if (MCAPP_MechIdAverage(pMechId))
+            {
+                pMechId->iqAccel = (int16_t)(pMechId->sumCurrent >> MECH_ID_AVG_SHIFT);
+                pMechId->speedAccel = (int16_t)(pMechId->sumSpeed >> MECH_ID_AVG_SHIFT);
+                pMechId->speedDelta = pMechId->speedEnd - pMechId->speedStart;
+                pMechId->state = MECH_ID_SPEED_HIGH;
+            }
+            break;
+
+        case MECH_ID_SPEED_HIGH:
+            pCtrlParam->qTargetVelocity = pMechId->speedHigh;
+            if (pCtrlParam->qVelRef != pMechId->speedHigh)
+            {
+                pMechId->counter = 0;
+            }
+            else if (MCAPP_MechIdAverage(pMechId))
+            {
+                iqHigh = (int16_t)(pMechId->sumCurrent >> MECH_ID_AVG_SHIFT);
+                speedHighMeas = (int16_t)(pMechId->sumSpeed >> MECH_ID_AVG_SHIFT);
+                MCAPP_MechIdCalculate(pMechId, iqHigh, speedHighMeas);
+            }
+            break;
+
+        case MECH_ID_IDLE:
+        case MECH_ID_COMPLETE:
+        case MECH_ID_FAULT:
+        default:
+            if (pMechId->onlineEnable == 1)
+            {
+                MCAPP_MechIdInertiaEstimation(pMechId);
+            }
+            break;
+    }
+}
+
+// </editor-fold>
+
+/**
+* <B> Function: MCAPP_MechIdAverage(MCAPP_MECH_ID_T *) </B>
+*
+* @brief Function accumulates 2^MECH_ID_AVG_SHIFT current and speed samples
+*        after the settling time. Speed at start and end of the averaging 
+*        window is recorded.
+*
+* @param Pointer to the data structure containing mechanical identification
+*        variables.
+* @return 1 - accumulation completed, 0 - otherwise.
+* @example
+* <CODE> status = MCAPP_MechIdAverage(&mechId); </CODE>
+*
+*/
+static int16_t MCAPP_MechIdAverage(MCAPP_MECH_ID_T *pMechId)
+{
+    pMechId->counter++;
+    if (pMechId->counter <= pMechId->settleCount)
+    {
+        pMechId->sumCurrent = 0;
+        pMechId->sumSpeed = 0;
+        pMechId->speedStart = *pMechId->pVelEstim;
+        return 0;
+    }
+    pMechId->sumCurrent += *pMechId->pIq;
+    pMechId->sumSpeed += *pMechId->pVelEstim;
+    if (pMechId->counter >= (pMechId->settleCount + (1 << MECH_ID_AVG_SHIFT)))
+    {
+        pMechId->counter = 0;
+        pMechId->speedEnd = *pMechId->pVelEstim;
+        return 1;
+    }
+    return 0;
+}
+
+/**
+* <B> Function: MCAPP_MechIdCalculate(MCAPP_MECH_ID_T *, int16_t, int16_t) </B>
+*
+* @brief Function computes friction and inertia from the measurements.
+*
+* @param Pointer to the data structure containing mechanical identification
+*        variables.
+* @param Mean current at high speed.
+* @param Mean speed at high speed.
+* @return none.
+* @example
+* <CODE> MCAPP_MechIdCalculate(&mechId, iqHigh, speedHigh); </CODE>
+*
+*/
+static void MCAPP_MechIdCalculate(MCAPP_MECH_ID_T *pMechId, int16_t iqHigh,
+                                                    int16_t speedHighMeas)
+{
+    MCAPP_MECH_ID_REPORT_T *pReport = &pMechId->report;
+    const int16_t deltaSpeed = speedHighMeas - pMechId->speedLowMeas;
+    const int16_t deltaIq = iqHigh - pMechId->iqLow;
+    int16_t iqNet;
+
+    if ((deltaSpeed <= 0) || (pMechId->speedDelta <= 0))
+    {
+        pReport->status = MECH_ID_STATUS_ERROR;
+        pMechId->state = MECH_ID_FAULT;
+        return;
+    }
+
+    /* Friction : iq = viscous*speed + coulomb */
+    if (deltaIq <= 0)
+    {
+        pReport->viscous = 0;
+    }
+    else if (deltaIq >= deltaSpeed)
+    {
+        pReport->viscous = 32767;
+    }
+    else
+    {
+        pReport->viscous = __builtin_divsd(((int32_t)deltaIq << 15), deltaSpeed);
+    }
+    pReport->coulomb = pMechId->iqLow - 
+        (int16_t)(__builtin_mulss(pReport->viscous, pMechId->speedLowMeas) >> 15);
+
+    /* Inertia : tm = (iq - friction)/(speed change per PWM period) */
+    iqNet = pMechId->iqAccel - MCAPP_MechIdFriction(pMechId, pMechId->speedAccel);
+    if (iqNet <= 0)
+    {
+        pReport->status = MECH_ID_STATUS_ERROR;
+        pMechId->state = MECH_ID_FAULT;
+        return;
+    }
+    pReport->tm = ((int32_t)iqNet << MECH_ID_AVG_SHIFT) / pMechId->speedDelta;
+    pReport->tmEstim = pReport->tm;
+
+    pReport->status = MECH_ID_STATUS_VALID;
+    pMechId->state = MECH_ID_COMPLETE;
+    MCAPP_MechIdSpeedGains(pMechId);
+}
+
+/**
+* <B> Function: MCAPP_MechIdInertiaEstimation(MCAPP_MECH_ID_T *) </B>
+*
+* @brief Function estimates the mechanical time constant online from the 
+*        mean current and the speed change over a window of 
+*        2^MECH_ID_WINDOW_SHIFT samples. Windows with a speed change below
+*        the threshold do not carry inertia information and are skipped.
+*
+* @param Pointer to the data structure containing mechanical identification
+*        variables.
+* @return none.
+* @example
+* <CODE> MCAPP_MechIdInertiaEstimation(&mechId); </CODE>
+*
+*/
+static void MCAPP_MechIdInertiaEstimation(MCAPP_MECH_ID_T *pMechId)
+{
+    MCAPP_MECH_ID_REPORT_T *pReport = &pMechId->report;
+    const int16_t speed = *pMechId->pVelEstim;
+    int16_t accel, iqNet;
+    int32_t tmWindow;
+
+    if (pMechId->windowCounter == 0)
+    {
+        pMechId->speedPrev = speed;
+        pMechId->sumWindow = 0;
+    }
+    pMechId->sumWindow += *pMechId->pIq;
+    pMechId->windowCounter++;
+    if (pMechId->windowCounter < (1 << MECH_ID_WINDOW_SHIFT))
+    {
+        return;
+    }
+    pMechId->windowCounter = 0;
+
+    accel = speed - pMechId->speedPrev;
+    if ((accel < pMechId->accelMin) && (accel > -pMechId->accelMin))
+    {
+        return;
+    }
+    iqNet = (int16_t)(pMechId->sumWindow >> MECH_ID_WINDOW_SHIFT) - 
+        MCAPP_MechIdFriction(pMechId, (pMechId->speedPrev >> 1) + (speed >> 1));
+    tmWindow = ((int32_t)iqNet << MECH_ID_WINDOW_SHIFT) / accel;
+    if (tmWindow > 0)
+    {
+        pReport->tmEstim += (tmWindow - pReport->tmEstim) >> MECH_ID_FILTER_SHIFT;
+        MCAPP_MechIdSpeedGains(pMechId);
+    }
+}
+
+/**
+* <B> Function: MCAPP_MechIdFriction(const MCAPP_MECH_ID_T *, int16_t) </B>
+*
+* @brief Function computes the friction current at a given speed.
+*
+* @param Pointer to the data structure containing mechanical identification
+*        variables.
+* @param Speed.
+* @return Friction current.
+* @example
+* <CODE> iqFriction = MCAPP_MechIdFriction(&mechId, speed); </CODE>
+*
+*/
+static int16_t MCAPP_MechIdFriction(const MCAPP_MECH_ID_T *pMechId, int16_t speed)
+{
+    return pMechId->report.coulomb +
+        (int16_t)(__builtin_mulss(pMechId->report.viscous, speed) >> 15);
+}
+
+/**
+* <B> Function: MCAPP_MechIdSpeedGains(MCAPP_MECH_ID_T *) </B>
+*
+* @brief Function schedules the speed controller gains for the target 
+*        bandwidth : Kp = omega*Ts*tm. The controller zero is placed at 
+*        1/4 of the bandwidth, or on the mechanical pole (viscous/tm) if 
+*        it is higher, Ki = Kp*zero.
+*
+* @param Pointer to the data structure containing mechanical identification
+*        variables.
+* @return none.
+* @example
+* <CODE> MCAPP_MechIdSpeedGains(&mechId); </CODE>
+*
+*/
+static void MCAPP_MechIdSpeedGains(MCAPP_MECH_ID_T *pMechId)
+{
+    MCAPP_MECH_ID_REPORT_T *pReport = &pMechId->report;
+    int16_t zero;
+    int32_t pole;
+
+    if ((pMechId->scheduleEnable == 0) || (pReport->tmEstim <= 0))
+    {
+        return;
+    }
+
+    pReport->kp = UTIL_GainScaleS16((int32_t)pMechId->bandwidth * 
+                                    pReport->tmEstim, &pReport->kpScale);
+
+    zero = pMechId->bandwidth >> 2;
+    pole = (int32_t)pReport->viscous / pReport->tmEstim;
+    if (pole > zero)
+    {
+        zero = (int16_t)pole;
+    }
+    pReport->ki = UTIL_GainScaleS16((__builtin_mulss(pReport->kp, zero) >> 15)
+                                    << pReport->kpScale, &pReport->kiScale);
+
+    pMechId->pPISpeed->kp = pReport->kp;
+    pMechId->pPISpeed->nkp = pReport->kpScale;
+    pMechId->pPISpeed->ki = pReport->ki;
+    pMechId->pPISpeed->nki = pReport->kiScale;
+}
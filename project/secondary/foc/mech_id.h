@@ -0,0 +1,176 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file mech_id.h
+ *
+ * @brief This module implements identification of the mechanical parameters
+ * (inertia, viscous and Coulomb friction), online inertia estimation and
+ * gain scheduling of the speed controller.
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+#ifndef MECH_ID_H
+#define	MECH_ID_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include "foc_control_types.h"
+#include "sat_pi/sat_pi.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS/MACROS ">
+
+/* Number of samples averaged (2^MECH_ID_AVG_SHIFT) at constant speed */
+#define MECH_ID_AVG_SHIFT           12
+/* Online inertia estimation window (2^MECH_ID_WINDOW_SHIFT samples) */
+#define MECH_ID_WINDOW_SHIFT        8
+/* Online inertia estimate filter : tm += (tm window - tm)/2^SHIFT */
+#define MECH_ID_FILTER_SHIFT        3
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="ENUMERATED CONSTANTS ">
+
+typedef enum
+{
+    MECH_ID_IDLE = 0,           /* Identification not running */
+    MECH_ID_SPEED_LOW = 1,      /* Friction measurement at low speed */
+    MECH_ID_ACCEL = 2,          /* Inertia measurement during speed ramp */
+    MECH_ID_SPEED_HIGH = 3,     /* Friction measurement at high speed */
+    MECH_ID_COMPLETE = 4,       /* Identification completed */
+    MECH_ID_FAULT = 5,          /* Identification failed */
+
+}MCAPP_MECH_ID_STATE_T;
+
+typedef enum
+{
+    MECH_ID_STATUS_NONE = 0,    /* No result available */
+    MECH_ID_STATUS_VALID = 1,   /* Mechanical parameters identified */
+    MECH_ID_STATUS_ERROR = 2,   /* Identification failed */
+
+}MCAPP_MECH_ID_STATUS_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
+
+/* Mechanical parameters, normalized to peak current and peak speed :
+ * iq = tm*(delta speed per PWM period) + viscous*speed + coulomb.
+ * tm is the mechanical time constant in PWM periods (time to accelerate 
+ * to peak speed at peak current) */
+typedef struct
+{
+    int16_t
+        status,             /* Result status MCAPP_MECH_ID_STATUS_T */
+        viscous,            /* Viscous friction (Q15) */
+        coulomb,            /* Coulomb friction current */
+        kp,                 /* Speed controller proportional gain */
+        kpScale,            /* Scaling for kp */
+        ki,                 /* Speed controller integral gain */
+        kiScale;            /* Scaling for ki */
+
+    int32_t
+        tm,                 /* Identified mechanical time constant */
+        tmEstim;            /* Online estimate of mechanical time constant */
+
+}MCAPP_MECH_ID_REPORT_T;
+
+typedef struct
+{
+    int16_t
+        enable,             /* Mechanical identification enable */
+        request,            /* Identification request, set by diagnostics */
+        state,              /* Identification state MCAPP_MECH_ID_STATE_T */
+        onlineEnable,       /* Online inertia estimation enable */
+        scheduleEnable,     /* Speed controller gain scheduling enable */
+        speedLow,           /* Low test speed */
+        speedHigh,          /* High test speed */
+        bandwidth,          /* Speed controller bandwidth : omega*Ts */
+        accelMin,           /* Minimum speed change in online window */
+        iqLow,              /* Mean current at low speed */
+        speedLowMeas,       /* Mean speed at low speed */
+        iqAccel,            /* Mean current during speed ramp */
+        speedAccel,         /* Mean speed during speed ramp */
+        speedDelta,         /* Speed change in speed ramp measurement */
+        speedStart,         /* Speed at start of averaging window */
+        speedEnd,           /* Speed at end of averaging window */
+        speedPrev;          /* Speed at start of online window */
+
+    uint16_t
+        counter,            /* Sample counter */
+        settleCount,        /* Samples before measurement starts */
+        windowCounter;      /* Online estimation sample counter */
+
+    int32_t
+        sumCurrent,         /* Sum of current samples */
+        sumSpeed,           /* Sum of speed samples */
+        sumWindow;          /* Sum of current samples in online window */
+
+    MCAPP_MECH_ID_REPORT_T
+        report;             /* Mechanical parameters */
+
+    MCAPP_CONTROL_T *pCtrlParam;
+    const int16_t *pIq;
+    const int16_t *pVelEstim;
+    MCAPP_PISTATE_T *pPISpeed;
+
+}MCAPP_MECH_ID_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+void MCAPP_MechIdInit(MCAPP_MECH_ID_T *);
+void MCAPP_MechanicalIdentification(MCAPP_MECH_ID_T *);
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* MECH_ID_H */
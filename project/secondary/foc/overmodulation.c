@@ -0,0 +1,261 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file overmodulation.c
+ *
+ * @brief This module implements the overmodulation stage of the space vector
+ * modulator (linear -> OM-I -> OM-II -> six-step).
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <libq.h>
+#include "overmodulation.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS/MACROS ">
+
+#define Q14_TWO_BY_SQRT_3   18919 /* 2/sqrt(3) */
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+static uint16_t MCAPP_OvermodulationDuty(const MCAPP_OVERMODULATION_T *,
+                                                    int32_t, uint16_t);
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLES ">
+
+/* Gain applied to the reference voltage so that the fundamental of the
+ * clamped output voltage equals the reference. Table is indexed by the
+ * reference magnitude from OVERMOD_LINEAR_LIMIT in steps of
+ * 2^OVERMOD_TABLE_SHIFT, gain in Q12. Last entries drive six-step. */
+static const int16_t overmodGainTable[OVERMOD_TABLE_SIZE] =
+{
+    4096, 4101, 4113, 4131, 4157, 4193, 4243, 4318, 4459,
+    4760, 5152, 5684, 6460, 7737, 10442, 27154, 32767
+};
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_OvermodulationInit(MCAPP_OVERMODULATION_T *) </B>
+*
+* @brief Function to reset variables used for overmodulation.
+*
+* @param Pointer to the data structure containing overmodulation parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_OvermodulationInit(&overmod); </CODE>
+*
+*/
+void MCAPP_OvermodulationInit(MCAPP_OVERMODULATION_T *pOvermod)
+{
+    pOvermod->voltageMag = 0;
+    pOvermod->gain = (1 << OVERMOD_GAIN_QVALUE);
+    pOvermod->region = OVERMOD_LINEAR;
+}
+
+/**
+* <B> Function: MCAPP_Overmodulation(MCAPP_OVERMODULATION_T *,
+*                       const MC_ABC_T *, uint16_t, MC_DUTYCYCLEOUT_T *) </B>
+*
+* @brief Function computes the duty cycles when the reference voltage
+*        exceeds the linear range of space vector modulation.
+*        The reference (normalized to Vdc) is amplified by a gain from the
+*        look up table and min-max centred. Duties are clamped, which limits
+*        the voltage vector to the hexagon sides (OM-I), holds it at the
+*        vertices (OM-II) and ends in six-step operation, while the gain
+*        keeps the fundamental of the output equal to the reference.
+*
+* @param Pointer to the data structure containing overmodulation parameters.
+* @param Pointer to the phase voltages normalized to DC link voltage.
+* @param PWM period.
+* @param Pointer to the duty cycle outputs.
+* @return 0 - reference in linear region, duties are not computed.
+*         1 - duties computed by overmodulation.
+*
+* @example
+* <CODE> status = MCAPP_Overmodulation(&overmod, &vabc, period, &duty); </CODE>
+*
+*/
+uint16_t MCAPP_Overmodulation(MCAPP_OVERMODULATION_T *pOvermod,
+                    const MC_ABC_T *pvabc, uint16_t period,
+                    MC_DUTYCYCLEOUT_T *pDuty)
+{
+    int16_t vBeta, vMax, vMin, vZero, index, delta;
+    int32_t dutyA, dutyB, dutyC;
+
+    if (pOvermod->enable == 0)
+    {
+        pOvermod->region = OVERMOD_LINEAR;
+        return 0;
+    }
+
+    /* Compute reference voltage vector magnitude */
+    vBeta = (int16_t)(__builtin_mulss(((pvabc->b >> 1) - (pvabc->c >> 1)),
+                                                Q14_TWO_BY_SQRT_3) >> 14);
+    pOvermod->voltageMag = _Q15sqrt(
+                    (int16_t)(__builtin_mulss(pvabc->a, pvabc->a) >> 15) +
+                    (int16_t)(__builtin_mulss(vBeta, vBeta) >> 15));
+
+    if (pOvermod->voltageMag <= OVERMOD_LINEAR_LIMIT)
+    {
+        pOvermod->gain = (1 << OVERMOD_GAIN_QVALUE);
+        pOvermod->region = OVERMOD_LINEAR;
+        return 0;
+    }
+
+    /* Interpolate reference gain from the look up table */
+    delta = pOvermod->voltageMag - OVERMOD_LINEAR_LIMIT;
+    index = delta >> OVERMOD_TABLE_SHIFT;
+    if (index >= (OVERMOD_TABLE_SIZE - 1))
+    {
+        pOvermod->gain = overmodGainTable[OVERMOD_TABLE_SIZE - 1];
+    }
+    else
+    {
+        delta = delta & ((1 << OVERMOD_TABLE_SHIFT) - 1);
+        pOvermod->gain = overmodGainTable[index] +
+            (int16_t)(__builtin_mulss((overmodGainTable[index + 1] -
+                overmodGainTable[index]), delta) >> OVERMOD_TABLE_SHIFT);
+    }
+
+    if (pOvermod->voltageMag >= OVERMOD_SIX_STEP_LIMIT)
+    {
+        pOvermod->region = OVERMOD_SIX_STEP;
+    }
+    else if (__builtin_mulss(pOvermod->voltageMag, pOvermod->gain) <=
+            ((int32_t)OVERMOD_HEXAGON_VERTEX << OVERMOD_GAIN_QVALUE))
+    {
+        pOvermod->region = OVERMOD_REGION_I;
+    }
+    else
+    {
+        pOvermod->region = OVERMOD_REGION_II;
+    }
+
+    /* Min-max zero sequence, identical to the one of space vector modulation */
+    vMax = pvabc->a;
+    vMin = pvabc->a;
+    if (pvabc->b > vMax)
+    {
+        vMax = pvabc->b;
+    }
+    else if (pvabc->b < vMin)
+    {
+        vMin = pvabc->b;
+    }
+    if (pvabc->c > vMax)
+    {
+        vMax = pvabc->c;
+    }
+    else if (pvabc->c < vMin)
+    {
+        vMin = pvabc->c;
+    }
+    vZero = (vMax >> 1) + (vMin >> 1);
+
+    /* Amplified and centred reference : duty = 0.5 + gain*(v - vZero) */
+    dutyA = (__builtin_mulss((pvabc->a - vZero), pOvermod->gain)
+                                    >> OVERMOD_GAIN_QVALUE) + 16384;
+    dutyB = (__builtin_mulss((pvabc->b - vZero), pOvermod->gain)
+                                    >> OVERMOD_GAIN_QVALUE) + 16384;
+    dutyC = (__builtin_mulss((pvabc->c - vZero), pOvermod->gain)
+                                    >> OVERMOD_GAIN_QVALUE) + 16384;
+
+    pDuty->dutycycle1 = MCAPP_OvermodulationDuty(pOvermod, dutyA, period);
+    pDuty->dutycycle2 = MCAPP_OvermodulationDuty(pOvermod, dutyB, period);
+    pDuty->dutycycle3 = MCAPP_OvermodulationDuty(pOvermod, dutyC, period);
+
+    return 1;
+}
+
+// </editor-fold>
+
+/**
+* <B> Function: MCAPP_OvermodulationDuty(const MCAPP_OVERMODULATION_T *,
+*                                                   int32_t, uint16_t) </B>
+*
+* @brief Function converts the normalized duty to PWM counts and applies the
+*        duty limits, which keep a minimum pulse width for shunt current
+*        sampling.
+*
+* @param Pointer to the data structure containing overmodulation parameters.
+* @param Duty normalized to PWM period (Q15).
+* @param PWM period.
+* @return Duty in PWM counts.
+* @example
+* <CODE> duty = MCAPP_OvermodulationDuty(&overmod, dutyA, period); </CODE>
+*
+*/
+static uint16_t MCAPP_OvermodulationDuty(const MCAPP_OVERMODULATION_T *pOvermod,
+                                                int32_t duty, uint16_t period)
+{
+    uint16_t dutyCount;
+
+    if (duty < 0)
+    {
+        duty = 0;
+    }
+    else if (duty > 32767)
+    {
+        duty = 32767;
+    }
+
+    dutyCount = (uint16_t)(__builtin_muluu(period, (uint16_t)duty) >> 15);
+
+    if (dutyCount < pOvermod->dutyMin)
+    {
+        dutyCount = pOvermod->dutyMin;
+    }
+    else if (dutyCount > pOvermod->dutyMax)
+    {
+        dutyCount = pOvermod->dutyMax;
+    }
+    return dutyCount;
+}
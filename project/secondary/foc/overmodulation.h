@@ -0,0 +1,126 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file overmodulation.h
+ *
+ * @brief This module implements the overmodulation stage of the space vector
+ * modulator (linear -> OM-I -> OM-II -> six-step).
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+#ifndef OVERMODULATION_H
+#define	OVERMODULATION_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include "motor_control.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS/MACROS ">
+
+/* Voltage magnitudes below are normalized to the DC link voltage (Q15) */
+
+/* Linear SVM limit : radius of circle inscribed in the hexagon = 1/sqrt(3) */
+#define OVERMOD_LINEAR_LIMIT        18919
+/* Fundamental voltage of six-step operation = 2/pi */
+#define OVERMOD_SIX_STEP_LIMIT      20861
+/* Radius of the hexagon vertices = 2/3 ; boosted reference magnitude beyond
+   this value holds the voltage vector at the vertices (OM-II) */
+#define OVERMOD_HEXAGON_VERTEX      21845
+
+/* Reference gain table : index step (2^OVERMOD_TABLE_SHIFT) and size */
+#define OVERMOD_TABLE_SHIFT         7
+#define OVERMOD_TABLE_SIZE          17
+/* Q format of the reference gain */
+#define OVERMOD_GAIN_QVALUE         12
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="ENUMERATED CONSTANTS ">
+
+typedef enum
+{
+    OVERMOD_LINEAR = 0,         /* Linear SVM region */
+    OVERMOD_REGION_I = 1,       /* OM-I : vector limited to hexagon sides */
+    OVERMOD_REGION_II = 2,      /* OM-II : vector held at hexagon vertices */
+    OVERMOD_SIX_STEP = 3,       /* Six-step operation */
+
+}MCAPP_OVERMOD_REGION_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
+
+typedef struct
+{
+    int16_t
+        enable,             /* Overmodulation enable */
+        voltageMag,         /* Reference voltage magnitude normalized to Vdc */
+        gain,               /* Reference gain applied in overmodulation */
+        region;             /* Modulation region MCAPP_OVERMOD_REGION_T */
+
+    uint16_t
+        dutyMin,            /* Minimum duty count */
+        dutyMax;            /* Maximum duty count */
+
+} MCAPP_OVERMODULATION_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+void MCAPP_OvermodulationInit(MCAPP_OVERMODULATION_T *);
+uint16_t MCAPP_Overmodulation(MCAPP_OVERMODULATION_T *, const MC_ABC_T *,
+                                        uint16_t, MC_DUTYCYCLEOUT_T *);
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* OVERMODULATION_H */
@@ -0,0 +1,572 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file param_id.c
+ *
+ * @brief This module implements identification of the motor parameters
+ * (stator resistance, inductance and BEMF constant) used by the PLL
+ * estimator and tuning of the current controllers.
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <libq.h>
+#include "param_id.h"
+#include "foc.h"
+#include "general.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+static void MCAPP_ParamIdDCInjection(MCAPP_PARAM_ID_T *, int16_t);
+static int16_t MCAPP_ParamIdAverage(MCAPP_PARAM_ID_T *, int16_t, int16_t);
+static void MCAPP_ParamIdVoltageOutput(const MCAPP_PARAM_ID_T *);
+static int16_t MCAPP_ParamIdNormalize(int32_t, int16_t, int16_t *);
+static void MCAPP_ParamIdCurrentGains(MCAPP_PARAM_ID_T *);
+static void MCAPP_ParamIdCurrentStep(MCAPP_PARAM_ID_T *);
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_ParamIdInit(MCAPP_PARAM_ID_T *) </B>
+*
+* @brief Function to reset variables used for parameter identification.
+*        Test current controller uses the gains of the d axis current
+*        controller.
+*
+* @param Pointer to the data structure containing parameter identification
+*        variables.
+* @return none.
+* @example
+* <CODE> MCAPP_ParamIdInit(&paramId); </CODE>
+*
+*/
+void MCAPP_ParamIdInit(MCAPP_PARAM_ID_T *pParamId)
+{
+    const MCAPP_PISTATE_T *pPIDCurrent = &pParamId->pFOC->piDCurrent;
+
+    pParamId->piCurrent.kp = pPIDCurrent->kp;
+    pParamId->piCurrent.nkp = pPIDCurrent->nkp;
+    pParamId->piCurrent.ki = pPIDCurrent->ki;
+    pParamId->piCurrent.nki = pPIDCurrent->nki;
+    pParamId->piCurrent.kc = pPIDCurrent->kc;
+    pParamId->piCurrent.outMax = pParamId->voltageLimit;
+    pParamId->piCurrent.outMin = -pParamId->voltageLimit;
+    MCAPP_ControllerPIInit(&pParamId->piCurrent);
+
+    pParamId->state = PARAM_ID_IDLE;
+    pParamId->vOut = 0;
+    pParamId->counter = 0;
+    pParamId->sumVoltage = 0;
+    pParamId->sumCurrent = 0;
+}
+
+/**
+* <B> Function: MCAPP_ParamIdStateMachine(MCAPP_PARAM_ID_T *) </B>
+*
+* @brief Function executes the parameter identification sequence :
+*        (1) Rs : DC current is injected along phase a (rotor aligns to it)
+*            at two test currents; Rs = delta V/delta I eliminates the 
+*            voltage error of the inverter.
+*        (2) Ls : a voltage step is added to the high test voltage and the
+*            current rise is timed; Ls/Ts = (V step - Rs*delta I/2)*N/delta I.
+*        (3) Current controller : gains are computed for the target bandwidth
+*            and verified by a step response from low to high test current;
+*            bandwidth is reduced if overshoot or settling time exceed limits.
+*        (4) Ke : identified Rs and Ls are loaded to the estimator and the 
+*            motor is spun in open loop; at the end of the speed ramp
+*            1/Kfi = speed/BEMF magnitude.
+*        State PARAM_ID_KE requires the FOC state machine to be executed
+*        after this function.
+*
+* @param Pointer to the data structure containing parameter identification
+*        variables.
+* @return none.
+* @example
+* <CODE> MCAPP_ParamIdStateMachine(&paramId); </CODE>
+*
+*/
+void MCAPP_ParamIdStateMachine(MCAPP_PARAM_ID_T *pParamId)
+{
+    MCAPP_FOC_T *pFOC = pParamId->pFOC;
+    MCAPP_PARAM_ID_REPORT_T *pReport = &pParamId->report;
+    int16_t deltaI, deltaV, eMag;
+
+    switch (pParamId->state)
+    {
+        case PARAM_ID_IDLE:
+            MCAPP_ControllerPIInit(&pParamId->piCurrent);
+            pReport->status = PARAM_ID_STATUS_NONE;
+            pReport->bandwidth = pParamId->bandwidth;
+            pParamId->tuneAttempt = 0;
+            pParamId->vOut = 0;
+            pParamId->counter = 0;
+            pParamId->state = PARAM_ID_RS_LOW;
+            break;
+
+        case PARAM_ID_RS_LOW:
+            MCAPP_ParamIdDCInjection(pParamId, pParamId->testCurrentLow);
+            if (MCAPP_ParamIdAverage(pParamId, pParamId->vOut, *pFOC->pIa))
+            {
+                pParamId->vLow = (int16_t)(pParamId->sumVoltage >> PARAM_ID_AVG_SHIFT);
+                pParamId->iLow = (int16_t)(pParamId->sumCurrent >> PARAM_ID_AVG_SHIFT);
+                pParamId->state = PARAM_ID_RS_HIGH;
+            }
+            break;
+
+        case PARAM_ID_RS_HIGH:
+            MCAPP_ParamIdDCInjection(pParamId, pParamId->testCurrentHigh);
+            if (MCAPP_ParamIdAverage(pParamId, pParamId->vOut, *pFOC->pIa))
+            {
+                pParamId->vHigh = (int16_t)(pParamId->sumVoltage >> PARAM_ID_AVG_SHIFT);
+                pParamId->iHigh = (int16_t)(pParamId->sumCurrent >> PARAM_ID_AVG_SHIFT);
+
+                deltaV = pParamId->vHigh - pParamId->vLow;
+                deltaI = pParamId->iHigh - pParamId->iLow;
+                if ((deltaV <= 0) || (deltaI <= 0))
+                {
+                    pReport->status = PARAM_ID_STATUS_RS_ERROR;
+                    pParamId->state = PARAM_ID_FAULT;
+                    break;
+                }
+                pReport->rs = MCAPP_ParamIdNormalize(deltaV, deltaI,
+                                                        &pReport->rsScale);
+
+                /* Apply voltage step from the high test current steady state.
+                   Step is at least twice the resistive drop of the current
+                   rise, so that the rise is close to linear */
+                deltaV = __builtin_divsd(__builtin_mulss(deltaV,
+                                    pParamId->lsDeltaCurrent), deltaI) << 1;
+                if (deltaV < pParamId->lsStepVoltage)
+                {
+                    deltaV = pParamId->lsStepVoltage;
+                }
+                pParamId->vOut = UTIL_LimitS16(pParamId->vHigh + deltaV,
+                                    -pParamId->voltageLimit, pParamId->voltageLimit);
+                pParamId->counter = 0;
+                pParamId->state = PARAM_ID_LS;
+                MCAPP_ParamIdVoltageOutput(pParamId);
+            }
+            break;
+
+        case PARAM_ID_LS:
+            pParamId->counter++;
+            deltaI = *pFOC->pIa - pParamId->iHigh;
+            if ((deltaI >= pParamId->lsDeltaCurrent) ||
+                (pParamId->counter >= PARAM_ID_LS_MAX_COUNT))
+            {
+                if (deltaI <= 0)
+                {
+                    pReport->status = PARAM_ID_STATUS_LS_ERROR;
+                    pParamId->state = PARAM_ID_FAULT;
+                    break;
+                }
+                /* Resistive drop at the mean current of the step */
+                deltaV = pParamId->vOut - pParamId->vHigh - __builtin_divsd(
+                        (__builtin_mulss((pParamId->vHigh - pParamId->vLow),
+                        deltaI) >> 1), (pParamId->iHigh - pParamId->iLow));
+                if (deltaV <= 0)
+                {
+                    pReport->status = PARAM_ID_STATUS_LS_ERROR;
+                    pParamId->state = PARAM_ID_FAULT;
+                    break;
+                }
+                pReport->lsDt = MCAPP_ParamIdNormalize(
+                            __builtin_mulss(deltaV, (int16_t)pParamId->counter),
+                            deltaI, &pReport->lsDtScale);
+                pParamId->vOut = pParamId->vHigh;
+                pParamId->counter = 0;
+                pParamId->state = PARAM_ID_PI_TUNE;
+            }
+            MCAPP_ParamIdVoltageOutput(pParamId);
+            break;
+
+        case PARAM_ID_PI_TUNE:
+            if (pParamId->counter == 0)
+            {
+                MCAPP_ParamIdCurrentGains(pParamId);
+            }
+            /* Settle at low test current with the computed gains */
+            MCAPP_ParamIdDCInjection(pParamId, pParamId->testCurrentLow);
+            pParamId->counter++;
+            if (pParamId->counter >= pParamId->settleCount)
+            {
+                pParamId->counter = 0;
+                pParamId->peakCurrent = *pFOC->pIa;
+                pReport->settleTime = 0;
+                pParamId->state = PARAM_ID_PI_STEP;
+            }
+            break;
+
+        case PARAM_ID_PI_STEP:
+            MCAPP_ParamIdCurrentStep(pParamId);
+            break;
+
+        case PARAM_ID_KE_START:
+            /* Estimator computes BEMF with the identified parameters */
+            pFOC->pMotor->qRs = pReport->rs;
+            pFOC->pMotor->qRsScale = pReport->rsScale;
+            pFOC->pMotor->qLsDt = pReport->lsDt;
+            pFOC->pMotor->qLsDtScale = pReport->lsDtScale;
+
+            pFOC->piDCurrent.kp = pReport->kp;
+            pFOC->piDCurrent.nkp = pReport->kpScale;
+            pFOC->piDCurrent.ki = pReport->ki;
+            pFOC->piDCurrent.nki = pReport->kiScale;
+            pFOC->piQCurrent.kp = pReport->kp;
+            pFOC->piQCurrent.nkp = pReport->kpScale;
+            pFOC->piQCurrent.ki = pReport->ki;
+            pFOC->piQCurrent.nki = pReport->kiScale;
+
+            pParamId->openLoop = pFOC->ctrlParam.openLoop;
+            pFOC->ctrlParam.openLoop = 1;
+            MCAPP_FOCInit(pFOC);
+            pFOC->focState = FOC_RTR_LOCK;
+
+            pParamId->counter = 0;
+            pParamId->state = PARAM_ID_KE;
+            break;
+
+        case PARAM_ID_KE:
+            if ((pFOC->focState != FOC_OPEN_LOOP) ||
+                (pFOC->ctrlParam.qVelRef < pFOC->pMotor->qMaxOLSpeed))
+            {
+                break;
+            }
+            eMag = _Q15sqrt(
+                (int16_t)(__builtin_mulss(pFOC->estimPLL.qEsdf, pFOC->estimPLL.qEsdf) >> 15) +
+                (int16_t)(__builtin_mulss(pFOC->estimPLL.qEsqf, pFOC->estimPLL.qEsqf) >> 15));
+            if (MCAPP_ParamIdAverage(pParamId, eMag, 0))
+            {
+                pFOC->ctrlParam.openLoop = pParamId->openLoop;
+                eMag = (int16_t)(pParamId->sumVoltage >> PARAM_ID_AVG_SHIFT);
+                if (eMag <= 0)
+                {
+                    pReport->status = PARAM_ID_STATUS_KE_ERROR;
+                    pParamId->state = PARAM_ID_FAULT;
+                    break;
+                }
+                pReport->invKfi = MCAPP_ParamIdNormalize(
+                            pFOC->ctrlParam.qVelRef, eMag, &pReport->invKfiScale);
+                pFOC->estimPLL.qInvKfiConst = pReport->invKfi;
+                pFOC->estimPLL.qInvKfiConstScale = pReport->invKfiScale;
+
+                pReport->status = PARAM_ID_STATUS_VALID;
+                pParamId->state = PARAM_ID_COMPLETE;
+            }
+            break;
+
+        case PARAM_ID_COMPLETE:
+        case PARAM_ID_FAULT:
+        default:
+            break;
+    }
+}
+
+/**
+* <B> Function: MCAPP_ParamIdStop(MCAPP_PARAM_ID_T *) </B>
+*
+* @brief Function ends the identification sequence and restores the open
+*        loop setting if the sequence is aborted during the BEMF test.
+*
+* @param Pointer to the data structure containing parameter identification
+*        variables.
+* @return none.
+* @example
+* <CODE> MCAPP_ParamIdStop(&paramId); </CODE>
+*
+*/
+void MCAPP_ParamIdStop(MCAPP_PARAM_ID_T *pParamId)
+{
+    if (pParamId->state == PARAM_ID_KE)
+    {
+        pParamId->pFOC->ctrlParam.openLoop = pParamId->openLoop;
+    }
+    if ((pParamId->state != PARAM_ID_COMPLETE) && 
+        (pParamId->state != PARAM_ID_FAULT))
+    {
+        pParamId->state = PARAM_ID_IDLE;
+    }
+}
+
+// </editor-fold>
+
+/**
+* <B> Function: MCAPP_ParamIdDCInjection(MCAPP_PARAM_ID_T *, int16_t) </B>
+*
+* @brief Function regulates phase a current to the test current.
+*
+* @param Pointer to the data structure containing parameter identification
+*        variables.
+* @param Test current.
+* @return none.
+* @example
+* <CODE> MCAPP_ParamIdDCInjection(&paramId, current); </CODE>
+*
+*/
+static void MCAPP_ParamIdDCInjection(MCAPP_PARAM_ID_T *pParamId, int16_t current)
+{
+    MCAPP_ControllerPIUpdate(current, *pParamId->pFOC->pIa,
+            &pParamId->piCurrent, MCAPP_SAT_NONE, &pParamId->vOut, current);
+    MCAPP_ParamIdVoltageOutput(pParamId);
+}
+
+/**
+* <B> Function: MCAPP_ParamIdAverage(MCAPP_PARAM_ID_T *, int16_t, int16_t) </B>
+*
+* @brief Function accumulates 2^PARAM_ID_AVG_SHIFT voltage and current 
+*        samples after the settling time. Sums are reset at the start of
+*        the next measurement.
+*
+* @param Pointer to the data structure containing parameter identification
+*        variables.
+* @param Voltage sample.
+* @param Current sample.
+* @return 1 - accumulation completed, 0 - otherwise.
+* @example
+* <CODE> status = MCAPP_ParamIdAverage(&paramId, vOut, ia); </CODE>
+*
+*/
+static int16_t MCAPP_ParamIdAverage(MCAPP_PARAM_ID_T *pParamId, 
+                                        int16_t voltage, int16_t current)
+{
+    if (pParamId->counter == 0)
+    {
+        pParamId->sumVoltage = 0;
+        pParamId->sumCurrent = 0;
+    }
+    pParamId->counter++;
+    if (pParamId->counter > pParamId->settleCount)
+    {
+        pParamId->sumVoltage += voltage;
+        pParamId->sumCurrent += current;
+    }
+    if (pParamId->counter >= (pParamId->settleCount + (1 << PARAM_ID_AVG_SHIFT)))
+    {
+        pParamId->counter = 0;
+        return 1;
+    }
+    return 0;
+}
+
+/**
+* <B> Function: MCAPP_ParamIdVoltageOutput(const MCAPP_PARAM_ID_T *) </B>
+*
+* @brief Function applies the test voltage along phase a axis :
+*        duty a = 0.5 + 3/4*Valpha/Vdc, duty b = duty c = 0.5 - 3/4*Valpha/Vdc.
+*
+* @param Pointer to the data structure containing parameter identification
+*        variables.
+* @return none.
+* @example
+* <CODE> MCAPP_ParamIdVoltageOutput(&paramId); </CODE>
+*
+*/
+static void MCAPP_ParamIdVoltageOutput(const MCAPP_PARAM_ID_T *pParamId)
+{
+    MCAPP_FOC_T *pFOC = pParamId->pFOC;
+    const int16_t vdc = *pFOC->pVdc;
+    int16_t vPhase, modIndex, dutyDelta, halfPeriod;
+
+    /* Test voltage normalized to peak voltage, limited below Vdc */
+    vPhase = (int16_t)(__builtin_mulss(pParamId->vOut, pParamId->vdcBase) >> 15);
+    if ((vdc <= 0) || (vPhase >= vdc) || (-vPhase >= vdc))
+    {
+        modIndex = 0;
+    }
+    else
+    {
+        modIndex = __builtin_divsd(((int32_t)vPhase << 15), vdc);
+    }
+
+    halfPeriod = (int16_t)(pFOC->pwmPeriod >> 1);
+    dutyDelta = (int16_t)(__builtin_mulss(
+                (int16_t)(__builtin_mulss(modIndex, PARAM_ID_DUTY_GAIN) >> 15),
+                halfPeriod) >> 14);
+    dutyDelta = UTIL_LimitS16(dutyDelta, (int16_t)pParamId->dutyMin - halfPeriod,
+                                    (int16_t)pParamId->dutyMax - halfPeriod);
+
+    pFOC->pPWMDuty->dutycycle1 = (uint16_t)(halfPeriod + dutyDelta);
+    pFOC->pPWMDuty->dutycycle2 = (uint16_t)(halfPeriod - dutyDelta);
+    pFOC->pPWMDuty->dutycycle3 = (uint16_t)(halfPeriod - dutyDelta);
+}
+
+/**
+* <B> Function: MCAPP_ParamIdCurrentGains(MCAPP_PARAM_ID_T *) </B>
+*
+* @brief Function computes the current controller gains placing the 
+*        controller zero on the R-L pole : Kp = omega*Ts*Ls/Ts,
+*        Ki = omega*Ts*Rs, which gives a first order closed loop response 
+*        with bandwidth omega. Gains are loaded to the test current 
+*        controller.
+*
+* @param Pointer to the data structure containing parameter identification
+*        variables.
+* @return none.
+* @example
+* <CODE> MCAPP_ParamIdCurrentGains(&paramId); </CODE>
+*
+*/
+static void MCAPP_ParamIdCurrentGains(MCAPP_PARAM_ID_T *pParamId)
+{
+    MCAPP_PARAM_ID_REPORT_T *pReport = &pParamId->report;
+
+    pReport->kp = UTIL_GainScaleS16(__builtin_mulss(pReport->bandwidth,
+                    pReport->lsDt) >> pReport->lsDtScale, &pReport->kpScale);
+    pReport->ki = UTIL_GainScaleS16(__builtin_mulss(pReport->bandwidth,
+                    pReport->rs) >> pReport->rsScale, &pReport->kiScale);
+
+    pParamId->piCurrent.kp = pReport->kp;
+    pParamId->piCurrent.nkp = pReport->kpScale;
+    pParamId->piCurrent.ki = pReport->ki;
+    pParamId->piCurrent.nki = pReport->kiScale;
+}
+
+/**
+* <B> Function: MCAPP_ParamIdCurrentStep(MCAPP_PARAM_ID_T *) </B>
+*
+* @brief Function executes the current controller step response test from 
+*        low to high test current and checks overshoot and settling time.
+*        On failure, the gains are computed again for a reduced bandwidth.
+*
+* @param Pointer to the data structure containing parameter identification
+*        variables.
+* @return none.
+* @example
+* <CODE> MCAPP_ParamIdCurrentStep(&paramId); </CODE>
+*
+*/
+static void MCAPP_ParamIdCurrentStep(MCAPP_PARAM_ID_T *pParamId)
+{
+    MCAPP_PARAM_ID_REPORT_T *pReport = &pParamId->report;
+    const int16_t current = *pParamId->pFOC->pIa;
+    const int16_t step = pParamId->testCurrentHigh - pParamId->testCurrentLow;
+    int16_t error, band, overshoot;
+
+    MCAPP_ParamIdDCInjection(pParamId, pParamId->testCurrentHigh);
+    pParamId->counter++;
+
+    if (current > pParamId->peakCurrent)
+    {
+        pParamId->peakCurrent = current;
+    }
+    error = current - pParamId->testCurrentHigh;
+    band = (int16_t)(__builtin_mulss(step, PARAM_ID_PI_SETTLE_BAND) >> 15);
+    if ((error > band) || (error < -band))
+    {
+        pReport->settleTime = (int16_t)pParamId->counter;
+    }
+
+    if (pParamId->counter < PARAM_ID_PI_STEP_COUNT)
+    {
+        return;
+    }
+
+    overshoot = pParamId->peakCurrent - pParamId->testCurrentHigh;
+    if (overshoot <= 0)
+    {
+        pReport->overshoot = 0;
+    }
+    else if (overshoot >= step)
+    {
+        pReport->overshoot = 32767;
+    }
+    else
+    {
+        pReport->overshoot = __builtin_divsd(((int32_t)overshoot << 15), step);
+    }
+
+    pParamId->counter = 0;
+    if ((pReport->overshoot <= pParamId->overshootMax) &&
+        (pReport->settleTime <= (int16_t)pParamId->settleTimeMax))
+    {
+        pParamId->state = PARAM_ID_KE_START;
+    }
+    else if (++pParamId->tuneAttempt < PARAM_ID_PI_TUNE_ATTEMPTS)
+    {
+        pReport->bandwidth = (int16_t)(__builtin_mulss(pReport->bandwidth,
+                                    PARAM_ID_PI_BANDWIDTH_STEP) >> 15);
+        pParamId->state = PARAM_ID_PI_TUNE;
+    }
+    else
+    {
+        pReport->status = PARAM_ID_STATUS_PI_ERROR;
+        pParamId->state = PARAM_ID_FAULT;
+    }
+}
+
+/**
+* <B> Function: MCAPP_ParamIdNormalize(int32_t, int16_t, int16_t *) </B>
+*
+* @brief Function computes the ratio num/den in the highest Q format 
+*        (up to Q15) which fits in 16 bits.
+*
+* @param Numerator (non negative).
+* @param Denominator (positive).
+* @param Pointer to the Q format of the result.
+* @return Ratio in the returned Q format.
+* @example
+* <CODE> rs = MCAPP_ParamIdNormalize(deltaV, deltaI, &rsScale); </CODE>
+*
+*/
+static int16_t MCAPP_ParamIdNormalize(int32_t num, int16_t den, int16_t *pScale)
+{
+    int32_t quotient = num / den;
+    int32_t remainder = num - (quotient * den);
+    int32_t value;
+    int16_t scale = 15;
+
+    while ((scale > 0) && (quotient >= ((int32_t)1 << (15 - scale))))
+    {
+        scale--;
+    }
+    value = (quotient << scale) + ((remainder << scale) / den);
+    if (value > 32767)
+    {
+        value = 32767;
+    }
+    *pScale = scale;
+    return (int16_t)value;
+}
@@ -0,0 +1,199 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file param_id.h
+ *
+ * @brief This module implements identification of the motor parameters
+ * (stator resistance, inductance and BEMF constant) used by the PLL
+ * estimator and tuning of the current controllers.
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+#ifndef PARAM_ID_H
+#define	PARAM_ID_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include "foc_types.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS/MACROS ">
+
+/* Number of samples averaged (2^PARAM_ID_AVG_SHIFT) in each measurement */
+#define PARAM_ID_AVG_SHIFT          10
+/* Maximum duration (PWM periods) of the inductance voltage step */
+#define PARAM_ID_LS_MAX_COUNT       64
+/* Phase a voltage to duty gain : duty deviation = 3/4*Valpha/Vdc, since 
+   Valpha = 2/3*(Va - Vb) when Vb = Vc = -Va */
+#define PARAM_ID_DUTY_GAIN          24576
+/* Duration (PWM periods) of the current controller step response test */
+#define PARAM_ID_PI_STEP_COUNT      128
+/* Settling band of the step response : 5% of the current step */
+#define PARAM_ID_PI_SETTLE_BAND     1638
+/* Number of tuning attempts, bandwidth is reduced to 3/4 after each failed
+   step response test */
+#define PARAM_ID_PI_TUNE_ATTEMPTS   3
+#define PARAM_ID_PI_BANDWIDTH_STEP  24576
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="ENUMERATED CONSTANTS ">
+
+typedef enum
+{
+    PARAM_ID_IDLE = 0,          /* Identification not started */
+    PARAM_ID_RS_LOW = 1,        /* DC injection at low test current */
+    PARAM_ID_RS_HIGH = 2,       /* DC injection at high test current */
+    PARAM_ID_LS = 3,            /* Voltage step for inductance */
+    PARAM_ID_PI_TUNE = 4,       /* Current controller gain calculation */
+    PARAM_ID_PI_STEP = 5,       /* Current controller step response test */
+    PARAM_ID_KE_START = 6,      /* Start open loop spin */
+    PARAM_ID_KE = 7,            /* BEMF measurement in open loop spin */
+    PARAM_ID_COMPLETE = 8,      /* Identification completed */
+    PARAM_ID_FAULT = 9,         /* Identification failed */
+
+}MCAPP_PARAM_ID_STATE_T;
+
+typedef enum
+{
+    PARAM_ID_STATUS_NONE = 0,       /* No result available */
+    PARAM_ID_STATUS_VALID = 1,      /* All parameters identified */
+    PARAM_ID_STATUS_RS_ERROR = 2,   /* Resistance measurement failed */
+    PARAM_ID_STATUS_LS_ERROR = 3,   /* Inductance measurement failed */
+    PARAM_ID_STATUS_KE_ERROR = 4,   /* BEMF measurement failed */
+    PARAM_ID_STATUS_PI_ERROR = 5,   /* Current controller step test failed */
+
+}MCAPP_PARAM_ID_STATUS_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
+
+/* Identification report, read through diagnostics (X2CScope). Values are
+ * in the format of the constants in mcx_user_params.h :
+ * rs/rsScale = NORM_RS/NORM_RS_QVALUE, lsDt/lsDtScale = 
+ * NORM_LSDT/NORM_LSDT_QVALUE, invKfi/invKfiScale = 
+ * NORM_INVKFI_CONST/NORM_INVKFI_CONST_QVALUE, kp/kpScale/ki/kiScale =
+ * D(Q)_CURRCNTR_PTERM/PTERM_SCALE/ITERM/ITERM_SCALE */
+typedef struct
+{
+    int16_t
+        status,             /* Result status MCAPP_PARAM_ID_STATUS_T */
+        rs,                 /* Normalized stator resistance */
+        rsScale,            /* Scaling for rs */
+        lsDt,               /* Normalized stator inductance/delta t */
+        lsDtScale,          /* Scaling for lsDt */
+        invKfi,             /* Normalized inverse of BEMF constant */
+        invKfiScale,        /* Scaling for invKfi */
+        kp,                 /* Current controller proportional gain */
+        kpScale,            /* Scaling for kp */
+        ki,                 /* Current controller integral gain */
+        kiScale,            /* Scaling for ki */
+        bandwidth,          /* Tuned bandwidth : omega*Ts */
+        overshoot,          /* Step response overshoot (fraction of step) */
+        settleTime;         /* Step response settling time in PWM periods */
+
+}MCAPP_PARAM_ID_REPORT_T;
+
+typedef struct
+{
+    int16_t
+        enable,             /* Parameter identification enable */
+        state,              /* Identification state MCAPP_PARAM_ID_STATE_T */
+        testCurrentLow,     /* Low DC test current */
+        testCurrentHigh,    /* High DC test current */
+        lsStepVoltage,      /* Voltage step for inductance measurement */
+        lsDeltaCurrent,     /* Current rise ending the voltage step */
+        voltageLimit,       /* Test voltage limit */
+        bandwidth,          /* Current controller bandwidth : omega*Ts */
+        overshootMax,       /* Maximum step response overshoot */
+        peakCurrent,        /* Peak current of step response */
+        tuneAttempt,        /* Current controller tuning attempt */
+        vdcBase,            /* Base voltage normalized to peak voltage */
+        vOut,               /* Alpha axis test voltage */
+        vLow,               /* Voltage at low test current */
+        iLow,               /* Current at low test current */
+        vHigh,              /* Voltage at high test current */
+        iHigh,              /* Current at high test current */
+        openLoop;           /* Open loop setting saved during BEMF test */
+
+    uint16_t
+        counter,            /* Sample counter */
+        settleCount,        /* Samples before measurement starts */
+        settleTimeMax,      /* Maximum step response settling time */
+        dutyMin,            /* Minimum duty count */
+        dutyMax;            /* Maximum duty count */
+
+    int32_t
+        sumVoltage,         /* Sum of voltage samples */
+        sumCurrent;         /* Sum of current samples */
+
+    MCAPP_PISTATE_T
+        piCurrent;          /* Test current controller */
+
+    MCAPP_PARAM_ID_REPORT_T
+        report;             /* Identification results */
+
+    MCAPP_FOC_T *pFOC;
+
+}MCAPP_PARAM_ID_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+void MCAPP_ParamIdInit(MCAPP_PARAM_ID_T *);
+void MCAPP_ParamIdStateMachine(MCAPP_PARAM_ID_T *);
+void MCAPP_ParamIdStop(MCAPP_PARAM_ID_T *);
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* PARAM_ID_H */
@@ -0,0 +1,157 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file ride_through.c
+ *
+ * @brief This module implements the mains loss ride through : DC link 
+ * voltage is held by the kinetic energy of the motor.
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include "ride_through.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_RideThroughInit(MCAPP_RIDE_THROUGH_T *) </B>
+*
+* @brief Function to reset variables used for mains loss ride through.
+*
+* @param Pointer to the data structure containing ride through parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_RideThroughInit(&rideThrough); </CODE>
+*
+*/
+void MCAPP_RideThroughInit(MCAPP_RIDE_THROUGH_T *pRide)
+{
+    pRide->state = RIDE_THROUGH_IDLE;
+    pRide->iqRef = 0;
+    pRide->duration = 0;
+    MCAPP_ControllerPIInit(&pRide->piVdc);
+}
+
+/**
+* <B> Function: MCAPP_RideThrough(MCAPP_RIDE_THROUGH_T *) </B>
+*
+* @brief Function detects mains loss and return from the DC link voltage and
+*        regulates the DC link voltage during mains loss.
+*        Ride through is armed when the PFC regulates the DC link voltage 
+*        above vdcArm. Mains loss is detected when the voltage falls below 
+*        vdcRef : the DC link voltage controller then computes a 
+*        regenerative q axis current, which converts kinetic energy into DC
+*        link energy. Ride through ends (RIDE_THROUGH_EXIT for one period) 
+*        when the voltage rises above vdcReturn or the speed falls below 
+*        speedMin; it is armed again by the PFC.
+*
+* @param Pointer to the data structure containing ride through parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_RideThrough(&rideThrough); </CODE>
+*
+*/
+void MCAPP_RideThrough(MCAPP_RIDE_THROUGH_T *pRide)
+{
+    const int16_t vdc = *pRide->pVdc;
+    const int16_t velocity = *pRide->pVelEstim;
+    int16_t speed, regen;
+
+    speed = (velocity < 0) ? -velocity : velocity;
+
+    switch (pRide->state)
+    {
+        case RIDE_THROUGH_IDLE:
+        case RIDE_THROUGH_EXIT:
+            pRide->state = RIDE_THROUGH_IDLE;
+            if ((pRide->enable == 1) && (vdc > pRide->vdcArm))
+            {
+                pRide->state = RIDE_THROUGH_ARMED;
+            }
+            break;
+
+        case RIDE_THROUGH_ARMED:
+            if (pRide->enable == 0)
+            {
+                pRide->state = RIDE_THROUGH_IDLE;
+            }
+            else if ((vdc < pRide->vdcRef) && (speed > pRide->speedMin))
+            {
+                MCAPP_ControllerPIReset(&pRide->piVdc, 0);
+                pRide->iqRef = 0;
+                pRide->duration = 0;
+                pRide->eventCount++;
+                pRide->state = RIDE_THROUGH_ACTIVE;
+            }
+            break;
+
+        case RIDE_THROUGH_ACTIVE:
+            if ((vdc > pRide->vdcReturn) || (speed < pRide->speedMin))
+            {
+                pRide->state = RIDE_THROUGH_EXIT;
+                break;
+            }
+            if (pRide->duration < 0xFFFF)
+            {
+                pRide->duration++;
+            }
+            if (pRide->duration > pRide->durationMax)
+            {
+                pRide->durationMax = pRide->duration;
+            }
+
+            /* Regenerative current magnitude (outMin = 0) : positive when
+               DC link voltage is below the reference */
+            MCAPP_ControllerPIUpdate(pRide->vdcRef, vdc, &pRide->piVdc,
+                                        MCAPP_SAT_NONE, &regen, pRide->vdcRef);
+            pRide->iqRef = (velocity < 0) ? regen : -regen;
+            break;
+
+        default:
+            pRide->state = RIDE_THROUGH_IDLE;
+            break;
+    }
+}
+
+// </editor-fold>
@@ -0,0 +1,114 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file ride_through.h
+ *
+ * @brief This module implements the mains loss ride through : DC link 
+ * voltage is held by the kinetic energy of the motor.
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+#ifndef RIDE_THROUGH_H
+#define	RIDE_THROUGH_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include "sat_pi/sat_pi.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
+
+typedef enum
+{
+    RIDE_THROUGH_IDLE = 0,      /* DC link voltage not regulated */
+    RIDE_THROUGH_ARMED = 1,     /* DC link voltage regulated by PFC */
+    RIDE_THROUGH_ACTIVE = 2,    /* Line loss : DC link voltage regulated by
+                                   the motor */
+    RIDE_THROUGH_EXIT = 3,      /* Line returned : speed control resumes */
+}RIDE_THROUGH_STATE_T;
+
+typedef struct
+{
+    int16_t
+        enable,             /* Ride through enable */
+        vdcArm,             /* Vdc above which ride through is armed */
+        vdcRef,             /* Vdc reference during ride through, line loss
+                               is detected below it */
+        vdcReturn,          /* Vdc above which line has returned */
+        speedMin,           /* Minimum speed : kinetic energy exhausted */
+        iqRef;              /* q axis current reference during ride through */
+
+    RIDE_THROUGH_STATE_T
+        state;              /* Ride through state */
+
+    uint16_t
+        eventCount,         /* Line loss events */
+        duration,           /* Duration of the last ride through (periods) */
+        durationMax;        /* Longest ride through (periods) */
+
+    MCAPP_PISTATE_T
+        piVdc;              /* DC link voltage controller */
+
+    const int16_t *pVdc;
+    const int16_t *pVelEstim;
+
+} MCAPP_RIDE_THROUGH_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+void MCAPP_RideThroughInit(MCAPP_RIDE_THROUGH_T *);
+void MCAPP_RideThrough(MCAPP_RIDE_THROUGH_T *);
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* RIDE_THROUGH_H */
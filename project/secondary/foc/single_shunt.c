@@ -0,0 +1,308 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file single_shunt.c
+ *
+ * @brief This module implements phase current reconstruction from DC bus
+ * current samples (single shunt).
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <libq.h>
+#include "single_shunt.h"
+#include "general.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_SingleShuntInit(MCAPP_SINGLE_SHUNT_T *) </B>
+*
+* @brief Function to reset variables used for single shunt reconstruction.
+*
+* @param Pointer to the data structure containing single shunt parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_SingleShuntInit(&singleShunt); </CODE>
+*
+*/
+void MCAPP_SingleShuntInit(MCAPP_SINGLE_SHUNT_T *pShunt)
+{
+    pShunt->vector = 0;
+    pShunt->planPhase = SINGLE_SHUNT_PHASE_NONE;
+    pShunt->planSign = 0;
+    pShunt->measPhase = SINGLE_SHUNT_PHASE_NONE;
+    pShunt->measSign = 0;
+    pShunt->lastPhase = SINGLE_SHUNT_PHASE_NONE;
+    pShunt->lastCurrent = 0;
+    pShunt->shiftPhase = SINGLE_SHUNT_PHASE_NONE;
+    pShunt->shift = 0;
+    pShunt->plausibilityError = 0;
+    pShunt->trigger = 0;
+    pShunt->invalidCount = 0;
+    pShunt->iabc.a = 0;
+    pShunt->iabc.b = 0;
+    pShunt->iabc.c = 0;
+}
+
+/**
+* <B> Function: MCAPP_SingleShuntReconstruct(MCAPP_SINGLE_SHUNT_T *) </B>
+*
+* @brief Function reconstructs the phase currents from the bus current
+*        sample of the last PWM period.
+*        The sample equals the current of the only phase connected to the
+*        positive rail (one phase high) or the negated current of the only
+*        phase connected to the negative rail (two phases high).
+*        Active vectors sampled alternate every period, so two consecutive
+*        samples measure two different phases and the third phase follows
+*        from ia + ib + ic = 0.
+*        Reconstructed currents are compared with the phase shunt currents
+*        when they are not used as feedback (plausibility check).
+*
+* @param Pointer to the data structure containing single shunt parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_SingleShuntReconstruct(&singleShunt); </CODE>
+*
+*/
+void MCAPP_SingleShuntReconstruct(MCAPP_SINGLE_SHUNT_T *pShunt)
+{
+    int16_t *pI[3];
+    int16_t current, errorA, errorB;
+
+    pI[0] = &pShunt->iabc.a;
+    pI[1] = &pShunt->iabc.b;
+    pI[2] = &pShunt->iabc.c;
+
+    if (pShunt->measPhase == SINGLE_SHUNT_PHASE_NONE)
+    {
+        /* No sample : currents are held, next sample starts a new pair */
+        pShunt->lastPhase = SINGLE_SHUNT_PHASE_NONE;
+        pShunt->invalidCount++;
+        return;
+    }
+
+    current = UTIL_SatShrS16(__builtin_mulss(*pShunt->pIbus, pShunt->ibusGain),
+                                                    SINGLE_SHUNT_GAIN_QVALUE);
+    if (pShunt->measSign < 0)
+    {
+        current = UTIL_SatShrS16(-(int32_t)current, 0);
+    }
+
+    *pI[pShunt->measPhase] = current;
+    if ((pShunt->lastPhase != SINGLE_SHUNT_PHASE_NONE) &&
+        (pShunt->lastPhase != pShunt->measPhase))
+    {
+        *pI[3 - pShunt->measPhase - pShunt->lastPhase] =
+            UTIL_SatShrS16(-((int32_t)current + pShunt->lastCurrent), 0);
+    }
+    pShunt->lastPhase = pShunt->measPhase;
+    pShunt->lastCurrent = current;
+
+    if (pShunt->feedback == 0)
+    {
+        errorA = UTIL_SatShrS16((int32_t)pShunt->iabc.a - *pShunt->pIa, 0);
+        errorB = UTIL_SatShrS16((int32_t)pShunt->iabc.b - *pShunt->pIb, 0);
+        if (_Q15abs(errorB) > _Q15abs(errorA))
+        {
+            errorA = errorB;
+        }
+        pShunt->plausibilityError = errorA;
+        if (_Q15abs(errorA) > pShunt->plausibilityLimit)
+        {
+            pShunt->plausibilityFaultCount++;
+        }
+    }
+}
+
+/**
+* <B> Function: MCAPP_SingleShuntDutyShift(MCAPP_SINGLE_SHUNT_T *, uint16_t,
+*                                               MC_DUTYCYCLEOUT_T *) </B>
+*
+* @brief Function plans the bus current sample of the next PWM period.
+*        In the first half of the center aligned period phase x is high for
+*        counts above (period - duty x) : the phase with the largest duty is
+*        high alone first, then together with the middle one.
+*        The active vector sampled alternates every period. When the vector
+*        is shorter than windowMin, it is extended by an edge shift : max duty
+*        is increased (one phase high) or min duty is reduced (two phases 
+*        high). The shift is removed from the same phase in the next period,
+*        so the average voltage over two periods is unchanged.
+*        Sample is triggered sampleAdvance before the end of the vector.
+*
+* @param Pointer to the data structure containing single shunt parameters.
+* @param PWM period.
+* @param Pointer to the duty cycles, updated with the edge shift.
+* @return none.
+* @example
+* <CODE> MCAPP_SingleShuntDutyShift(&singleShunt, period, &duty); </CODE>
+*
+*/
+void MCAPP_SingleShuntDutyShift(MCAPP_SINGLE_SHUNT_T *pShunt,
+                            uint16_t period, MC_DUTYCYCLEOUT_T *pDuty)
+{
+    uint16_t *pD[3];
+    int16_t max, mid, min, temp, shifted;
+    int32_t duty;
+    uint16_t window, end, room, shift;
+
+    pD[0] = &pDuty->dutycycle1;
+    pD[1] = &pDuty->dutycycle2;
+    pD[2] = &pDuty->dutycycle3;
+
+    /* Sample planned in the last call is taken in the coming period */
+    pShunt->measPhase = pShunt->planPhase;
+    pShunt->measSign = pShunt->planSign;
+
+    /* Compensate edge shift of the previous period */
+    if (pShunt->shiftPhase != SINGLE_SHUNT_PHASE_NONE)
+    {
+        duty = (int32_t)*pD[pShunt->shiftPhase] - pShunt->shift;
+        if (duty > pShunt->dutyMax)
+        {
+            duty = pShunt->dutyMax;
+        }
+        else if (duty < pShunt->dutyMin)
+        {
+            duty = pShunt->dutyMin;
+        }
+        *pD[pShunt->shiftPhase] = (uint16_t)duty;
+        pShunt->shiftPhase = SINGLE_SHUNT_PHASE_NONE;
+        pShunt->shift = 0;
+    }
+
+    /* Sort the phases by duty */
+    max = 0;
+    mid = 1;
+    min = 2;
+    if (*pD[mid] > *pD[max])
+    {
+        temp = max;
+        max = mid;
+        mid = temp;
+    }
+    if (*pD[min] > *pD[mid])
+    {
+        temp = mid;
+        mid = min;
+        min = temp;
+    }
+    if (*pD[mid] > *pD[max])
+    {
+        temp = max;
+        max = mid;
+        mid = temp;
+    }
+
+    pShunt->vector ^= 1;
+    if (pShunt->vector == 0)
+    {
+        /* One phase high : bus current = current of max phase. Vector starts
+           when max phase goes high and ends when mid phase goes high, it is 
+           extended by increasing max duty */
+        shifted = max;
+        room = 0;
+        if (pShunt->dutyMax > *pD[max])
+        {
+            room = pShunt->dutyMax - *pD[max];
+        }
+        pShunt->planPhase = max;
+        pShunt->planSign = 1;
+        window = *pD[max] - *pD[mid];
+        end = *pD[mid];
+    }
+    else
+    {
+        /* Two phases high : bus current = -current of min phase. Vector ends
+           when min phase goes high, it is extended by reducing min duty */
+        shifted = min;
+        room = 0;
+        if (*pD[min] > pShunt->dutyMin)
+        {
+            room = *pD[min] - pShunt->dutyMin;
+        }
+        pShunt->planPhase = min;
+        pShunt->planSign = -1;
+        window = *pD[mid] - *pD[min];
+        end = *pD[min];
+    }
+
+    if (window < pShunt->windowMin)
+    {
+        shift = pShunt->windowMin - window;
+        if (shift > room)
+        {
+            shift = room;
+        }
+        if (shift > pShunt->shiftMax)
+        {
+            shift = pShunt->shiftMax;
+        }
+        window += shift;
+        if (pShunt->vector == 0)
+        {
+            *pD[shifted] += shift;
+            pShunt->shift = shift;
+        }
+        else
+        {
+            *pD[shifted] -= shift;
+            end -= shift;
+            pShunt->shift = -shift;
+        }
+        pShunt->shiftPhase = shifted;
+    }
+
+    if (window < pShunt->windowMin)
+    {
+        pShunt->planPhase = SINGLE_SHUNT_PHASE_NONE;
+        pShunt->trigger = 0;
+    }
+    else
+    {
+        pShunt->trigger = period - end - pShunt->sampleAdvance;
+    }
+}
+
+// </editor-fold>
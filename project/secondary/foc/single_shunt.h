@@ -0,0 +1,127 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file single_shunt.h
+ *
+ * @brief This module implements phase current reconstruction from DC bus
+ * current samples (single shunt).
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+#ifndef SINGLE_SHUNT_H
+#define	SINGLE_SHUNT_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include "motor_control.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS/MACROS ">
+
+/* Phase index : 0 - a, 1 - b, 2 - c */
+#define SINGLE_SHUNT_PHASE_NONE     -1
+/* Q format of the bus current gain */
+#define SINGLE_SHUNT_GAIN_QVALUE    14
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
+
+typedef struct
+{
+    int16_t
+        enable,             /* Single shunt reconstruction enable */
+        feedback,           /* 1 - Reconstructed currents are FOC feedback */
+        ibusGain,           /* Bus current to phase current scaling (Q14) */
+        vector,             /* Active vector sampled : 0 - one phase high,
+                               1 - two phases high */
+        planPhase,          /* Phase sampled in the next period */
+        planSign,           /* Sign of bus current w.r.t. planPhase current */
+        measPhase,          /* Phase sampled in the last period */
+        measSign,           /* Sign of bus current w.r.t. measPhase current */
+        lastPhase,          /* Phase of the previous valid sample */
+        lastCurrent,        /* Current of the previous valid sample */
+        shiftPhase,         /* Phase with edge shift to be compensated */
+        shift,              /* Edge shift (duty added) in PWM counts */
+        plausibilityError,  /* Reconstructed - measured phase current */
+        plausibilityLimit;  /* Plausibility error limit */
+
+    uint16_t
+        windowMin,          /* Minimum active vector duration for a sample */
+        sampleAdvance,      /* Sample instant before the end of the vector */
+        shiftMax,           /* Maximum edge shift */
+        dutyMin,            /* Minimum duty count */
+        dutyMax,            /* Maximum duty count */
+        trigger,            /* ADC trigger count of the next bus sample */
+        invalidCount,       /* Periods without valid bus current sample */
+        plausibilityFaultCount; /* Samples with plausibility error > limit */
+
+    MC_ABC_T
+        iabc;               /* Reconstructed phase currents */
+
+    const int16_t *pIbus;
+    const int16_t *pIa;
+    const int16_t *pIb;
+
+} MCAPP_SINGLE_SHUNT_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+void MCAPP_SingleShuntInit(MCAPP_SINGLE_SHUNT_T *);
+void MCAPP_SingleShuntReconstruct(MCAPP_SINGLE_SHUNT_T *);
+void MCAPP_SingleShuntDutyShift(MCAPP_SINGLE_SHUNT_T *, uint16_t,
+                                                MC_DUTYCYCLEOUT_T *);
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* SINGLE_SHUNT_H */
@@ -0,0 +1,168 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file speed_trajectory.c
+ *
+ * @brief This module implements the jerk limited speed reference trajectory.
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include "speed_trajectory.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_SpeedTrajectoryInit(MCAPP_SPEED_TRAJECTORY_T *) </B>
+*
+* @brief Function to reset variables used for the speed trajectory.
+*
+* @param Pointer to the data structure containing speed trajectory parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_SpeedTrajectoryInit(&speedTraj); </CODE>
+*
+*/
+void MCAPP_SpeedTrajectoryInit(MCAPP_SPEED_TRAJECTORY_T *pTraj)
+{
+    MCAPP_SpeedTrajectoryReset(pTraj, 0);
+}
+
+/**
+* <B> Function: MCAPP_SpeedTrajectoryReset(MCAPP_SPEED_TRAJECTORY_T *, 
+*                                                       int16_t) </B>
+*
+* @brief Function starts the trajectory from the given velocity at rest 
+*        (zero acceleration), e.g. at the transition to closed loop.
+*
+* @param Pointer to the data structure containing speed trajectory parameters.
+* @param Initial velocity reference.
+* @return none.
+* @example
+* <CODE> MCAPP_SpeedTrajectoryReset(&speedTraj, qVelRef); </CODE>
+*
+*/
+void MCAPP_SpeedTrajectoryReset(MCAPP_SPEED_TRAJECTORY_T *pTraj, 
+                                                        int16_t qVelRef)
+{
+    pTraj->velocity = (int32_t)qVelRef << SPEED_TRAJ_VELOCITY_QVALUE;
+    pTraj->accel = 0;
+    pTraj->qVelRef = qVelRef;
+}
+
+/**
+* <B> Function: MCAPP_SpeedTrajectory(MCAPP_SPEED_TRAJECTORY_T *, int16_t) 
+*                                                                       </B>
+*
+* @brief Function moves the velocity reference towards the target with 
+*        limited acceleration and jerk (S-curve).
+*        Velocity change needed to bring the acceleration to zero with the 
+*        jerk limit (accel*(accel/jerk + 1)/2) is compared with the velocity
+*        error : acceleration is increased by the jerk limit while the error
+*        is larger and reduced otherwise. Hence a target change in flight is
+*        followed from the present velocity and acceleration.
+*        Velocity is accumulated with fractional resolution, so the slope of
+*        the reference has no quantization steps.
+*
+* @param Pointer to the data structure containing speed trajectory parameters.
+* @param Target velocity.
+* @return none.
+* @example
+* <CODE> MCAPP_SpeedTrajectory(&speedTraj, qTargetVelocity); </CODE>
+*
+*/
+void MCAPP_SpeedTrajectory(MCAPP_SPEED_TRAJECTORY_T *pTraj, int16_t target)
+{
+    int32_t error, stop, accelAbs;
+    int16_t steps;
+
+    error = ((int32_t)target << SPEED_TRAJ_VELOCITY_QVALUE) - pTraj->velocity;
+
+    /* Periods to bring the acceleration to zero */
+    accelAbs = (pTraj->accel < 0) ? -pTraj->accel : pTraj->accel;
+    if ((accelAbs >> 15) >= pTraj->jerkMax)
+    {
+        steps = 32767;
+    }
+    else
+    {
+        steps = __builtin_divsd(accelAbs, pTraj->jerkMax);
+    }
+    stop = (pTraj->accel >> (SPEED_TRAJ_ACCEL_QVALUE - 
+                            SPEED_TRAJ_VELOCITY_QVALUE + 1)) * (steps + 1);
+
+    if ((accelAbs <= pTraj->jerkMax) && 
+        (error <= (pTraj->jerkMax >> 
+                (SPEED_TRAJ_ACCEL_QVALUE - SPEED_TRAJ_VELOCITY_QVALUE))) &&
+        (error >= -(pTraj->jerkMax >> 
+                (SPEED_TRAJ_ACCEL_QVALUE - SPEED_TRAJ_VELOCITY_QVALUE))))
+    {
+        /* Target reached */
+        pTraj->velocity = (int32_t)target << SPEED_TRAJ_VELOCITY_QVALUE;
+        pTraj->accel = 0;
+    }
+    else if (error > stop)
+    {
+        pTraj->accel += pTraj->jerkMax;
+        if (pTraj->accel > pTraj->accelMax)
+        {
+            pTraj->accel = pTraj->accelMax;
+        }
+    }
+    else if (error < stop)
+    {
+        pTraj->accel -= pTraj->jerkMax;
+        if (pTraj->accel < -pTraj->accelMax)
+        {
+            pTraj->accel = -pTraj->accelMax;
+        }
+    }
+
+    pTraj->velocity += pTraj->accel >> 
+                    (SPEED_TRAJ_ACCEL_QVALUE - SPEED_TRAJ_VELOCITY_QVALUE);
+    pTraj->qVelRef = (int16_t)((pTraj->velocity + 
+        (1 << (SPEED_TRAJ_VELOCITY_QVALUE - 1))) >> SPEED_TRAJ_VELOCITY_QVALUE);
+}
+
+// </editor-fold>
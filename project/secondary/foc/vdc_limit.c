@@ -0,0 +1,163 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file vdc_limit.c
+ *
+ * @brief This module implements the DC link overvoltage control : limitation
+ * of the regenerative current and of the deceleration.
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include "vdc_limit.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_VdcLimitInit(MCAPP_VDC_LIMIT_T *) </B>
+*
+* @brief Function to reset variables used for DC link overvoltage control.
+*
+* @param Pointer to the data structure containing DC link overvoltage control
+*        parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_VdcLimitInit(&vdcLimit); </CODE>
+*
+*/
+void MCAPP_VdcLimitInit(MCAPP_VDC_LIMIT_T *pVdcLimit)
+{
+    pVdcLimit->vdcFilt = *pVdcLimit->pVdc;
+    pVdcLimit->vdcFiltState = (int32_t)pVdcLimit->vdcFilt << 15;
+    pVdcLimit->regenLimit = pVdcLimit->iqLimit;
+    pVdcLimit->active = 0;
+}
+
+/**
+* <B> Function: MCAPP_VdcLimit(MCAPP_VDC_LIMIT_T *) </B>
+*
+* @brief Function computes the regenerative current limit from the filtered
+*        DC link voltage : full limit up to vdcStart, reduced linearly to zero
+*        at vdcStop. Motors sharing the DC link apply the same characteristic
+*        to the same voltage, hence regenerative current is shared and a 
+*        motoring motor absorbs the energy of the other one first.
+*
+* @param Pointer to the data structure containing DC link overvoltage control
+*        parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_VdcLimit(&vdcLimit); </CODE>
+*
+*/
+void MCAPP_VdcLimit(MCAPP_VDC_LIMIT_T *pVdcLimit)
+{
+    if (pVdcLimit->enable == 0)
+    {
+        pVdcLimit->regenLimit = pVdcLimit->iqLimit;
+        pVdcLimit->active = 0;
+        return;
+    }
+
+    pVdcLimit->vdcFiltState += __builtin_mulss(
+            (*pVdcLimit->pVdc - pVdcLimit->vdcFilt), pVdcLimit->filterCoef);
+    pVdcLimit->vdcFilt = (int16_t)(pVdcLimit->vdcFiltState >> 15);
+
+    if (pVdcLimit->vdcFilt <= pVdcLimit->vdcStart)
+    {
+        pVdcLimit->regenLimit = pVdcLimit->iqLimit;
+        pVdcLimit->active = 0;
+    }
+    else
+    {
+        if (pVdcLimit->vdcFilt >= pVdcLimit->vdcStop)
+        {
+            pVdcLimit->regenLimit = 0;
+        }
+        else
+        {
+            pVdcLimit->regenLimit = __builtin_divsd(
+                __builtin_mulss(pVdcLimit->iqLimit, 
+                            (pVdcLimit->vdcStop - pVdcLimit->vdcFilt)),
+                            (pVdcLimit->vdcStop - pVdcLimit->vdcStart));
+        }
+        pVdcLimit->active = 1;
+    }
+}
+
+/**
+* <B> Function: MCAPP_VdcLimitTarget(const MCAPP_VDC_LIMIT_T *, int16_t, 
+*                                                       int16_t) </B>
+*
+* @brief Function holds the deceleration while the DC link voltage is above
+*        vdcStart : a target velocity of lower magnitude than the velocity 
+*        reference is replaced by the velocity reference. Deceleration 
+*        resumes when the DC link voltage falls.
+*
+* @param Pointer to the data structure containing DC link overvoltage control
+*        parameters.
+* @param Velocity reference.
+* @param Target velocity.
+* @return Target velocity for the speed reference ramp.
+* @example
+* <CODE> target = MCAPP_VdcLimitTarget(&vdcLimit, qVelRef, target); </CODE>
+*
+*/
+int16_t MCAPP_VdcLimitTarget(const MCAPP_VDC_LIMIT_T *pVdcLimit,
+                                            int16_t qVelRef, int16_t target)
+{
+    if (pVdcLimit->active)
+    {
+        if ((qVelRef >= 0) && (target < qVelRef))
+        {
+            target = qVelRef;
+        }
+        else if ((qVelRef < 0) && (target > qVelRef))
+        {
+            target = qVelRef;
+        }
+    }
+    return target;
+}
+
+// </editor-fold>
@@ -102,7 +102,11 @@ void InitializeADCs (void)
            interrupts ,when the EISTATx flag is set
        0 = The individual interrupts are generated when conversion is done ,
            when the ANxRDY flag is set*/
+#ifdef ENABLE_ADC_EARLY_INTERRUPT
+    ADCON2Lbits.EIEN = 1;
+#else
     ADCON2Lbits.EIEN = 0;
+#endif
 
     ADCON2H = 0;
     /* Shared ADC Core Sample Time Selection bits 
@@ -111,6 +115,10 @@ void InitializeADCs (void)
        Ranges from 2 to 1025 TADCORE
        if SHRSAMC = 15 ,then Sampling time is 17 TADCORE */
     ADCON2Hbits.SHRSAMC = 15;
+    /* Shared Core Early Interrupt Time Selection bits
+       111 = Early interrupt is set 8 TADCORE clocks prior to end of conversion
+       000 = Early interrupt is set 1 TADCORE clock prior to end of conversion*/
+    ADCON2Hbits.SHREISEL = ADC_EARLY_INTERRUPT_TAD - 1;
 
     ADCON3L  = 0;
     /* ADC Reference Voltage Selection bits 
@@ -156,10 +164,10 @@ void InitializeADCs (void)
     ADCON4H      = 0x0000;
     /* Dedicated ADC Core 0 Input Channel Selection bits
        01 = ANA0 00 = AN0 */
-    ADCON4Hbits.C0CHS = 0;
+    ADCON4Hbits.C0CHS = MC1_ADC_CORE_CHS;
     /* Dedicated ADC Core 1 Input Channel Selection bits
        01 = ANA1 00 = AN1 */
-    ADCON4Hbits.C1CHS = 0;
+    ADCON4Hbits.C1CHS = MC1_ADC_CORE_CHS;
     
     /* Initialize DEDICATED ADC CORE 0 CONTROL REGISTER LOW */
     ADCORE0L     = 0x0000;
@@ -234,6 +242,33 @@ void InitializeADCs (void)
     ADMOD1Lbits.SIGN18 = 0;
 
     
+    /* Initialize ADC DIGITAL FILTER 0 and 1 CONTROL REGISTERS */
+    ADFL0CON = 0x0000;
+    ADFL1CON = 0x0000;
+#ifdef ENABLE_CURRENT_OVERSAMPLING
+    /* Filter Mode bits
+       11 = Averaging mode
+       00 = Oversampling mode */
+    ADFL0CONbits.MODE = 0b11;
+    ADFL1CONbits.MODE = 0b11;
+    /* Filter Averaging/Oversampling Ratio bits : Averaging mode
+       000 = 2x conversions averaged (PGxTRIGA and PGxTRIGB) */
+    ADFL0CONbits.OVRSAM = 0b000;
+    ADFL1CONbits.OVRSAM = 0b000;
+    /* Filter Interrupt Enable bit
+       0 = Filter common and individual interrupts are disabled */
+    ADFL0CONbits.IE = 0;
+    ADFL1CONbits.IE = 0;
+    /* Filter Input Channel Selection : Ia on AN0 (S1AN0/S1ANA0), 
+       Ib on AN1 (S1AN1/S1ANA1) */
+    ADFL0CONbits.FLCHSEL = 0;
+    ADFL1CONbits.FLCHSEL = 1;
+    /* Filter Enable bit
+       1 = Filter is enabled */
+    ADFL0CONbits.FLEN = 1;
+    ADFL1CONbits.FLEN = 1;
+#endif
+
     /* Ensuring all interrupts are disabled and Status Flags are cleared */
     ADIEL = 0;
     ADIEH = 0;
@@ -243,6 +278,11 @@ void InitializeADCs (void)
     ADEIEH  = 0;
     ADEISTATL = 0;
     ADEISTATH = 0;
+#ifdef ENABLE_ADC_EARLY_INTERRUPT
+    /* Early interrupt enabled for the MC1 and MC2 interrupt channels */
+    ADEIELbits.EIEN15 = 1;
+    ADEIEHbits.EIEN18 = 1;
+#endif
  
     ADCON5H = 0;
     /* Shared ADC Core Ready Common Interrupt Enable bit
@@ -289,16 +329,16 @@ void InitializeADCs (void)
     _IE18        = 1 ;
     /* Clear ADC interrupt flag */
     _ADCAN18IF    = 0 ;  
-    /* Set ADC interrupt priority IPL 7  */ 
-    _ADCAN18IP   = 6 ;  
+    /* Set ADC interrupt priority, same as MC1 : interrupts never nest */ 
+    _ADCAN18IP   = MC_ADC_INTERRUPT_PRIORITY ;  
     /* Disable the AN18 interrupt  */
     _ADCAN18IE    = 0 ;  
 	      
      _IE15        = 1 ;
     /* Clear ADC interrupt flag */
     _ADCAN15IF    = 0 ;  
-    /* Set ADC interrupt priority IPL 7  */ 
-    _ADCAN15IP   = 7 ;  
+    /* Set ADC interrupt priority, same as MC2 : interrupts never nest */ 
+    _ADCAN15IP   = MC_ADC_INTERRUPT_PRIORITY ;  
     /* Disable the AN15 interrupt  */
     _ADCAN15IE    = 0 ;  
     
@@ -336,18 +376,22 @@ void InitializeADCs (void)
         00001 = Common software trigger
         00000 = No trigger is enabled  */  
     /* Trigger Source for Analog Input #0  = 0b0100 */
-    ADTRIG0Lbits.TRGSRC0 = 0x4;
+    ADTRIG0Lbits.TRGSRC0 = MC1_ADC_TRGSRC;
     /* Trigger Source for Analog Input #1  = 0b0100 */
-    ADTRIG0Lbits.TRGSRC1 = 0x4;
+    ADTRIG0Lbits.TRGSRC1 = MC1_ADC_TRGSRC;
     /* Trigger Source for Analog Input #10  = 0b0100 for Vbus*/
-    ADTRIG2Hbits.TRGSRC10 = 0x4;  
-    /* Trigger Source for Analog Input #13  = 0b0100 for Ibus */
+    ADTRIG2Hbits.TRGSRC10 = MC1_ADC_TRGSRC;  
+    /* Trigger Source for Analog Input #13  = 0b0101 for Ibus */
+#ifdef ENABLE_MC1_SINGLE_SHUNT
+    ADTRIG3Lbits.TRGSRC13 = MC1_ADC_IBUS_TRGSRC;
+#else
     ADTRIG3Lbits.TRGSRC13 = 0;
+#endif
     /* Trigger Source for Analog Input #15  = 0b0100 for POT */
-    ADTRIG3Hbits.TRGSRC15 = 0x4;
+    ADTRIG3Hbits.TRGSRC15 = MC1_ADC_TRGSRC;
     
-    /* Trigger Source for Analog Input #18  = 0b0100 for IBUS2 */
-    ADTRIG4Hbits.TRGSRC18 = 0b01101;
+    /* Trigger Source for Analog Input #18  = 0b01101 for IBUS2 */
+    ADTRIG4Hbits.TRGSRC18 = MC2_ADC_TRGSRC;
     
 }
 // </editor-fold> 
\ No newline at end of file
@@ -58,20 +58,31 @@
 // <editor-fold defaultstate="collapsed" desc="HEADER FILES ">        
 #include <xc.h>
 #include <stdint.h>
+#include "pwm.h"
 // </editor-fold>         
 
 // <editor-fold defaultstate="collapsed" desc="DEFINITIONS/MACROS ">
 
 #define MC_ADCBUF_VDC         (int16_t)( ADCBUF10 >> 1)
 /* MC1 ADC Buffer Definitions */
+#ifdef ENABLE_CURRENT_OVERSAMPLING
+#define MC1_ADCBUF_IPHASE1    (int16_t)(-ADFL0DAT)   
+#define MC1_ADCBUF_IPHASE2    (int16_t)(-ADFL1DAT)
+#else
 #define MC1_ADCBUF_IPHASE1    (int16_t)(-ADCBUF0)   
 #define MC1_ADCBUF_IPHASE2    (int16_t)(-ADCBUF1)
+#endif
 #define MC1_ADCBUF_IBUS       ADCBUF13      
 #define MC1_ADCBUF_POT        (int16_t)(ADCBUF15 >> 1)
    
 /* MC2 ADC Buffer definitions */
+#ifdef ENABLE_CURRENT_OVERSAMPLING
+#define MC2_ADCBUF_IPHASE1    (int16_t)(-ADFL0DAT)   
+#define MC2_ADCBUF_IPHASE2    (int16_t)(-ADFL1DAT)
+#else
 #define MC2_ADCBUF_IPHASE1    (int16_t)(-ADCBUF0)   
 #define MC2_ADCBUF_IPHASE2    (int16_t)(-ADCBUF1)
+#endif
 #define MC2_ADCBUF_IBUS       ADCBUF18
 /*
  .....
@@ -91,6 +102,42 @@
 #define MC2_ClearADCIF()           _ADCAN18IF = 0
 #define MC2_ClearADCIF_ReadADCBUF() ADCBUF18      
 
+/* ADC conversion ready status of the interrupt channels */
+#define MC1_ADCRDY()               ADSTATLbits.AN15RDY
+#define MC2_ADCRDY()               ADSTATHbits.AN18RDY
+/* Phase current average ready status of ADC digital filters 0 and 1 */
+#define MC_ADC_IPHASE_FILTER_RDY() (ADFL0CONbits.RDY && ADFL1CONbits.RDY)
+
+/* ADC schedule of the secondary core :
+   - Dedicated ADC cores 0 and 1 convert the phase currents of MC1 (S1AN0,
+     S1AN1 on PG1TRIGA) and MC2 (S1ANA0,S1ANA1 on PG6TRIGA) alternately.
+     Each ADC interrupt hands the cores over to the other motor.
+   - Shared ADC core converts Vbus and Pot on PG1TRIGA, Ibus2 on PG6TRIGA.
+   - MC1 and MC2 ADC interrupts have the same priority and never nest. Carrier
+     phase shift MC2_PWM_PHASE_DEG separates them in time. */
+#define MC_ADC_INTERRUPT_PRIORITY   7
+/* Trigger sources : 00100 = PWM1 Trigger 1, 01101 = PWM6 Trigger 1 */
+#define MC1_ADC_TRGSRC              0b00100
+#define MC2_ADC_TRGSRC              0b01101
+/* Trigger source of MC1 bus current for single shunt : 00101 = PWM1 Trigger 2*/
+#define MC1_ADC_IBUS_TRGSRC         0b00101
+/* Dedicated core input channel selection : 00 = S1ANx, 01 = S1ANAx */
+#define MC1_ADC_CORE_CHS            0b00
+#define MC2_ADC_CORE_CHS            0b01
+
+/* Definition to enable early ADC interrupt : interrupt channels (AN15,AN18)
+   request the interrupt ADC_EARLY_INTERRUPT_TAD shared core clocks (1 to 8)
+   before the end of conversion. The control runs on the phase currents and
+   Vbus, converted before, while the interrupt channel converts; its result
+   (MC1 potentiometer, MC2 bus current, not used by the control) is read 
+   after the duty cycles are written, once MCx_ADCRDY() is set. Compare the
+   ADC trigger to duty cycle update time with hostsim adc_latency. */
+#undef ENABLE_ADC_EARLY_INTERRUPT
+#define ADC_EARLY_INTERRUPT_TAD     8
+/* Maximum number of polls of a conversion ready flag in the control ISR, a
+   result not ready within is reported as ADC fault */
+#define ADC_READY_POLL_MAX          200
+
 // </editor-fold> 
         
 // <editor-fold defaultstate="collapsed" desc="INTERFACE FUNCTIONS ">  
@@ -327,6 +327,21 @@ void HAL_MC1PWMSetDutyCycles(MC_DUTYCYCLEOUT_T *pdc)
     MC1_PWM_PDC1 = pdc->dutycycle1;
 }
 
+/**
+ * Writes the ADC trigger of MC1 bus current (single shunt) to PG1TRIGC.
+ * Summary: Sets the bus current sampling instant of the next PWM period.
+ * Trigger is updated with the duty cycles, so it must be written before them.
+ * @param trigger PWM time base count of the bus current sample
+ * @example
+ * <code>
+ * HAL_MC1PWMSetBusCurrentTrigger(trigger);
+ * </code>
+ */
+void HAL_MC1PWMSetBusCurrentTrigger(uint16_t trigger)
+{
+    PG1TRIGC = trigger;
+}
+
 /**
  * Writes three unique duty cycle values to the PWM duty cycle registers
  * corresponding to Motor #2.
@@ -393,16 +408,23 @@ void HAL_MC1ADCSwitchChannels(void)
     /* C0CHS[1:0]: Dedicated ADC Core 0 Input Channel Selection bits
         01 = S1ANA0
         00 = S1AN0  */
-    ADCON4Hbits.C0CHS = 0b01;
+    ADCON4Hbits.C0CHS = MC2_ADC_CORE_CHS;
     /* C1CHS[1:0]: Dedicated ADC Core 1 Input Channel Selection bits
         01 = S1ANA1
         00 = S1AN1 */
-    ADCON4Hbits.C1CHS = 0b01;
+    ADCON4Hbits.C1CHS = MC2_ADC_CORE_CHS;
     
     /* Trigger Source Selection for Corresponding Analog Inputs bits 
         01101 = Slave PWM6 Trigger 1 :(ADC Sampling ponit -PG6TRIGA)  */ 
-    ADTRIG0Lbits.TRGSRC0 = 0b01101;
-    ADTRIG0Lbits.TRGSRC1 = 0b01101;
+    ADTRIG0Lbits.TRGSRC0 = MC2_ADC_TRGSRC;
+    ADTRIG0Lbits.TRGSRC1 = MC2_ADC_TRGSRC;
+#ifdef ENABLE_CURRENT_OVERSAMPLING
+    /* Restart averaging of the phase current filters for MC2 */
+    ADFL0CONbits.FLEN = 0;
+    ADFL1CONbits.FLEN = 0;
+    ADFL0CONbits.FLEN = 1;
+    ADFL1CONbits.FLEN = 1;
+#endif
 }
 
 /**
@@ -420,57 +442,196 @@ void HAL_MC2ADCSwitchChannels(void)
     /* C0CHS[1:0]: Dedicated ADC Core 0 Input Channel Selection bits
         01 = S1ANA0
         00 = S1AN0  */
-    ADCON4Hbits.C0CHS = 0b00;
+    ADCON4Hbits.C0CHS = MC1_ADC_CORE_CHS;
     /* C1CHS[1:0]: Dedicated ADC Core 1 Input Channel Selection bits
         01 = S1ANA1
         00 = S1AN1 */
-    ADCON4Hbits.C1CHS = 0b00;
+    ADCON4Hbits.C1CHS = MC1_ADC_CORE_CHS;
     
     /* Trigger Source Selection for Corresponding Analog Inputs bits 
         00100 = Slave PWM1 Trigger 1 :(ADC Sampling ponit -PG1TRIGA) */ 
-    ADTRIG0Lbits.TRGSRC0 = 0b00100;
-    ADTRIG0Lbits.TRGSRC1 = 0b00100;
+    ADTRIG0Lbits.TRGSRC0 = MC1_ADC_TRGSRC;
+    ADTRIG0Lbits.TRGSRC1 = MC1_ADC_TRGSRC;
+#ifdef ENABLE_CURRENT_OVERSAMPLING
+    /* Restart averaging of the phase current filters for MC1 */
+    ADFL0CONbits.FLEN = 0;
+    ADFL1CONbits.FLEN = 0;
+    ADFL0CONbits.FLEN = 1;
+    ADFL1CONbits.FLEN = 1;
+#endif
 }
 
 /**
  * <B> Function: HAL_MC1MotorInputsRead(MCAPP_MEASURE_T *)  </B>
- * @brief Function to read motor inputs.
- * @param None.
- * @return None.
+ * @brief Function to read motor inputs. Waiting for a conversion result is
+ *        bounded by ADC_READY_POLL_MAX polls.
+ * @param Pointer to the motor inputs.
+ * @return 1 if a conversion result was not ready in time, 0 otherwise.
  * @example
  * <code>
  * status = HAL_MC1MotorInputsRead(&motorInputs);
  * </code>
  */
-void HAL_MC1MotorInputsRead(MCAPP_MEASURE_T *pMotorInputs)
+bool HAL_MC1MotorInputsRead(MCAPP_MEASURE_T *pMotorInputs)
 {
+    uint16_t __attribute__((__unused__)) poll = 0;
+    
+#ifdef ENABLE_CURRENT_OVERSAMPLING
+    while ((!MC_ADC_IPHASE_FILTER_RDY()) && (poll < ADC_READY_POLL_MAX))
+    {
+        poll++;
+    }
+#endif
     pMotorInputs->measureCurrent.Ia = MC1_ADCBUF_IPHASE1;
     pMotorInputs->measureCurrent.Ib = MC1_ADCBUF_IPHASE2;
     pMotorInputs->measureCurrent.Ibus = MC1_ADCBUF_IBUS;
+#ifndef ENABLE_ADC_EARLY_INTERRUPT
     pMotorInputs->measurePot = MC1_ADCBUF_POT;
+#endif
     pMotorInputs->measureVdc.value =  MC_ADCBUF_VDC;
     
     HAL_MC1ADCSwitchChannels();
+    
+    return (poll >= ADC_READY_POLL_MAX);
 }
 
+#ifdef ENABLE_ADC_EARLY_INTERRUPT
+/**
+ * <B> Function: HAL_MC1InterruptChannelRead(MCAPP_MEASURE_T *)  </B>
+ * @brief Function to read the ADC interrupt channel of motor 1 (potentiometer)
+ *        after the control. It is still converting when the early interrupt
+ *        enters, the control does not use it. Waiting for the result is 
+ *        bounded by ADC_READY_POLL_MAX polls.
+ * @param Pointer to the motor inputs.
+ * @return 1 if the conversion result was not ready in time, 0 otherwise.
+ * @example
+ * <code>
+ * status = HAL_MC1InterruptChannelRead(&motorInputs);
+ * </code>
+ */
+bool HAL_MC1InterruptChannelRead(MCAPP_MEASURE_T *pMotorInputs)
+{
+    uint16_t poll = 0;
+    
+    while ((MC1_ADCRDY() == 0) && (poll < ADC_READY_POLL_MAX))
+    {
+        poll++;
+    }
+    pMotorInputs->measurePot = MC1_ADCBUF_POT;
+    
+    return (poll >= ADC_READY_POLL_MAX);
+}
+#endif
+
 /**
  * <B> Function: HAL_MC2MotorInputsRead(MCAPP_MEASURE_T *)  </B>
- * @brief Function to read motor inputs.
- * @param None.
- * @return None.
+ * @brief Function to read motor inputs. Waiting for a conversion result is
+ *        bounded by ADC_READY_POLL_MAX polls.
+ * @param Pointer to the motor inputs.
+ * @return 1 if a conversion result was not ready in time, 0 otherwise.
  * @example
  * <code>
  * status = HAL_MC2MotorInputsRead(pMotorInputs);
  * </code>
  */
-void HAL_MC2MotorInputsRead(MCAPP_MEASURE_T *pMotorInputs)
+bool HAL_MC2MotorInputsRead(MCAPP_MEASURE_T *pMotorInputs)
 {
+    uint16_t __attribute__((__unused__)) poll = 0;
+    
+#ifdef ENABLE_CURRENT_OVERSAMPLING
+    while ((!MC_ADC_IPHASE_FILTER_RDY()) && (poll < ADC_READY_POLL_MAX))
+    {
+        poll++;
+    }
+#endif
     pMotorInputs->measureCurrent.Ia = MC2_ADCBUF_IPHASE1;
     pMotorInputs->measureCurrent.Ib = MC2_ADCBUF_IPHASE2;
+#ifndef ENABLE_ADC_EARLY_INTERRUPT
     pMotorInputs->measureCurrent.Ibus = MC2_ADCBUF_IBUS;
+#endif
     pMotorInputs->measureVdc.value =  MC_ADCBUF_VDC;
     
     HAL_MC2ADCSwitchChannels();
+    
+    return (poll >= ADC_READY_POLL_MAX);
+}
+
+#ifdef ENABLE_ADC_EARLY_INTERRUPT
+/**
+ * <B> Function: HAL_MC2InterruptChannelRead(MCAPP_MEASURE_T *)  </B>
+ * @brief Function to read the ADC interrupt channel of motor 2 (bus current)
+ *        after the control. It is still converting when the early interrupt
+ *        enters, the control does not use it. Waiting for the result is 
+ *        bounded by ADC_READY_POLL_MAX polls.
+ * @param Pointer to the motor inputs.
+ * @return 1 if the conversion result was not ready in time, 0 otherwise.
+ * @example
+ * <code>
+ * status = HAL_MC2InterruptChannelRead(pMotorInputs);
+ * </code>
+ */
+bool HAL_MC2InterruptChannelRead(MCAPP_MEASURE_T *pMotorInputs)
+{
+    uint16_t poll = 0;
+    
+    while ((MC2_ADCRDY() == 0) && (poll < ADC_READY_POLL_MAX))
+    {
+        poll++;
+    }
+    pMotorInputs->measureCurrent.Ibus = MC2_ADCBUF_IBUS;
+    
+    return (poll >= ADC_READY_POLL_MAX);
+}
+#endif
+
+/**
+ * <B> Function: HAL_MC1ADCInterruptLatency()  </B>
+ * @brief Function to measure the time from MC1 ADC trigger (PG1TRIGA) to the
+ *        call, using a software capture of PG1 time base (CAPSRC = 0).
+ *        Center aligned time base counts up to the period in each half.
+ * @param None.
+ * @return Latency in PWM clock periods.
+ * @example
+ * <code>
+ * latency = HAL_MC1ADCInterruptLatency();
+ * </code>
+ */
+uint16_t HAL_MC1ADCInterruptLatency(void)
+{
+    uint16_t count;
+    
+    PG1CAP = 0;
+    count = PG1CAP;
+    if (PG1STATbits.CAHALF)
+    {
+        count += LOOPTIME_TCY + 1;
+    }
+    return count - PG1TRIGA;
+}
+
+/**
+ * <B> Function: HAL_MC2ADCInterruptLatency()  </B>
+ * @brief Function to measure the time from MC2 ADC trigger (PG6TRIGA) to the
+ *        call, using a software capture of PG6 time base (CAPSRC = 0).
+ *        Center aligned time base counts up to the period in each half.
+ * @param None.
+ * @return Latency in PWM clock periods.
+ * @example
+ * <code>
+ * latency = HAL_MC2ADCInterruptLatency();
+ * </code>
+ */
+uint16_t HAL_MC2ADCInterruptLatency(void)
+{
+    uint16_t count;
+    
+    PG6CAP = 0;
+    count = PG6CAP;
+    if (PG6STATbits.CAHALF)
+    {
+        count += LOOPTIME_TCY + 1;
+    }
+    return count - PG6TRIGA;
 }
 
 
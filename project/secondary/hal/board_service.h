@@ -122,15 +122,24 @@ void HAL_ResetPeripherals(void);
 void HAL_MC1PWMDisableOutputs(void);
 void HAL_MC1PWMEnableOutputs(void);
 void HAL_MC1PWMSetDutyCycles(MC_DUTYCYCLEOUT_T *);
+void HAL_MC1PWMSetBusCurrentTrigger(uint16_t);
 void HAL_MC1ADCSwitchChannels(void);
-void HAL_MC1MotorInputsRead(MCAPP_MEASURE_T *);
+bool HAL_MC1MotorInputsRead(MCAPP_MEASURE_T *);
+#ifdef ENABLE_ADC_EARLY_INTERRUPT
+bool HAL_MC1InterruptChannelRead(MCAPP_MEASURE_T *);
+#endif
+uint16_t HAL_MC1ADCInterruptLatency(void);
 void HAL_MC1SetVoltageVector(int16_t);
 
 void HAL_MC2PWMDisableOutputs(void);
 void HAL_MC2PWMEnableOutputs(void);
 void HAL_MC2PWMSetDutyCycles(MC_DUTYCYCLEOUT_T *);
 void HAL_MC2ADCSwitchChannels(void);
-void HAL_MC2MotorInputsRead(MCAPP_MEASURE_T *);
+bool HAL_MC2MotorInputsRead(MCAPP_MEASURE_T *);
+#ifdef ENABLE_ADC_EARLY_INTERRUPT
+bool HAL_MC2InterruptChannelRead(MCAPP_MEASURE_T *);
+#endif
+uint16_t HAL_MC2ADCInterruptLatency(void);
 void HAL_MC2SetVoltageVector(int16_t);
 
 
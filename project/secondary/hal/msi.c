@@ -0,0 +1,122 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * msi.c
+ *
+ * This file includes subroutines to exchange data with the Main core through
+ * the MSI mailboxes.
+ * 
+ * Definitions in this file are for dsPIC33CH512MP508.
+ * 
+ * Component: Secondary Core - HAL - MSI
+ * 
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#ifdef __XC16__  // See comments at the top of this header file
+    #include <xc.h>
+#endif // __XC16__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "msi.h"
+
+// </editor-fold> 
+
+// <editor-fold defaultstate="collapsed" desc="INTERFACE FUNCTIONS ">
+
+/**
+ * <B> Function: HAL_MSICommandRead(MSI_COMMAND_T *)  </B>
+ * @brief Function reads the command of the Main core (protocol block A) when
+ *        a new command is ready. Reading the last register (MBX6) releases 
+ *        the block for the next command.
+ * @param Pointer to the command.
+ * @return true - new command read, false - no new command.
+ * @example
+ * <code>
+ * status = HAL_MSICommandRead(&msiCommand);
+ * </code>
+ */
+bool HAL_MSICommandRead(MSI_COMMAND_T *pCommand)
+{
+    if (SI1MBXSbits.DTRDYA == 0)
+    {
+        return false;
+    }
+    pCommand->velocityRefMC1 = (int16_t)SI1MBX0D;
+    pCommand->iqRefMC1 = (int16_t)SI1MBX1D;
+    pCommand->idRefMC1 = (int16_t)SI1MBX2D;
+    pCommand->velocityRefMC2 = (int16_t)SI1MBX3D;
+    pCommand->iqRefMC2 = (int16_t)SI1MBX4D;
+    pCommand->idRefMC2 = (int16_t)SI1MBX5D;
+    pCommand->flags = SI1MBX6D;
+    return true;
+}
+
+/**
+ * <B> Function: HAL_MSIFeedbackWrite(const MSI_FEEDBACK_T *)  </B>
+ * @brief Function writes the feedback to the Main core (protocol block B)
+ *        when the previous feedback has been read. Writing the last register
+ *        (MBX15) sets the data ready flag of the block.
+ * @param Pointer to the feedback.
+ * @return true - feedback written, false - previous feedback not yet read.
+ * @example
+ * <code>
+ * status = HAL_MSIFeedbackWrite(&msiFeedback);
+ * </code>
+ */
+bool HAL_MSIFeedbackWrite(const MSI_FEEDBACK_T *pFeedback)
+{
+    if (SI1MBXSbits.DTRDYB)
+    {
+        return false;
+    }
+    SI1MBX7D = (uint16_t)pFeedback->potentiometer;
+    SI1MBX8D = (uint16_t)pFeedback->velocityMC1;
+    SI1MBX9D = (uint16_t)pFeedback->velocityMC2;
+    SI1MBX10D = (uint16_t)pFeedback->iqRefMC1;
+    SI1MBX11D = (uint16_t)pFeedback->iqRefMC2;
+    SI1MBX12D = (uint16_t)pFeedback->voltageErrorMC1;
+    SI1MBX13D = (uint16_t)pFeedback->voltageErrorMC2;
+    SI1MBX14D = (uint16_t)pFeedback->voltageDemand;
+    SI1MBX15D = pFeedback->status;
+    return true;
+}
+
+// </editor-fold>
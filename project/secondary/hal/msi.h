@@ -0,0 +1,94 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file msi.h
+ *
+ * @brief This header file lists interface functions for the data exchange 
+ * with the Main core through the MSI mailboxes. Data types are shared by both
+ * cores in msi_protocol.h.
+ * 
+ * Definitions in the file are for dsPIC33CH512MP508 MC DIM plugged onto 
+ * Motor Control Development board from Microchip
+ * 
+ * Component: MSI
+ * 
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*******************************************************************************
+* SOFTWARE LICENSE AGREEMENT
+* 
+*  [2024] Microchip Technology Inc. and its subsidiaries
+* 
+* Subject to your compliance with these terms, you may use this Microchip 
+* software and any derivatives exclusively with Microchip products. 
+* You are responsible for complying with third party license terms applicable to
+* your use of third party software (including open source software) that may 
+* accompany this Microchip software.
+* 
+* Redistribution of this Microchip software in source or binary form is allowed 
+* and must include the above terms of use and the following disclaimer with the
+* distribution and accompanying materials.
+* 
+* SOFTWARE IS "AS IS." NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+* APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,
+* MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL 
+* MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR 
+* CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO
+* THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE 
+* POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY
+* LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL
+* NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS
+* SOFTWARE
+*
+* You agree that you are solely responsible for testing the code and
+* determining its suitability.  Microchip has no obligation to modify, test,
+* certify, or support the code.
+*
+*******************************************************************************/
+// </editor-fold>
+
+#ifndef __MSI_H
+#define __MSI_H
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+    
+#ifdef __XC16__  // See comments at the top of this header file
+    #include <xc.h>
+#endif // __XC16__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "msi_protocol.h"
+
+// </editor-fold> 
+
+#ifdef __cplusplus  // Provide C++ Compatability
+    extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS or MACROS ">
+
+/* Motors are stopped when no command is received within the timeout 
+   (TIMER1 periods) */
+#define MSI_COMMAND_TIMEOUT     100
+/* Feedback is written MSI_FEEDBACK_DELAY TIMER1 periods after a command is 
+   read, one to two periods before the next exchange of the Main core 
+   (every 10 TIMER1 periods) : the outer loops run on fresh feedback */
+#define MSI_FEEDBACK_DELAY      8
+
+// </editor-fold>    
+        
+// <editor-fold defaultstate="collapsed" desc="INTERFACE FUNCTIONS ">
+
+bool HAL_MSICommandRead(MSI_COMMAND_T *);
+bool HAL_MSIFeedbackWrite(const MSI_FEEDBACK_T *);
+
+// </editor-fold> 
+
+#ifdef __cplusplus  // Provide C++ Compatibility
+    }
+#endif
+#endif      // end of __MSI_H
@@ -653,7 +653,11 @@ void InitPWMGenerator1 (void)
     /* ADC Trigger 1 Source is PG1TRIGB Compare Event Enable bit
        0 = PG1TRIGB register compare event is disabled as trigger source for 
            ADC Trigger 1 */
+#ifdef ENABLE_CURRENT_OVERSAMPLING
+    PG1EVTLbits.ADTR1EN2 = 1;
+#else
     PG1EVTLbits.ADTR1EN2 = 0;
+#endif
     /* ADC Trigger 1 Source is PG1TRIGA Compare Event Enable bit
        1 = PG1TRIGA register compare event is enabled as trigger source for 
            ADC Trigger 1 */
@@ -690,7 +694,11 @@ void InitPWMGenerator1 (void)
     /* ADC Trigger 2 Source is PG1TRIGC Compare Event Enable bit
        0 = PG1TRIGC register compare event is disabled as 
            trigger source for ADC Trigger 2 */
+#ifdef ENABLE_MC1_SINGLE_SHUNT
+    PG1EVTHbits.ADTR2EN3 = 1;
+#else
     PG1EVTHbits.ADTR2EN3 = 0;
+#endif
     /* ADC Trigger 2 Source is PG1TRIGB Compare Event Enable bit
        0 = PG1TRIGB register compare event is disabled as 
            trigger source for ADC Trigger 2 */
@@ -817,9 +825,13 @@ void InitPWMGenerator1 (void)
     PG1DTH       = DDEADTIME;
 
     /* Initialize PWM GENERATOR 1 TRIGGER A REGISTER */
-    PG1TRIGA     = ADC_SAMPLING_POINT;
+    PG1TRIGA     = ADC_SAMPLING_POINT_A;
     /* Initialize PWM GENERATOR 1 TRIGGER B REGISTER */
+#ifdef ENABLE_CURRENT_OVERSAMPLING
+    PG1TRIGB     = ADC_SAMPLING_POINT_B;
+#else
     PG1TRIGB     = 0x0000;
+#endif
     /* Initialize PWM GENERATOR 1 TRIGGER C REGISTER */
     PG1TRIGC     = 0x0000;
    
@@ -1830,7 +1842,7 @@ void InitPWMGenerator5 (void)
     /* Initialize PWM GENERATOR 5 PHASE REGISTER */
     PG5PHASE     = 0x0000;
     /* Initialize PWM GENERATOR 5 DUTY CYCLE REGISTER */
-    PG5DC        = LOOPTIME_TCY+1;
+    PG5DC        = MC2_PWM_PHASE_COUNT;
     /* Initialize PWM GENERATOR 5 DUTY CYCLE ADJUSTMENT REGISTER */
     PG5DCA       = 0x0000;
     /* Initialize PWM GENERATOR 5 PERIOD REGISTER */
@@ -2004,7 +2016,11 @@ void InitPWMGenerator6 (void)
     /* ADC Trigger 1 Source is PG6TRIGB Compare Event Enable bit
        0 = PG6TRIGB register compare event is disabled as trigger source for 
            ADC Trigger 1 */
+#ifdef ENABLE_CURRENT_OVERSAMPLING
+    PG6EVTLbits.ADTR1EN2 = 1;
+#else
     PG6EVTLbits.ADTR1EN2 = 0;
+#endif
     /* ADC Trigger 1 Source is PG6TRIGA Compare Event Enable bit
        0 = PG6TRIGA register compare event is disabled as trigger source for 
            ADC Trigger 1 */
@@ -2167,9 +2183,13 @@ void InitPWMGenerator6 (void)
     PG6DTH       = DDEADTIME;
 
     /* Initialize PWM GENERATOR 6 TRIGGER A REGISTER */
-    PG6TRIGA     = ADC_SAMPLING_POINT; 
+    PG6TRIGA     = ADC_SAMPLING_POINT_A; 
     /* Initialize PWM GENERATOR 6 TRIGGER B REGISTER */
+#ifdef ENABLE_CURRENT_OVERSAMPLING
+    PG6TRIGB     = ADC_SAMPLING_POINT_B;
+#else
     PG6TRIGB     = 0x0000;
+#endif
     /* Initialize PWM GENERATOR 6 TRIGGER C REGISTER */
     PG6TRIGC     = 0x0000;
 }
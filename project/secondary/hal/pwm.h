@@ -107,9 +107,54 @@
 
 /* Specify ADC Triggering Point w.r.t PWM Output for sensing Motor Currents */
 #define ADC_SAMPLING_POINT     (uint16_t)(DDEADTIME/2 )
+
+/* Definition to enable oversampling of phase currents : dedicated ADC cores
+   convert phase currents twice per PWM period (PGxTRIGA and PGxTRIGB), 
+   centred on ADC_SAMPLING_POINT, and ADC digital filters 0 and 1 average 
+   the two conversions. Spacing must exceed dedicated core conversion time */
+#undef ENABLE_CURRENT_OVERSAMPLING
+/* Specify spacing of the current conversions in micro seconds */
+#define CURRENT_OVERSAMPLE_SPACING_MICROSEC 0.8
+#define CURRENT_OVERSAMPLE_SPACING  (uint16_t)(CURRENT_OVERSAMPLE_SPACING_MICROSEC*FOSC_MHZ)
+#ifdef ENABLE_CURRENT_OVERSAMPLING
+    #define ADC_SAMPLING_POINT_A    (ADC_SAMPLING_POINT - CURRENT_OVERSAMPLE_SPACING/2)
+    #define ADC_SAMPLING_POINT_B    (ADC_SAMPLING_POINT + CURRENT_OVERSAMPLE_SPACING/2)
+    /* Low side conduction around PWM midpoint must cover the last conversion */
+    #define OVERSAMPLE_DUTY_MARGIN  (uint16_t)(CURRENT_OVERSAMPLE_SPACING/2)
+#else
+    #define ADC_SAMPLING_POINT_A    ADC_SAMPLING_POINT
+    #define OVERSAMPLE_DUTY_MARGIN  0
+#endif
+
+/* Definition to enable single shunt current reconstruction of MC1 : bus 
+   current (S1AN13) is converted on PG1TRIGC (ADC Trigger 2) inside an active
+   vector planned by the control. MC2 is not supported, its bus current 
+   channel (S1AN18) is the MC2 ADC interrupt channel triggered on PG6TRIGA */
+#undef ENABLE_MC1_SINGLE_SHUNT
+
 /* Minimum and Maximum PWM duty cycle */        
 #define MIN_DUTY            (uint16_t)(DDEADTIME + DDEADTIME/2)
-#define MAX_DUTY            LOOPTIME_TCY - (uint16_t)(DDEADTIME + DDEADTIME/2)
+#define MAX_DUTY            LOOPTIME_TCY - (uint16_t)(DDEADTIME + DDEADTIME/2) \
+                                - OVERSAMPLE_DUTY_MARGIN
+
+/* Carrier phase shift of MC2 PWM (PG6-PG8) with respect to MC1 PWM (PG1-PG3)
+   in degrees of the PWM period. PG1-PG3 start on the rising edge and PG6-PG8
+   on the falling edge of PG5, so PG5 duty sets the shift. 180 degrees
+   interleaves the inverter switching ripple on the shared DC link.
+   MC2 ADC trigger (PG6TRIGA) and ADC interrupt follow the MC2 carrier. */
+#define MC2_PWM_PHASE_DEG       180
+/* Minimum shift : ADC dedicated cores 0 and 1 are shared by MC1 and MC2 and
+   switched over in the ADC interrupts, so MC1 interrupt must complete before
+   MC2 trigger and vice versa. Keep above worst case interrupt execution time
+   (see isrCyclesMax of control KPI) */
+#define MC2_PWM_PHASE_MIN_DEG   120
+#if (MC2_PWM_PHASE_DEG < MC2_PWM_PHASE_MIN_DEG) || \
+    (MC2_PWM_PHASE_DEG > (360 - MC2_PWM_PHASE_MIN_DEG))
+    #error MC2_PWM_PHASE_DEG leaves no time for MC1 or MC2 ADC interrupt
+#endif
+/* MC2 carrier phase shift in terms of PWM clock period (PG5 duty) */
+#define MC2_PWM_PHASE_COUNT     (uint16_t)(((uint32_t)(LOOPTIME_TCY+1)* \
+                                            MC2_PWM_PHASE_DEG)/180)
 
         
 /* Specify Overrides for PWM TOP and BOTTOM ON */
@@ -52,6 +52,7 @@
 #include <xc.h>
 
 #include "board_service.h"
+#include "msi.h"
 
 #include "diagnostics.h"
 
@@ -65,6 +66,14 @@
 
 int16_t runCmdMC1, qTargetVelocityMC1;
 int16_t runCmdMC2, qTargetVelocityMC2;
+
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+MSI_COMMAND_T msiCommand;
+MSI_FEEDBACK_T msiFeedback;
+uint16_t msiCommandAge;
+
+static void MCAPP_CrossCoreExchange(void);
+#endif
 // </editor-fold>
 
 /**
@@ -148,8 +157,12 @@ void __attribute__((__interrupt__,__auto_psv__)) _T1Interrupt (void)
     runCmdMC2 = 0;
 #endif
 	
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+    MCAPP_CrossCoreExchange();
+#else
     qTargetVelocityMC1 = MCAPP_MC1GetTargetVelocity();
     qTargetVelocityMC2 = MCAPP_MC2GetTargetVelocity();
+#endif
     
     MCAPP_MC1InputBufferSet(runCmdMC1, qTargetVelocityMC1);
     MCAPP_MC2InputBufferSet(runCmdMC2, qTargetVelocityMC2);
@@ -186,4 +199,90 @@ void __attribute__((__interrupt__,no_auto_psv)) _MC2PWMInterrupt()
       MCAPP_MC2ServiceInit();
      */
     ClearMC2PWMIF();
-}
\ No newline at end of file
+}
+
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+/**
+* <B> Function: MCAPP_CrossCoreExchange()  </B>
+*
+* @brief Function exchanges data with the supervisory tasks of the Main core,
+*        which run the outer loops (velocity reference ramp, speed and flux 
+*        weakening controllers) of both motors. Outer loop references and 
+*        run permissions are taken from the last command. Without permission
+*        (or command timeout) run commands are cleared, so that a motor 
+*        never starts on a late permission.
+*        Feedback is written MSI_FEEDBACK_DELAY periods after a command is
+*        read, so that it is fresh at the next exchange of the Main core; 
+*        without commands it is written when the Main core has read the 
+*        previous one. It includes the outer loop status, the estimated 
+*        velocity, the speed and flux weakening controller inputs and the DC 
+*        link voltage demand of the motors, the larger of the two, which the
+*        PFC may use to adapt its voltage reference.
+* 
+*/
+static void MCAPP_CrossCoreExchange(void)
+{
+    uint16_t flagsMC1, flagsMC2;
+    int16_t voltageDemandMC2;
+    
+    if (HAL_MSICommandRead(&msiCommand))
+    {
+        msiCommandAge = 0;
+    }
+    else if (msiCommandAge < MSI_COMMAND_TIMEOUT)
+    {
+        msiCommandAge++;
+    }
+    if (msiCommandAge >= MSI_COMMAND_TIMEOUT)
+    {
+        msiCommand.flags = 0;
+    }
+    
+    flagsMC1 = msiCommand.flags & MSI_FLAGS_MASK;
+    flagsMC2 = (msiCommand.flags >> MSI_FLAGS_SHIFT_MC2) & MSI_FLAGS_MASK;
+    if ((flagsMC1 & MSI_RUN_PERMIT) == 0)
+    {
+        runCmdMC1 = 0;
+    }
+    if ((flagsMC2 & MSI_RUN_PERMIT) == 0)
+    {
+        runCmdMC2 = 0;
+    }
+    MCAPP_MC1OuterLoopSet(flagsMC1, msiCommand.velocityRefMC1, 
+                            msiCommand.iqRefMC1, msiCommand.idRefMC1);
+    MCAPP_MC2OuterLoopSet(flagsMC2, msiCommand.velocityRefMC2, 
+                            msiCommand.iqRefMC2, msiCommand.idRefMC2);
+    qTargetVelocityMC1 = 0;
+    qTargetVelocityMC2 = 0;
+    
+    if ((msiCommandAge != MSI_FEEDBACK_DELAY) && 
+        (msiCommandAge < MSI_COMMAND_TIMEOUT))
+    {
+        return;
+    }
+    msiFeedback.potentiometer = MCAPP_MC1GetPotentiometer();
+    msiFeedback.status = MCAPP_MC1GetOuterLoopStatus() | 
+            (MCAPP_MC2GetOuterLoopStatus() << MSI_FLAGS_SHIFT_MC2);
+    if (runCmdMC1)
+    {
+        msiFeedback.status |= MSI_RUN_CMD;
+    }
+    if (runCmdMC2)
+    {
+        msiFeedback.status |= MSI_RUN_CMD << MSI_FLAGS_SHIFT_MC2;
+    }
+    msiFeedback.velocityMC1 = MCAPP_MC1GetVelocity();
+    msiFeedback.velocityMC2 = MCAPP_MC2GetVelocity();
+    msiFeedback.iqRefMC1 = MCAPP_MC1GetCurrentReference();
+    msiFeedback.iqRefMC2 = MCAPP_MC2GetCurrentReference();
+    msiFeedback.voltageErrorMC1 = MCAPP_MC1GetFluxWeakeningError();
+    msiFeedback.voltageErrorMC2 = MCAPP_MC2GetFluxWeakeningError();
+    msiFeedback.voltageDemand = MCAPP_MC1GetVoltageDemand();
+    voltageDemandMC2 = MCAPP_MC2GetVoltageDemand();
+    if (voltageDemandMC2 > msiFeedback.voltageDemand)
+    {
+        msiFeedback.voltageDemand = voltageDemandMC2;
+    }
+    HAL_MSIFeedbackWrite(&msiFeedback);
+}
+#endif
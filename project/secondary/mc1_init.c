@@ -77,27 +77,33 @@ static void MCAPP_MC1OutputConfig(MC1APP_DATA_T *);
 // </editor-fold>
 
 /**
-* <B> Function: MCAPP_MC1ParamsInit (MC1APP_DATA_T *)  </B>
+* <B> Function: MCAPP_MC1ParamsInit (MC1APP_DATA_T *, MC1APP_ISR_DATA_T *,
+*                                               MCAPP_MOTOR_T *)  </B>
 *
 * @brief Function to reset variables used for current offset measurement.
 *
 * @param Pointer to the Application data structure required for 
 * controlling motor 1.
+* @param Pointer to the ISR state of motor 1.
+* @param Pointer to the motor parameters of motor 1.
 * @return none.
 * @example
-* <CODE> MCAPP_MC1ParamsInit(&mc1); </CODE>
+* <CODE> MCAPP_MC1ParamsInit(&mc1, &mc1Isr, &mc1Motor); </CODE>
 *
 */
-void MCAPP_MC1ParamsInit(MC1APP_DATA_T *pMCData)
+void MCAPP_MC1ParamsInit(MC1APP_DATA_T *pMCData, MC1APP_ISR_DATA_T *pIsrData,
+                                                MCAPP_MOTOR_T *pMotor)
 {    
-    /* Reset all variables in the data structure to '0' */
+    /* Reset all variables in the data structures to '0' */
     memset(pMCData,0,sizeof(MC1APP_DATA_T));
+    memset(pIsrData,0,sizeof(MC1APP_ISR_DATA_T));
+    memset(pMotor,0,sizeof(MCAPP_MOTOR_T));
 
-    pMCData->pControlScheme = &pMCData->controlScheme;
-    pMCData->pMotorInputs = &pMCData->motorInputs;
+    pMCData->pControlScheme = &pIsrData->controlScheme;
+    pMCData->pMotorInputs = &pIsrData->motorInputs;
     pMCData->pLoad = &pMCData->load;
-    pMCData->pMotor = &pMCData->motor;
-    pMCData->pPWMDuty = &pMCData->PWMDuty;
+    pMCData->pMotor = pMotor;
+    pMCData->pPWMDuty = &pIsrData->PWMDuty;
     
     /* Configure Feedbacks */
     MCAPP_MC1FeedbackConfig(pMCData);
@@ -119,10 +125,10 @@ void MCAPP_MC1FeedbackConfig(MC1APP_DATA_T *pMCData)
 {
     pMCData->HAL_MotorInputsRead = HAL_MC1MotorInputsRead;
     
-    pMCData->motorInputs.measureVdc.dcMinRun = 
+    pMCData->pMotorInputs->measureVdc.dcMinRun = 
                         NORM_VALUE(MC1_MOTOR_MIN_DC_VOLT, MC1_PEAK_VOLTAGE);
     
-    pMCData->motorInputs.measureVdc.dcMaxStop = 
+    pMCData->pMotorInputs->measureVdc.dcMaxStop = 
                         NORM_VALUE(MC1_MOTOR_MIN_DC_VOLT, MC1_PEAK_VOLTAGE);
 
 }
@@ -144,6 +150,9 @@ void MCAPP_MC1ControlSchemeConfig(MC1APP_DATA_T *pMCData)
     pControlScheme->pIb = &pMotorInputs->measureCurrent.Ib;
     pControlScheme->pVdc = &pMotorInputs->measureVdc.value;  
     pControlScheme->pMotor = pMCData->pMotor;
+    pControlScheme->pMechId = &pMCData->mechId;
+    pControlScheme->pLoadObserver = &pMCData->loadObserver;
+    pControlScheme->pKpi = &pMCData->kpi;
     
     /* Initialize IMotor parameters */
     pMotor->polePairs       = POLEPAIRS;
@@ -188,6 +197,14 @@ void MCAPP_MC1ControlSchemeConfig(MC1APP_DATA_T *pMCData)
     pControlScheme->ctrlParam.speedRampIncLimit = RAMP_UP_TIME_MULTIPLIER;
     pControlScheme->ctrlParam.speedRampDecLimit = RAMP_DN_TIME_MULTIPLIER;   
     
+#ifdef ENABLE_SPEED_TRAJECTORY
+    pControlScheme->speedTraj.enable = 1;
+#else
+    pControlScheme->speedTraj.enable = 0;
+#endif
+    pControlScheme->speedTraj.accelMax = SPEED_TRAJ_ACCEL;
+    pControlScheme->speedTraj.jerkMax = SPEED_TRAJ_JERK;
+    
     pControlScheme->ctrlParam.normDeltaT = NORM_DELTA_T;
 
     
@@ -222,7 +239,11 @@ void MCAPP_MC1ControlSchemeConfig(MC1APP_DATA_T *pMCData)
     /* Initialize PLL Estimator */
     pControlScheme->estimPLL.pCtrlParam  = &pControlScheme->ctrlParam;
     pControlScheme->estimPLL.pIAlphaBeta = &pControlScheme->ialphabeta;
+#ifdef ENABLE_DEADTIME_COMPENSATION
+    pControlScheme->estimPLL.pVAlphaBeta = &pControlScheme->deadTimeComp.valphabeta;
+#else
     pControlScheme->estimPLL.pVAlphaBeta = &pControlScheme->valphabeta;
+#endif
     pControlScheme->estimPLL.pMotor      = pMCData->pMotor;
     pControlScheme->estimPLL.pIdq        = &pControlScheme->idq;
 
@@ -253,11 +274,202 @@ void MCAPP_MC1ControlSchemeConfig(MC1APP_DATA_T *pMCData)
     pControlScheme->fluxControl.feedBackFW.IdRefFiltConst = FD_WEAK_IDREF_FILT_CONST;
     pControlScheme->fluxControl.feedBackFW.IdRefMin = ID_REF_MIN;
     
+    /* Initialize MTPA Id reference generation */
+    pControlScheme->fluxControl.mtpa.pCtrlParam = &pControlScheme->ctrlParam;
+#ifdef ENABLE_MTPA
+    pControlScheme->fluxControl.mtpa.enable = 1;
+#else
+    pControlScheme->fluxControl.mtpa.enable = 0;
+#endif
+    pControlScheme->fluxControl.mtpa.constA = MTPA_CONST_A;
+    pControlScheme->fluxControl.mtpa.constAScale = MTPA_CONST_A_QVALUE;
+    MCAPP_MTPATableInit(&pControlScheme->fluxControl.mtpa);
+    
 
     /* Output Initializations */
     pControlScheme->pwmPeriod = MC1_LOOPTIME_TCY;
+    pControlScheme->vMaxFactor = VMAX_FACTOR;
+    
+    /* Initialize overmodulation */
+#ifdef ENABLE_OVERMODULATION
+    pControlScheme->overmod.enable = 1;
+#else
+    pControlScheme->overmod.enable = 0;
+#endif
+    pControlScheme->overmod.dutyMin = MIN_DUTY;
+    pControlScheme->overmod.dutyMax = MAX_DUTY;
+
+    /* Initialize dq decoupling feedforward */
+#ifdef ENABLE_DECOUPLING_FEEDFORWARD
+    pControlScheme->decoupling.enable = 1;
+#else
+    pControlScheme->decoupling.enable = 0;
+#endif
+    pControlScheme->decoupling.xd = DECOUPLING_XD;
+    pControlScheme->decoupling.xq = DECOUPLING_XQ;
+    pControlScheme->decoupling.xScale = DECOUPLING_X_QVALUE;
+    pControlScheme->decoupling.kfi = DECOUPLING_KFI;
+    pControlScheme->decoupling.kfiScale = DECOUPLING_KFI_QVALUE;
+
+    /* Initialize dead time compensation */
+#ifdef ENABLE_DEADTIME_COMPENSATION
+    pControlScheme->deadTimeComp.enable = 1;
+#else
+    pControlScheme->deadTimeComp.enable = 0;
+#endif
+    pControlScheme->deadTimeComp.errorDuty = DT_COMP_ERROR_DUTY;
+    pControlScheme->deadTimeComp.deviceDrop = DT_COMP_DEVICE_DROP;
+    pControlScheme->deadTimeComp.signGain = DT_COMP_SIGN_GAIN;
+    pControlScheme->deadTimeComp.signGainScale = DT_COMP_SIGN_GAIN_SCALE;
+    pControlScheme->deadTimeComp.vdcGain = DT_COMP_VDC_GAIN;
+    pControlScheme->deadTimeComp.dutyMin = MIN_DUTY;
+    pControlScheme->deadTimeComp.dutyMax = MAX_DUTY;
+    pControlScheme->deadTimeComp.pIabc = &pControlScheme->iabc;
+    pControlScheme->deadTimeComp.pVAlphaBeta = &pControlScheme->valphabeta;
+    pControlScheme->deadTimeComp.pVdc = pControlScheme->pVdc;
     pControlScheme->pPWMDuty = pMCData->pPWMDuty;
 
+    /* Initialize mechanical identification and speed gain scheduling */
+#ifdef ENABLE_MECHANICAL_IDENTIFICATION
+    pControlScheme->pMechId->enable = 1;
+#else
+    pControlScheme->pMechId->enable = 0;
+#endif
+#ifdef ENABLE_INERTIA_ESTIMATION
+    pControlScheme->pMechId->onlineEnable = 1;
+#else
+    pControlScheme->pMechId->onlineEnable = 0;
+#endif
+#ifdef ENABLE_SPEED_GAIN_SCHEDULING
+    pControlScheme->pMechId->scheduleEnable = 1;
+#else
+    pControlScheme->pMechId->scheduleEnable = 0;
+#endif
+    pControlScheme->pMechId->speedLow = NORM_VALUE(MECH_ID_SPEED_LOW_RPM, MC1_PEAK_SPEED_RPM);
+    pControlScheme->pMechId->speedHigh = NORM_VALUE(MECH_ID_SPEED_HIGH_RPM, MC1_PEAK_SPEED_RPM);
+    pControlScheme->pMechId->settleCount = MECH_ID_SETTLE_COUNT;
+    pControlScheme->pMechId->bandwidth = MECH_SPEED_BANDWIDTH;
+    pControlScheme->pMechId->accelMin = MECH_ID_ACCEL_MIN;
+    pControlScheme->pMechId->report.tmEstim = MECH_TIME_CONSTANT_INIT;
+    pControlScheme->pMechId->pCtrlParam = &pControlScheme->ctrlParam;
+    pControlScheme->pMechId->pIq = &pControlScheme->idq.q;
+    pControlScheme->pMechId->pVelEstim = &pControlScheme->estimInterface.qVelEstim;
+    pControlScheme->pMechId->pPISpeed = &pControlScheme->piSpeed;
+
+    /* Initialize load torque observer and repetitive feedforward */
+#ifdef ENABLE_LOAD_OBSERVER
+    pControlScheme->pLoadObserver->enable = 1;
+#else
+    pControlScheme->pLoadObserver->enable = 0;
+#endif
+#ifdef ENABLE_REPETITIVE_FEEDFORWARD
+    pControlScheme->pLoadObserver->repetitiveEnable = 1;
+#else
+    pControlScheme->pLoadObserver->repetitiveEnable = 0;
+#endif
+    pControlScheme->pLoadObserver->gain = LOAD_OBS_GAIN;
+    pControlScheme->pLoadObserver->learnGain = LOAD_OBS_LEARN_GAIN;
+    pControlScheme->pLoadObserver->speedMin = pMotor->qMinSpeed;
+    pControlScheme->pLoadObserver->iqLimit = SPEEDCNTR_OUTMAX;
+    pControlScheme->pLoadObserver->polePairs = POLEPAIRS;
+    pControlScheme->pLoadObserver->pIq = &pControlScheme->idq.q;
+    pControlScheme->pLoadObserver->pVelEstim = &pControlScheme->estimInterface.qVelEstim;
+    pControlScheme->pLoadObserver->pTheta = &pControlScheme->estimInterface.qTheta;
+    pControlScheme->pLoadObserver->pTm = &pMCData->mechId.report.tmEstim;
+
+    /* Initialize DC link overvoltage control */
+#ifdef ENABLE_VDC_OVERVOLTAGE_CONTROL
+    pControlScheme->vdcLimit.enable = 1;
+#else
+    pControlScheme->vdcLimit.enable = 0;
+#endif
+    pControlScheme->vdcLimit.vdcStart = VDC_LIMIT_START;
+    pControlScheme->vdcLimit.vdcStop = VDC_LIMIT_STOP;
+    pControlScheme->vdcLimit.filterCoef = VDC_LIMIT_FILTER_COEF;
+    pControlScheme->vdcLimit.iqLimit = SPEEDCNTR_OUTMAX;
+    pControlScheme->vdcLimit.pVdc = pControlScheme->pVdc;
+
+    /* Initialize mains loss ride through */
+#ifdef ENABLE_RIDE_THROUGH
+    pControlScheme->rideThrough.enable = 1;
+#else
+    pControlScheme->rideThrough.enable = 0;
+#endif
+    pControlScheme->rideThrough.vdcArm = RIDE_THROUGH_VDC_ARM;
+    pControlScheme->rideThrough.vdcRef = RIDE_THROUGH_VDC_REF;
+    pControlScheme->rideThrough.vdcReturn = RIDE_THROUGH_VDC_RETURN;
+    pControlScheme->rideThrough.speedMin = pMotor->qMinSpeed;
+    pControlScheme->rideThrough.piVdc.kp = RIDE_THROUGH_PTERM;
+    pControlScheme->rideThrough.piVdc.nkp = RIDE_THROUGH_PTERM_SCALE;
+    pControlScheme->rideThrough.piVdc.ki = RIDE_THROUGH_ITERM;
+    pControlScheme->rideThrough.piVdc.nki = RIDE_THROUGH_ITERM_SCALE;
+    pControlScheme->rideThrough.piVdc.kc = Q15(0.99999);
+    pControlScheme->rideThrough.piVdc.outMax = SPEEDCNTR_OUTMAX;
+    pControlScheme->rideThrough.piVdc.outMin = 0;
+    pControlScheme->rideThrough.pVdc = pControlScheme->pVdc;
+    pControlScheme->rideThrough.pVelEstim = &pControlScheme->estimInterface.qVelEstim;
+
+    /* Initialize control KPI measurement */
+#ifdef ENABLE_CONTROL_KPI
+    pControlScheme->pKpi->enable = 1;
+#else
+    pControlScheme->pKpi->enable = 0;
+#endif
+    pControlScheme->pKpi->stepMin = NORM_VALUE(CONTROL_KPI_STEP_MIN_RPM, MC1_PEAK_SPEED_RPM);
+    pControlScheme->pKpi->settleBand = Q15(CONTROL_KPI_SETTLE_BAND);
+    pControlScheme->pKpi->isrCyclesMax = 0;
+    pControlScheme->pKpi->isrLatencyMin = 0xFFFF;
+    pControlScheme->pKpi->isrLatencyMax = 0;
+    pControlScheme->pKpi->pCtrlParam = &pControlScheme->ctrlParam;
+    pControlScheme->pKpi->pFocState = &pControlScheme->focState;
+    pControlScheme->pKpi->pVelEstim = &pControlScheme->estimInterface.qVelEstim;
+    pControlScheme->pKpi->pIq = &pControlScheme->idq.q;
+    pControlScheme->pKpi->pThetaOffset = &pControlScheme->estimInterface.qThetaOffset;
+
+    /* Initialize single shunt current reconstruction */
+#ifdef ENABLE_MC1_SINGLE_SHUNT
+    pControlScheme->singleShunt.enable = 1;
+#else
+    pControlScheme->singleShunt.enable = 0;
+#endif
+#if defined(ENABLE_MC1_SINGLE_SHUNT) && defined(SINGLE_SHUNT_CURRENT_FEEDBACK)
+    pControlScheme->singleShunt.feedback = 1;
+#else
+    pControlScheme->singleShunt.feedback = 0;
+#endif
+    pControlScheme->singleShunt.ibusGain = SINGLE_SHUNT_GAIN;
+    pControlScheme->singleShunt.windowMin = SINGLE_SHUNT_WINDOW_MIN;
+    pControlScheme->singleShunt.sampleAdvance = SINGLE_SHUNT_SAMPLE_ADVANCE;
+    pControlScheme->singleShunt.shiftMax = SINGLE_SHUNT_WINDOW_MIN;
+    pControlScheme->singleShunt.dutyMin = MIN_DUTY;
+    pControlScheme->singleShunt.dutyMax = MAX_DUTY;
+    pControlScheme->singleShunt.plausibilityLimit = SINGLE_SHUNT_PLAUSIBILITY;
+    pControlScheme->singleShunt.plausibilityFaultCount = 0;
+    pControlScheme->singleShunt.pIbus = &pMotorInputs->measureCurrent.Ibus;
+    pControlScheme->singleShunt.pIa = &pMotorInputs->measureCurrent.Ia;
+    pControlScheme->singleShunt.pIb = &pMotorInputs->measureCurrent.Ib;
+
+    /* Initialize parameter identification */
+#ifdef ENABLE_PARAMETER_IDENTIFICATION
+    pMCData->paramId.enable = 1;
+#else
+    pMCData->paramId.enable = 0;
+#endif
+    pMCData->paramId.testCurrentLow = PARAM_ID_CURRENT_LOW;
+    pMCData->paramId.testCurrentHigh = PARAM_ID_CURRENT_HIGH;
+    pMCData->paramId.lsStepVoltage = PARAM_ID_LS_STEP_VOLTAGE;
+    pMCData->paramId.lsDeltaCurrent = PARAM_ID_LS_DELTA_CURRENT;
+    pMCData->paramId.voltageLimit = PARAM_ID_VOLTAGE_LIMIT;
+    pMCData->paramId.vdcBase = DC_LINK_BASE_VOLTAGE;
+    pMCData->paramId.settleCount = PARAM_ID_SETTLE_COUNT;
+    pMCData->paramId.bandwidth = PARAM_ID_PI_BANDWIDTH;
+    pMCData->paramId.overshootMax = PARAM_ID_PI_OVERSHOOT;
+    pMCData->paramId.settleTimeMax = PARAM_ID_PI_SETTLE_COUNT;
+    pMCData->paramId.dutyMin = MIN_DUTY;
+    pMCData->paramId.dutyMax = MAX_DUTY;
+    pMCData->paramId.pFOC = pControlScheme;
+    MCAPP_ParamIdInit(&pMCData->paramId);
+
     /* Initialize application structure */
     pMCData->MCAPP_ControlSchemeInit = MCAPP_FOCInit;
     pMCData->MCAPP_ControlStateMachine = MCAPP_FOCStateMachine;
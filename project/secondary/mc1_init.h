@@ -64,6 +64,8 @@ extern "C" {
 #include "foc.h"
 #include "fault.h"
 #include "generic_load.h"
+#include "param_id.h"
+#include "mc_app_types.h"
     
 // </editor-fold>
 
@@ -75,33 +77,53 @@ extern "C" {
     
 // <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
 
+/* ISR state of motor 1 : updated every control period */
+typedef struct
+{
+    MCAPP_MEASURE_T
+        motorInputs;
+    
+    MCAPP_CONTROL_SCHEME_T
+        controlScheme;              /* Motor Control parameters */
+    
+    MC_DUTYCYCLEOUT_T
+        PWMDuty;
+
+}MC1APP_ISR_DATA_T;
+
+/* Configuration and slow state of motor 1, ISR state is accessed through
+   pMotorInputs, pControlScheme and pPWMDuty */
 typedef struct
 {
     int16_t
         appState,                   /* Application State */
         runCmd,                     /* Run command for motor */
         runCmdBuffer,               /* Run command buffer for validation */
+        identCmd,                   /* Parameter identification command */
         qTargetVelocity,            /* Target motor Velocity */
         qMaxSpeedFactor;            /* Maximum speed to peak speed ratio */
     
-    MCAPP_MEASURE_T
-        motorInputs;
-    
-    MCAPP_MOTOR_T
-        motor;
-    
-    MCAPP_CONTROL_SCHEME_T
-        controlScheme;              /* Motor Control parameters */
+    MCAPP_COMMAND_BUFFER_T
+        command;                    /* Run command and target velocity */
     
     MCAPP_LOAD_T
         load;                       /* Load parameters */
     
-    MC_DUTYCYCLEOUT_T
-        PWMDuty;
-    
     MCAPP_FAULT_T
         fault;
     
+    MCAPP_PARAM_ID_T
+        paramId;                    /* Parameter identification */
+    
+    MCAPP_MECH_ID_T
+        mechId;                     /* Mechanical identification */
+    
+    MCAPP_LOAD_OBSERVER_T
+        loadObserver;               /* Load torque observer */
+    
+    MCAPP_CONTROL_KPI_T
+        kpi;                        /* Control KPI */
+    
     MCAPP_MEASURE_T *pMotorInputs;
     MCAPP_MOTOR_T *pMotor;
     MCAPP_CONTROL_SCHEME_T *pControlScheme;
@@ -113,7 +135,7 @@ typedef struct
     void (*MCAPP_MeasureOffset) (MCAPP_MEASURE_T *);
     void (*MCAPP_GetProcessedInputs) (MCAPP_MEASURE_T *);
     int16_t (*MCAPP_IsOffsetMeasurementComplete) (MCAPP_MEASURE_T *);
-    void (*HAL_MotorInputsRead) (MCAPP_MEASURE_T *);
+    bool (*HAL_MotorInputsRead) (MCAPP_MEASURE_T *);
     
     /* Function pointers for control scheme */
     void (*MCAPP_ControlSchemeInit) (MCAPP_CONTROL_SCHEME_T *);
@@ -143,7 +165,8 @@ typedef struct
     
 // <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
 
-void MCAPP_MC1ParamsInit(MC1APP_DATA_T *);
+void MCAPP_MC1ParamsInit(MC1APP_DATA_T *, MC1APP_ISR_DATA_T *,
+                                                MCAPP_MOTOR_T *);
 
 // </editor-fold>
 
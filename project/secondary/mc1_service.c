@@ -55,9 +55,11 @@
 #include "mc1_init.h"
 #include "mc_app_types.h"
 #include "mc1_service.h"
+#include "mc1_calc_params.h"
 #include "foc.h"
 #include "general.h"
 #include "diagnostics.h"
+#include "adc_trace.h"
 // </editor-fold>
 
 // <editor-fold defaultstate="collapsed" desc="Definitions ">
@@ -69,6 +71,15 @@
 
 MC1APP_DATA_T mc1;
 MC1APP_DATA_T *pMC1Data = &mc1;
+MC1APP_ISR_DATA_T mc1Isr;
+MCAPP_MOTOR_T mc1Motor;
+
+#ifdef ENABLE_ADC_TRACE
+ADC_TRACE_T mc1Trace;
+/* Regions of MCAPP_MC1TraceInit() */
+ADC_TRACE_SNAPSHOT_CHECK(mc1, sizeof(MC1APP_DATA_T) + 
+                        sizeof(MC1APP_ISR_DATA_T) + sizeof(MCAPP_MOTOR_T));
+#endif
 
 // </editor-fold>
 
@@ -76,6 +87,12 @@ MC1APP_DATA_T *pMC1Data = &mc1;
 
 static void MC1APP_StateMachine(MC1APP_DATA_T *);
 static void MCAPP_MC1ReceivedDataProcess(MC1APP_DATA_T *);
+static void MCAPP_MC1CommandAdopt(MC1APP_DATA_T *);
+static void MCAPP_MC1PWMEnableOutputs(MC1APP_DATA_T *);
+#ifdef ENABLE_ADC_TRACE
+static void MCAPP_MC1TraceInit(MC1APP_DATA_T *);
+static uint16_t MCAPP_MC1TraceSignature(MC1APP_DATA_T *);
+#endif
 
 // </editor-fold>
 
@@ -119,6 +136,11 @@ static void MC1APP_StateMachine(MC1APP_DATA_T *pMCData)
         {
             pMCData->appState = MCAPP_OFFSET;
         }
+        else if((pMCData->identCmd == 1) && (pMCData->paramId.enable == 1))
+        {
+            MCAPP_ParamIdInit(&pMCData->paramId);
+            pMCData->appState = MCAPP_OFFSET;
+        }
        break;
        
     case MCAPP_OFFSET:
@@ -128,7 +150,15 @@ static void MC1APP_StateMachine(MC1APP_DATA_T *pMCData)
 
         if(pMCData->MCAPP_IsOffsetMeasurementComplete(pMotorInputs))
         {
-            pMCData->appState = MCAPP_LOAD_START_READY_CHECK;
+            if((pMCData->runCmd == 0) && (pMCData->identCmd == 1))
+            {
+                MCAPP_MC1PWMEnableOutputs(pMCData);
+                pMCData->appState = MCAPP_IDENTIFY;
+            }
+            else
+            {
+                pMCData->appState = MCAPP_LOAD_START_READY_CHECK;
+            }
         }
 
         break;
@@ -141,7 +171,7 @@ static void MC1APP_StateMachine(MC1APP_DATA_T *pMCData)
         if(pMCData->MCAPP_IsLoadReadyToStart(pLoad))
         {
             /* Load is ready, start the motor */
-            pMCData->HAL_PWMEnableOutputs();
+            MCAPP_MC1PWMEnableOutputs(pMCData);
 
             pMCData->MCAPP_LoadStartTransition(pControlScheme, pLoad); 
 
@@ -194,6 +224,38 @@ static void MC1APP_StateMachine(MC1APP_DATA_T *pMCData)
 
         break;
 
+    case MCAPP_IDENTIFY:
+        
+        pMCData->MCAPP_GetProcessedInputs(pMotorInputs);
+        if (MCAPP_OverCurrentFault_Detect(pMotorInputs, &pMCData->fault) == 1)
+        {
+            pMCData->appState = MCAPP_FAULT;
+            break;
+        } 
+
+        MCAPP_ParamIdStateMachine(&pMCData->paramId);
+        if (pMCData->paramId.state == PARAM_ID_KE)
+        {
+            /* BEMF is measured in open loop spin */
+            pMCData->MCAPP_ControlStateMachine(pControlScheme);
+            if(pControlScheme->faultStatus == 1) 
+            {
+                pMCData->appState = MCAPP_FAULT;
+                break;
+            }
+        }
+
+        if ((pMCData->paramId.state == PARAM_ID_COMPLETE) ||
+            (pMCData->paramId.state == PARAM_ID_FAULT) ||
+            (pMCData->identCmd == 0))
+        {
+            /* Exit identification when completed or aborted */
+            MCAPP_ParamIdStop(&pMCData->paramId);
+            pMCData->identCmd = 0;
+            pMCData->appState = MCAPP_STOP;
+        }
+        break;
+
     case MCAPP_STOP:
         pMCData->HAL_PWMDisableOutputs();
         pMCData->appState = MCAPP_INIT;
@@ -232,25 +294,81 @@ static void MC1APP_StateMachine(MC1APP_DATA_T *pMCData)
 */
 void __attribute__((__interrupt__,no_auto_psv)) MC1_ADC_INTERRUPT()
 {
+#ifdef ENABLE_CONTROL_KPI
+    const uint16_t isrStart = TIMER1_CounterRead();
+    const uint16_t adcLatency = HAL_MC1ADCInterruptLatency();
+#endif
     int16_t __attribute__((__unused__)) adcBuffer;
+#ifdef ENABLE_ADC_TRACE
+    uint16_t traceState;
+#endif
     
     #ifdef ENABLE_DIAGNOSTICS
         DiagnosticsStepIsr();
     #endif
 
-    pMC1Data->HAL_MotorInputsRead(pMC1Data->pMotorInputs);
+    if (pMC1Data->HAL_MotorInputsRead(pMC1Data->pMotorInputs) == 1)
+    {
+        /* Stale ADC results must not be used for control */
+        pMC1Data->fault.faultState = MCAPP_ADC_FAULT;
+        pMC1Data->appState = MCAPP_FAULT;
+    }
+    
+#ifdef ENABLE_ADC_TRACE
+    /* Commands are adopted before the inputs are recorded, trace channels 
+       hold the adopted run command and target velocity. Replay restores 
+       them instead of adopting the live commands */
+    if ((mc1Trace.state != ADC_TRACE_REPLAY) && 
+        (mc1Trace.state != ADC_TRACE_DONE))
+    {
+        MCAPP_MC1CommandAdopt(pMC1Data);
+    }
+    traceState = ADCTraceInputs(&mc1Trace);
+    if ((traceState == ADC_TRACE_REPLAY) || (traceState == ADC_TRACE_DONE))
+    {
+        /* Replayed state must not drive the inverter */
+        pMC1Data->HAL_PWMDisableOutputs();
+    }
+#else
+    MCAPP_MC1CommandAdopt(pMC1Data);
+#endif
     
     MC1APP_StateMachine(pMC1Data);
 
+#ifdef ENABLE_ADC_TRACE
+    ADCTraceOutputs(&mc1Trace, MCAPP_MC1TraceSignature(pMC1Data),
+                                    (pMC1Data->appState == MCAPP_FAULT));
+#endif
+
+#ifdef ENABLE_MC1_SINGLE_SHUNT
+    HAL_MC1PWMSetBusCurrentTrigger(pMC1Data->pControlScheme->singleShunt.trigger);
+#endif
     pMC1Data->HAL_PWMSetDutyCycles(pMC1Data->pPWMDuty);
+#ifdef ENABLE_ADC_EARLY_INTERRUPT
+    /* Interrupt channel converts while the control runs */
+    if (HAL_MC1InterruptChannelRead(pMC1Data->pMotorInputs) == 1)
+    {
+        pMC1Data->fault.faultState = MCAPP_ADC_FAULT;
+        pMC1Data->appState = MCAPP_FAULT;
+    }
+#endif
         
     adcBuffer = MC1_ClearADCIF_ReadADCBUF();
 	MC1_ClearADCIF();
+    
+#ifdef ENABLE_CONTROL_KPI
+    MCAPP_ControlKPIIsrTime(&pMC1Data->kpi, isrStart,
+            TIMER1_CounterRead(), TIMER1_PERIOD_COUNT, TIMER1_CLOCK_PRESCALER);
+    MCAPP_ControlKPIIsrLatency(&pMC1Data->kpi, adcLatency);
+#endif
 }
 
 void MCAPP_MC1ServiceInit(void)
 {
-    MCAPP_MC1ParamsInit(pMC1Data);
+    MCAPP_MC1ParamsInit(pMC1Data, &mc1Isr, &mc1Motor);
+#ifdef ENABLE_ADC_TRACE
+    MCAPP_MC1TraceInit(pMC1Data);
+#endif
     
     MC1_ClearADCIF_ReadADCBUF();
     MC1_ClearADCIF();
@@ -259,17 +377,66 @@ void MCAPP_MC1ServiceInit(void)
     pMC1Data->HAL_PWMDisableOutputs();
 }
 
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+/**
+* <B> Function: MCAPP_MC1OuterLoopSet(uint16_t, int16_t, int16_t, int16_t) </B>
+*
+* @brief Function writes the outer loop references of motor 1, computed by
+*        the Main core, to the inactive block of the command buffer. The 
+*        block is published with them by MCAPP_MC1InputBufferSet(), which 
+*        must follow.
+*
+* @param Outer loop flags and epoch (msi_protocol.h).
+* @param Velocity reference.
+* @param q axis current reference less the load torque feedforward.
+* @param d axis current reference of the flux weakening controller.
+* @return none.
+* @example
+* <CODE> MCAPP_MC1OuterLoopSet(flags, qVelRef, qIqRef, qIdRef); </CODE>
+*
+*/
+void MCAPP_MC1OuterLoopSet(uint16_t flags, int16_t qVelRef, int16_t qIqRef,
+                                                            int16_t qIdRef)
+{
+    MCAPP_COMMAND_BUFFER_T *pCommand = &pMC1Data->command;
+    volatile MCAPP_COMMAND_T *pBlock;
+    
+    pBlock = &pCommand->block[(pCommand->sequence + 1) & 1];
+    pBlock->flags = (int16_t)flags;
+    pBlock->qVelRef = qVelRef;
+    pBlock->qIqRef = qIqRef;
+    pBlock->qIdRef = qIdRef;
+}
+#endif
+
+/**
+* <B> Function: MCAPP_MC1InputBufferSet(int16_t, int16_t)  </B>
+*
+* @brief Function publishes the run command and target velocity of motor 1.
+*        Inactive block of the command buffer is written and then made 
+*        active, the block is adopted by the ADC ISR in its next period.
+*
+* @param Run command.
+* @param Target velocity (Q15, minimum to maximum speed).
+* @return none.
+* @example
+* <CODE> MCAPP_MC1InputBufferSet(runCmd, qTargetVelocity); </CODE>
+*
+*/
 void MCAPP_MC1InputBufferSet(int16_t runCmd, int16_t qTargetVelocity)
 {
-    MC1APP_DATA_T   *pMCData = pMC1Data;
+    MCAPP_COMMAND_BUFFER_T *pCommand = &pMC1Data->command;
     MCAPP_MOTOR_T   *pMotor = pMC1Data->pMotor;
+    volatile MCAPP_COMMAND_T *pBlock;
     
-    pMCData->qTargetVelocity =  pMotor->qMinSpeed + 
+    pBlock = &pCommand->block[(pCommand->sequence + 1) & 1];
+    pBlock->qTargetVelocity =  pMotor->qMinSpeed + 
             (int16_t)(__builtin_mulss((pMotor->qMaxSpeed - 
             pMotor->qMinSpeed), qTargetVelocity) >> 15);
+    pBlock->runCmd = runCmd;
     
-    pMCData->runCmdBuffer = runCmd;
-    MCAPP_MC1ReceivedDataProcess(pMCData);
+    /* Publish : single word write makes the block active */
+    pCommand->sequence = pCommand->sequence + 1;
 }
 
 int16_t potFilt;
@@ -279,7 +446,7 @@ int16_t MCAPP_MC1GetTargetVelocity(void)
     int16_t potValueNormalized;
     
     potFiltStateVar +=
-            __builtin_mulss((pMC1Data->motorInputs.measurePot - potFilt),POT_FILTER_COEF);
+            __builtin_mulss((pMC1Data->pMotorInputs->measurePot - potFilt),POT_FILTER_COEF);
     potFilt = (int16_t)(potFiltStateVar >> 15);
     
     potValueNormalized   = UTIL_SatShrS16(__builtin_mulss(potFilt,POT_NOM_FACTOR),14); 
@@ -287,12 +454,156 @@ int16_t MCAPP_MC1GetTargetVelocity(void)
     return potValueNormalized;
 }
 
+/* Status of motor 1 sent to the Main core */
+int16_t MCAPP_MC1GetPotentiometer(void)
+{
+    return pMC1Data->pMotorInputs->measurePot;
+}
+
+
+int16_t MCAPP_MC1GetVelocity(void)
+{
+    return pMC1Data->pControlScheme->estimInterface.qVelEstim;
+}
+
+/* DC link voltage required by motor 1, normalized to peak voltage */
+int16_t MCAPP_MC1GetVoltageDemand(void)
+{
+    const MC_DQ_T *pVdq = &pMC1Data->pControlScheme->vdq;
+    int32_t voltageSqr;
+    
+    if (pMC1Data->appState != MCAPP_RUN)
+    {
+        return 0;
+    }
+    voltageSqr = (__builtin_mulss(pVdq->d, pVdq->d) >> 15) + 
+                    (__builtin_mulss(pVdq->q, pVdq->q) >> 15);
+    if (voltageSqr > INT16_MAX)
+    {
+        voltageSqr = INT16_MAX;
+    }
+    return UTIL_SatShrS16(__builtin_mulss(_Q15sqrt((int16_t)voltageSqr), 
+                                                    VDC_DEMAND_GAIN), 14);
+}
+
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+/* Outer loop status of motor 1 sent to the Main core : the speed loop is 
+   active in closed loop outside of mains loss ride through, its epoch is
+   incremented each time it (re)starts */
+uint16_t MCAPP_MC1GetOuterLoopStatus(void)
+{
+    const MCAPP_CONTROL_SCHEME_T *pControlScheme = pMC1Data->pControlScheme;
+    uint16_t status;
+    
+    status = ((uint16_t)pControlScheme->outerLoop.epoch << MSI_EPOCH_SHIFT) & 
+                                                            MSI_EPOCH_MASK;
+    if (pMC1Data->appState == MCAPP_CMD_WAIT)
+    {
+        status |= MSI_IDLE;
+    }
+    if ((pMC1Data->appState == MCAPP_RUN) && 
+        (pControlScheme->focState == FOC_CLOSE_LOOP))
+    {
+        status |= MSI_CLOSE_LOOP;
+        if (pControlScheme->rideThrough.state != RIDE_THROUGH_ACTIVE)
+        {
+            status |= MSI_SPEED_LOOP_ACTIVE;
+        }
+    }
+    return status;
+}
+
+/* q axis current reference less the load torque feedforward : speed 
+   controller output */
+int16_t MCAPP_MC1GetCurrentReference(void)
+{
+    const MCAPP_CONTROL_SCHEME_T *pControlScheme = pMC1Data->pControlScheme;
+    
+    return UTIL_SatShrS16((int32_t)pControlScheme->ctrlParam.qIqRef - 
+                                    pControlScheme->pLoadObserver->iqFF, 0);
+}
+
+/* Voltage magnitude error : flux weakening controller input */
+int16_t MCAPP_MC1GetFluxWeakeningError(void)
+{
+    const MCAPP_FLUX_WEAKENING_VOLT_FB_T *pFeedBackFW = 
+                        &pMC1Data->pControlScheme->fluxControl.feedBackFW;
+    
+    return UTIL_SatShrS16((int32_t)pFeedBackFW->voltageMagRef - 
+                                            pFeedBackFW->voltageMag, 0);
+}
+#endif
+
+/**
+* <B> Function: MCAPP_MC1CommandAdopt(MC1APP_DATA_T *)  </B>
+*
+* @brief Function adopts the active command block, if a new one has been 
+*        published since the last adoption. Run command and target velocity
+*        are then validated together in the ADC ISR context.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_MC1CommandAdopt(pMCData); </CODE>
+*
+*/
+static void MCAPP_MC1CommandAdopt(MC1APP_DATA_T *pMCData)
+{
+    MCAPP_COMMAND_BUFFER_T *pCommand = &pMCData->command;
+    const uint16_t sequence = pCommand->sequence;
+    
+    if (sequence != pCommand->adopted)
+    {
+        pCommand->adopted = sequence;
+        pMCData->qTargetVelocity = pCommand->block[sequence & 1].qTargetVelocity;
+        pMCData->runCmdBuffer = pCommand->block[sequence & 1].runCmd;
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+        pMCData->pControlScheme->outerLoop.flags = 
+                                    pCommand->block[sequence & 1].flags;
+        pMCData->pControlScheme->outerLoop.qVelRef = 
+                                    pCommand->block[sequence & 1].qVelRef;
+        pMCData->pControlScheme->outerLoop.qIqRef = 
+                                    pCommand->block[sequence & 1].qIqRef;
+        pMCData->pControlScheme->outerLoop.qIdRef = 
+                                    pCommand->block[sequence & 1].qIdRef;
+#endif
+        MCAPP_MC1ReceivedDataProcess(pMCData);
+    }
+}
+
+/**
+* <B> Function: MCAPP_MC1PWMEnableOutputs(MC1APP_DATA_T *)  </B>
+*
+* @brief Function enables the PWM outputs of motor 1, unless the ADC trace 
+*        is replaying : replayed state must not drive the inverter.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_MC1PWMEnableOutputs(pMCData); </CODE>
+*
+*/
+static void MCAPP_MC1PWMEnableOutputs(MC1APP_DATA_T *pMCData)
+{
+#ifdef ENABLE_ADC_TRACE
+    if ((mc1Trace.state == ADC_TRACE_REPLAY) || 
+        (mc1Trace.state == ADC_TRACE_DONE))
+    {
+        return;
+    }
+#endif
+    pMCData->HAL_PWMEnableOutputs();
+}
+
 static void MCAPP_MC1ReceivedDataProcess(MC1APP_DATA_T *pMCData)
 {
     MCAPP_CONTROL_SCHEME_T *pControlScheme = pMCData->pControlScheme;
     MCAPP_MOTOR_T *pMotor = pMCData->pMotor;
     MCAPP_MEASURE_T *pMotorInputs = pMCData->pMotorInputs;
 
+    /* With the outer loops on the Main core the velocity reference is part
+       of the command (MCAPP_SpeedControlRemote) */
+#ifndef ENABLE_CROSS_CORE_SUPERVISOR
     if(pMCData->runCmd == 1)
     {
         if(pMCData->qTargetVelocity > pMotor->qMaxSpeed)
@@ -309,6 +620,7 @@ static void MCAPP_MC1ReceivedDataProcess(MC1APP_DATA_T *pMCData)
 
         pControlScheme->ctrlParam.qTargetVelocity = pMCData->qTargetVelocity;
     }
+#endif
     
     if( (pMotorInputs->measureVdc.value >= pMotorInputs->measureVdc.dcMinRun) && 
                                             (pControlScheme->faultStatus == 0) )
@@ -322,4 +634,54 @@ static void MCAPP_MC1ReceivedDataProcess(MC1APP_DATA_T *pMCData)
     }
 }
 
+#ifdef ENABLE_ADC_TRACE
+/**
+* <B> Function: MCAPP_MC1TraceInit(MC1APP_DATA_T *)  </B>
+*
+* @brief Function to initialize the ADC trace of motor 1. Trace restores the
+*        complete application data (configuration, ISR state and motor
+*        parameters) on replay. Channels are the raw ADC 
+*        inputs and the commands written outside the ADC ISR.
+*
+*/
+static void MCAPP_MC1TraceInit(MC1APP_DATA_T *pMCData)
+{
+    MCAPP_MEASURE_T *pMotorInputs = pMCData->pMotorInputs;
+    
+    ADCTraceInit(&mc1Trace, pMCData, sizeof(MC1APP_DATA_T));
+    ADCTraceStateAdd(&mc1Trace, &mc1Isr, sizeof(MC1APP_ISR_DATA_T));
+    ADCTraceStateAdd(&mc1Trace, &mc1Motor, sizeof(MCAPP_MOTOR_T));
+    ADCTraceChannelAdd(&mc1Trace, &pMotorInputs->measureCurrent.Ia);
+    ADCTraceChannelAdd(&mc1Trace, &pMotorInputs->measureCurrent.Ib);
+    ADCTraceChannelAdd(&mc1Trace, &pMotorInputs->measureCurrent.Ibus);
+    ADCTraceChannelAdd(&mc1Trace, &pMotorInputs->measureVdc.value);
+    ADCTraceChannelAdd(&mc1Trace, &pMotorInputs->measurePot);
+    ADCTraceChannelAdd(&mc1Trace, &pMCData->runCmd);
+    ADCTraceChannelAdd(&mc1Trace, &pMCData->identCmd);
+    ADCTraceChannelAdd(&mc1Trace, 
+                    &pMCData->pControlScheme->ctrlParam.qTargetVelocity);
+}
 
+/**
+* <B> Function: MCAPP_MC1TraceSignature(MC1APP_DATA_T *)  </B>
+*
+* @brief Function returns the signature of the state trajectory of motor 1 :
+*        application and control states, fault status and duty cycles.
+*
+*/
+static uint16_t MCAPP_MC1TraceSignature(MC1APP_DATA_T *pMCData)
+{
+    uint16_t signature = 0;
+    
+    signature = ADCTraceSignatureAdd(signature, pMCData->appState);
+    signature = ADCTraceSignatureAdd(signature, 
+                                    pMCData->pControlScheme->focState);
+    signature = ADCTraceSignatureAdd(signature, 
+                                    pMCData->pControlScheme->faultStatus);
+    signature = ADCTraceSignatureAdd(signature, pMCData->pPWMDuty->dutycycle1);
+    signature = ADCTraceSignatureAdd(signature, pMCData->pPWMDuty->dutycycle2);
+    signature = ADCTraceSignatureAdd(signature, pMCData->pPWMDuty->dutycycle3);
+    
+    return signature;
+}
+#endif
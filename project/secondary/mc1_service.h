@@ -57,6 +57,8 @@ extern "C" {
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "msi_protocol.h"
+
 // </editor-fold>
     
 // <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
@@ -65,6 +67,15 @@ void    MCAPP_MC1ServiceInit(void);
 void    MCAPP_MC1InputBufferSet(int16_t, int16_t);
 
 int16_t MCAPP_MC1GetTargetVelocity(void);
+int16_t MCAPP_MC1GetPotentiometer(void);
+int16_t MCAPP_MC1GetVelocity(void);
+int16_t MCAPP_MC1GetVoltageDemand(void);
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+void    MCAPP_MC1OuterLoopSet(uint16_t, int16_t, int16_t, int16_t);
+uint16_t MCAPP_MC1GetOuterLoopStatus(void);
+int16_t MCAPP_MC1GetCurrentReference(void);
+int16_t MCAPP_MC1GetFluxWeakeningError(void);
+#endif
 
 // </editor-fold>
 
@@ -97,6 +97,40 @@ extern "C" {
     /* VOLTAGE_UTIL_FACTOR = Peak_motor_voltage/Available_DC_Voltage */
     #define VOLTAGE_UTIL_FACTOR      (float)0.82
 
+    /* Overmodulation : define ENABLE_OVERMODULATION to extend the voltage 
+     * vector beyond the linear SVM range (OM-I, OM-II up to six-step). 
+     * OVERMOD_VOLTAGE_UTIL_FACTOR = Peak_motor_voltage/(Available_DC_Voltage/sqrt(3))
+     * in overmodulation, six-step operation corresponds to 1.1027.
+     * It raises the flux weakening voltage reference and adds low order 
+     * harmonics to the phase currents : validate on the motor before 
+     * enabling (change #undef to #define) */
+    #undef ENABLE_OVERMODULATION
+    #define OVERMOD_VOLTAGE_UTIL_FACTOR     (float)1.10
+
+    /* dq decoupling : define ENABLE_DECOUPLING_FEEDFORWARD to add the cross
+     * coupling (-omega*Lq*iq, omega*Ld*id) and BEMF (omega*psi) feedforward
+     * voltages to the current controller outputs. Disabled by default : 
+     * enable only after LD_BY_LS, LQ_BY_LS and the BEMF constant are 
+     * validated on the motor */
+    #undef ENABLE_DECOUPLING_FEEDFORWARD
+    /* d and q axis inductance relative to Ls (1.0 for surface mounted PM) */
+    #define LD_BY_LS                        (float)1.0
+    #define LQ_BY_LS                        (float)1.0
+
+    /* Dead time compensation : define ENABLE_DEADTIME_COMPENSATION to correct
+     * the duty cycles for inverter dead time and device voltage drop and to
+     * use the corrected phase voltage in the PLL estimator. Device 
+     * parameters below are placeholders : characterise them on the board 
+     * before enabling */
+    #undef ENABLE_DEADTIME_COMPENSATION
+    /* Voltage error time = dead time (DEADTIME_MICROSEC) + switching delays */
+    #define DEADTIME_COMP_MICROSEC          (float)2.0
+    /* Device (MOSFET/diode) forward voltage drop in Volts */
+    #define DEADTIME_COMP_DEVICE_DROP       (float)1.0
+    /* Phase current band (Amps) around zero in which the compensation varies 
+     * linearly with current (smooth polarity detection) */
+    #define DEADTIME_COMP_CURRENT_BAND      (float)0.2
+
     /* Motor Rated Current Peak in Amps */
     #define NOMINAL_CURRENT_PEAK       (float) (NOMINAL_CURRENT_PHASE_RMS*1.414)
 
@@ -149,6 +183,10 @@ extern "C" {
     #undef ID_REFERNCE_FILTER_ENABLE
     #define FD_WEAK_IDREF_FILT_CONST    1000
 
+    /* MTPA : define ENABLE_MTPA for interior PM motors (LQ_BY_LS > LD_BY_LS)
+     * to use maximum torque per ampere Id reference below flux weakening */
+    #undef ENABLE_MTPA
+
     /* Open loop startup parameters */
     /* Lock time for motor's poles alignment 
      * LOCK_TIME_COUNT = Lock_time_sec*PWF_frequency */
@@ -177,6 +215,13 @@ extern "C" {
 #define     RAMP_DN_TIME_MULTIPLIER    20 /* Sample time multiplier for down count */
 /* Speed rampe rate(rpm/sec) = 
  * (SPEED_CHANGE_RATE_COUNT/(LOOPTIME_SEC*TIME_MULTIPLIER)) *(MC1_PEAK_SPEED_RPM/32767) */
+/* Define ENABLE_SPEED_TRAJECTORY to replace the closed loop speed reference 
+ * ramp by a jerk limited (S-curve) trajectory. Acceleration limit in rpm/s,
+ * jerk limit in rpm/s^2 : acceleration limit is reached in accel/jerk seconds
+ * (below 2 seconds) */
+#undef ENABLE_SPEED_TRAJECTORY
+#define SPEED_TRAJ_ACCEL_RPM_PER_SEC    (float)180.0
+#define SPEED_TRAJ_JERK_RPM_PER_SEC2    (float)1800.0
  
 /** Fault Parameters  */
 /* Phase Over-current fault limit in Amps*/
@@ -185,6 +230,121 @@ extern "C" {
 /* End speed rpm for open loop to closed loop transition */
 #define     END_SPEED_RPM       MINIMUM_SPEED_RPM
 
+/** Motor parameter identification */
+/* Define ENABLE_PARAMETER_IDENTIFICATION to identify Rs, Ls and BEMF constant
+ * when identification command (mc1.identCmd) is set through diagnostics
+ * while the motor is stopped. Results (mc1.paramId.report) are in the format
+ * of NORM_RS, NORM_LSDT and NORM_INVKFI_CONST */
+#define ENABLE_PARAMETER_IDENTIFICATION
+/* DC test currents in Amps for resistance measurement */
+#define PARAM_ID_CURRENT_LOW_AMPS       (float)(NOMINAL_CURRENT_PEAK*0.25)
+#define PARAM_ID_CURRENT_HIGH_AMPS      (float)(NOMINAL_CURRENT_PEAK*0.5)
+/* Minimum voltage step in Volts for inductance measurement; step ends when 
+ * current rises by PARAM_ID_LS_DELTA_CURRENT_AMPS */
+#define PARAM_ID_LS_STEP_VOLTS          (float)5.0
+#define PARAM_ID_LS_DELTA_CURRENT_AMPS  (float)(NOMINAL_CURRENT_PEAK*0.25)
+/* Test voltage limit in Volts */
+#define PARAM_ID_VOLTAGE_LIMIT_VOLTS    (float)60.0
+/* Settling time in seconds before each measurement */
+#define PARAM_ID_SETTLE_TIME_SEC        (float)0.5
+/* Current controller tuning : target bandwidth in Hz, maximum overshoot 
+ * (fraction of the step) and maximum settling time (5% band) of the step 
+ * response test. Tuned gains are applied to the D and Q current controllers */
+#define PARAM_ID_CURRENT_BANDWIDTH_HZ   (float)300.0
+#define PARAM_ID_PI_MAX_OVERSHOOT       (float)0.1
+#define PARAM_ID_PI_SETTLE_TIME_SEC     (float)0.003
+
+/** Mechanical identification and speed controller gain scheduling */
+/* Define ENABLE_MECHANICAL_IDENTIFICATION to identify inertia, viscous and
+ * Coulomb friction in closed loop when identification request 
+ * (mc1.mechId.request) is set through diagnostics. The motor 
+ * runs at low speed, ramps to high speed with the closed loop speed ramp 
+ * and runs at high speed. Results are in mc1.mechId.report */
+#define ENABLE_MECHANICAL_IDENTIFICATION
+#define MECH_ID_SPEED_LOW_RPM           (float)(MINIMUM_SPEED_RPM*1.2)
+#define MECH_ID_SPEED_HIGH_RPM          (float)(NOMINAL_SPEED_RPM*0.8)
+/* Settling time in seconds before each measurement */
+#define MECH_ID_SETTLE_TIME_SEC         (float)0.5
+/* Define ENABLE_INERTIA_ESTIMATION to estimate inertia online during speed 
+ * changes of at least MECH_ID_ACCEL_MIN_RPM_PER_SEC */
+#undef ENABLE_INERTIA_ESTIMATION
+#define MECH_ID_ACCEL_MIN_RPM_PER_SEC   (float)100.0
+/* Define ENABLE_SPEED_GAIN_SCHEDULING to compute speed controller gains for
+ * MECH_SPEED_BANDWIDTH_HZ from the identified or estimated inertia and 
+ * friction. MECH_TIME_CONSTANT_SEC (time to reach peak speed at peak 
+ * current) is used until identified */
+#undef ENABLE_SPEED_GAIN_SCHEDULING
+#define MECH_SPEED_BANDWIDTH_HZ         (float)10.0
+#define MECH_TIME_CONSTANT_SEC          (float)0.5
+
+/** Load torque observer */
+/* Define ENABLE_LOAD_OBSERVER to add the estimated load current (torque) as
+ * feedforward to the speed controller output. Observer uses the mechanical 
+ * time constant (MECH_TIME_CONSTANT_SEC or identified/estimated value) */
+#undef ENABLE_LOAD_OBSERVER
+#define LOAD_OBS_BANDWIDTH_HZ           (float)20.0
+/* Define ENABLE_REPETITIVE_FEEDFORWARD to learn periodic loads (e.g. 
+ * compressors) per mechanical angle and add them as feedforward */
+#undef ENABLE_REPETITIVE_FEEDFORWARD
+#define LOAD_OBS_LEARN_GAIN_VALUE       (float)0.002
+
+/** DC link overvoltage control */
+/* Define ENABLE_VDC_OVERVOLTAGE_CONTROL to hold the deceleration when the DC
+ * link voltage exceeds VDC_LIMIT_START_VOLTS and reduce the regenerative 
+ * current linearly to zero at VDC_LIMIT_STOP_VOLTS. PFC cannot return energy
+ * to the mains and trips at PFC_OUTPUT_OVER_VOLTAGE (410 V, Main core). 
+ * Motors on the shared DC link apply their own thresholds to the same 
+ * voltage : lower thresholds give priority to the regeneration of the other
+ * motor */
+#undef ENABLE_VDC_OVERVOLTAGE_CONTROL
+#define VDC_LIMIT_START_VOLTS           (float)395.0
+#define VDC_LIMIT_STOP_VOLTS            (float)405.0
+#define VDC_LIMIT_FILTER_HZ             (float)500.0
+
+/** Mains loss ride through */
+/* Define ENABLE_RIDE_THROUGH to hold the DC link voltage with the kinetic 
+ * energy of the motor on mains loss. Ride through is armed while the PFC 
+ * regulates the DC link voltage above RIDE_THROUGH_ARM_VOLTS. Mains loss is
+ * detected below RIDE_THROUGH_VDC_VOLTS, which is then regulated by the 
+ * motor. Speed control resumes from the present speed when the voltage rises
+ * above RIDE_THROUGH_RETURN_VOLTS (PFC restarted or rectified mains) or the
+ * speed falls below minimum speed. Main core does not withdraw the run 
+ * permission on PFC input under voltage (ENABLE_CROSS_CORE_SUPERVISOR) */
+#undef ENABLE_RIDE_THROUGH
+#define RIDE_THROUGH_ARM_VOLTS          (float)350.0
+#define RIDE_THROUGH_VDC_VOLTS          (float)300.0
+#define RIDE_THROUGH_RETURN_VOLTS       (float)320.0
+/* DC link voltage controller : Vdc error to regenerative q axis current */
+#define RIDE_THROUGH_PTERM              Q15(0.5)
+#define RIDE_THROUGH_PTERM_SCALE        4
+#define RIDE_THROUGH_ITERM              Q15(0.01)
+#define RIDE_THROUGH_ITERM_SCALE        0
+
+/** Control KPIs */
+/* Define ENABLE_CONTROL_KPI to measure time to closed loop, overshoot and 
+ * settling time of target speed steps (changes of at least 
+ * CONTROL_KPI_STEP_MIN_RPM, settling band CONTROL_KPI_SETTLE_BAND of the 
+ * step), RMS speed and current errors and ISR execution time (for X2CScope) */
+#undef ENABLE_CONTROL_KPI
+#define CONTROL_KPI_STEP_MIN_RPM        100
+#define CONTROL_KPI_SETTLE_BAND         (float)0.02
+
+/** Single shunt current reconstruction */
+/* Phase currents are reconstructed from two DC bus current samples when 
+ * ENABLE_MC1_SINGLE_SHUNT is defined in hal/pwm.h. Define 
+ * SINGLE_SHUNT_CURRENT_FEEDBACK to use them as FOC feedback, else they are 
+ * checked against the phase shunt currents (plausibility) */
+#undef SINGLE_SHUNT_CURRENT_FEEDBACK
+/* Minimum active vector duration for a bus current sample : dead time, 
+ * settling and sampling time (micro seconds) */
+#define SINGLE_SHUNT_WINDOW_MIN_MICROSEC    3.0
+/* Sample instant before the end of the active vector (micro seconds) */
+#define SINGLE_SHUNT_SAMPLE_ADVANCE_MICROSEC 0.5
+/* Ratio of bus current to phase current measurement gain */
+#define SINGLE_SHUNT_IBUS_GAIN              (float)1.0
+/* Plausibility limit of reconstructed - phase shunt current (A) */
+#define SINGLE_SHUNT_PLAUSIBILITY_AMPS      2.0
+
 // </editor-fold>
 
 #ifdef __cplusplus
@@ -84,15 +84,98 @@ extern "C" {
 #define MAX_VOLTAGE_SQUARE   (int16_t)( (float)VMAX_CLOSEDLOOP_CONTROL*VMAX_CLOSEDLOOP_CONTROL/32767 )
 
 /* Voltage factor for dynamic voltage limit calculation */    
+#ifdef ENABLE_OVERMODULATION
+#define VMAX_FACTOR     (int16_t)((float)(0.577)*OVERMOD_VOLTAGE_UTIL_FACTOR*32767*MC2_PEAK_VOLTAGE/MC2_BASE_VOLTAGE)
+#else
 #define VMAX_FACTOR     (int16_t)((float)(0.577)*VOLTAGE_UTIL_FACTOR*32767*MC2_PEAK_VOLTAGE/MC2_BASE_VOLTAGE)        
+#endif
 
     
 /* Flux weakening parameters */
+#ifdef ENABLE_OVERMODULATION
+#define FD_WEAK_VOLTAGE_REF  (int16_t)((float)VMAX_CLOSEDLOOP_CONTROL*FW_VOLTAGE_REF_FACTOR*OVERMOD_VOLTAGE_UTIL_FACTOR/VOLTAGE_UTIL_FACTOR)
+#else
 #define FD_WEAK_VOLTAGE_REF  (int16_t)((float)VMAX_CLOSEDLOOP_CONTROL*FW_VOLTAGE_REF_FACTOR)
+#endif
     
 /* DC bus compensation factor */ 
 #define DC_LINK_BASE_VOLTAGE    NORM_VALUE(MC2_BASE_VOLTAGE, MC2_PEAK_VOLTAGE)
 
+/* dq decoupling feedforward parameters */
+/* Reactance at peak speed = Ls*omega_peak*(Base current/Base voltage), 
+   derived from NORM_LSDT (Ls/Ts) and NORM_DELTA_T (omega_peak*Ts/pi) */
+#define DECOUPLING_X_QVALUE     14
+#define DECOUPLING_XS           ((float)NORM_LSDT/(1<<NORM_LSDT_QVALUE)*PI*NORM_DELTA_T/32768)
+#define DECOUPLING_XD           (int16_t)(DECOUPLING_XS*LD_BY_LS*(1<<DECOUPLING_X_QVALUE))
+#define DECOUPLING_XQ           (int16_t)(DECOUPLING_XS*LQ_BY_LS*(1<<DECOUPLING_X_QVALUE))
+/* BEMF constant = 1/NORM_INVKFI_CONST */
+#define DECOUPLING_KFI_QVALUE   14
+#define DECOUPLING_KFI          (int16_t)((float)(1L<<NORM_INVKFI_CONST_QVALUE)/NORM_INVKFI_CONST*(1<<DECOUPLING_KFI_QVALUE))
+
+/* MTPA parameters */
+/* a = psi/(2*(Lq-Ld)) normalized to peak current, must be less than 32 */
+#define MTPA_CONST_A_QVALUE     10
+#ifdef ENABLE_MTPA
+#define MTPA_CONST_A            (int16_t)((float)DECOUPLING_KFI/(2.0*(DECOUPLING_XQ-DECOUPLING_XD))*(1<<MTPA_CONST_A_QVALUE))
+#else
+#define MTPA_CONST_A            0
+#endif
+
+/* Dead time compensation parameters */
+/* Voltage error duty = error time/PWM period */
+#define DT_COMP_ERROR_DUTY      NORM_VALUE(DEADTIME_COMP_MICROSEC, LOOPTIME_MICROSEC)
+#define DT_COMP_DEVICE_DROP     NORM_VALUE(DEADTIME_COMP_DEVICE_DROP, MC2_PEAK_VOLTAGE)
+/* Smooth polarity gain = Peak current/current band */
+#define DT_COMP_SIGN_GAIN_SCALE 8
+#define DT_COMP_SIGN_GAIN       (int16_t)((float)MC2_PEAK_CURRENT*(1<<DT_COMP_SIGN_GAIN_SCALE)/DEADTIME_COMP_CURRENT_BAND)
+#define DT_COMP_VDC_GAIN        Q14((float)MC2_PEAK_VOLTAGE/MC2_BASE_VOLTAGE)
+
+/* Speed trajectory parameters : velocity change per period (acceleration) and
+   acceleration change per period (jerk) in Q(SPEED_TRAJ_ACCEL_QVALUE) */
+#define SPEED_TRAJ_ACCEL    (int32_t)(SPEED_TRAJ_ACCEL_RPM_PER_SEC*LOOPTIME_SEC*32768.0/(MC2_PEAK_SPEED_RPM)*(1UL<<SPEED_TRAJ_ACCEL_QVALUE))
+#define SPEED_TRAJ_JERK     (int16_t)(SPEED_TRAJ_JERK_RPM_PER_SEC2*LOOPTIME_SEC*LOOPTIME_SEC*32768.0/(MC2_PEAK_SPEED_RPM)*(1UL<<SPEED_TRAJ_ACCEL_QVALUE))
+
+/* Parameter identification parameters */
+#define PARAM_ID_CURRENT_LOW        NORM_VALUE(PARAM_ID_CURRENT_LOW_AMPS, MC2_PEAK_CURRENT)
+#define PARAM_ID_CURRENT_HIGH       NORM_VALUE(PARAM_ID_CURRENT_HIGH_AMPS, MC2_PEAK_CURRENT)
+#define PARAM_ID_LS_STEP_VOLTAGE    NORM_VALUE(PARAM_ID_LS_STEP_VOLTS, MC2_BASE_VOLTAGE)
+#define PARAM_ID_LS_DELTA_CURRENT   NORM_VALUE(PARAM_ID_LS_DELTA_CURRENT_AMPS, MC2_PEAK_CURRENT)
+#define PARAM_ID_VOLTAGE_LIMIT      NORM_VALUE(PARAM_ID_VOLTAGE_LIMIT_VOLTS, MC2_BASE_VOLTAGE)
+#define PARAM_ID_SETTLE_COUNT       (uint16_t)(PARAM_ID_SETTLE_TIME_SEC/LOOPTIME_SEC)
+/* Current controller bandwidth = omega*Ts */
+#define PARAM_ID_PI_BANDWIDTH       Q15(2.0*PI*PARAM_ID_CURRENT_BANDWIDTH_HZ*LOOPTIME_SEC)
+#define PARAM_ID_PI_OVERSHOOT       Q15(PARAM_ID_PI_MAX_OVERSHOOT)
+#define PARAM_ID_PI_SETTLE_COUNT    (uint16_t)(PARAM_ID_PI_SETTLE_TIME_SEC/LOOPTIME_SEC)
+
+/* Mechanical identification parameters */
+#define MECH_ID_SETTLE_COUNT        (uint16_t)(MECH_ID_SETTLE_TIME_SEC/LOOPTIME_SEC)
+/* Speed change in online estimation window of 2^MECH_ID_WINDOW_SHIFT samples */
+#define MECH_ID_ACCEL_MIN           NORM_VALUE(MECH_ID_ACCEL_MIN_RPM_PER_SEC*LOOPTIME_SEC*(1<<MECH_ID_WINDOW_SHIFT), MC2_PEAK_SPEED_RPM)
+/* Speed controller bandwidth = omega*Ts */
+#define MECH_SPEED_BANDWIDTH        Q15(2.0*PI*MECH_SPEED_BANDWIDTH_HZ*LOOPTIME_SEC)
+/* Mechanical time constant in PWM periods */
+#define MECH_TIME_CONSTANT_INIT     (int32_t)(MECH_TIME_CONSTANT_SEC/LOOPTIME_SEC)
+
+/* DC link overvoltage control parameters */
+#define VDC_LIMIT_START             NORM_VALUE(VDC_LIMIT_START_VOLTS, MC2_PEAK_VOLTAGE)
+#define VDC_LIMIT_STOP              NORM_VALUE(VDC_LIMIT_STOP_VOLTS, MC2_PEAK_VOLTAGE)
+/* Filter coefficient = omega*Ts */
+#define VDC_LIMIT_FILTER_COEF       Q15(2.0*PI*VDC_LIMIT_FILTER_HZ*LOOPTIME_SEC)
+
+/* Mains loss ride through parameters */
+#define RIDE_THROUGH_VDC_ARM        NORM_VALUE(RIDE_THROUGH_ARM_VOLTS, MC2_PEAK_VOLTAGE)
+#define RIDE_THROUGH_VDC_REF        NORM_VALUE(RIDE_THROUGH_VDC_VOLTS, MC2_PEAK_VOLTAGE)
+#define RIDE_THROUGH_VDC_RETURN     NORM_VALUE(RIDE_THROUGH_RETURN_VOLTS, MC2_PEAK_VOLTAGE)
+
+/* DC link voltage demand reported to the Main core : 
+   Vdc = sqrt(3)*|Vdq| (linear SVM limit), scaled from base to peak voltage */
+#define VDC_DEMAND_GAIN             Q14(1.732*MC2_BASE_VOLTAGE/MC2_PEAK_VOLTAGE)
+
+/* Load torque observer parameters */
+/* Observer bandwidth = omega*Ts */
+#define LOAD_OBS_GAIN               Q15(2.0*PI*LOAD_OBS_BANDWIDTH_HZ*LOOPTIME_SEC)
+#define LOAD_OBS_LEARN_GAIN         Q15(LOAD_OBS_LEARN_GAIN_VALUE)
+
 /** Estimator-PLL Parameters */
 #define DECIMATE_NOMINAL_SPEED  100
 /* Filters constants definitions  */
@@ -56,6 +56,7 @@
 #include "mc2_init.h"
 #include "mc_app_types.h"
 #include "mc2_service.h"
+#include "mc2_calc_params.h"
 #include "foc.h"
 #include "general.h"
 
@@ -70,6 +71,8 @@
 
 MC2APP_DATA_T mc2;
 MC2APP_DATA_T *pMC2Data = &mc2;
+MC2APP_ISR_DATA_T mc2Isr;
+MCAPP_MOTOR_T mc2Motor;
 
 // </editor-fold>
 
@@ -77,6 +80,7 @@ MC2APP_DATA_T *pMC2Data = &mc2;
 
 static void MC2APP_StateMachine(MC2APP_DATA_T *);
 static void MCAPP_MC2ReceivedDataProcess(MC2APP_DATA_T *);
+static void MCAPP_MC2CommandAdopt(MC2APP_DATA_T *);
 
 // </editor-fold>
 
@@ -121,6 +125,11 @@ static void MC2APP_StateMachine(MC2APP_DATA_T *pMCData)
         {
             pMCData->appState = MCAPP_OFFSET;
         }
+        else if((pMCData->identCmd == 1) && (pMCData->paramId.enable == 1))
+        {
+            MCAPP_ParamIdInit(&pMCData->paramId);
+            pMCData->appState = MCAPP_OFFSET;
+        }
        break;
        
     case MCAPP_OFFSET:
@@ -130,7 +139,15 @@ static void MC2APP_StateMachine(MC2APP_DATA_T *pMCData)
 
         if(pMCData->MCAPP_IsOffsetMeasurementComplete(pMotorInputs))
         {
-            pMCData->appState = MCAPP_LOAD_START_READY_CHECK;
+            if((pMCData->runCmd == 0) && (pMCData->identCmd == 1))
+            {
+                pMCData->HAL_PWMEnableOutputs();
+                pMCData->appState = MCAPP_IDENTIFY;
+            }
+            else
+            {
+                pMCData->appState = MCAPP_LOAD_START_READY_CHECK;
+            }
         }
 
         break;
@@ -196,6 +213,38 @@ static void MC2APP_StateMachine(MC2APP_DATA_T *pMCData)
 
         break;
 
+    case MCAPP_IDENTIFY:
+        
+        pMCData->MCAPP_GetProcessedInputs(pMotorInputs);
+        if (MCAPP_OverCurrentFault_Detect(pMotorInputs, &pMCData->fault) == 1)
+        {
+            pMCData->appState = MCAPP_FAULT;
+            break;
+        } 
+
+        MCAPP_ParamIdStateMachine(&pMCData->paramId);
+        if (pMCData->paramId.state == PARAM_ID_KE)
+        {
+            /* BEMF is measured in open loop spin */
+            pMCData->MCAPP_ControlStateMachine(pControlScheme);
+            if(pControlScheme->faultStatus == 1) 
+            {
+                pMCData->appState = MCAPP_FAULT;
+                break;
+            }
+        }
+
+        if ((pMCData->paramId.state == PARAM_ID_COMPLETE) ||
+            (pMCData->paramId.state == PARAM_ID_FAULT) ||
+            (pMCData->identCmd == 0))
+        {
+            /* Exit identification when completed or aborted */
+            MCAPP_ParamIdStop(&pMCData->paramId);
+            pMCData->identCmd = 0;
+            pMCData->appState = MCAPP_STOP;
+        }
+        break;
+
     case MCAPP_STOP:
         pMCData->HAL_PWMDisableOutputs();
         pMCData->appState = MCAPP_INIT;
@@ -234,22 +283,46 @@ static void MC2APP_StateMachine(MC2APP_DATA_T *pMCData)
 */
 void __attribute__((__interrupt__,no_auto_psv)) MC2_ADC_INTERRUPT()
 {
+#ifdef ENABLE_CONTROL_KPI
+    const uint16_t isrStart = TIMER1_CounterRead();
+    const uint16_t adcLatency = HAL_MC2ADCInterruptLatency();
+#endif
     int16_t __attribute__((__unused__)) adcBuffer;
     
-    pMC2Data->HAL_MotorInputsRead(pMC2Data->pMotorInputs);
+    if (pMC2Data->HAL_MotorInputsRead(pMC2Data->pMotorInputs) == 1)
+    {
+        /* Stale ADC results must not be used for control */
+        pMC2Data->fault.faultState = MCAPP_ADC_FAULT;
+        pMC2Data->appState = MCAPP_FAULT;
+    }
     
+    MCAPP_MC2CommandAdopt(pMC2Data);
     MC2APP_StateMachine(pMC2Data);
     
     pMC2Data->HAL_PWMSetDutyCycles(pMC2Data->pPWMDuty);
+#ifdef ENABLE_ADC_EARLY_INTERRUPT
+    /* Interrupt channel converts while the control runs */
+    if (HAL_MC2InterruptChannelRead(pMC2Data->pMotorInputs) == 1)
+    {
+        pMC2Data->fault.faultState = MCAPP_ADC_FAULT;
+        pMC2Data->appState = MCAPP_FAULT;
+    }
+#endif
 
     adcBuffer = MC2_ClearADCIF_ReadADCBUF();
 	MC2_ClearADCIF();
+    
+#ifdef ENABLE_CONTROL_KPI
+    MCAPP_ControlKPIIsrTime(&pMC2Data->kpi, isrStart,
+            TIMER1_CounterRead(), TIMER1_PERIOD_COUNT, TIMER1_CLOCK_PRESCALER);
+    MCAPP_ControlKPIIsrLatency(&pMC2Data->kpi, adcLatency);
+#endif
 }
 
 
 void MCAPP_MC2ServiceInit(void)
 {
-    MCAPP_MC2ParamsInit(pMC2Data);
+    MCAPP_MC2ParamsInit(pMC2Data, &mc2Isr, &mc2Motor);
     
     MC2_ClearADCIF_ReadADCBUF();
     MC2_ClearADCIF();
@@ -259,23 +332,72 @@ void MCAPP_MC2ServiceInit(void)
 }
 
 
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+/**
+* <B> Function: MCAPP_MC2OuterLoopSet(uint16_t, int16_t, int16_t, int16_t) </B>
+*
+* @brief Function writes the outer loop references of motor 2, computed by
+*        the Main core, to the inactive block of the command buffer. The 
+*        block is published with them by MCAPP_MC2InputBufferSet(), which 
+*        must follow.
+*
+* @param Outer loop flags and epoch (msi_protocol.h).
+* @param Velocity reference.
+* @param q axis current reference less the load torque feedforward.
+* @param d axis current reference of the flux weakening controller.
+* @return none.
+* @example
+* <CODE> MCAPP_MC2OuterLoopSet(flags, qVelRef, qIqRef, qIdRef); </CODE>
+*
+*/
+void MCAPP_MC2OuterLoopSet(uint16_t flags, int16_t qVelRef, int16_t qIqRef,
+                                                            int16_t qIdRef)
+{
+    MCAPP_COMMAND_BUFFER_T *pCommand = &pMC2Data->command;
+    volatile MCAPP_COMMAND_T *pBlock;
+    
+    pBlock = &pCommand->block[(pCommand->sequence + 1) & 1];
+    pBlock->flags = (int16_t)flags;
+    pBlock->qVelRef = qVelRef;
+    pBlock->qIqRef = qIqRef;
+    pBlock->qIdRef = qIdRef;
+}
+#endif
+
+/**
+* <B> Function: MCAPP_MC2InputBufferSet(int16_t, int16_t)  </B>
+*
+* @brief Function publishes the run command and target velocity of motor 2.
+*        Inactive block of the command buffer is written and then made 
+*        active, the block is adopted by the ADC ISR in its next period.
+*
+* @param Run command.
+* @param Target velocity (Q15, minimum to maximum speed).
+* @return none.
+* @example
+* <CODE> MCAPP_MC2InputBufferSet(runCmd, qTargetVelocity); </CODE>
+*
+*/
 void MCAPP_MC2InputBufferSet(int16_t runCmd, int16_t qTargetVelocity)
 {
-    MC2APP_DATA_T   *pMCData = pMC2Data;
+    MCAPP_COMMAND_BUFFER_T *pCommand = &pMC2Data->command;
     MCAPP_MOTOR_T   *pMotor = pMC2Data->pMotor;
+    volatile MCAPP_COMMAND_T *pBlock;
     
-    pMCData->qTargetVelocity =  pMotor->qMinSpeed + 
+    pBlock = &pCommand->block[(pCommand->sequence + 1) & 1];
+    pBlock->qTargetVelocity =  pMotor->qMinSpeed + 
             (int16_t)(__builtin_mulss((pMotor->qMaxSpeed - 
             pMotor->qMinSpeed), qTargetVelocity) >> 15);
+    pBlock->runCmd = runCmd;
     
-    pMCData->runCmdBuffer = runCmd;
-    MCAPP_MC2ReceivedDataProcess(pMCData);
+    /* Publish : single word write makes the block active */
+    pCommand->sequence = pCommand->sequence + 1;
 }
 
 
 int16_t MCAPP_MC2GetTargetVelocity(void)
 {
-    int16_t motorSpeed = 600;
+    int16_t motorSpeed = MC2_TARGET_VELOCITY;
     /*
      
      
@@ -284,12 +406,126 @@ int16_t MCAPP_MC2GetTargetVelocity(void)
     return motorSpeed;
 }
 
+/* Status of motor 2 sent to the Main core */
+int16_t MCAPP_MC2GetVelocity(void)
+{
+    return pMC2Data->pControlScheme->estimInterface.qVelEstim;
+}
+
+/* DC link voltage required by motor 2, normalized to peak voltage */
+int16_t MCAPP_MC2GetVoltageDemand(void)
+{
+    const MC_DQ_T *pVdq = &pMC2Data->pControlScheme->vdq;
+    int32_t voltageSqr;
+    
+    if (pMC2Data->appState != MCAPP_RUN)
+    {
+        return 0;
+    }
+    voltageSqr = (__builtin_mulss(pVdq->d, pVdq->d) >> 15) + 
+                    (__builtin_mulss(pVdq->q, pVdq->q) >> 15);
+    if (voltageSqr > INT16_MAX)
+    {
+        voltageSqr = INT16_MAX;
+    }
+    return UTIL_SatShrS16(__builtin_mulss(_Q15sqrt((int16_t)voltageSqr), 
+                                                    VDC_DEMAND_GAIN), 14);
+}
+
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+/* Outer loop status of motor 2 sent to the Main core : the speed loop is 
+   active in closed loop outside of mains loss ride through, its epoch is
+   incremented each time it (re)starts */
+uint16_t MCAPP_MC2GetOuterLoopStatus(void)
+{
+    const MCAPP_CONTROL_SCHEME_T *pControlScheme = pMC2Data->pControlScheme;
+    uint16_t status;
+    
+    status = ((uint16_t)pControlScheme->outerLoop.epoch << MSI_EPOCH_SHIFT) & 
+                                                            MSI_EPOCH_MASK;
+    if (pMC2Data->appState == MCAPP_CMD_WAIT)
+    {
+        status |= MSI_IDLE;
+    }
+    if ((pMC2Data->appState == MCAPP_RUN) && 
+        (pControlScheme->focState == FOC_CLOSE_LOOP))
+    {
+        status |= MSI_CLOSE_LOOP;
+        if (pControlScheme->rideThrough.state != RIDE_THROUGH_ACTIVE)
+        {
+            status |= MSI_SPEED_LOOP_ACTIVE;
+        }
+    }
+    return status;
+}
+
+/* q axis current reference less the load torque feedforward : speed 
+   controller output */
+int16_t MCAPP_MC2GetCurrentReference(void)
+{
+    const MCAPP_CONTROL_SCHEME_T *pControlScheme = pMC2Data->pControlScheme;
+    
+    return UTIL_SatShrS16((int32_t)pControlScheme->ctrlParam.qIqRef - 
+                                    pControlScheme->pLoadObserver->iqFF, 0);
+}
+
+/* Voltage magnitude error : flux weakening controller input */
+int16_t MCAPP_MC2GetFluxWeakeningError(void)
+{
+    const MCAPP_FLUX_WEAKENING_VOLT_FB_T *pFeedBackFW = 
+                        &pMC2Data->pControlScheme->fluxControl.feedBackFW;
+    
+    return UTIL_SatShrS16((int32_t)pFeedBackFW->voltageMagRef - 
+                                            pFeedBackFW->voltageMag, 0);
+}
+#endif
+
+/**
+* <B> Function: MCAPP_MC2CommandAdopt(MC2APP_DATA_T *)  </B>
+*
+* @brief Function adopts the active command block, if a new one has been 
+*        published since the last adoption. Run command and target velocity
+*        are then validated together in the ADC ISR context.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_MC2CommandAdopt(pMCData); </CODE>
+*
+*/
+static void MCAPP_MC2CommandAdopt(MC2APP_DATA_T *pMCData)
+{
+    MCAPP_COMMAND_BUFFER_T *pCommand = &pMCData->command;
+    const uint16_t sequence = pCommand->sequence;
+    
+    if (sequence != pCommand->adopted)
+    {
+        pCommand->adopted = sequence;
+        pMCData->qTargetVelocity = pCommand->block[sequence & 1].qTargetVelocity;
+        pMCData->runCmdBuffer = pCommand->block[sequence & 1].runCmd;
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+        pMCData->pControlScheme->outerLoop.flags = 
+                                    pCommand->block[sequence & 1].flags;
+        pMCData->pControlScheme->outerLoop.qVelRef = 
+                                    pCommand->block[sequence & 1].qVelRef;
+        pMCData->pControlScheme->outerLoop.qIqRef = 
+                                    pCommand->block[sequence & 1].qIqRef;
+        pMCData->pControlScheme->outerLoop.qIdRef = 
+                                    pCommand->block[sequence & 1].qIdRef;
+#endif
+        MCAPP_MC2ReceivedDataProcess(pMCData);
+    }
+}
+
 static void MCAPP_MC2ReceivedDataProcess(MC2APP_DATA_T *pMCData)
 {
     MCAPP_CONTROL_SCHEME_T *pControlScheme = pMCData->pControlScheme;
     MCAPP_MOTOR_T *pMotor = pMCData->pMotor;
     MCAPP_MEASURE_T *pMotorInputs = pMCData->pMotorInputs;
 
+    /* With the outer loops on the Main core the velocity reference is part
+       of the command (MCAPP_SpeedControlRemote) */
+#ifndef ENABLE_CROSS_CORE_SUPERVISOR
     if(pMCData->runCmd == 1)
     {
         if(pMCData->qTargetVelocity > pMotor->qMaxSpeed)
@@ -306,6 +542,7 @@ static void MCAPP_MC2ReceivedDataProcess(MC2APP_DATA_T *pMCData)
 
         pControlScheme->ctrlParam.qTargetVelocity = pMCData->qTargetVelocity;
     }
+#endif
     
     if( (pMotorInputs->measureVdc.value >= pMotorInputs->measureVdc.dcMinRun) && 
                                             (pControlScheme->faultStatus == 0) )
@@ -45,8 +45,8 @@
 *******************************************************************************/
 // </editor-fold>
 
-#ifndef MC1_SERVICE_H
-#define	MC1_SERVICE_H
+#ifndef MC2_SERVICE_H
+#define	MC2_SERVICE_H
 
 #ifdef	__cplusplus
 extern "C" {
@@ -57,6 +57,8 @@ extern "C" {
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "msi_protocol.h"
+
 // </editor-fold>
     
 // <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
@@ -65,6 +67,14 @@ void    MCAPP_MC2ServiceInit(void);
 void    MCAPP_MC2InputBufferSet(int16_t, int16_t);
 
 int16_t MCAPP_MC2GetTargetVelocity(void);
+int16_t MCAPP_MC2GetVelocity(void);
+int16_t MCAPP_MC2GetVoltageDemand(void);
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+void    MCAPP_MC2OuterLoopSet(uint16_t, int16_t, int16_t, int16_t);
+uint16_t MCAPP_MC2GetOuterLoopStatus(void);
+int16_t MCAPP_MC2GetCurrentReference(void);
+int16_t MCAPP_MC2GetFluxWeakeningError(void);
+#endif
 
 // </editor-fold>
 
@@ -73,5 +83,5 @@ int16_t MCAPP_MC2GetTargetVelocity(void);
 }
 #endif
 
-#endif	/* MC1_SERVICE_H */
+#endif	/* MC2_SERVICE_H */
 
@@ -48,6 +48,14 @@
 #ifndef MC_APP_TYPES_H
 #define	MC_APP_TYPES_H
 
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include "msi_protocol.h"
+
+// </editor-fold>
+
 #ifdef	__cplusplus
 extern "C" {
 #endif
@@ -64,9 +72,43 @@ typedef enum
     MCAPP_LOAD_STOP_READY_CHECK = 5,    /* Wait for load to be ready to stop */
     MCAPP_STOP = 6,                     /* Stop the motor */
     MCAPP_FAULT = 7,                    /* Motor is in Fault mode */
+    MCAPP_IDENTIFY = 8,                 /* Identify motor parameters */
 
 }MCAPP_STATE_T;
 
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="VARIABLE TYPE DEFINITIONS ">
+
+/* Command/set point block of a motor */
+typedef struct
+{
+    int16_t
+        runCmd,                     /* Run command */
+        qTargetVelocity;            /* Target velocity, scaled to speed */
+#ifdef ENABLE_CROSS_CORE_SUPERVISOR
+    int16_t
+        flags,                      /* Outer loop flags and epoch (MSI) */
+        qVelRef,                    /* Velocity reference of the Main core */
+        qIqRef,                     /* q axis current reference (speed loop) */
+        qIdRef;                     /* d axis current reference (flux weakening) */
+#endif
+}MCAPP_COMMAND_T;
+
+/* Double buffered command block : published by TIMER1 ISR (producer) and
+   adopted by the ADC ISR of the motor (consumer) at the start of its control
+   period. Producer writes the inactive block and then increments sequence, 
+   block[sequence & 1] is the active block. ADC ISR has higher priority, so it
+   never observes a partially written active block */
+typedef struct
+{
+    volatile MCAPP_COMMAND_T
+        block[2];                   /* Active and inactive block */
+    volatile uint16_t
+        sequence;                   /* Number of blocks published */
+    uint16_t
+        adopted;                    /* Sequence of the last adopted block */
+}MCAPP_COMMAND_BUFFER_T;
 
 // </editor-fold>
 